@@ -0,0 +1,109 @@
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+using System.Globalization;
+using System.Text.Json;
+
+namespace VenusRootLoader.Benchmarks.Baselines;
+
+/// <summary>
+/// The measurements of a previous benchmarks run that later runs are compared against to detect regressions.
+/// </summary>
+internal sealed class BenchmarkBaseline
+{
+    private static readonly JsonSerializerOptions SerializerOptions = new() { WriteIndented = true };
+
+    public Dictionary<string, BenchmarkMeasurement> Measurements { get; set; } = new();
+
+    internal static BenchmarkBaseline FromSummaries(IEnumerable<Summary> summaries)
+    {
+        BenchmarkBaseline baseline = new();
+        foreach (BenchmarkReport report in summaries.SelectMany(s => s.Reports))
+        {
+            if (report.ResultStatistics is null)
+                continue;
+
+            baseline.Measurements[GetBenchmarkName(report)] = new()
+            {
+                MeanNanoseconds = report.ResultStatistics.Mean,
+                AllocatedBytesPerOperation = report.GcStats.GetBytesAllocatedPerOperation(report.BenchmarkCase)
+            };
+        }
+
+        return baseline;
+    }
+
+    internal static BenchmarkBaseline Load(string path) =>
+        JsonSerializer.Deserialize<BenchmarkBaseline>(File.ReadAllText(path), SerializerOptions) ?? new();
+
+    internal void Save(string path) => File.WriteAllText(path, JsonSerializer.Serialize(this, SerializerOptions));
+
+    /// <summary>
+    /// Finds every benchmark whose measurements regressed past a threshold compared to this baseline. Benchmarks that
+    /// aren't part of this baseline are ignored and allocations are only compared if both runs could measure them.
+    /// </summary>
+    /// <param name="current">The measurements of the current run.</param>
+    /// <param name="maxTimeRegressionPercent">The percentage the mean time can increase before being a
+    /// regression.</param>
+    /// <param name="maxAllocationRegressionPercent">The percentage the allocated bytes per operation can increase
+    /// before being a regression.</param>
+    /// <returns>A description of each regression.</returns>
+    internal List<string> FindRegressions(
+        BenchmarkBaseline current,
+        double maxTimeRegressionPercent,
+        double maxAllocationRegressionPercent)
+    {
+        List<string> regressions = new();
+        foreach (KeyValuePair<string, BenchmarkMeasurement> currentMeasurement in current.Measurements)
+        {
+            if (!Measurements.TryGetValue(currentMeasurement.Key, out BenchmarkMeasurement baselineMeasurement))
+                continue;
+
+            double baselineMean = baselineMeasurement.MeanNanoseconds;
+            double currentMean = currentMeasurement.Value.MeanNanoseconds;
+            if (currentMean > baselineMean * (1 + maxTimeRegressionPercent / 100))
+            {
+                regressions.Add(
+                    $"{currentMeasurement.Key}: the mean time went from {FormatNanoseconds(baselineMean)} to " +
+                    $"{FormatNanoseconds(currentMean)} ({FormatIncrease(baselineMean, currentMean)})");
+            }
+
+            if (baselineMeasurement.AllocatedBytesPerOperation is not { } baselineAllocated ||
+                currentMeasurement.Value.AllocatedBytesPerOperation is not { } currentAllocated)
+            {
+                continue;
+            }
+
+            if (currentAllocated > baselineAllocated * (1 + maxAllocationRegressionPercent / 100))
+            {
+                regressions.Add(
+                    $"{currentMeasurement.Key}: the allocations went from {baselineAllocated} B to " +
+                    $"{currentAllocated} B ({FormatIncrease(baselineAllocated, currentAllocated)})");
+            }
+        }
+
+        return regressions;
+    }
+
+    private static string GetBenchmarkName(BenchmarkReport report)
+    {
+        BenchmarkCase benchmarkCase = report.BenchmarkCase;
+        string methodName = $"{benchmarkCase.Descriptor.Type.Name}.{benchmarkCase.Descriptor.WorkloadMethod.Name}";
+        return benchmarkCase.HasParameters
+            ? $"{methodName} {benchmarkCase.Parameters.DisplayInfo}"
+            : methodName;
+    }
+
+    private static string FormatNanoseconds(double nanoseconds) =>
+        $"{(nanoseconds / 1000).ToString("N2", CultureInfo.InvariantCulture)} µs";
+
+    private static string FormatIncrease(double baseline, double current) =>
+        baseline == 0
+            ? "new allocations"
+            : $"+{((current / baseline - 1) * 100).ToString("N1", CultureInfo.InvariantCulture)}%";
+}
+
+internal sealed class BenchmarkMeasurement
+{
+    public double MeanNanoseconds { get; set; }
+    public long? AllocatedBytesPerOperation { get; set; }
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+using BenchmarkDotNet.Attributes;
+using Microsoft.Extensions.Logging.Abstractions;
+using VenusRootLoader.Benchmarks.Workloads;
+using VenusRootLoader.BudLoading;
+
+namespace VenusRootLoader.Benchmarks.BudLoading;
+
+public class BudsLoadingBenchmarks
+{
+    private readonly BudsDependencySorter _dependencySorter = new(NullLogger<BudsDependencySorter>.Instance);
+
+    private Dictionary<string, BudInfo> _budsById = null!;
+    private IList<BudInfo> _sortedBuds = null!;
+
+    [Params(100, 1000)]
+    public int BudsAmount { get; set; }
+
+    [Params(1, 8)]
+    public int DependenciesPerBud { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _budsById = SyntheticWorkload.CreateBuds(BudsAmount, DependenciesPerBud);
+        _sortedBuds = _dependencySorter.SortBudsTopologicallyFromDependencyGraph(_budsById);
+    }
+
+    [Benchmark]
+    public int SortTopologically() => _dependencySorter.SortBudsTopologicallyFromDependencyGraph(_budsById).Count;
+
+    [Benchmark]
+    public int EnumerateLoadOrder()
+    {
+        // The enumerator remembers which buds it enumerated so a new one is needed each time like on a new launch
+        BudsLoadOrderEnumerator loadOrderEnumerator = new(NullLogger<BudsLoadOrderEnumerator>.Instance);
+        int budsToLoadAmount = 0;
+        foreach (BudInfo _ in loadOrderEnumerator.EnumerateBudsWithFulfilledDependencies(_sortedBuds))
+            budsToLoadAmount++;
+        return budsToLoadAmount;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+using BenchmarkDotNet.Attributes;
+using Microsoft.Extensions.Logging.Abstractions;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Benchmarks.Workloads;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers.LocalisedData;
+using VenusRootLoader.Registry;
+using VenusRootLoader.Utility;
+
+namespace VenusRootLoader.Benchmarks.Patching.Resources.TextAssetPatchers;
+
+public class LocalizedTextAssetPatcherBenchmarks
+{
+    private const int BaseGameItemsAmount = 200;
+    private const int LanguageId = 0;
+
+    private LocalizedTextAssetPatcher<ItemLeaf> _patcher = null!;
+
+    [Params(10, 100)]
+    public int BudsAmount { get; set; }
+
+    [Params(10, 100)]
+    public int ItemsPerBud { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        AutoSequentialIdBasedRegistry<LanguageLeaf> languagesRegistry =
+            SyntheticWorkload.CreateRegistry<LanguageLeaf>(4, 0, 0);
+        AutoSequentialIdBasedRegistry<ItemLeaf> itemsRegistry =
+            SyntheticWorkload.CreateRegistry<ItemLeaf>(BaseGameItemsAmount, BudsAmount, ItemsPerBud);
+        LanguageLeaf language = languagesRegistry.GetByGameId(LanguageId);
+        foreach (ItemLeaf item in itemsRegistry)
+        {
+            item.LocalizedData[language] = new()
+            {
+                Name = $"Item {item.NamedId}",
+                Description = $"The description of the item {item.NamedId} which is about as long as the game's.",
+                Prepender = item.GameId % 4 == 0 ? "a" : null
+            };
+        }
+
+        _patcher = new(
+            [ResourcesPaths.DataLocalizedItemsPathSuffix],
+            NullLogger<LocalizedTextAssetPatcher<ItemLeaf>>.Instance,
+            new NullTextAssetDumper(),
+            new TextAssetPatchCache(),
+            itemsRegistry,
+            new ItemLocalizedTextAssetParser(languagesRegistry),
+            null);
+    }
+
+    [Benchmark]
+    public string BuildPatchedText() =>
+        _patcher.BuildPatchedText(LanguageId, ResourcesPaths.DataLocalizedItemsPathSuffix, true);
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+using BenchmarkDotNet.Attributes;
+using Microsoft.Extensions.Logging.Abstractions;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Api.Leaves.MapEntities;
+using VenusRootLoader.Benchmarks.Workloads;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Benchmarks.Patching.Resources.TextAssetPatchers;
+
+public class MapEntityTextAssetBenchmarks
+{
+    private const string DataSubpath = "0";
+    private const string NamesSubpath = "0names";
+
+    private MapEntityTextAssetParser _parser = null!;
+    private MapEntitiesTextAssetPatcher _patcher = null!;
+    private MapLeaf _map = null!;
+    private MapLeaf _mapToCollect = null!;
+    private string[] _dataLines = null!;
+    private string[] _nameLines = null!;
+
+    [Params(100, 500)]
+    public int EntitiesAmount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        AutoSequentialIdBasedRegistry<FlagLeaf> flagsRegistry = SyntheticWorkload.CreateRegistry<FlagLeaf>(750, 0, 0);
+        _parser = new(NullLogger<MapEntityTextAssetParser>.Instance, flagsRegistry);
+        _map = SyntheticWorkload.CreateMapWithEntities(EntitiesAmount);
+        _mapToCollect = SyntheticWorkload.CreateMapWithEntities(0);
+
+        AutoSequentialIdBasedRegistry<MapLeaf> mapsRegistry = new(NullLogger.Instance, IdSequenceDirection.Increment);
+        _patcher = new(
+            NullLogger<MapEntitiesTextAssetPatcher>.Instance,
+            new NullTextAssetDumper(),
+            new TextAssetPatchCache(),
+            mapsRegistry,
+            _parser);
+
+        _dataLines = _map.EntitiesRegistry.Select(e => _parser.GetTextAssetSerializedString(DataSubpath, e)).ToArray();
+        _nameLines = _map.EntitiesRegistry.Select(e => _parser.GetTextAssetSerializedString(NamesSubpath, e)).ToArray();
+    }
+
+    [Benchmark]
+    public int SerializeEntities()
+    {
+        int length = 0;
+        foreach (MapEntityLeaf entity in _map.EntitiesRegistry)
+            length += _parser.GetTextAssetSerializedString(DataSubpath, entity).Length;
+        return length;
+    }
+
+    [Benchmark]
+    public string BuildPatchedDataText() => _patcher.BuildPatchedText(DataSubpath, _map);
+
+    [Benchmark]
+    public string BuildPatchedNamesText() => _patcher.BuildPatchedText(NamesSubpath, _map);
+
+    [Benchmark]
+    public int CollectEntities()
+    {
+        // Collecting registers every entity so it needs an empty registry each time like on a new launch
+        _mapToCollect.EntitiesRegistry = SyntheticWorkload.CreateEmptyMapEntitiesRegistry();
+        for (int i = 0; i < _dataLines.Length; i++)
+            _parser.FromTextAssetSerializedString(_mapToCollect, i, _nameLines[i], _dataLines[i]);
+        return _mapToCollect.EntitiesRegistry.Count;
+    }
+}
\ No newline at end of file
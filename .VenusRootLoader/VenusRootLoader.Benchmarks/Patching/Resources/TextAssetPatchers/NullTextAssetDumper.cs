@@ -0,0 +1,11 @@
+using VenusRootLoader.Patching.Resources.TextAssetPatchers;
+
+namespace VenusRootLoader.Benchmarks.Patching.Resources.TextAssetPatchers;
+
+/// <summary>
+/// An <see cref="ITextAssetDumper"/> that discards everything since dumping only happens with trace logs enabled.
+/// </summary>
+internal sealed class NullTextAssetDumper : ITextAssetDumper
+{
+    public void DumpTextAssetContent(string dataSubpath, string content) { }
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+using BenchmarkDotNet.Attributes;
+using VenusRootLoader.Benchmarks.Workloads;
+using VenusRootLoader.Persistence;
+using VenusRootLoader.Persistence.BaseGameSave;
+
+namespace VenusRootLoader.Benchmarks.Persistence.BaseGameSave;
+
+public class BaseGameSaveDataBenchmarks
+{
+    private BaseGameSaveDataSerializer _serializer = null!;
+    private BaseGameSaveDataDeserializer _deserializer = null!;
+    private string _saveData = null!;
+
+    [Params(10, 100)]
+    public int BudsAmount { get; set; }
+
+    [Params(50, 500)]
+    public int InventorySize { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        SaveDataWorkload workload = new(BudsAmount, leavesPerBud: 20, InventorySize);
+        _serializer = workload.CreateBaseGameSaveDataSerializer();
+        _deserializer = workload.CreateBaseGameSaveDataDeserializer();
+        _saveData = _serializer.GetBaseGameSaveDataFromRuntimeState(null);
+    }
+
+    [Benchmark]
+    public string Serialize() => _serializer.GetBaseGameSaveDataFromRuntimeState(null);
+
+    [Benchmark]
+    public MainManager.LoadData DeserializeLite() => _deserializer.DeserializeLiteBaseGameSaveData(_saveData);
+
+    [Benchmark]
+    public object DeserializeFull()
+    {
+        StagingLoadData stagingLoadData = new();
+        _deserializer.DeserializeFullBaseGameSaveData(_saveData, stagingLoadData);
+        return stagingLoadData;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+using BenchmarkDotNet.Attributes;
+using VenusRootLoader.Benchmarks.Workloads;
+using VenusRootLoader.Persistence.BudsSave;
+
+namespace VenusRootLoader.Benchmarks.Persistence.BudsSave;
+
+public class BudsSaveDataSerializerBenchmarks
+{
+    private BudsSaveDataSerializer _serializer = null!;
+    private Dictionary<string, BudSaveData> _lastWrittenBudsSaveData = null!;
+
+    [Params(10, 100)]
+    public int BudsAmount { get; set; }
+
+    [Params(20, 200)]
+    public int LeavesPerBud { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        SaveDataWorkload workload = new(BudsAmount, LeavesPerBud, inventorySize: 50);
+        _serializer = workload.CreateBudsSaveDataSerializer();
+        _lastWrittenBudsSaveData = _serializer.GetBudsSaveDataFromRuntimeState();
+    }
+
+    [Benchmark]
+    public Dictionary<string, string> Serialize() =>
+        _serializer.GetBudsSaveDataFromRuntimeState()
+            .ToDictionary(b => b.Key, b => _serializer.SerializeBudSaveData(b.Value));
+
+    // This is what a save costs when no bud's save data changed since the slot was last written
+    [Benchmark]
+    public int FindChangedBuds() =>
+        _serializer.GetBudsSaveDataFromRuntimeState()
+            .Count(b => !b.Value.HasSameContentAs(_lastWrittenBudsSaveData[b.Key]));
+}
\ No newline at end of file
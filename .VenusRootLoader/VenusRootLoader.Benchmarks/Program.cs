@@ -0,0 +1,155 @@
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Jobs;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+using BenchmarkDotNet.Toolchains.InProcess.NoEmit;
+using System.Globalization;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using VenusRootLoader.Benchmarks.Baselines;
+
+namespace VenusRootLoader.Benchmarks;
+
+/// <summary>
+/// Runs the benchmarks with BenchmarkDotNet. On top of BenchmarkDotNet's own arguments, the following are supported:
+/// <list type="bullet">
+/// <item><c>--save-baseline &lt;path&gt;</c>: saves the measurements of this run as a baseline file.</item>
+/// <item><c>--compare-baseline &lt;path&gt;</c>: compares the measurements of this run against a baseline file and
+/// exits with a non zero code if any of them regressed.</item>
+/// <item><c>--max-time-regression &lt;percent&gt;</c>: how much the mean time can increase before being a
+/// regression (10 by default).</item>
+/// <item><c>--max-allocation-regression &lt;percent&gt;</c>: how much the allocated bytes per operation can increase
+/// before being a regression (10 by default).</item>
+/// </list>
+/// If one of them is missing its value or has an invalid one, nothing is ran and the exit code is 2.
+/// </summary>
+public static class Program
+{
+    private const string SaveBaselineArgument = "--save-baseline";
+    private const string CompareBaselineArgument = "--compare-baseline";
+    private const string MaxTimeRegressionArgument = "--max-time-regression";
+    private const string MaxAllocationRegressionArgument = "--max-allocation-regression";
+    private const int UsageErrorExitCode = 2;
+
+    public static int Main(string[] args)
+    {
+        // The game's assemblies are copied next to the benchmarks, but they aren't resolved automatically since
+        // they aren't listed as dependencies of this assembly
+        AppDomain.CurrentDomain.AssemblyResolve += OnAssemblyResolve;
+        return Run(args);
+    }
+
+    // This is a separate method so that no types of the loader are loaded before the resolver is installed
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Run(string[] args)
+    {
+        List<string> benchmarkDotNetArgs = new();
+        string? saveBaselinePath = null;
+        string? compareBaselinePath = null;
+        double maxTimeRegressionPercent = 10;
+        double maxAllocationRegressionPercent = 10;
+        for (int i = 0; i < args.Length; i++)
+        {
+            string argument = args[i];
+            if (argument is not (SaveBaselineArgument
+                or CompareBaselineArgument
+                or MaxTimeRegressionArgument
+                or MaxAllocationRegressionArgument))
+            {
+                benchmarkDotNetArgs.Add(argument);
+                continue;
+            }
+
+            // Another argument in place of the value means it was forgotten so it must not be taken as the value
+            if (i + 1 >= args.Length || args[i + 1].StartsWith("--", StringComparison.Ordinal))
+                return ReportUsageError($"{argument} requires a value");
+
+            string value = args[++i];
+            switch (argument)
+            {
+                case SaveBaselineArgument:
+                    saveBaselinePath = value;
+                    break;
+                case CompareBaselineArgument:
+                    compareBaselinePath = value;
+                    break;
+                case MaxTimeRegressionArgument:
+                    if (!TryParsePercent(value, out maxTimeRegressionPercent))
+                        return ReportInvalidPercentUsageError(argument, value);
+                    break;
+                case MaxAllocationRegressionArgument:
+                    if (!TryParsePercent(value, out maxAllocationRegressionPercent))
+                        return ReportInvalidPercentUsageError(argument, value);
+                    break;
+            }
+        }
+
+        // The benchmarks runs in process so they don't need an SDK to generate and build a host project which means
+        // they work the same under mono
+        IConfig config = DefaultConfig.Instance
+            .AddJob(Job.Default.WithToolchain(InProcessNoEmitToolchain.Instance).WithId("InProcess"))
+            .AddDiagnoser(MemoryDiagnoser.Default);
+
+        Summary[] summaries = BenchmarkSwitcher
+            .FromAssembly(typeof(Program).Assembly)
+            .Run(benchmarkDotNetArgs.ToArray(), config)
+            .ToArray();
+        BenchmarkBaseline currentRun = BenchmarkBaseline.FromSummaries(summaries);
+
+        if (saveBaselinePath is not null)
+        {
+            currentRun.Save(saveBaselinePath);
+            Console.WriteLine(
+                $"Saved the baseline of {currentRun.Measurements.Count} benchmarks to {saveBaselinePath}");
+        }
+
+        if (compareBaselinePath is null)
+            return 0;
+
+        BenchmarkBaseline baseline = BenchmarkBaseline.Load(compareBaselinePath);
+        List<string> regressions = baseline.FindRegressions(
+            currentRun,
+            maxTimeRegressionPercent,
+            maxAllocationRegressionPercent);
+        if (regressions.Count == 0)
+        {
+            Console.WriteLine($"No regressions found compared to the baseline {compareBaselinePath}");
+            return 0;
+        }
+
+        Console.WriteLine($"Found {regressions.Count} regressions compared to the baseline {compareBaselinePath}:");
+        foreach (string regression in regressions)
+            Console.WriteLine($"  {regression}");
+
+        return 1;
+    }
+
+    private static bool TryParsePercent(string value, out double percent) =>
+        double.TryParse(value, NumberStyles.Float, CultureInfo.InvariantCulture, out percent) && percent >= 0;
+
+    private static int ReportInvalidPercentUsageError(string argument, string value) =>
+        ReportUsageError($"{argument} requires a percentage of 0 or more, but got {value}");
+
+    private static int ReportUsageError(string message)
+    {
+        Console.Error.WriteLine(message);
+        Console.Error.WriteLine(
+            $"Usage: [{SaveBaselineArgument} <path>] [{CompareBaselineArgument} <path>] " +
+            $"[{MaxTimeRegressionArgument} <percent>] [{MaxAllocationRegressionArgument} <percent>] " +
+            "[BenchmarkDotNet arguments]");
+        return UsageErrorExitCode;
+    }
+
+    private static Assembly? OnAssemblyResolve(object? sender, ResolveEventArgs args)
+    {
+        string assemblyName = new AssemblyName(args.Name).Name!;
+        foreach (string file in Directory.EnumerateFiles(AppDomain.CurrentDomain.BaseDirectory, "*.dll"))
+        {
+            if (assemblyName == Path.GetFileNameWithoutExtension(file))
+                return Assembly.LoadFile(file);
+        }
+
+        return null;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+using BenchmarkDotNet.Attributes;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Benchmarks.Workloads;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Benchmarks.Registry;
+
+public class BaseRegistryBenchmarks
+{
+    private const int BaseGameLeavesAmount = 750;
+    private const int LeavesPerBud = 50;
+
+    private AutoSequentialIdBasedRegistry<FlagLeaf> _registry = null!;
+    private int[] _gameIds = null!;
+    private string[] _effectiveIds = null!;
+
+    [Params(10, 200)]
+    public int BudsAmount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _registry = SyntheticWorkload.CreateRegistry<FlagLeaf>(BaseGameLeavesAmount, BudsAmount, LeavesPerBud);
+        _gameIds = _registry.Select(l => l.GameId).ToArray();
+        _effectiveIds = _registry.Select(l => l.EffectiveId).ToArray();
+    }
+
+    [Benchmark]
+    public int RegisterAndFreeze() =>
+        SyntheticWorkload.CreateRegistry<FlagLeaf>(BaseGameLeavesAmount, BudsAmount, LeavesPerBud).Count;
+
+    [Benchmark]
+    public int GetByGameId()
+    {
+        int sum = 0;
+        foreach (int gameId in _gameIds)
+            sum += _registry.GetByGameId(gameId).GameId;
+        return sum;
+    }
+
+    [Benchmark]
+    public int GetByEffectiveId()
+    {
+        int sum = 0;
+        foreach (string effectiveId in _effectiveIds)
+            sum += _registry.GetByEffectiveId(effectiveId).GameId;
+        return sum;
+    }
+
+    [Benchmark]
+    public int Enumerate()
+    {
+        int sum = 0;
+        foreach (FlagLeaf leaf in _registry)
+            sum += leaf.GameId;
+        return sum;
+    }
+}
\ No newline at end of file
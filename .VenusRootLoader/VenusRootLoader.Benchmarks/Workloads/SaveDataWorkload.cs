@@ -0,0 +1,256 @@
+using Microsoft.Extensions.Logging.Abstractions;
+using UnityEngine;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Persistence;
+using VenusRootLoader.Persistence.BaseGameSave;
+using VenusRootLoader.Persistence.BudsSave;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Benchmarks.Workloads;
+
+/// <summary>
+/// The registries and runtime state of a game session with many buds and a large inventory which is what the save data
+/// serializers and deserializers operate on. The base game amounts match the ones of the game.
+/// </summary>
+internal sealed class SaveDataWorkload
+{
+    private const int BaseGameAnimIdsAmount = 250;
+    private const int BaseGameMapsAmount = 250;
+    private const int BaseGameAreasAmount = 25;
+    private const int BaseGameMedalsAmount = 120;
+    private const int BaseGameQuestsAmount = 90;
+    private const int BaseGameItemsAmount = 200;
+    private const int BaseGameMusicsAmount = 60;
+    private const int BaseGameDiscoveriesAmount = 50;
+    private const int BaseGameEnemiesAmount = 116;
+    private const int BaseGameRecipeLibraryEntriesAmount = 70;
+    private const int BaseGameRecordsAmount = 30;
+    private const int BaseGameFlagsAmount = 750;
+    private const int BaseGameFlagstringsAmount = 15;
+    private const int BaseGameSpyCardsAmount = 130;
+    private const int BaseGameFlagvarsAmount = 70;
+    private const int BaseGameCrystalBerriesAmount = 50;
+    private const int BaseGameMedalShopsAmount = 2;
+    private const int RegionalFlagsAmount = 200;
+    private const int PartyMembersAmount = 3;
+
+    private readonly AutoSequentialIdBasedRegistry<AnimIdLeaf> _animIdsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<MapLeaf> _mapsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<AreaLeaf> _areasRegistry;
+    private readonly AutoSequentialIdBasedRegistry<MedalLeaf> _medalsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<QuestLeaf> _questsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<ItemLeaf> _itemsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<MusicLeaf> _musicsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<DiscoveryLeaf> _discoveriesRegistry;
+    private readonly AutoSequentialIdBasedRegistry<EnemyLeaf> _enemiesRegistry;
+    private readonly AutoSequentialIdBasedRegistry<RecipeLibraryEntryLeaf> _recipeLibraryEntriesRegistry;
+    private readonly AutoSequentialIdBasedRegistry<RecordLeaf> _recordsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<FlagLeaf> _flagsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<FlagstringLeaf> _flagstringsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<SpyCardLeaf> _spyCardsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<FlagvarLeaf> _flagvarsRegistry;
+    private readonly AutoSequentialIdBasedRegistry<CrystalBerryLeaf> _crystalBerriesRegistry;
+    private readonly AutoSequentialIdBasedRegistry<MedalShopLeaf> _medalShopsRegistry;
+
+    /// <summary>
+    /// Creates the workload.
+    /// </summary>
+    /// <param name="budsAmount">The amount of buds that created leaves in every registry.</param>
+    /// <param name="leavesPerBud">The amount of leaves each bud created in every registry.</param>
+    /// <param name="inventorySize">The amount of items in each item inventories and the amount of medals owned.</param>
+    internal SaveDataWorkload(int budsAmount, int leavesPerBud, int inventorySize)
+    {
+        _animIdsRegistry = CreateRegistry<AnimIdLeaf>(BaseGameAnimIdsAmount);
+        _mapsRegistry = CreateRegistry<MapLeaf>(BaseGameMapsAmount);
+        _areasRegistry = CreateRegistry<AreaLeaf>(BaseGameAreasAmount);
+        _medalsRegistry = CreateRegistry<MedalLeaf>(BaseGameMedalsAmount);
+        _questsRegistry = CreateRegistry<QuestLeaf>(BaseGameQuestsAmount);
+        _itemsRegistry = CreateRegistry<ItemLeaf>(BaseGameItemsAmount);
+        _musicsRegistry = CreateRegistry<MusicLeaf>(BaseGameMusicsAmount);
+        _discoveriesRegistry = CreateRegistry<DiscoveryLeaf>(BaseGameDiscoveriesAmount);
+        _enemiesRegistry = CreateRegistry<EnemyLeaf>(BaseGameEnemiesAmount);
+        _recipeLibraryEntriesRegistry = CreateRegistry<RecipeLibraryEntryLeaf>(BaseGameRecipeLibraryEntriesAmount);
+        _recordsRegistry = CreateRegistry<RecordLeaf>(BaseGameRecordsAmount);
+        _flagsRegistry = CreateRegistry<FlagLeaf>(BaseGameFlagsAmount);
+        _flagstringsRegistry = CreateRegistry<FlagstringLeaf>(BaseGameFlagstringsAmount);
+        _spyCardsRegistry = CreateRegistry<SpyCardLeaf>(BaseGameSpyCardsAmount);
+        _flagvarsRegistry = CreateRegistry<FlagvarLeaf>(BaseGameFlagvarsAmount);
+        _crystalBerriesRegistry = CreateRegistry<CrystalBerryLeaf>(BaseGameCrystalBerriesAmount);
+        _medalShopsRegistry = SyntheticWorkload.CreateRegistry<MedalShopLeaf>(BaseGameMedalShopsAmount, budsAmount, 1);
+
+        RuntimeState = CreateRuntimeState(inventorySize);
+
+        AutoSequentialIdBasedRegistry<TLeaf> CreateRegistry<TLeaf>(int baseGameAmount)
+            where TLeaf : Leaf =>
+            SyntheticWorkload.CreateRegistry<TLeaf>(baseGameAmount, budsAmount, leavesPerBud);
+    }
+
+    internal SyntheticGameDataRuntimeState RuntimeState { get; }
+
+    internal BaseGameSaveDataSerializer CreateBaseGameSaveDataSerializer() =>
+        new(
+            RuntimeState,
+            _animIdsRegistry,
+            _mapsRegistry,
+            _areasRegistry,
+            _medalsRegistry,
+            _questsRegistry,
+            _itemsRegistry,
+            _musicsRegistry,
+            _discoveriesRegistry,
+            _enemiesRegistry,
+            _recipeLibraryEntriesRegistry,
+            _recordsRegistry,
+            _flagsRegistry,
+            _flagstringsRegistry,
+            _spyCardsRegistry,
+            _flagvarsRegistry,
+            _crystalBerriesRegistry);
+
+    internal BaseGameSaveDataDeserializer CreateBaseGameSaveDataDeserializer() =>
+        new(
+            NullLogger<BaseGameSaveDataDeserializer>.Instance,
+            _animIdsRegistry,
+            _mapsRegistry,
+            _areasRegistry,
+            _medalsRegistry,
+            _questsRegistry,
+            _itemsRegistry,
+            _musicsRegistry,
+            _discoveriesRegistry,
+            _enemiesRegistry,
+            _recipeLibraryEntriesRegistry,
+            _recordsRegistry,
+            _flagsRegistry,
+            _flagstringsRegistry,
+            _spyCardsRegistry,
+            _flagvarsRegistry,
+            _crystalBerriesRegistry);
+
+    internal BudsSaveDataSerializer CreateBudsSaveDataSerializer() =>
+        new(
+            RuntimeState,
+            _medalShopsRegistry,
+            _medalsRegistry,
+            _discoveriesRegistry,
+            _enemiesRegistry,
+            _recipeLibraryEntriesRegistry,
+            _recordsRegistry,
+            _areasRegistry,
+            _flagsRegistry,
+            _flagstringsRegistry,
+            _flagvarsRegistry,
+            _crystalBerriesRegistry);
+
+    private SyntheticGameDataRuntimeState CreateRuntimeState(int inventorySize)
+    {
+        int libraryPageSize = new[]
+        {
+            256,
+            _discoveriesRegistry.Count,
+            _enemiesRegistry.Count,
+            _recipeLibraryEntriesRegistry.Count,
+            _recordsRegistry.Count,
+            _areasRegistry.Count
+        }.Max();
+        bool[,] libraryStuff = new bool[5, libraryPageSize];
+        for (int i = 0; i < libraryStuff.GetLength(0); i++)
+        for (int j = 0; j < libraryStuff.GetLength(1); j++)
+            libraryStuff[i, j] = (i + j) % 3 != 0;
+
+        int[,] enemyEncounter = new int[_enemiesRegistry.Count, 2];
+        for (int i = 0; i < enemyEncounter.GetLength(0); i++)
+        {
+            enemyEncounter[i, 0] = i % 50;
+            enemyEncounter[i, 1] = i % 25;
+        }
+
+        string[] flagstrings = Enumerable.Range(0, _flagstringsRegistry.Count).Select(i => $"Flagstring{i}").ToArray();
+        flagstrings[8] = "1,2,3-4,5-7";
+        flagstrings[12] = string.Join(",", Enumerable.Range(0, 15).Select(i => i % _spyCardsRegistry.Count));
+        flagstrings[13] = "5,6";
+
+        int[] flagvars = Enumerable.Range(0, _flagvarsRegistry.Count).Select(i => i * 3).ToArray();
+        flagvars[56] = _itemsRegistry.Count - 1;
+
+        return new()
+        {
+            PlayerPosition = new Vector3(12.5f, 0.25f, -3.75f),
+            PartyOrder = Enumerable.Range(0, PartyMembersAmount).ToArray(),
+            PlayerData = Enumerable.Range(0, PartyMembersAmount)
+                .Select(i => new PartyMemberRuntimeState
+                {
+                    Trueid = i,
+                    Animid = i,
+                    Hp = 10 + i,
+                    Maxhp = 15 + i,
+                    Basehp = 10,
+                    Atk = 2 + i,
+                    Baseatk = 2,
+                    Def = i,
+                    Basedef = 0
+                })
+                .ToList(),
+            MapAreaId = 3,
+            MapName = "5",
+            PartyLevel = 27,
+            PartyExp = 50,
+            NeededExp = 100,
+            BaseTp = 30,
+            Tp = 30,
+            Money = 999,
+            Bp = 30,
+            MaxBp = 51,
+            MaxItems = inventorySize,
+            MaxStorage = inventorySize,
+            ClockHour = 20,
+            ClockMin = 15,
+            ClockSec = 30,
+            AvailableBadgePool = CreateMedalShopsData(inventorySize / 2),
+            BadgeShops = CreateMedalShopsData(inventorySize / 4),
+            BoardQuests =
+            [
+                CreateGameIdsList(inventorySize / 4, _questsRegistry.Count, 0),
+                CreateGameIdsList(inventorySize / 4, _questsRegistry.Count, 1),
+                CreateGameIdsList(inventorySize / 4, _questsRegistry.Count, 2)
+            ],
+            Items =
+            [
+                CreateGameIdsList(inventorySize, _itemsRegistry.Count, 0),
+                CreateGameIdsList(inventorySize, _itemsRegistry.Count, 1),
+                CreateGameIdsList(inventorySize, _itemsRegistry.Count, 2)
+            ],
+            Badges = Enumerable.Range(0, inventorySize)
+                .Select(i => new[] { (i * 7) % _medalsRegistry.Count, i % 4 == 0 ? -2 : i % PartyMembersAmount })
+                .ToList(),
+            SamiraMusics = Enumerable.Range(0, _musicsRegistry.Count).Select(i => new[] { i, i % 2 }).ToList(),
+            StatBonus = Enumerable.Range(0, inventorySize / 10)
+                .Select(i => new[] { i % 3, 1 + i % 2, i % PartyMembersAmount })
+                .ToList(),
+            LibraryStuff = libraryStuff,
+            Flags = Enumerable.Range(0, _flagsRegistry.Count).Select(i => i % 2 == 0).ToArray(),
+            Flagstring = flagstrings,
+            Flagvar = flagvars,
+            RegionalFlags = Enumerable.Range(0, RegionalFlagsAmount).Select(i => i % 5 == 0).ToArray(),
+            CrystalBFlags = Enumerable.Range(0, _crystalBerriesRegistry.Count).Select(i => i % 3 == 0).ToArray(),
+            ExtraFollowers = [PartyMembersAmount, PartyMembersAmount + 1],
+            EnemyEncounter = enemyEncounter
+        };
+
+        List<int>[] CreateMedalShopsData(int baseGameShopSize)
+        {
+            List<int>[] medalShops = new List<int>[_medalShopsRegistry.Count];
+            for (int i = 0; i < medalShops.Length; i++)
+            {
+                int shopSize = i < BaseGameMedalShopsAmount ? baseGameShopSize : 5;
+                medalShops[i] = CreateGameIdsList(shopSize, _medalsRegistry.Count, i);
+            }
+
+            return medalShops;
+        }
+    }
+
+    // Spreads the game ids over the whole registry so both base game and buds leaves are referenced
+    private static List<int> CreateGameIdsList(int amount, int registryCount, int seed) =>
+        Enumerable.Range(0, amount).Select(i => (i * 13 + seed) % registryCount).ToList();
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+using UnityEngine;
+using VenusRootLoader.Persistence;
+
+namespace VenusRootLoader.Benchmarks.Workloads;
+
+/// <summary>
+/// An <see cref="IGameDataRuntimeState"/> that holds its state in plain properties instead of the game's managers so
+/// the save data serializers can run outside of Unity.
+/// </summary>
+internal sealed class SyntheticGameDataRuntimeState : IGameDataRuntimeState
+{
+    public Vector3 PlayerPosition { get; set; }
+    public int[] PartyOrder { get; set; } = [];
+    public List<PartyMemberRuntimeState> PlayerData { get; set; } = [];
+    public int MapAreaId { get; set; }
+    public string MapName { get; set; } = "0";
+    public int PartyLevel { get; set; }
+    public int PartyExp { get; set; }
+    public int NeededExp { get; set; }
+    public int BaseTp { get; set; }
+    public int Tp { get; set; }
+    public int Money { get; set; }
+    public int Bp { get; set; }
+    public int MaxBp { get; set; }
+    public int MaxItems { get; set; }
+    public int MaxStorage { get; set; }
+    public int ClockHour { get; set; }
+    public int ClockMin { get; set; }
+    public int ClockSec { get; set; }
+    public List<int>[] AvailableBadgePool { get; set; } = [];
+    public List<int>[] BadgeShops { get; set; } = [];
+    public List<int>[] BoardQuests { get; set; } = [];
+    public List<int>[] Items { get; set; } = [];
+    public List<int[]> Badges { get; set; } = [];
+    public List<int[]> SamiraMusics { get; set; } = [];
+    public List<int[]> StatBonus { get; set; } = [];
+    public bool[,] LibraryStuff { get; set; } = new bool[0, 0];
+    public bool[] Flags { get; set; } = [];
+    public string[] Flagstring { get; set; } = [];
+    public int[] Flagvar { get; set; } = [];
+    public bool[] RegionalFlags { get; set; } = [];
+    public bool[] CrystalBFlags { get; set; } = [];
+    public List<int> ExtraFollowers { get; set; } = [];
+    public int[,] EnemyEncounter { get; set; } = new int[0, 0];
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+using Microsoft.Extensions.Logging.Abstractions;
+using NuGet.Versioning;
+using UnityEngine;
+using VenusRootLoader.Api;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Api.Leaves.MapEntities;
+using VenusRootLoader.Api.Leaves.MapEntities.Objects;
+using VenusRootLoader.BudLoading;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Benchmarks.Workloads;
+
+/// <summary>
+/// Generates deterministic synthetic data that resembles what the loader deals with when a large amount of buds are
+/// installed. Nothing here touches the game or the file system so every workload can be created outside of Unity.
+/// </summary>
+internal static class SyntheticWorkload
+{
+    internal const string BudIdPrefix = "SyntheticBud";
+
+    internal static string GetBudId(int budIndex) => $"{BudIdPrefix}{budIndex}";
+
+    /// <summary>
+    /// Creates buds where each of them depends on up to <paramref name="dependenciesPerBud"/> buds created before it
+    /// with the last one being optional. They are returned in reverse order so sorting them has to reorder all of them.
+    /// </summary>
+    /// <param name="budsAmount">The amount of buds to create.</param>
+    /// <param name="dependenciesPerBud">The maximum amount of dependencies of each bud.</param>
+    /// <returns>The buds indexed by their bud id.</returns>
+    internal static Dictionary<string, BudInfo> CreateBuds(int budsAmount, int dependenciesPerBud)
+    {
+        Dictionary<string, BudInfo> budsById = new();
+        for (int i = budsAmount - 1; i >= 0; i--)
+        {
+            string budId = GetBudId(i);
+            int dependenciesAmount = Math.Min(i, dependenciesPerBud);
+            BudDependency[] dependencies = new BudDependency[dependenciesAmount];
+            for (int j = 0; j < dependenciesAmount; j++)
+            {
+                dependencies[j] = new()
+                {
+                    BudId = GetBudId(i - 1 - j),
+                    Optional = j == dependenciesAmount - 1,
+                    Version = VersionRange.Parse("[1.0.0, 2.0.0)")
+                };
+            }
+
+            budsById.Add(
+                budId,
+                new()
+                {
+                    BudManifest = new()
+                    {
+                        AssemblyFile = $"{budId}.dll",
+                        BudId = budId,
+                        BudName = budId,
+                        BudVersion = new(1, i % 10, 0),
+                        BudAuthor = "Synthetic",
+                        BudDependencies = dependencies,
+                        BudIncompatibilities = []
+                    },
+                    BudAssemblyPath = Path.Combine("Buds", budId, $"{budId}.dll"),
+                    BudTypeFullName = $"{budId}.{budId}"
+                });
+        }
+
+        return budsById;
+    }
+
+    /// <summary>
+    /// Creates a registry with base game leaves whose game ids are contiguous from 0 followed by the leaves of each
+    /// bud.
+    /// </summary>
+    /// <param name="baseGameAmount">The amount of base game leaves.</param>
+    /// <param name="budsAmount">The amount of buds that created leaves.</param>
+    /// <param name="leavesPerBud">The amount of leaves each bud created.</param>
+    /// <param name="freeze">Tells if the registry should be frozen like it is once all buds are loaded.</param>
+    /// <typeparam name="TLeaf">The type of leaf of the registry.</typeparam>
+    /// <returns>The registry.</returns>
+    internal static AutoSequentialIdBasedRegistry<TLeaf> CreateRegistry<TLeaf>(
+        int baseGameAmount,
+        int budsAmount,
+        int leavesPerBud,
+        bool freeze = true)
+        where TLeaf : Leaf
+    {
+        AutoSequentialIdBasedRegistry<TLeaf> registry = new(NullLogger.Instance, IdSequenceDirection.Increment);
+        for (int i = 0; i < baseGameAmount; i++)
+            registry.RegisterExisting(i, i.ToString());
+        for (int i = 0; i < budsAmount; i++)
+        {
+            string budId = GetBudId(i);
+            for (int j = 0; j < leavesPerBud; j++)
+                registry.RegisterNew(budId, $"{typeof(TLeaf).Name}{j}");
+        }
+
+        if (freeze)
+            registry.Freeze();
+        return registry;
+    }
+
+    /// <summary>
+    /// Creates a map with as many entities as requested. The entities are breakable rocks since they can be created
+    /// without any other registries, but they still go through the entire serialization format.
+    /// </summary>
+    /// <param name="entitiesAmount">The amount of entities in the map.</param>
+    /// <returns>The map.</returns>
+    internal static MapLeaf CreateMapWithEntities(int entitiesAmount)
+    {
+        AutoSequentialIdBasedRegistry<MapLeaf> mapsRegistry = CreateRegistry<MapLeaf>(1, 0, 0, freeze: false);
+        MapLeaf map = mapsRegistry.GetByGameId(0);
+        map.EntitiesRegistry = CreateEmptyMapEntitiesRegistry();
+        map.DialoguesRegistry = new AutoSequentialIdBasedRegistry<MapDialogueLeaf>(
+            NullLogger.Instance,
+            IdSequenceDirection.Increment);
+
+        for (int i = 0; i < entitiesAmount; i++)
+        {
+            BreakableRockMapEntityLeaf entity =
+                map.EntitiesRegistry.RegisterNew<BreakableRockMapEntityLeaf>(GetBudId(i % 10), $"Rock{i}");
+            entity.InitializeFromNew(new Vector3(i * 1.5f, i % 7, -i * 0.25f));
+            entity.BaseGameObjectName = $"Rock{i}";
+            entity.Map = map;
+        }
+
+        return map;
+    }
+
+    internal static AutoSequentialIdBasedRegistry<MapEntityLeaf> CreateEmptyMapEntitiesRegistry() =>
+        new(NullLogger.Instance, IdSequenceDirection.Increment);
+}
\ No newline at end of file
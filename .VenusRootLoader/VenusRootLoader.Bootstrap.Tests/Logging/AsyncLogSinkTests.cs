@@ -0,0 +1,192 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
+using VenusRootLoader.Bootstrap.Logging;
+using VenusRootLoader.Bootstrap.Settings.LogProvider;
+
+namespace VenusRootLoader.Bootstrap.Tests.Logging;
+
+public sealed class AsyncLogSinkTests
+{
+    private sealed class RecordingLogEntryWriter : ILogEntryWriter
+    {
+        private readonly Lock _lock = new();
+        private readonly List<string> _messages = new();
+
+        internal ManualResetEventSlim FirstEntryStarted { get; } = new(false);
+        internal ManualResetEventSlim Gate { get; } = new(true);
+
+        internal List<string> Messages
+        {
+            get
+            {
+                lock (_lock)
+                    return _messages.ToList();
+            }
+        }
+
+        public void WriteEntry(in LogEntry entry)
+        {
+            FirstEntryStarted.Set();
+            Gate.Wait();
+            lock (_lock)
+                _messages.Add(entry.Message);
+        }
+    }
+
+    private const int Capacity = 16;
+
+    private readonly RecordingLogEntryWriter _writer = new();
+    private int _flushesCount;
+
+    [Fact]
+    public void Flush_WritesEveryEntryInOrder_WhenEntriesWereEnqueued()
+    {
+        using AsyncLogSink sut = CreateSink(LogOverflowPolicy.Block);
+        List<string> expectedMessages = Enumerable.Range(0, 1000).Select(i => i.ToString()).ToList();
+
+        foreach (string message in expectedMessages)
+            sut.Enqueue(CreateEntry(LogLevel.Information, message));
+        sut.Flush();
+
+        _writer.Messages.Should().Equal(expectedMessages);
+        _flushesCount.Should().BePositive();
+        sut.DroppedEntriesCount.Should().Be(0);
+    }
+
+    [Theory]
+    [InlineData(LogLevel.Error)]
+    [InlineData(LogLevel.Critical)]
+    public void Enqueue_WritesEntryBeforeReturning_WhenEntryIsAnErrorOrCritical(LogLevel logLevel)
+    {
+        using AsyncLogSink sut = CreateSink(LogOverflowPolicy.Block);
+
+        sut.Enqueue(CreateEntry(LogLevel.Information, "first"));
+        sut.Enqueue(CreateEntry(logLevel, "error"));
+
+        _writer.Messages.Should().Equal("first", "error");
+    }
+
+    [Fact]
+    public async Task Enqueue_WaitsUntilWriterMadeRoom_WhenQueueIsFullAndPolicyIsBlock()
+    {
+        using AsyncLogSink sut = CreateSink(LogOverflowPolicy.Block);
+        List<string> queuedMessages = FillQueueWhileWriterIsBlocked(sut);
+        CancellationToken cancellationToken = TestContext.Current.CancellationToken;
+
+        Task enqueueTask = Task.Run(
+            () => sut.Enqueue(CreateEntry(LogLevel.Information, "overflowing")),
+            cancellationToken);
+        Task completedWhileWriterWasBlocked = await Task.WhenAny(
+            enqueueTask,
+            Task.Delay(TimeSpan.FromMilliseconds(200), cancellationToken));
+        _writer.Gate.Set();
+        Task completedAfterWriterWasUnblocked = await Task.WhenAny(
+            enqueueTask,
+            Task.Delay(TimeSpan.FromSeconds(5), cancellationToken));
+        sut.Flush();
+
+        completedWhileWriterWasBlocked.Should().NotBeSameAs(enqueueTask);
+        completedAfterWriterWasUnblocked.Should().BeSameAs(enqueueTask);
+        sut.DroppedEntriesCount.Should().Be(0);
+        _writer.Messages.Should().Equal([..queuedMessages, "overflowing"]);
+    }
+
+    [Fact]
+    public void Enqueue_DropsTraceEntries_WhenQueueIsFullAndPolicyIsDropTrace()
+    {
+        using AsyncLogSink sut = CreateSink(LogOverflowPolicy.DropTrace);
+        List<string> queuedMessages = FillQueueWhileWriterIsBlocked(sut);
+
+        sut.Enqueue(CreateEntry(LogLevel.Trace, "trace"));
+        _writer.Gate.Set();
+        sut.Flush();
+
+        sut.DroppedEntriesCount.Should().Be(1);
+        _writer.Messages.Should().Equal(queuedMessages);
+    }
+
+    [Fact]
+    public void Enqueue_DropsOldestEntries_WhenQueueIsFullAndPolicyIsDropOldest()
+    {
+        using AsyncLogSink sut = CreateSink(LogOverflowPolicy.DropOldest);
+        List<string> queuedMessages = FillQueueWhileWriterIsBlocked(sut);
+
+        sut.Enqueue(CreateEntry(LogLevel.Information, "newest 1"));
+        sut.Enqueue(CreateEntry(LogLevel.Information, "newest 2"));
+        _writer.Gate.Set();
+        sut.Flush();
+
+        sut.DroppedEntriesCount.Should().Be(2);
+        _writer.Messages.Should().Equal(
+            [queuedMessages[0], ..queuedMessages.Skip(3), "newest 1", "newest 2"]);
+    }
+
+    [Fact]
+    public void Dispose_WritesRemainingEntries_WhenEntriesAreStillQueued()
+    {
+        AsyncLogSink sut = CreateSink(LogOverflowPolicy.Block);
+        List<string> queuedMessages = FillQueueWhileWriterIsBlocked(sut);
+
+        _writer.Gate.Set();
+        sut.Dispose();
+
+        _writer.Messages.Should().Equal(queuedMessages);
+        sut.QueueDepth.Should().Be(0);
+        _flushesCount.Should().BePositive();
+    }
+
+    [Fact]
+    public void Drain_WritesAndFlushesEveryQueuedEntry_WhenEntriesWereEnqueued()
+    {
+        using AsyncLogSink sut = CreateSink(LogOverflowPolicy.Block);
+        List<string> expectedMessages = Enumerable.Range(0, 100).Select(i => i.ToString()).ToList();
+
+        foreach (string message in expectedMessages)
+            sut.Enqueue(CreateEntry(LogLevel.Information, message));
+        sut.Drain();
+
+        _writer.Messages.Should().Equal(expectedMessages);
+        sut.QueueDepth.Should().Be(0);
+        _flushesCount.Should().BePositive();
+    }
+
+    [Fact]
+    public void DrainAllSinks_DoesNotWriteToDisposedSinks_WhenASinkWasDisposed()
+    {
+        AsyncLogSink disposedSink = CreateSink(LogOverflowPolicy.Block);
+        disposedSink.Enqueue(CreateEntry(LogLevel.Information, "written on dispose"));
+        disposedSink.Dispose();
+        int flushesCountAfterDispose = _flushesCount;
+
+        AsyncLogSink.DrainAllSinks();
+
+        _writer.Messages.Should().Equal("written on dispose");
+        _flushesCount.Should().Be(flushesCountAfterDispose);
+    }
+
+    private AsyncLogSink CreateSink(LogOverflowPolicy overflowPolicy) =>
+        new(Capacity, overflowPolicy, () => Interlocked.Increment(ref _flushesCount), nameof(AsyncLogSinkTests));
+
+    // Blocks the writer thread on a first entry and then fills every slot of the queue so the next enqueue overflows.
+    // The returned messages are in the order they are expected to be written
+    private List<string> FillQueueWhileWriterIsBlocked(AsyncLogSink sut)
+    {
+        _writer.Gate.Reset();
+        List<string> messages = ["blocking"];
+        sut.Enqueue(CreateEntry(LogLevel.Information, "blocking"));
+        _writer.FirstEntryStarted.Wait(TimeSpan.FromSeconds(5)).Should().BeTrue();
+
+        for (int i = 0; i < Capacity; i++)
+        {
+            string message = $"queued {i}";
+            messages.Add(message);
+            sut.Enqueue(CreateEntry(LogLevel.Information, message));
+        }
+
+        sut.QueueDepth.Should().Be(Capacity);
+        return messages;
+    }
+
+    private LogEntry CreateEntry(LogLevel logLevel, string message) =>
+        new(DateTimeOffset.Now, logLevel, message, null, _writer);
+}
\ No newline at end of file
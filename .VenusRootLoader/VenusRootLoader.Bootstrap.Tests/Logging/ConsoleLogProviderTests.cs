@@ -30,7 +30,9 @@ public sealed class ConsoleLogProviderTests
             new ConsoleLoggerSettings
             {
                 Enable = false,
-                LogWithColors = true
+                LogWithColors = true,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         GameExecutionContext gameExecutionContext = new()
         {
@@ -57,7 +59,9 @@ public sealed class ConsoleLogProviderTests
             new ConsoleLoggerSettings
             {
                 Enable = true,
-                LogWithColors = false
+                LogWithColors = false,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         GameExecutionContext gameExecutionContext = new()
         {
@@ -90,7 +94,9 @@ public sealed class ConsoleLogProviderTests
             new ConsoleLoggerSettings
             {
                 Enable = true,
-                LogWithColors = true
+                LogWithColors = true,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         GameExecutionContext gameExecutionContext = new()
         {
@@ -124,7 +130,9 @@ public sealed class ConsoleLogProviderTests
             new ConsoleLoggerSettings
             {
                 Enable = true,
-                LogWithColors = true
+                LogWithColors = true,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         GameExecutionContext gameExecutionContext = new()
         {
@@ -159,7 +167,9 @@ public sealed class ConsoleLogProviderTests
             new ConsoleLoggerSettings
             {
                 Enable = true,
-                LogWithColors = true
+                LogWithColors = true,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         GameExecutionContext gameExecutionContext = new()
         {
@@ -0,0 +1,99 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Abstractions;
+using NSubstitute;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using VenusRootLoader.Bootstrap.Logging;
+using VenusRootLoader.Bootstrap.Settings.LogProvider;
+using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tests.TestHelpers;
+
+namespace VenusRootLoader.Bootstrap.Tests.Logging;
+
+public sealed class CrashLogsDrainerTests
+{
+    private sealed class RecordingLogEntryWriter : ILogEntryWriter
+    {
+        internal List<string> Messages { get; } = new();
+
+        public void WriteEntry(in LogEntry entry)
+        {
+            lock (Messages)
+                Messages.Add(entry.Message);
+        }
+    }
+
+    private const int ExceptionContinueSearch = 0;
+    private const int ExceptionExecuteHandler = 1;
+
+    private readonly TestPltHookManager _pltHooksManager = new();
+    private readonly IWin32 _win32 = Substitute.For<IWin32>();
+
+    private readonly GameExecutionContext _gameExecutionContext = new()
+    {
+        GameDir = "",
+        DataDir = "",
+        UnityPlayerDllFileName = "UnityPlayer.dll",
+        IsWine = false
+    };
+
+    private readonly CrashLogsDrainer _sut;
+    private nint _installedFilter;
+
+    public CrashLogsDrainerTests()
+    {
+        _win32.SetUnhandledExceptionFilter(Arg.Do<nint>(f => _installedFilter = f));
+        _sut = new(NullLogger<CrashLogsDrainer>.Instance, _pltHooksManager, _gameExecutionContext, _win32);
+    }
+
+    [Fact]
+    public void Filter_ContinuesTheSearch_WhenNoOtherFilterWasInstalled()
+    {
+        _sut.DrainLogsOnCrash();
+
+        int result = CallInstalledFilter();
+
+        _installedFilter.Should().NotBe(nint.Zero);
+        result.Should().Be(ExceptionContinueSearch);
+    }
+
+    [Fact]
+    public unsafe void Filter_CallsTheFilterUnityPlayerTriedToInstall_WhenItTriedToReplaceOurs()
+    {
+        nint previousFilter = (nint)Random.Shared.Next(1, int.MaxValue);
+        nint unityFilter = (nint)(delegate* unmanaged[Stdcall]<nint, int>)&ExecuteHandlerFilter;
+        _win32.SetUnhandledExceptionFilter(Arg.Any<nint>()).Returns(previousFilter);
+        _sut.DrainLogsOnCrash();
+
+        nint returnedFilter = (nint)_pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.SetUnhandledExceptionFilter),
+            unityFilter)!;
+        int result = CallInstalledFilter();
+
+        returnedFilter.Should().Be(previousFilter);
+        result.Should().Be(ExceptionExecuteHandler);
+        _win32.Received(1).SetUnhandledExceptionFilter(Arg.Any<nint>());
+    }
+
+    [Fact]
+    public void Filter_WritesTheQueuedEntriesOfEverySink_WhenCalled()
+    {
+        RecordingLogEntryWriter writer = new();
+        using AsyncLogSink sink = new(16, LogOverflowPolicy.Block, null, nameof(CrashLogsDrainerTests));
+        _sut.DrainLogsOnCrash();
+        sink.Enqueue(new(DateTimeOffset.Now, LogLevel.Information, "before crash", null, writer));
+
+        CallInstalledFilter();
+
+        writer.Messages.Should().Equal("before crash");
+        sink.QueueDepth.Should().Be(0);
+    }
+
+    private unsafe int CallInstalledFilter() =>
+        ((delegate* unmanaged[Stdcall]<nint, int>)_installedFilter)(nint.Zero);
+
+    [UnmanagedCallersOnly(CallConvs = [typeof(CallConvStdcall)])]
+    private static int ExecuteHandlerFilter(nint exceptionInfo) => ExceptionExecuteHandler;
+}
\ No newline at end of file
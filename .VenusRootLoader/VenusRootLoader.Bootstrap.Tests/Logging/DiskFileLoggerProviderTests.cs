@@ -27,7 +27,9 @@ public sealed class DiskFileLoggerProviderTests
             new DiskFileLoggerSettings
             {
                 Enable = false,
-                MaxFilesToKeep = 5
+                MaxFilesToKeep = 5,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
 
         DiskFileLoggerProvider sut = new(
@@ -54,7 +56,9 @@ public sealed class DiskFileLoggerProviderTests
             new DiskFileLoggerSettings
             {
                 Enable = true,
-                MaxFilesToKeep = 5
+                MaxFilesToKeep = 5,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         _bootstrapEnvironment.BasePath.Returns(rootPath);
         _fileSystem.AddFile(existingLogPath, new(existingLogsContent) { AllowedFileShare = FileShare.None });
@@ -84,7 +88,9 @@ public sealed class DiskFileLoggerProviderTests
             new DiskFileLoggerSettings
             {
                 Enable = true,
-                MaxFilesToKeep = 5
+                MaxFilesToKeep = 5,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         _bootstrapEnvironment.BasePath.Returns(rootPath);
 
@@ -119,7 +125,9 @@ public sealed class DiskFileLoggerProviderTests
             new DiskFileLoggerSettings
             {
                 Enable = true,
-                MaxFilesToKeep = 5
+                MaxFilesToKeep = 5,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         _bootstrapEnvironment.BasePath.Returns(rootPath);
         _fileSystem.AddFile(latestLogPath, new(existingLogsContent));
@@ -171,7 +179,9 @@ public sealed class DiskFileLoggerProviderTests
             new DiskFileLoggerSettings
             {
                 Enable = true,
-                MaxFilesToKeep = 2
+                MaxFilesToKeep = 2,
+                OverflowPolicy = LogOverflowPolicy.Block,
+                QueueCapacity = 16
             });
         _bootstrapEnvironment.BasePath.Returns(rootPath);
         _fileSystem.AddFile(latestLogPath, new(newerLogContent));
@@ -1,4 +1,5 @@
 using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
 using Microsoft.Extensions.Logging.Testing;
 using NSubstitute;
 using VenusRootLoader.Bootstrap.Logging;
@@ -13,23 +14,14 @@ public sealed class StandardStreamsProtectorTests
 {
     private readonly FakeLogger<StandardStreamsProtector> _logger = new();
     private readonly IWin32 _win32 = Substitute.For<IWin32>();
-    private readonly TestPltHookManager _pltHookManager = new();
+    private readonly TestCloseHandleSharedHooker _closeHandleSharedHooker = new();
     private readonly IMonoInitLifeCycleEvents _monoInitLifeCycleEvents = new MonoInitLifeCycleEvents();
 
-    private readonly GameExecutionContext _gameExecutionContext = new()
-    {
-        GameDir = "",
-        DataDir = "",
-        UnityPlayerDllFileName = "UnityPlayer.dll",
-        IsWine = false
-    };
-
     private readonly StandardStreamsProtector _sut;
 
     public StandardStreamsProtectorTests() => _sut = new(
         _logger,
-        _pltHookManager,
-        _gameExecutionContext,
+        _closeHandleSharedHooker,
         _monoInitLifeCycleEvents,
         _win32);
 
@@ -39,70 +31,58 @@ public sealed class StandardStreamsProtectorTests
         _sut.ProtectStreams();
         _win32.Received(1).GetStdHandle(STD_HANDLE.STD_OUTPUT_HANDLE);
         _win32.Received(1).GetStdHandle(STD_HANDLE.STD_ERROR_HANDLE);
-        _pltHookManager.Hooks.Should()
-            .ContainKey((_gameExecutionContext.UnityPlayerDllFileName, nameof(IWin32.CloseHandle)));
+        _closeHandleSharedHooker.Hooks.Should().ContainKey(nameof(StandardStreamsProtector));
     }
 
     [Fact]
-    public void CloseHandleHook_CallsOriginal_WhenHandleIsNotStdoutOrStderr()
+    public void CloseHandleHook_DoesNotPreventClose_WhenHandleIsNotStdoutOrStderr()
     {
         HANDLE stdOutHandle = (HANDLE)Random.Shared.Next();
         HANDLE stdErrHandle = (HANDLE)Random.Shared.Next();
         HANDLE receivedHandle = (HANDLE)Random.Shared.Next();
-        BOOL expectedResult = Random.Shared.Next() % 2 == 0;
 
         _win32.GetStdHandle(STD_HANDLE.STD_OUTPUT_HANDLE).Returns(stdOutHandle);
         _win32.GetStdHandle(STD_HANDLE.STD_ERROR_HANDLE).Returns(stdErrHandle);
-        _win32.CloseHandle(Arg.Any<HANDLE>()).Returns(expectedResult);
 
         _sut.ProtectStreams();
-        BOOL result = (BOOL)_pltHookManager.SimulateHook(
-            _gameExecutionContext.UnityPlayerDllFileName,
-            nameof(IWin32.CloseHandle),
-            receivedHandle)!;
+        bool result = _closeHandleSharedHooker.SimulateHook(receivedHandle);
 
-        result.Should().Be(expectedResult);
-        _win32.Received(1).CloseHandle(receivedHandle);
+        result.Should().BeFalse();
+        _logger.Collector.Count.Should().Be(0);
     }
 
     [Theory]
     [InlineData(STD_HANDLE.STD_OUTPUT_HANDLE)]
     [InlineData(STD_HANDLE.STD_ERROR_HANDLE)]
-    public void CloseHandleHook_ReturnsTrueWithoutCallingOriginal_WhenHandleIsStdoutOrStderr(STD_HANDLE stdHandle)
+    public void CloseHandleHook_PreventsClose_WhenHandleIsStdoutOrStderr(STD_HANDLE stdHandle)
     {
         HANDLE stdOutHandle = (HANDLE)Random.Shared.Next();
         HANDLE stdErrHandle = (HANDLE)Random.Shared.Next();
         HANDLE receivedHandle = stdHandle == STD_HANDLE.STD_OUTPUT_HANDLE
             ? stdOutHandle
             : stdErrHandle;
-        BOOL expectedResult = Random.Shared.Next() % 2 == 0;
 
         _win32.GetStdHandle(STD_HANDLE.STD_OUTPUT_HANDLE).Returns(stdOutHandle);
         _win32.GetStdHandle(STD_HANDLE.STD_ERROR_HANDLE).Returns(stdErrHandle);
-        _win32.CloseHandle(Arg.Any<HANDLE>()).Returns(expectedResult);
         _win32.CompareObjectHandles(
                 Arg.Any<HANDLE>(),
                 Arg.Any<HANDLE>())
             .ReturnsForAnyArgs(c => (BOOL)(c.ArgAt<HANDLE>(0) == c.ArgAt<HANDLE>(1)));
 
         _sut.ProtectStreams();
-        BOOL result = (BOOL)_pltHookManager.SimulateHook(
-            _gameExecutionContext.UnityPlayerDllFileName,
-            nameof(IWin32.CloseHandle),
-            receivedHandle)!;
+        bool result = _closeHandleSharedHooker.SimulateHook(receivedHandle);
 
-        result.Should().Be((BOOL)true);
-        _win32.DidNotReceive().CloseHandle(receivedHandle);
+        result.Should().BeTrue();
+        _logger.LatestRecord.Level.Should().Be(LogLevel.Information);
     }
 
     [Fact]
-    public void OnGameLifeCycle_UninstallPltHook_WhenMonoInitialisedEventReceived()
+    public void OnGameLifeCycle_UnregistersHook_WhenMonoInitialisedEventReceived()
     {
         _sut.ProtectStreams();
 
         _monoInitLifeCycleEvents.Publish(this);
 
-        _pltHookManager.Hooks
-            .Should().NotContainKey((_gameExecutionContext.UnityPlayerDllFileName, nameof(IWin32.CloseHandle)));
+        _closeHandleSharedHooker.Hooks.Should().NotContainKey(nameof(StandardStreamsProtector));
     }
 }
\ No newline at end of file
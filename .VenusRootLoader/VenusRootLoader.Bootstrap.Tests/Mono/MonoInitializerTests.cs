@@ -10,6 +10,7 @@ using VenusRootLoader.Bootstrap.Mono;
 using VenusRootLoader.Bootstrap.Settings;
 using VenusRootLoader.Bootstrap.Shared;
 using VenusRootLoader.Bootstrap.Tests.TestHelpers;
+using VenusRootLoader.Bootstrap.Tracing;
 using VenusRootLoader.Bootstrap.Unity;
 using VenusRootLoader.Bootstrap.Unity.GlobalManagers;
 using Windows.Win32.Foundation;
@@ -34,6 +35,7 @@ public sealed class MonoInitializerTests
     private readonly IMonoFunctions _monoFunctions = Substitute.For<IMonoFunctions>();
     private readonly IMonoInitLifeCycleEvents _monoInitLifeCycleEvents = Substitute.For<IMonoInitLifeCycleEvents>();
     private readonly IAssembliesListAppender _assembliesListAppender = Substitute.For<IAssembliesListAppender>();
+    private readonly ITraceRecorder _traceRecorder = Substitute.For<ITraceRecorder>();
     private readonly TestPltHookManager _pltHooksManager = new();
     private readonly MockFileSystem _fileSystem = new();
     private IGameExecutionContext _gameExecutionContext = Substitute.For<IGameExecutionContext>();
@@ -64,7 +66,8 @@ public sealed class MonoInitializerTests
             _win32,
             _fileSystem,
             _monoFunctions,
-            _assembliesListAppender);
+            _assembliesListAppender,
+            _traceRecorder);
     }
 
     [Fact]
@@ -0,0 +1,134 @@
+using AwesomeAssertions;
+using NSubstitute;
+using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tests.TestHelpers;
+using Windows.Win32.Foundation;
+
+namespace VenusRootLoader.Bootstrap.Tests.Shared;
+
+public sealed class CloseHandleSharedHookerTests
+{
+    private readonly TestPltHookManager _pltHooksManager = new();
+    private readonly IWin32 _win32 = Substitute.For<IWin32>();
+
+    private readonly GameExecutionContext _gameExecutionContext = new()
+    {
+        GameDir = "",
+        DataDir = "",
+        UnityPlayerDllFileName = "UnityPlayer.dll",
+        IsWine = false
+    };
+
+    private readonly CloseHandleSharedHooker _sut;
+
+    public CloseHandleSharedHookerTests() => _sut = new(_pltHooksManager, _gameExecutionContext, _win32);
+
+    [Fact]
+    public void CloseHandleHook_CallsOriginal_WhenNoHooksAreRegistered()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        BOOL expectedReturn = Random.Shared.Next() % 2 == 0;
+        _win32.CloseHandle(Arg.Any<HANDLE>()).Returns(expectedReturn);
+
+        BOOL result = (BOOL)_pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.CloseHandle),
+            handle)!;
+
+        _win32.Received(1).CloseHandle(handle);
+        result.Should().Be(expectedReturn);
+    }
+
+    [Fact]
+    public void CloseHandleHook_CallsEveryHookThenOriginal_WhenNoHooksPreventTheClose()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        BOOL expectedReturn = Random.Shared.Next() % 2 == 0;
+        List<(string, HANDLE)> hooksCalls = new();
+        _win32.CloseHandle(Arg.Any<HANDLE>()).Returns(expectedReturn);
+
+        _sut.RegisterHook("hook1", h => AddCall(hooksCalls, "hook1", h));
+        _sut.RegisterHook("hook2", h => AddCall(hooksCalls, "hook2", h));
+        BOOL result = (BOOL)_pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.CloseHandle),
+            handle)!;
+
+        hooksCalls.Should().Equal(("hook1", handle), ("hook2", handle));
+        _win32.Received(1).CloseHandle(handle);
+        result.Should().Be(expectedReturn);
+    }
+
+    [Fact]
+    public void CloseHandleHook_CallsEveryHookAndReturnsTrueWithoutCallingOriginal_WhenAHookPreventsTheClose()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        List<(string, HANDLE)> hooksCalls = new();
+
+        _sut.RegisterHook("hook1", _ => true);
+        _sut.RegisterHook("hook2", h => AddCall(hooksCalls, "hook2", h));
+        BOOL result = (BOOL)_pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.CloseHandle),
+            handle)!;
+
+        hooksCalls.Should().Equal(("hook2", handle));
+        _win32.DidNotReceiveWithAnyArgs().CloseHandle(default);
+        result.Should().Be((BOOL)true);
+    }
+
+    [Fact]
+    public void CloseHandleHook_DoesNotCallHook_WhenItWasUnregistered()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+
+        _sut.RegisterHook("hook1", _ => true);
+        _sut.RegisterHook("hook2", _ => false);
+        _sut.UnregisterHook("hook1");
+        _pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.CloseHandle),
+            handle);
+
+        _win32.Received(1).CloseHandle(handle);
+    }
+
+    [Fact]
+    public void UnregisterHook_UninstallsPltHook_WhenTheLastHookIsUnregistered()
+    {
+        _sut.RegisterHook("hook1", _ => false);
+        _sut.RegisterHook("hook2", _ => false);
+
+        _sut.UnregisterHook("hook1");
+        _pltHooksManager.Hooks.Should()
+            .ContainKey((_gameExecutionContext.UnityPlayerDllFileName, nameof(IWin32.CloseHandle)));
+        _sut.UnregisterHook("hook2");
+
+        _pltHooksManager.Hooks.Should()
+            .NotContainKey((_gameExecutionContext.UnityPlayerDllFileName, nameof(IWin32.CloseHandle)));
+    }
+
+    [Fact]
+    public void RegisterHook_ReinstallsPltHook_WhenTheLastHookWasUnregistered()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        List<(string, HANDLE)> hooksCalls = new();
+        _sut.RegisterHook("hook1", _ => false);
+        _sut.UnregisterHook("hook1");
+
+        _sut.RegisterHook("hook2", h => AddCall(hooksCalls, "hook2", h));
+        _pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.CloseHandle),
+            handle);
+
+        hooksCalls.Should().Equal(("hook2", handle));
+        _win32.Received(1).CloseHandle(handle);
+    }
+
+    private static bool AddCall(List<(string, HANDLE)> hooksCalls, string hookName, HANDLE handle)
+    {
+        hooksCalls.Add((hookName, handle));
+        return false;
+    }
+}
\ No newline at end of file
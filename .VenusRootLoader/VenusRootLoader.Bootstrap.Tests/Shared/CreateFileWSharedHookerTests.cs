@@ -30,7 +30,7 @@ public sealed class CreateFileWSharedHookerTests
     public unsafe void CreateFileWHook_CallsOriginal_WhenNoFileHooksAreRegistered()
     {
         HANDLE expectedReturn = (HANDLE)Random.Shared.Next();
-        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalAnsi("someFile");
+        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalUni("someFile");
         _win32.CreateFile(
                 Arg.Any<PCWSTR>(),
                 Arg.Any<uint>(),
@@ -66,10 +66,10 @@ public sealed class CreateFileWSharedHookerTests
     }
 
     [Fact]
-    public unsafe void CreateFileWHook_CallsOriginal_WhenAllFileHooksPredicatesReturnsFalse()
+    public unsafe void CreateFileWHook_CallsOriginal_WhenNoFileHooksMatchersMatch()
     {
         HANDLE expectedReturn = (HANDLE)Random.Shared.Next();
-        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalAnsi("someFile");
+        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalUni("someFile");
         string hookedFileName1 = "file1";
         string hookedFileName2 = "file2";
         string hookedFileName3 = "file3";
@@ -83,9 +83,18 @@ public sealed class CreateFileWSharedHookerTests
                 Arg.Any<HANDLE>())
             .ReturnsForAnyArgs(expectedReturn);
 
-        _sut.RegisterHook(hookedFileName1, _ => false, (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
-        _sut.RegisterHook(hookedFileName2, _ => false, (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
-        _sut.RegisterHook(hookedFileName3, _ => false, (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
+        _sut.RegisterHook(
+            hookedFileName1,
+            [FilePathMatcher.ExactPath("someFile2")],
+            (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
+        _sut.RegisterHook(
+            hookedFileName2,
+            [FilePathMatcher.FileNameSuffix(".txt")],
+            (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
+        _sut.RegisterHook(
+            hookedFileName3,
+            [FilePathMatcher.DirectoryPrefix("someFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
         nint result = (nint)_pltHooksManager.SimulateHook(
             _gameExecutionContext.UnityPlayerDllFileName,
             "CreateFileW",
@@ -111,11 +120,11 @@ public sealed class CreateFileWSharedHookerTests
     }
 
     [Fact]
-    public unsafe void CreateFileWHook_CallsHooksWhosePredicateReturnsTrue_WhenSuchHooksExists()
+    public unsafe void CreateFileWHook_CallsHookWhoseMatchersMatch_WhenSuchHookExists()
     {
         HANDLE unexpectedReturn = (HANDLE)Random.Shared.Next();
         HANDLE expectedReturn = (HANDLE)Random.Shared.Next();
-        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalAnsi("someFile");
+        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalUni("someFile");
         string hookedFileName1 = "file1";
         string hookedFileName2 = "file2";
         string hookedFileName3 = "file3";
@@ -129,9 +138,18 @@ public sealed class CreateFileWSharedHookerTests
                 Arg.Any<HANDLE>())
             .ReturnsForAnyArgs(unexpectedReturn);
 
-        _sut.RegisterHook(hookedFileName1, _ => false, (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
-        _sut.RegisterHook(hookedFileName2, _ => true, (out handle, _, _, _, _, _, _, _) => handle = expectedReturn);
-        _sut.RegisterHook(hookedFileName3, _ => false, (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
+        _sut.RegisterHook(
+            hookedFileName1,
+            [FilePathMatcher.ExactPath("otherFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
+        _sut.RegisterHook(
+            hookedFileName2,
+            [FilePathMatcher.ExactPath("otherFile"), FilePathMatcher.ExactPath("SOMEFILE")],
+            (out handle, _, _, _, _, _, _, _) => handle = expectedReturn);
+        _sut.RegisterHook(
+            hookedFileName3,
+            [FilePathMatcher.FileNameSuffix("File")],
+            (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
         nint result = (nint)_pltHooksManager.SimulateHook(
             _gameExecutionContext.UnityPlayerDllFileName,
             "CreateFileW",
@@ -161,7 +179,7 @@ public sealed class CreateFileWSharedHookerTests
     {
         HANDLE unexpectedReturn = (HANDLE)Random.Shared.Next();
         HANDLE expectedReturn = (HANDLE)Random.Shared.Next();
-        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalAnsi("someFile");
+        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalUni("someFile");
         string hookedFileName1 = "file1";
         string hookedFileName2 = "file2";
         string hookedFileName3 = "file3";
@@ -175,9 +193,18 @@ public sealed class CreateFileWSharedHookerTests
                 Arg.Any<HANDLE>())
             .ReturnsForAnyArgs(unexpectedReturn);
 
-        _sut.RegisterHook(hookedFileName1, _ => true, (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
-        _sut.RegisterHook(hookedFileName2, _ => true, (out handle, _, _, _, _, _, _, _) => handle = expectedReturn);
-        _sut.RegisterHook(hookedFileName3, _ => false, (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
+        _sut.RegisterHook(
+            hookedFileName1,
+            [FilePathMatcher.ExactPath("someFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
+        _sut.RegisterHook(
+            hookedFileName2,
+            [FilePathMatcher.FileNameSuffix("File")],
+            (out handle, _, _, _, _, _, _, _) => handle = expectedReturn);
+        _sut.RegisterHook(
+            hookedFileName3,
+            [FilePathMatcher.ExactPath("otherFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
 
         _sut.UnregisterHook(hookedFileName1);
         nint result = (nint)_pltHooksManager.SimulateHook(
@@ -207,7 +234,7 @@ public sealed class CreateFileWSharedHookerTests
     [Fact]
     public unsafe void UnregisterHook_RemovesCreateFileWHook_WhenLastHookIsUnregistered()
     {
-        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalAnsi("someFile");
+        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalUni("someFile");
         string hookedFileName1 = "file1";
         _win32.CreateFile(
                 Arg.Any<PCWSTR>(),
@@ -219,7 +246,10 @@ public sealed class CreateFileWSharedHookerTests
                 Arg.Any<HANDLE>())
             .ReturnsForAnyArgs(HANDLE.Null);
 
-        _sut.RegisterHook(hookedFileName1, _ => true, (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
+        _sut.RegisterHook(
+            hookedFileName1,
+            [FilePathMatcher.ExactPath("someFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
         _sut.UnregisterHook(hookedFileName1);
         object result = _pltHooksManager.SimulateHook(
             _gameExecutionContext.UnityPlayerDllFileName,
@@ -245,4 +275,51 @@ public sealed class CreateFileWSharedHookerTests
 
         Marshal.FreeHGlobal((nint)fileNamePtr.Value);
     }
+
+    [Fact]
+    public unsafe void CreateFileWHook_CallsFirstRegisteredHook_WhenMultipleHooksMatch()
+    {
+        HANDLE unexpectedReturn = (HANDLE)Random.Shared.Next();
+        HANDLE expectedReturn = (HANDLE)Random.Shared.Next();
+        PCWSTR fileNamePtr = (char*)Marshal.StringToHGlobalUni(@"C:\Game\Data\someFile");
+
+        _sut.RegisterHook(
+            "file1",
+            [FilePathMatcher.DirectoryPrefix("C:/Game")],
+            (out handle, _, _, _, _, _, _, _) => handle = expectedReturn);
+        _sut.RegisterHook(
+            "file2",
+            [FilePathMatcher.ExactPath(@"C:\Game\Data\someFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = unexpectedReturn);
+        nint result = (nint)_pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            "CreateFileW",
+            fileNamePtr,
+            0u,
+            default(FILE_SHARE_MODE),
+            null,
+            default(FILE_CREATION_DISPOSITION),
+            default(FILE_FLAGS_AND_ATTRIBUTES),
+            default(HANDLE))!;
+
+        result.Should().Be(expectedReturn);
+
+        Marshal.FreeHGlobal((nint)fileNamePtr.Value);
+    }
+
+    [Fact]
+    public void RegisterHook_Throws_WhenHookWithSameNameIsAlreadyRegistered()
+    {
+        _sut.RegisterHook(
+            "file1",
+            [FilePathMatcher.ExactPath("someFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
+
+        Action act = () => _sut.RegisterHook(
+            "file1",
+            [FilePathMatcher.ExactPath("otherFile")],
+            (out handle, _, _, _, _, _, _, _) => handle = HANDLE.Null);
+
+        act.Should().Throw<ArgumentException>();
+    }
 }
\ No newline at end of file
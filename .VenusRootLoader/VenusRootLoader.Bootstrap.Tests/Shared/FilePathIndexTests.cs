@@ -0,0 +1,91 @@
+using AwesomeAssertions;
+using VenusRootLoader.Bootstrap.Shared;
+
+namespace VenusRootLoader.Bootstrap.Tests.Shared;
+
+public sealed class FilePathIndexTests
+{
+    [Theory]
+    [InlineData(@"C:\Game\Data\data.unity3d")]
+    [InlineData(@"c:\game\data\DATA.UNITY3D")]
+    [InlineData("C:/Game/Data/data.unity3d")]
+    public void TryMatch_MatchesExactPath_WhenPathIsEqualIgnoringCaseAndSeparators(string path)
+    {
+        FilePathIndex<int> sut = new([(FilePathMatcher.ExactPath(@"C:\Game\Data\data.unity3d"), 1)]);
+
+        bool result = sut.TryMatch(path, out int value);
+
+        result.Should().BeTrue();
+        value.Should().Be(1);
+    }
+
+    [Theory]
+    [InlineData(@"C:\Game\Data\data.unity3d.modified")]
+    [InlineData(@"C:\Game\Data\data")]
+    [InlineData("")]
+    public void TryMatch_DoesNotMatchExactPath_WhenPathIsDifferent(string path)
+    {
+        FilePathIndex<int> sut = new([(FilePathMatcher.ExactPath(@"C:\Game\Data\data.unity3d"), 1)]);
+
+        bool result = sut.TryMatch(path, out _);
+
+        result.Should().BeFalse();
+    }
+
+    [Theory]
+    [InlineData(@"C:\Users\AppData\LocalLow\Moonsprout Games\Bug Fables\Player.log", true)]
+    [InlineData("stuff/player.LOG", true)]
+    [InlineData("Player.log", true)]
+    [InlineData("Player.log.txt", false)]
+    [InlineData("layer.log", false)]
+    public void TryMatch_MatchesFileNameSuffix_WhenPathEndsWithSuffix(string path, bool expectedResult)
+    {
+        FilePathIndex<int> sut = new([(FilePathMatcher.FileNameSuffix("Player.log"), 1)]);
+
+        bool result = sut.TryMatch(path, out _);
+
+        result.Should().Be(expectedResult);
+    }
+
+    [Theory]
+    [InlineData(@"C:\Game\Data\Managed\Bud.dll", true)]
+    [InlineData(@"C:\Game\Data\Managed\Sub\Bud.dll", true)]
+    [InlineData("c:/game/data/managed/Bud.dll", true)]
+    [InlineData(@"C:\Game\Data\ManagedOther\Bud.dll", false)]
+    [InlineData(@"C:\Game\Data\Managed", false)]
+    [InlineData(@"C:\Game\Data\Bud.dll", false)]
+    public void TryMatch_MatchesDirectoryPrefix_WhenPathIsUnderDirectory(string path, bool expectedResult)
+    {
+        FilePathIndex<int> sut = new([(FilePathMatcher.DirectoryPrefix(@"C:\Game\Data\Managed\"), 1)]);
+
+        bool result = sut.TryMatch(path, out _);
+
+        result.Should().Be(expectedResult);
+    }
+
+    [Fact]
+    public void TryMatch_ReturnsFirstAddedMatcherValue_WhenMultipleMatchersMatch()
+    {
+        FilePathIndex<int> sut = new(
+        [
+            (FilePathMatcher.FileNameSuffix("other.dll"), 1),
+            (FilePathMatcher.DirectoryPrefix(@"C:\Game"), 2),
+            (FilePathMatcher.FileNameSuffix(".dll"), 3),
+            (FilePathMatcher.ExactPath(@"C:\Game\Bud.dll"), 4)
+        ]);
+
+        bool result = sut.TryMatch(@"C:\Game\Bud.dll", out int value);
+
+        result.Should().BeTrue();
+        value.Should().Be(2);
+    }
+
+    [Fact]
+    public void TryMatch_ReturnsFalse_WhenIndexIsEmpty()
+    {
+        bool result = FilePathIndex<int>.Empty.TryMatch(@"C:\Game\Bud.dll", out _);
+
+        result.Should().BeFalse();
+        FilePathIndex<int>.Empty.IsEmpty.Should().BeTrue();
+    }
+}
\ No newline at end of file
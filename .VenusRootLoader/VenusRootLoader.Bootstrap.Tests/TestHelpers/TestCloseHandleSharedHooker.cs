@@ -0,0 +1,27 @@
+using VenusRootLoader.Bootstrap.Shared;
+using Windows.Win32.Foundation;
+
+namespace VenusRootLoader.Bootstrap.Tests.TestHelpers;
+
+public sealed class TestCloseHandleSharedHooker : ICloseHandleSharedHooker
+{
+    internal Dictionary<string, CloseHandleSharedHooker.CloseHandleHook> Hooks { get; } = new();
+
+    public void RegisterHook(string name, CloseHandleSharedHooker.CloseHandleHook hook)
+    {
+        Hooks.Add(name, hook);
+    }
+
+    public void UnregisterHook(string name)
+    {
+        Hooks.Remove(name);
+    }
+
+    public bool SimulateHook(HANDLE handle)
+    {
+        bool preventClose = false;
+        foreach (CloseHandleSharedHooker.CloseHandleHook hook in Hooks.Values.ToList())
+            preventClose |= hook(handle);
+        return preventClose;
+    }
+}
\ No newline at end of file
@@ -5,14 +5,17 @@ namespace VenusRootLoader.Bootstrap.Tests.TestHelpers;
 
 public sealed class TestCreateFileWSharedHooker : ICreateFileWSharedHooker
 {
-    internal Dictionary<string, (Func<string, bool> Predicate, CreateFileWSharedHooker.CreateFileWHook Hook)> Hooks
+    internal Dictionary<string, (FilePathMatcher[] Matchers, CreateFileWSharedHooker.CreateFileWHook Hook)> Hooks
     {
         get;
     } = new();
 
-    public void RegisterHook(string name, Func<string, bool> predicate, CreateFileWSharedHooker.CreateFileWHook hook)
+    public void RegisterHook(
+        string name,
+        IEnumerable<FilePathMatcher> matchers,
+        CreateFileWSharedHooker.CreateFileWHook hook)
     {
-        Hooks.Add(name, (predicate, hook));
+        Hooks.Add(name, (matchers.ToArray(), hook));
     }
 
     public void UnregisterHook(string name)
@@ -22,15 +25,12 @@ public sealed class TestCreateFileWSharedHooker : ICreateFileWSharedHooker
 
     public unsafe HANDLE? SimulateHook(PCWSTR fileName)
     {
-        foreach (KeyValuePair<string, (Func<string, bool> Predicate, CreateFileWSharedHooker.CreateFileWHook Hook)> hook
-                 in Hooks)
-        {
-            if (!hook.Value.Predicate(fileName.ToString()))
-                continue;
-            hook.Value.Hook(out HANDLE handle, fileName, 0u, default, null, default, default, default);
-            return handle;
-        }
+        FilePathIndex<CreateFileWSharedHooker.CreateFileWHook> index = new(
+            Hooks.Values.SelectMany(h => h.Matchers.Select(matcher => (matcher, h.Hook))));
+        if (!index.TryMatch(fileName.AsSpan(), out CreateFileWSharedHooker.CreateFileWHook? hook))
+            return null;
 
-        return null;
+        hook(out HANDLE handle, fileName, 0u, default, null, default, default, default);
+        return handle;
     }
 }
\ No newline at end of file
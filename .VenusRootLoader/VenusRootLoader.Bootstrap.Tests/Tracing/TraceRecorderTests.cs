@@ -0,0 +1,106 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging.Testing;
+using Microsoft.Extensions.Options;
+using Microsoft.Extensions.Time.Testing;
+using NSubstitute;
+using System.IO.Abstractions.TestingHelpers;
+using System.Text.Json;
+using VenusRootLoader.Bootstrap.Settings;
+using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tracing;
+
+namespace VenusRootLoader.Bootstrap.Tests.Tracing;
+
+public sealed class TraceRecorderTests
+{
+    private const uint ThreadId = 42;
+
+    private static readonly string RootPath =
+        Path.Combine(Directory.GetDirectoryRoot(Directory.GetCurrentDirectory()), "root");
+
+    private static readonly string TraceFilePath = Path.Combine(RootPath, "Logs", "trace.json");
+
+    private readonly IOptions<TracingSettings> _tracingSettings = Substitute.For<IOptions<TracingSettings>>();
+    private readonly IBootstrapEnvironment _bootstrapEnvironment = Substitute.For<IBootstrapEnvironment>();
+    private readonly IWin32 _win32 = Substitute.For<IWin32>();
+    private readonly FakeTimeProvider _timeProvider = new();
+    private readonly FakeLogger<TraceRecorder> _logger = new();
+    private readonly MockFileSystem _fileSystem = new();
+
+    public TraceRecorderTests()
+    {
+        _bootstrapEnvironment.BasePath.Returns(RootPath);
+        _win32.GetCurrentThreadId().Returns(ThreadId);
+    }
+
+    [Fact]
+    public void BeginSpan_DoesNotWriteATraceFile_WhenTracingIsDisabled()
+    {
+        _tracingSettings.Value.Returns(new TracingSettings { Enable = false });
+        TraceRecorder sut = CreateSut();
+
+        using (sut.BeginSpan("Span", "Category"))
+            _timeProvider.Advance(TimeSpan.FromMilliseconds(1));
+        sut.Dispose();
+
+        sut.IsEnabled.Should().BeFalse();
+        _fileSystem.File.Exists(TraceFilePath).Should().BeFalse();
+        _win32.DidNotReceive().GetCurrentThreadId();
+    }
+
+    [Fact]
+    public void BeginSpan_WritesTheBeginAndEndEventsOfTheSpan_WhenTracingIsEnabled()
+    {
+        _tracingSettings.Value.Returns(new TracingSettings { Enable = true });
+        TraceRecorder sut = CreateSut();
+
+        _timeProvider.Advance(TimeSpan.FromMilliseconds(2));
+        using (sut.BeginSpan("Span", "Category"))
+            _timeProvider.Advance(TimeSpan.FromMilliseconds(1));
+        sut.Dispose();
+
+        using JsonDocument trace = JsonDocument.Parse(_fileSystem.File.ReadAllText(TraceFilePath));
+        JsonElement[] spanEvents = trace.RootElement.EnumerateArray()
+            .Where(e => e.GetProperty("ph").GetString() != "M")
+            .ToArray();
+        spanEvents.Should().HaveCount(2);
+        spanEvents.Should().AllSatisfy(e =>
+        {
+            e.GetProperty("name").GetString().Should().Be("Span");
+            e.GetProperty("cat").GetString().Should().Be("Category");
+            e.GetProperty("tid").GetUInt32().Should().Be(ThreadId);
+            e.GetProperty("pid").GetInt32().Should().Be(Environment.ProcessId);
+        });
+        spanEvents[0].GetProperty("ph").GetString().Should().Be("B");
+        spanEvents[0].GetProperty("ts").GetDouble().Should().Be(2000);
+        spanEvents[1].GetProperty("ph").GetString().Should().Be("E");
+        spanEvents[1].GetProperty("ts").GetDouble().Should().Be(3000);
+        spanEvents[1].GetProperty("args").GetProperty("allocatedBytes").GetInt64().Should().BeGreaterThanOrEqualTo(0);
+        spanEvents[1].GetProperty("args").GetProperty("gcCount").GetInt32().Should().BeGreaterThanOrEqualTo(0);
+    }
+
+    [Fact]
+    public void RecordEvent_WritesTheEventsRelayedFromTheManagedSide_WhenTracingIsEnabled()
+    {
+        _tracingSettings.Value.Returns(new TracingSettings { Enable = true });
+        TraceRecorder sut = CreateSut();
+
+        sut.RecordEvent(TraceEventPhase.Begin, "Collector", "BaseGameCollector", 0, 0);
+        sut.RecordEvent(TraceEventPhase.End, "Collector", "BaseGameCollector", 1024, 1);
+        sut.Dispose();
+
+        using JsonDocument trace = JsonDocument.Parse(_fileSystem.File.ReadAllText(TraceFilePath));
+        JsonElement endEvent = trace.RootElement.EnumerateArray().Last();
+        endEvent.GetProperty("ph").GetString().Should().Be("E");
+        endEvent.GetProperty("args").GetProperty("allocatedBytes").GetInt64().Should().Be(1024);
+        endEvent.GetProperty("args").GetProperty("gcCount").GetInt32().Should().Be(1);
+    }
+
+    private TraceRecorder CreateSut() => new(
+        _tracingSettings,
+        _bootstrapEnvironment,
+        _fileSystem,
+        _timeProvider,
+        _win32,
+        _logger);
+}
\ No newline at end of file
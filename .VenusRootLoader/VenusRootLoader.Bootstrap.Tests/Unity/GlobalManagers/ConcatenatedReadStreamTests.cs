@@ -0,0 +1,65 @@
+using AwesomeAssertions;
+using VenusRootLoader.Bootstrap.Unity.GlobalManagers;
+
+namespace VenusRootLoader.Bootstrap.Tests.Unity.GlobalManagers;
+
+public sealed class ConcatenatedReadStreamTests
+{
+    private readonly MemoryStream _firstStream = new([0, 1, 2, 3, 4, 5, 6, 7]);
+    private readonly MemoryStream _secondStream = new([10, 11, 12]);
+
+    [Fact]
+    public void Read_ReadsTheSegmentsOneAfterTheOther_WhenSegmentsComeFromSeveralStreams()
+    {
+        using ConcatenatedReadStream sut = new(
+        [
+            new(_firstStream, 5, 3),
+            new(_secondStream, 0, 0),
+            new(_secondStream, 0, 3),
+            new(_firstStream, 1, 2)
+        ]);
+        using MemoryStream result = new();
+
+        sut.CopyTo(result, 2);
+
+        sut.Length.Should().Be(8);
+        result.ToArray().Should().Equal(5, 6, 7, 10, 11, 12, 1, 2);
+    }
+
+    [Fact]
+    public void Read_ReadsFromTheMiddleOfASegment_WhenPositionWasSeeked()
+    {
+        using ConcatenatedReadStream sut = new([new(_firstStream, 0, 4), new(_secondStream, 0, 3)]);
+        byte[] buffer = new byte[4];
+
+        sut.Seek(-5, SeekOrigin.End);
+        int read = sut.Read(buffer, 0, buffer.Length);
+
+        read.Should().Be(4);
+        buffer.Should().Equal(2, 3, 10, 11);
+        sut.Position.Should().Be(6);
+    }
+
+    [Fact]
+    public void Read_ReadsNothing_WhenPositionIsAtTheEnd()
+    {
+        using ConcatenatedReadStream sut = new([new(_firstStream, 0, 4)]);
+        byte[] buffer = new byte[4];
+        sut.Position = 4;
+
+        int read = sut.Read(buffer, 0, buffer.Length);
+
+        read.Should().Be(0);
+    }
+
+    [Fact]
+    public void Read_ThrowsEndOfStreamException_WhenASegmentIsLongerThanItsStream()
+    {
+        using ConcatenatedReadStream sut = new([new(_secondStream, 1, 5)]);
+        byte[] buffer = new byte[5];
+
+        Action act = () => sut.ReadExactly(buffer);
+
+        act.Should().Throw<EndOfStreamException>();
+    }
+}
\ No newline at end of file
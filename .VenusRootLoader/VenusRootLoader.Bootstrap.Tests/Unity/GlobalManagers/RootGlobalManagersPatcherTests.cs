@@ -0,0 +1,174 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Testing;
+using NSubstitute;
+using System.IO.Abstractions;
+using System.IO.Abstractions.TestingHelpers;
+using System.Security.Cryptography;
+using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tests.TestHelpers;
+using VenusRootLoader.Bootstrap.Tracing;
+using VenusRootLoader.Bootstrap.Unity.GlobalManagers;
+
+namespace VenusRootLoader.Bootstrap.Tests.Unity.GlobalManagers;
+
+public sealed class RootGlobalManagersPatcherTests
+{
+    private static readonly string GameDir =
+        Path.Combine(Directory.GetDirectoryRoot(Directory.GetCurrentDirectory()), "game");
+
+    private static readonly string DataDir = Path.Combine(GameDir, "Bug Fables_Data");
+    private static readonly string GameBundlePath = Path.Combine(DataDir, "data.unity3d");
+    private static readonly string ModifiedGameBundlePath =
+        Path.Combine(GameDir, "VenusRootLoader", "data.unity3d.modified");
+    private static readonly string FingerprintPath = ModifiedGameBundlePath + ".fingerprint";
+
+    private static readonly DateTime OriginalLastWriteTimeUtc = new(2025, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+    private static readonly byte[] OriginalBundleContent = [1, 2, 3, 4];
+
+    private readonly IGlobalManagersPatcher _globalManagersPatcher = Substitute.For<IGlobalManagersPatcher>();
+    private readonly FakeLogger<RootGlobalManagersPatcher> _logger = new();
+    private readonly TestCreateFileWSharedHooker _createFileWSharedHooker = new();
+    private readonly IWin32 _win32 = Substitute.For<IWin32>();
+    private readonly ITraceRecorder _traceRecorder = Substitute.For<ITraceRecorder>();
+    private readonly MockFileSystem _fileSystem = new();
+
+    private readonly GameExecutionContext _gameExecutionContext = new()
+    {
+        GameDir = GameDir,
+        DataDir = DataDir,
+        UnityPlayerDllFileName = "UnityPlayer.dll",
+        IsWine = false
+    };
+
+    private readonly RootGlobalManagersPatcher _sut;
+
+    public RootGlobalManagersPatcherTests()
+    {
+        _globalManagersPatcher.GetInputsFingerprint().Returns("inputs");
+        _fileSystem.AddFile(GameBundlePath, new MockFileData(OriginalBundleContent));
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, OriginalLastWriteTimeUtc);
+        _fileSystem.AddFile(ModifiedGameBundlePath, new MockFileData([5, 6]));
+        _sut = new(
+            [_globalManagersPatcher],
+            _logger,
+            _createFileWSharedHooker,
+            _gameExecutionContext,
+            _win32,
+            _fileSystem,
+            _traceRecorder);
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsTrue_WhenTheFingerprintMatches()
+    {
+        string patchersInputsHash = _sut.ComputePatchersInputsHash();
+        WriteOriginalBundleFingerprint(patchersInputsHash);
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), patchersInputsHash);
+
+        upToDate.Should().BeTrue();
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsFalse_WhenTheModifiedBundleIsMissing()
+    {
+        string patchersInputsHash = _sut.ComputePatchersInputsHash();
+        WriteOriginalBundleFingerprint(patchersInputsHash);
+        _fileSystem.File.Delete(ModifiedGameBundlePath);
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), patchersInputsHash);
+
+        upToDate.Should().BeFalse();
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsFalse_WhenThePatchersInputsChanged()
+    {
+        WriteOriginalBundleFingerprint(_sut.ComputePatchersInputsHash());
+        _globalManagersPatcher.GetInputsFingerprint().Returns("other inputs");
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), _sut.ComputePatchersInputsHash());
+
+        upToDate.Should().BeFalse();
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsFalse_WhenTheOriginalBundleSizeChanged()
+    {
+        string patchersInputsHash = _sut.ComputePatchersInputsHash();
+        WriteOriginalBundleFingerprint(patchersInputsHash);
+        _fileSystem.File.WriteAllBytes(GameBundlePath, [1, 2, 3, 4, 5]);
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, OriginalLastWriteTimeUtc);
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), patchersInputsHash);
+
+        upToDate.Should().BeFalse();
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsTrueAndRefreshesTheFingerprint_WhenOnlyTheLastWriteTimeChanged()
+    {
+        string patchersInputsHash = _sut.ComputePatchersInputsHash();
+        WriteOriginalBundleFingerprint(patchersInputsHash);
+        DateTime newLastWriteTimeUtc = OriginalLastWriteTimeUtc.AddDays(1);
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, newLastWriteTimeUtc);
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), patchersInputsHash);
+
+        upToDate.Should().BeTrue();
+        _sut.TryReadFingerprint(out RootGlobalManagersPatcher.BundleFingerprint fingerprint).Should().BeTrue();
+        fingerprint.OriginalBundleLastWriteTimeUtcTicks.Should().Be(newLastWriteTimeUtc.Ticks);
+        _fileSystem.File.Exists(FingerprintPath + ".tmp").Should().BeFalse();
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsFalse_WhenTheOriginalBundleContentChanged()
+    {
+        string patchersInputsHash = _sut.ComputePatchersInputsHash();
+        WriteOriginalBundleFingerprint(patchersInputsHash);
+        _fileSystem.File.WriteAllBytes(GameBundlePath, [4, 3, 2, 1]);
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, OriginalLastWriteTimeUtc.AddDays(1));
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), patchersInputsHash);
+
+        upToDate.Should().BeFalse();
+    }
+
+    [Fact]
+    public void IsModifiedGameBundleUpToDate_ReturnsFalse_WhenTheFingerprintIsInvalid()
+    {
+        string patchersInputsHash = _sut.ComputePatchersInputsHash();
+        _fileSystem.File.WriteAllLines(FingerprintPath, ["not a size", "0"]);
+
+        bool upToDate = _sut.IsModifiedGameBundleUpToDate(OriginalBundleInfo(), patchersInputsHash);
+
+        upToDate.Should().BeFalse();
+        _logger.Collector.GetSnapshot().Should().ContainSingle(l => l.Level == LogLevel.Warning);
+    }
+
+    [Fact]
+    public void WriteFingerprint_ReplacesTheExistingFingerprintWithoutLeavingATemporaryFile_WhenCalled()
+    {
+        _fileSystem.File.WriteAllText(FingerprintPath, "old");
+        RootGlobalManagersPatcher.BundleFingerprint fingerprint = new(1, 2, "hash", "inputs");
+
+        _sut.WriteFingerprint(fingerprint);
+
+        _sut.TryReadFingerprint(out RootGlobalManagersPatcher.BundleFingerprint readFingerprint).Should().BeTrue();
+        readFingerprint.Should().Be(fingerprint);
+        _fileSystem.File.Exists(FingerprintPath + ".tmp").Should().BeFalse();
+    }
+
+    private IFileInfo OriginalBundleInfo() => _fileSystem.FileInfo.New(GameBundlePath);
+
+    private void WriteOriginalBundleFingerprint(string patchersInputsHash)
+    {
+        _sut.WriteFingerprint(
+            new(
+                OriginalBundleContent.Length,
+                OriginalLastWriteTimeUtc.Ticks,
+                Convert.ToHexString(SHA256.HashData(OriginalBundleContent)),
+                patchersInputsHash));
+    }
+}
\ No newline at end of file
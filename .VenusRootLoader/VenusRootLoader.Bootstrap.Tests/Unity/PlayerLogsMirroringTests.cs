@@ -33,6 +33,7 @@ public sealed class PlayerLogsMirroringTests
     private readonly IWin32 _win32 = Substitute.For<IWin32>();
     private readonly IMonoInitLifeCycleEvents _monoInitLifeCycleEvents = new MonoInitLifeCycleEvents();
     private readonly TestCreateFileWSharedHooker _createFileWSharedHooker = new();
+    private readonly TestCloseHandleSharedHooker _closeHandleSharedHooker = new();
 
     private readonly GameExecutionContext _gameExecutionContext = new()
     {
@@ -53,6 +54,7 @@ public sealed class PlayerLogsMirroringTests
             _loggerFactory,
             _pltHooksManager,
             _createFileWSharedHooker,
+            _closeHandleSharedHooker,
             _gameExecutionContext,
             _monoInitLifeCycleEvents,
             _win32);
@@ -67,6 +69,7 @@ public sealed class PlayerLogsMirroringTests
         _pltHooksManager.Hooks.Should()
             .ContainKey((_gameExecutionContext.UnityPlayerDllFileName, nameof(_win32.WriteFile)));
         _createFileWSharedHooker.Hooks.Should().ContainKey(nameof(PlayerLogsMirroring));
+        _closeHandleSharedHooker.Hooks.Should().ContainKey(nameof(PlayerLogsMirroring));
     }
 
     [Theory]
@@ -324,6 +327,76 @@ public sealed class PlayerLogsMirroringTests
         Marshal.FreeHGlobal((nint)messagePtr);
     }
 
+    [Fact]
+    public void WriteFileHook_ClassifiesHandleOnlyOnce_WhenWritingToTheSameHandleMultipleTimes()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        _sut.MirrorLogs();
+
+        SimulateWriteFile(handle, "first write");
+        SimulateWriteFile(handle, "second write");
+
+        _win32.ReceivedWithAnyArgs(3).CompareObjectHandles(default, default);
+        _win32.Received(2).WriteFile(handle, Arg.Any<Pointer<byte>>(), Arg.Any<uint>(), default, default);
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void WriteFileHook_ClassifiesHandleAgain_WhenItWasClosed()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        _sut.MirrorLogs();
+
+        SimulateWriteFile(handle, "first write");
+        bool preventedClose = _closeHandleSharedHooker.SimulateHook(handle);
+        SimulateWriteFile(handle, "second write");
+
+        preventedClose.Should().BeFalse();
+        _win32.ReceivedWithAnyArgs(6).CompareObjectHandles(default, default);
+    }
+
+    [Fact]
+    public void WriteFileHook_OnlyLogsCompleteLines_WhenALineIsSplitAcrossWrites()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        _win32.GetStdHandle(STD_HANDLE.STD_OUTPUT_HANDLE).Returns(handle);
+        _win32.CompareObjectHandles(
+                Arg.Any<HANDLE>(),
+                Arg.Any<HANDLE>())
+            .ReturnsForAnyArgs(c => (BOOL)(c.ArgAt<HANDLE>(0) == c.ArgAt<HANDLE>(1)));
+        _sut.MirrorLogs();
+
+        SimulateWriteFile(handle, "Some logging");
+        _logger.Collector.Count.Should().Be(0);
+        SimulateWriteFile(handle, " message\r\nSome other");
+        _logger.Collector.Count.Should().Be(1);
+        _logger.LatestRecord.Message.Should().Be("Some logging message");
+        SimulateWriteFile(handle, " logging message\r\n");
+
+        _logger.Collector.Count.Should().Be(2);
+        _logger.LatestRecord.Level.Should().Be(LogLevel.Trace);
+        _logger.LatestRecord.Message.Should().Be("Some other logging message");
+    }
+
+    [Fact]
+    public void CloseHandleHook_LogsIncompleteLine_WhenMirroredHandleIsClosed()
+    {
+        HANDLE handle = (HANDLE)Random.Shared.Next();
+        _win32.GetStdHandle(STD_HANDLE.STD_ERROR_HANDLE).Returns(handle);
+        _win32.CompareObjectHandles(
+                Arg.Any<HANDLE>(),
+                Arg.Any<HANDLE>())
+            .ReturnsForAnyArgs(c => (BOOL)(c.ArgAt<HANDLE>(0) == c.ArgAt<HANDLE>(1)));
+        _sut.MirrorLogs();
+
+        SimulateWriteFile(handle, "Some logging message without line ending");
+        _logger.Collector.Count.Should().Be(0);
+        _closeHandleSharedHooker.SimulateHook(handle);
+
+        _logger.Collector.Count.Should().Be(1);
+        _logger.LatestRecord.Message.Should().Be("Some logging message without line ending");
+    }
+
     [Fact]
     public unsafe void OnGameLifeCycle_UninstallPltHook_WhenMonoInitialisedEventReceived()
     {
@@ -337,4 +410,18 @@ public sealed class PlayerLogsMirroringTests
 
         Marshal.FreeHGlobal((nint)fileNamePtr);
     }
+
+    private unsafe void SimulateWriteFile(HANDLE handle, string message)
+    {
+        byte* messagePtr = (byte*)Marshal.StringToHGlobalAnsi(message);
+        _pltHooksManager.SimulateHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(_win32.WriteFile),
+            handle,
+            (nint)messagePtr,
+            (uint)message.Length,
+            null,
+            null);
+        Marshal.FreeHGlobal((nint)messagePtr);
+    }
 }
\ No newline at end of file
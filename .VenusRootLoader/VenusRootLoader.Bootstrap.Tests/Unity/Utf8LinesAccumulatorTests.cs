@@ -0,0 +1,39 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging.Testing;
+using System.Text;
+using VenusRootLoader.Bootstrap.Unity;
+
+namespace VenusRootLoader.Bootstrap.Tests.Unity;
+
+public sealed class Utf8LinesAccumulatorTests
+{
+    private readonly FakeLogger _logger = new();
+    private readonly Utf8LinesAccumulator _sut;
+
+    public Utf8LinesAccumulatorTests() => _sut = new(_logger);
+
+    [Fact]
+    public void Append_LogsUpToTheLastCompleteCodePoint_WhenTheMaxPendingBytesSplitsACodePoint()
+    {
+        string text = new('a', Utf8LinesAccumulator.MaxPendingBytes - 1);
+        byte[] codePoint = "€"u8.ToArray();
+
+        _sut.Append(Encoding.UTF8.GetBytes(text));
+        _sut.Append(codePoint.AsSpan(0, 1));
+        _sut.Append(codePoint.AsSpan(1));
+        _sut.Append("b\n"u8);
+
+        _logger.Collector.GetSnapshot().Select(r => r.Message).Should().Equal(text, "€b");
+    }
+
+    [Fact]
+    public void Append_LogsEveryPendingByte_WhenTheMaxPendingBytesEndsOnACompleteCodePoint()
+    {
+        string text = new string('a', Utf8LinesAccumulator.MaxPendingBytes - 3) + "€";
+
+        _sut.Append(Encoding.UTF8.GetBytes(text));
+        _sut.Append("b\n"u8);
+
+        _logger.Collector.GetSnapshot().Select(r => r.Message).Should().Equal(text, "b");
+    }
+}
\ No newline at end of file
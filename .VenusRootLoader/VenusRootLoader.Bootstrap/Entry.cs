@@ -11,6 +11,7 @@ using VenusRootLoader.Bootstrap.Logging;
 using VenusRootLoader.Bootstrap.Mono;
 using VenusRootLoader.Bootstrap.Settings;
 using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tracing;
 using VenusRootLoader.Bootstrap.Unity;
 using VenusRootLoader.Bootstrap.Unity.GlobalManagers;
 using Windows.Win32;
@@ -24,10 +25,13 @@ using Environment = System.Environment;
 namespace VenusRootLoader.Bootstrap;
 
 /// <summary>
-/// This class contains the entrypoint method from the C++ native side, and it initialises the rest of the bootstrap
+/// This class contains the entrypoint method from the C++ native side, and it initialises the rest of the bootstrap.
+/// It also contains the exit point method the C++ side calls once the game exits which shuts the bootstrap down
 /// </summary>
 internal sealed class Entry
 {
+    private static ServiceProvider? _serviceProvider;
+
     [UnmanagedCallersOnly(EntryPoint = "EntryPoint")]
     public static void EntryPoint(nint module)
     {
@@ -69,7 +73,14 @@ internal sealed class Entry
                 PInvoke.DestroyWindow(consoleWindow);
             }
 
+            _serviceProvider = serviceProvider;
+            CrashLogsDrainer crashLogsDrainer = serviceProvider.GetRequiredService<CrashLogsDrainer>();
+            crashLogsDrainer.DrainLogsOnCrash();
+
             ManagedLogsRelay.Init(serviceProvider.GetRequiredService<ILoggerFactory>());
+            ITraceRecorder traceRecorder = serviceProvider.GetRequiredService<ITraceRecorder>();
+            ManagedTracesRelay.Init(traceRecorder);
+            using TraceSpan entryPointSpan = traceRecorder.BeginSpan("Bootstrap entrypoint", "Bootstrap");
 
             logger = serviceProvider.GetRequiredService<ILogger<Entry>>();
             logger.LogInformation("Using base directory {BaseDir}", customContentRootPath);
@@ -99,6 +110,28 @@ internal sealed class Entry
         }
     }
 
+    [UnmanagedCallersOnly(EntryPoint = "ExitPoint")]
+    public static void ExitPoint(uint exitCode)
+    {
+        if (_serviceProvider is null)
+            return;
+
+        try
+        {
+            ILogger logger = _serviceProvider.GetRequiredService<ILogger<Entry>>();
+            logger.LogInformation("UnityMain returned with exit code {ExitCode}, shutting down", exitCode);
+
+            // The runtime doesn't reliably raise ProcessExit when it's hosted in a native library so this is where
+            // the logs and traces still queued get written and their files closed
+            _serviceProvider.Dispose();
+            _serviceProvider = null;
+        }
+        catch (Exception)
+        {
+            // The game is exiting either way and an exception can't go back to the native side
+        }
+    }
+
     private static bool ShouldResumeEntry(
         [NotNullWhen(true)] out GameExecutionContext? gameExecutionContext,
         [NotNullWhen(true)] out string[]? args)
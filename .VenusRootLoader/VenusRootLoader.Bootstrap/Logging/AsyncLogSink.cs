@@ -0,0 +1,385 @@
+using Microsoft.Extensions.Logging;
+using System.Numerics;
+using VenusRootLoader.Bootstrap.Settings.LogProvider;
+
+namespace VenusRootLoader.Bootstrap.Logging;
+
+/// <summary>
+/// Moves the formatting and writing of log entries off the logging threads which are usually Unity's main thread.
+/// Loggers enqueue a <see cref="LogEntry"/> in a lock-free bounded ring buffer and a dedicated writer thread drains it
+/// in batches, writing every entry of a batch before flushing the destination once.
+/// When the buffer is full, the <see cref="LogOverflowPolicy"/> decides if the logging thread waits for the writer
+/// thread to make room or if an entry gets dropped. <see cref="LogLevel.Error"/> and <see cref="LogLevel.Critical"/>
+/// entries are always flushed before the logging call returns and the remaining entries are flushed when the sink gets
+/// disposed on exit or drained from the thread of a crash by <see cref="DrainAllSinks"/>
+/// </summary>
+public sealed class AsyncLogSink : IDisposable
+{
+    // A slot of the ring buffer. The sequence tells if the slot is free to be written at a given enqueue position or
+    // if it holds an entry ready to be read at a given dequeue position. See Dmitry Vyukov's bounded MPMC queue
+    private struct Slot
+    {
+        internal long Sequence;
+        internal LogEntry Entry;
+    }
+
+    private const int MaxBatchSize = 256;
+
+    // Waiting for the writer's progress is only bounded so a writer thread that died can't block the logging threads
+    private const int ProgressWaitTimeoutMilliseconds = 100;
+
+    // The writer thread wakes up at least this often so an entry never stays queued longer than this, even if the
+    // signal of its enqueue got missed
+    private const int MaxWriterIdleMilliseconds = 1000;
+
+    // A crash can happen while the writer thread is writing so draining waits for it to finish its batch, but not
+    // forever because the writer thread might be the one that crashed or it might be stuck in the destination
+    private const int DrainWriteLockTimeoutMilliseconds = 500;
+
+    private static readonly Lock LiveSinksLock = new();
+    private static volatile AsyncLogSink[] _liveSinks = [];
+
+    private readonly Slot[] _slots;
+    private readonly long _indexMask;
+    private readonly LogOverflowPolicy _overflowPolicy;
+    private readonly Action? _flushDestination;
+    private readonly AutoResetEvent _writerSignal = new(false);
+    private readonly object _progressLock = new();
+    private readonly object _writeLock = new();
+    private readonly Thread _writerThread;
+
+    private long _enqueuePosition;
+    private long _dequeuePosition;
+    private long _completedPosition;
+    private long _droppedEntriesCount;
+    private int _writerIsWaiting;
+    private int _progressWaitersCount;
+    private volatile bool _disposed;
+
+    /// <summary>
+    /// The amount of entries that were discarded due to the <see cref="LogOverflowPolicy"/>
+    /// </summary>
+    public long DroppedEntriesCount => Interlocked.Read(ref _droppedEntriesCount);
+
+    /// <summary>
+    /// The amount of entries currently waiting to be written
+    /// </summary>
+    public int QueueDepth =>
+        (int)Math.Max(0, Interlocked.Read(ref _enqueuePosition) - Interlocked.Read(ref _dequeuePosition));
+
+    public AsyncLogSink(int capacity, LogOverflowPolicy overflowPolicy, Action? flushDestination, string threadName)
+    {
+        int slotsCount = (int)BitOperations.RoundUpToPowerOf2((uint)capacity);
+        _slots = new Slot[slotsCount];
+        for (int i = 0; i < slotsCount; i++)
+            _slots[i].Sequence = i;
+        _indexMask = slotsCount - 1;
+        _overflowPolicy = overflowPolicy;
+        _flushDestination = flushDestination;
+
+        _writerThread = new(WriterLoop)
+        {
+            Name = threadName,
+            IsBackground = true
+        };
+        _writerThread.Start();
+
+        lock (LiveSinksLock)
+            _liveSinks = [.._liveSinks, this];
+        AppDomain.CurrentDomain.ProcessExit += OnProcessExit;
+        AppDomain.CurrentDomain.UnhandledException += OnUnhandledException;
+    }
+
+    /// <summary>
+    /// Drains every sink that isn't disposed with <see cref="Drain"/>. This is meant to be called when the process is
+    /// about to crash
+    /// </summary>
+    public static void DrainAllSinks()
+    {
+        foreach (AsyncLogSink sink in _liveSinks)
+            sink.Drain();
+    }
+
+    public void Enqueue(in LogEntry entry)
+    {
+        // Once disposed, there's no writer thread anymore so we just write synchronously
+        if (_disposed)
+        {
+            WriteEntrySafely(entry);
+            _flushDestination?.Invoke();
+            return;
+        }
+
+        while (!TryEnqueue(entry))
+        {
+            if (_overflowPolicy == LogOverflowPolicy.DropOldest)
+            {
+                if (TryDequeue(out _))
+                    Interlocked.Increment(ref _droppedEntriesCount);
+                continue;
+            }
+
+            if (_overflowPolicy == LogOverflowPolicy.DropTrace && entry.LogLevel == LogLevel.Trace)
+            {
+                Interlocked.Increment(ref _droppedEntriesCount);
+                return;
+            }
+
+            if (EnqueueOnceWriterMadeRoom(entry))
+                break;
+
+            // The sink got disposed while waiting so there's no writer thread anymore
+            WriteEntrySafely(entry);
+            _flushDestination?.Invoke();
+            return;
+        }
+
+        if (Interlocked.Exchange(ref _writerIsWaiting, 0) == 1)
+            _writerSignal.Set();
+
+        // These entries are likely to precede a crash so they can't be left in the queue
+        if (entry.LogLevel >= LogLevel.Error)
+            Flush();
+    }
+
+    /// <summary>
+    /// Blocks until every entry enqueued before the call has been written and flushed
+    /// </summary>
+    public void Flush()
+    {
+        if (_disposed)
+            return;
+
+        long targetPosition = Interlocked.Read(ref _enqueuePosition);
+        if (Interlocked.Read(ref _completedPosition) >= targetPosition)
+            return;
+
+        Interlocked.Increment(ref _progressWaitersCount);
+        try
+        {
+            lock (_progressLock)
+            {
+                while (Interlocked.Read(ref _completedPosition) < targetPosition && _writerThread.IsAlive)
+                {
+                    WakeWriter();
+                    Monitor.Wait(_progressLock, ProgressWaitTimeoutMilliseconds);
+                }
+            }
+        }
+        finally
+        {
+            Interlocked.Decrement(ref _progressWaitersCount);
+        }
+    }
+
+    /// <summary>
+    /// Writes every queued entry from the calling thread and flushes the destination without waiting on the writer
+    /// thread. This is meant for when the process is about to crash where the writer thread might never get to them
+    /// </summary>
+    public void Drain()
+    {
+        if (_disposed)
+            return;
+
+        bool lockTaken = false;
+        try
+        {
+            Monitor.TryEnter(_writeLock, DrainWriteLockTimeoutMilliseconds, ref lockTaken);
+            while (TryDequeue(out LogEntry entry))
+                WriteEntrySafely(entry);
+            FlushDestinationSafely();
+            CompleteDequeuedEntries();
+        }
+        finally
+        {
+            if (lockTaken)
+                Monitor.Exit(_writeLock);
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+
+        _disposed = true;
+        lock (LiveSinksLock)
+            _liveSinks = _liveSinks.Where(s => s != this).ToArray();
+        AppDomain.CurrentDomain.ProcessExit -= OnProcessExit;
+        AppDomain.CurrentDomain.UnhandledException -= OnUnhandledException;
+        _writerSignal.Set();
+        _writerThread.Join();
+
+        // Entries enqueued while the writer was exiting are written here
+        while (TryDequeue(out LogEntry entry))
+            WriteEntrySafely(entry);
+        _flushDestination?.Invoke();
+        SignalProgress();
+        _writerSignal.Dispose();
+    }
+
+    private void OnProcessExit(object? sender, EventArgs e) => Dispose();
+
+    private void OnUnhandledException(object sender, UnhandledExceptionEventArgs e) => Drain();
+
+    private void WakeWriter()
+    {
+        Interlocked.Exchange(ref _writerIsWaiting, 0);
+        _writerSignal.Set();
+    }
+
+    // Waits for the writer to dequeue entries until the given one fits in the queue. Returns false if the sink got
+    // disposed before that happened
+    private bool EnqueueOnceWriterMadeRoom(in LogEntry entry)
+    {
+        Interlocked.Increment(ref _progressWaitersCount);
+        try
+        {
+            lock (_progressLock)
+            {
+                while (!TryEnqueue(entry))
+                {
+                    if (_disposed)
+                        return false;
+
+                    WakeWriter();
+                    Monitor.Wait(_progressLock, ProgressWaitTimeoutMilliseconds);
+                }
+
+                return true;
+            }
+        }
+        finally
+        {
+            Interlocked.Decrement(ref _progressWaitersCount);
+        }
+    }
+
+    // The waiters register themselves before checking the positions and the writer checks for waiters after updating
+    // them, so either a waiter sees the new positions or the writer sees the waiter and wakes it up
+    private void SignalProgress()
+    {
+        if (Volatile.Read(ref _progressWaitersCount) == 0)
+            return;
+
+        lock (_progressLock)
+            Monitor.PulseAll(_progressLock);
+    }
+
+    private void WriterLoop()
+    {
+        while (true)
+        {
+            int batchSize = 0;
+            lock (_writeLock)
+            {
+                while (batchSize < MaxBatchSize && TryDequeue(out LogEntry entry))
+                {
+                    WriteEntrySafely(entry);
+                    batchSize++;
+                }
+
+                if (batchSize > 0)
+                    _flushDestination?.Invoke();
+            }
+
+            CompleteDequeuedEntries();
+            if (batchSize == MaxBatchSize)
+                continue;
+
+            if (_disposed)
+                return;
+
+            // The queue must be checked again after advertising that we are waiting, otherwise an entry enqueued
+            // right before could be missed until the next one comes in
+            Interlocked.Exchange(ref _writerIsWaiting, 1);
+            if (Interlocked.Read(ref _enqueuePosition) != Interlocked.Read(ref _dequeuePosition))
+            {
+                Interlocked.Exchange(ref _writerIsWaiting, 0);
+                continue;
+            }
+
+            _writerSignal.WaitOne(MaxWriterIdleMilliseconds);
+        }
+    }
+
+    // Entries dropped by the logging threads also count as completed which is why this isn't a count of the entries
+    // written
+    private void CompleteDequeuedEntries()
+    {
+        Interlocked.Exchange(ref _completedPosition, Interlocked.Read(ref _dequeuePosition));
+        SignalProgress();
+    }
+
+    private void FlushDestinationSafely()
+    {
+        try
+        {
+            _flushDestination?.Invoke();
+        }
+        catch (Exception)
+        {
+            // Same as when writing an entry, there's nowhere to report this
+        }
+    }
+
+    private static void WriteEntrySafely(in LogEntry entry)
+    {
+        try
+        {
+            entry.Writer.WriteEntry(entry);
+        }
+        catch (Exception)
+        {
+            // There's nowhere to report a failure to write logs so the entry is lost, but the writer must keep going
+        }
+    }
+
+    private bool TryEnqueue(in LogEntry entry)
+    {
+        while (true)
+        {
+            long position = Interlocked.Read(ref _enqueuePosition);
+            ref Slot slot = ref _slots[position & _indexMask];
+            long difference = Volatile.Read(ref slot.Sequence) - position;
+            if (difference == 0)
+            {
+                if (Interlocked.CompareExchange(ref _enqueuePosition, position + 1, position) != position)
+                    continue;
+
+                slot.Entry = entry;
+                Volatile.Write(ref slot.Sequence, position + 1);
+                return true;
+            }
+
+            if (difference < 0)
+                return false;
+        }
+    }
+
+    private bool TryDequeue(out LogEntry entry)
+    {
+        while (true)
+        {
+            long position = Interlocked.Read(ref _dequeuePosition);
+            ref Slot slot = ref _slots[position & _indexMask];
+            long difference = Volatile.Read(ref slot.Sequence) - (position + 1);
+            if (difference == 0)
+            {
+                if (Interlocked.CompareExchange(ref _dequeuePosition, position + 1, position) != position)
+                    continue;
+
+                entry = slot.Entry;
+                slot.Entry = default;
+                Volatile.Write(ref slot.Sequence, position + _slots.Length);
+                return true;
+            }
+
+            if (difference < 0)
+            {
+                entry = default;
+                return false;
+            }
+        }
+    }
+}
\ No newline at end of file
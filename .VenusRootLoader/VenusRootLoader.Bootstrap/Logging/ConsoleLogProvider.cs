@@ -16,6 +16,7 @@ namespace VenusRootLoader.Bootstrap.Logging;
 ///   supported. Wine never supports ANSI, but lies that it does so on Wine, we always select legacy colors
 /// - No colors: Just text when colors are disabled in the configuration
 /// If console logging is disabled, this returns a <see cref="NullLogger"/>
+/// The entries are rendered to the console by an <see cref="AsyncLogSink"/> so the logging threads never wait on it
 /// </summary>
 public sealed class ConsoleLogProvider : ILoggerProvider
 {
@@ -31,6 +32,17 @@ public sealed class ConsoleLogProvider : ILoggerProvider
     private readonly TimeProvider _timeProvider;
     private readonly ConsoleLoggerSettings _consoleLoggerSettings;
     private readonly RenderingMode _renderingMode;
+    private readonly AsyncLogSink? _asyncLogSink;
+
+    /// <summary>
+    /// The amount of entries that were discarded due to the configured <see cref="LogOverflowPolicy"/>
+    /// </summary>
+    public long DroppedEntriesCount => _asyncLogSink?.DroppedEntriesCount ?? 0;
+
+    /// <summary>
+    /// The amount of entries currently waiting to be rendered to the console
+    /// </summary>
+    public int QueuedEntriesCount => _asyncLogSink?.QueueDepth ?? 0;
 
     public unsafe ConsoleLogProvider(
         IGameExecutionContext gameExecutionContext,
@@ -65,6 +77,15 @@ public sealed class ConsoleLogProvider : ILoggerProvider
                 ? RenderingMode.AnsiColors
                 : RenderingMode.LegacyColors;
         }
+
+        if (_consoleLoggerSettings.Enable!.Value)
+        {
+            _asyncLogSink = new(
+                _consoleLoggerSettings.QueueCapacity!.Value,
+                _consoleLoggerSettings.OverflowPolicy!.Value,
+                null,
+                "VenusRootLoader console logger");
+        }
     }
 
     public ILogger CreateLogger(string categoryName)
@@ -72,8 +93,8 @@ public sealed class ConsoleLogProvider : ILoggerProvider
         if (!_consoleLoggerSettings.Enable!.Value)
             return NullLogger.Instance;
 
-        return new ConsoleLogger(categoryName, _renderingMode, _timeProvider, SystemConsole);
+        return new ConsoleLogger(categoryName, _renderingMode, _timeProvider, SystemConsole, _asyncLogSink);
     }
 
-    public void Dispose() { }
+    public void Dispose() => _asyncLogSink?.Dispose();
 }
\ No newline at end of file
@@ -12,8 +12,9 @@ namespace VenusRootLoader.Bootstrap.Logging;
 /// - Our bootstrap logs uses magenta
 /// - Unity player logs (marked with the special UNITY category) uses cyan
 /// - Every other categories renders white, but it could be possible to customise this in the future
+/// When given an <see cref="AsyncLogSink"/>, the entries are rendered by its writer thread instead of the caller
 /// </summary>
-public sealed class ConsoleLogger : ILogger
+public sealed class ConsoleLogger : ILogger, ILogEntryWriter
 {
     private struct LogLevelInfo
     {
@@ -101,6 +102,7 @@ public sealed class ConsoleLogger : ILogger
 
     private readonly TimeProvider _timeProvider;
     private readonly IConsole _console;
+    private readonly AsyncLogSink? _asyncLogSink;
     private readonly string _assemblyName = Assembly.GetExecutingAssembly().GetName().Name!;
 
     public ConsoleLogger(
@@ -108,6 +110,14 @@ public sealed class ConsoleLogger : ILogger
         ConsoleLogProvider.RenderingMode renderingMode,
         TimeProvider timeProvider,
         IConsole console)
+        : this(categoryName, renderingMode, timeProvider, console, null) { }
+
+    public ConsoleLogger(
+        string categoryName,
+        ConsoleLogProvider.RenderingMode renderingMode,
+        TimeProvider timeProvider,
+        IConsole console,
+        AsyncLogSink? asyncLogSink)
     {
         string simplifiedCategoryName = categoryName;
         int lastDotIndex = categoryName.LastIndexOf('.');
@@ -125,6 +135,7 @@ public sealed class ConsoleLogger : ILogger
         _renderingMode = renderingMode;
         _timeProvider = timeProvider;
         _console = console;
+        _asyncLogSink = asyncLogSink;
         if (_categoryColor is not null)
             _legacyCategoryColor = GetClosestConsoleColor(_categoryColor.Value);
     }
@@ -143,12 +154,22 @@ public sealed class ConsoleLogger : ILogger
         if (!IsEnabled(logLevel))
             return;
 
-        string time = _timeProvider.GetLocalNow().ToString("HH:mm:ss.fff");
+        LogEntry entry = new(_timeProvider.GetLocalNow(), logLevel, formatter(state, exception), exception, this);
+        if (_asyncLogSink is null)
+            WriteEntry(entry);
+        else
+            _asyncLogSink.Enqueue(entry);
+    }
+
+    public void WriteEntry(in LogEntry entry)
+    {
+        LogLevel logLevel = entry.LogLevel;
+        string time = entry.Timestamp.ToString("HH:mm:ss.fff");
         ConsoleColor legacyCategoryColor = _legacyCategoryColor ?? ConsoleColor.Cyan;
 
-        string message = formatter(state, exception);
-        if (exception is not null)
-            message += $" {exception}";
+        string message = entry.Message;
+        if (entry.Exception is not null)
+            message += $" {entry.Exception}";
 
         if (_renderingMode == ConsoleLogProvider.RenderingMode.LegacyColors)
         {
@@ -0,0 +1,82 @@
+using Microsoft.Extensions.Logging;
+using System.Runtime.InteropServices;
+using VenusRootLoader.Bootstrap.Shared;
+
+namespace VenusRootLoader.Bootstrap.Logging;
+
+/// <summary>
+/// This service makes sure the log entries still queued in the <see cref="AsyncLogSink"/> get written when the game
+/// crashes from a native exception nobody handled, such as an access violation in UnityPlayer.dll. It installs a top
+/// level exception filter that drains every sink from the crashing thread before letting the exception continue.
+/// UnityPlayer.dll installs its own filter to run its crash handler so its SetUnhandledExceptionFilter calls are hooked
+/// to keep ours first: Unity's filter gets called by ours instead of replacing it
+/// </summary>
+public sealed class CrashLogsDrainer
+{
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    private delegate int TopLevelExceptionFilterFn(nint exceptionInfo);
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    private delegate nint SetUnhandledExceptionFilterFn(nint lpTopLevelExceptionFilter);
+
+    private const int ExceptionContinueSearch = 0;
+
+    private static TopLevelExceptionFilterFn _filterDelegate = null!;
+    private static SetUnhandledExceptionFilterFn _hookSetUnhandledExceptionFilterDelegate = null!;
+
+    private readonly ILogger<CrashLogsDrainer> _logger;
+    private readonly IPltHooksManager _pltHooksManager;
+    private readonly IGameExecutionContext _gameExecutionContext;
+    private readonly IWin32 _win32;
+
+    // The filter to call after ours which is the one that was installed before ours or the last one Unity tried to
+    // install
+    private nint _nextFilter;
+
+    public CrashLogsDrainer(
+        ILogger<CrashLogsDrainer> logger,
+        IPltHooksManager pltHooksManager,
+        IGameExecutionContext gameExecutionContext,
+        IWin32 win32)
+    {
+        _logger = logger;
+        _pltHooksManager = pltHooksManager;
+        _gameExecutionContext = gameExecutionContext;
+        _win32 = win32;
+        _filterDelegate = Filter;
+        _hookSetUnhandledExceptionFilterDelegate = HookSetUnhandledExceptionFilter;
+    }
+
+    public void DrainLogsOnCrash()
+    {
+        nint previousFilter =
+            _win32.SetUnhandledExceptionFilter(Marshal.GetFunctionPointerForDelegate(_filterDelegate));
+        Volatile.Write(ref _nextFilter, previousFilter);
+        _pltHooksManager.InstallHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            nameof(IWin32.SetUnhandledExceptionFilter),
+            _hookSetUnhandledExceptionFilterDelegate);
+        _logger.LogDebug("Installed the unhandled exception filter that drains the logs on crash");
+    }
+
+    private nint HookSetUnhandledExceptionFilter(nint lpTopLevelExceptionFilter) =>
+        Interlocked.Exchange(ref _nextFilter, lpTopLevelExceptionFilter);
+
+    private int Filter(nint exceptionInfo)
+    {
+        try
+        {
+            AsyncLogSink.DrainAllSinks();
+        }
+        catch (Exception)
+        {
+            // The logs are lost, but the next filter must still get to handle the crash
+        }
+
+        nint nextFilter = Volatile.Read(ref _nextFilter);
+        return nextFilter == nint.Zero ? ExceptionContinueSearch : CallFilter(nextFilter, exceptionInfo);
+    }
+
+    private static unsafe int CallFilter(nint filter, nint exceptionInfo) =>
+        ((delegate* unmanaged[Stdcall]<nint, int>)filter)(exceptionInfo);
+}
\ No newline at end of file
@@ -4,25 +4,27 @@ namespace VenusRootLoader.Bootstrap.Logging;
 
 /// <summary>
 /// The logger used with the <see cref="DiskFileLoggerProvider"/>. It's a simple text logger
-/// similar to the <see cref="ConsoleLogger"/>, but without colors since it's just text
+/// similar to the <see cref="ConsoleLogger"/>, but without colors since it's just text.
+/// When given an <see cref="AsyncLogSink"/>, the entries are written by its writer thread instead of the logging thread
 /// </summary>
-public sealed class DiskFileLogger : ILogger
+public sealed class DiskFileLogger : ILogger, ILogEntryWriter
 {
-    private readonly Dictionary<LogLevel, string> _logLevelInfos = new()
-    {
-        { LogLevel.Critical, "!" },
-        { LogLevel.Error, "E" },
-        { LogLevel.Warning, "W" },
-        { LogLevel.Information, "I" },
-        { LogLevel.Debug, "D" },
-        { LogLevel.Trace, "T" }
-    };
+    // Indexed by LogLevel, LogLevel.None is never logged
+    private static readonly string[] LogLevelMonikers = ["T", "D", "I", "W", "E", "!"];
 
     private readonly string _categoryName;
     private readonly TimeProvider _timeProvider;
     private readonly StreamWriter _logWriter;
+    private readonly AsyncLogSink? _asyncLogSink;
 
     public DiskFileLogger(string categoryName, StreamWriter logWriter, TimeProvider timeProvider)
+        : this(categoryName, logWriter, timeProvider, null) { }
+
+    public DiskFileLogger(
+        string categoryName,
+        StreamWriter logWriter,
+        TimeProvider timeProvider,
+        AsyncLogSink? asyncLogSink)
     {
         string simplifiedCategoryName = categoryName;
         int lastDotIndex = categoryName.LastIndexOf('.');
@@ -32,6 +34,7 @@ public sealed class DiskFileLogger : ILogger
         _categoryName = simplifiedCategoryName;
         _logWriter = logWriter;
         _timeProvider = timeProvider;
+        _asyncLogSink = asyncLogSink;
     }
 
     public void Log<TState>(
@@ -44,17 +47,33 @@ public sealed class DiskFileLogger : ILogger
         if (!IsEnabled(logLevel))
             return;
 
-        string time = _timeProvider.GetLocalNow().ToString("HH:mm:ss.fff");
+        LogEntry entry = new(_timeProvider.GetLocalNow(), logLevel, formatter(state, exception), exception, this);
+        if (_asyncLogSink is null)
+            WriteEntry(entry);
+        else
+            _asyncLogSink.Enqueue(entry);
+    }
+
+    public void WriteEntry(in LogEntry entry)
+    {
+        Span<char> time = stackalloc char[12];
+        entry.Timestamp.TryFormat(time, out int timeLength, "HH:mm:ss.fff");
 
-        string message = formatter(state, exception);
-        if (exception is not null)
-            message += $" {exception}";
+        _logWriter.Write('[');
+        _logWriter.Write(time[..timeLength]);
+        _logWriter.Write("] [");
+        _logWriter.Write(LogLevelMonikers[(int)entry.LogLevel]);
+        _logWriter.Write("] [");
+        _logWriter.Write(_categoryName);
+        _logWriter.Write("] ");
+        _logWriter.Write(entry.Message);
+        if (entry.Exception is not null)
+        {
+            _logWriter.Write(' ');
+            _logWriter.Write(entry.Exception.ToString());
+        }
 
-        _logWriter.WriteLine(
-            $"[{time}] " +
-            $"[{_logLevelInfos[logLevel]}] " +
-            $"[{_categoryName}] " +
-            $"{message}");
+        _logWriter.WriteLine();
     }
 
     public bool IsEnabled(LogLevel logLevel) => logLevel != LogLevel.None;
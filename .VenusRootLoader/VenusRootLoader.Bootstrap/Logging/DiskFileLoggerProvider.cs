@@ -11,16 +11,30 @@ namespace VenusRootLoader.Bootstrap.Logging;
 /// A disk file logger provider that will always log to a file named "latest.log" using a <see cref="DiskFileLogger"/>,
 /// but it will keep the last X amount of existing files by renaming them before creating a new "latest.log".
 /// X here is a value determined from the configuration system. Other log files are named after their creation timestamp
+/// The entries are written to the file by an <see cref="AsyncLogSink"/> which flushes the file once per batch, but
+/// errors are flushed before the logging call returns so they aren't lost if the game crashes right after. The entries
+/// still queued are written when the game exits or by <see cref="CrashLogsDrainer"/> when it crashes
 /// </summary>
 public sealed class DiskFileLoggerProvider : ILoggerProvider
 {
     private readonly TimeProvider _timeProvider;
     private readonly IFileSystem _fileSystem;
     private readonly StreamWriter? _logWriter;
+    private readonly AsyncLogSink? _asyncLogSink;
     private readonly DiskFileLoggerSettings _diskFileLoggerSettings;
 
     private readonly bool _initialised;
 
+    /// <summary>
+    /// The amount of entries that were discarded due to the configured <see cref="LogOverflowPolicy"/>
+    /// </summary>
+    public long DroppedEntriesCount => _asyncLogSink?.DroppedEntriesCount ?? 0;
+
+    /// <summary>
+    /// The amount of entries currently waiting to be written to the file
+    /// </summary>
+    public int QueuedEntriesCount => _asyncLogSink?.QueueDepth ?? 0;
+
     public DiskFileLoggerProvider(
         IOptions<DiskFileLoggerSettings> loggingSettings,
         IBootstrapEnvironment bootstrapEnvironment,
@@ -41,10 +55,15 @@ public sealed class DiskFileLoggerProvider : ILoggerProvider
             PurgeOldLogFiles(logsDirectory, _diskFileLoggerSettings.MaxFilesToKeep!.Value);
             string latestLogFilePath = _fileSystem.Path.Combine(logsDirectory, "latest.log");
             FreeLatestLogFilePath(latestLogFilePath);
-            _logWriter =
-                new(_fileSystem.File.Open(latestLogFilePath, FileMode.Create, FileAccess.Write)) { AutoFlush = true };
+            _logWriter = new(_fileSystem.File.Open(latestLogFilePath, FileMode.Create, FileAccess.Write));
             // For some reason, this isn't done correctly on native Windows so we have to do this to make sure
             _fileSystem.File.SetCreationTime(latestLogFilePath, _timeProvider.GetLocalNow().DateTime);
+            StreamWriter logWriter = _logWriter;
+            _asyncLogSink = new(
+                _diskFileLoggerSettings.QueueCapacity!.Value,
+                _diskFileLoggerSettings.OverflowPolicy!.Value,
+                () => logWriter.Flush(),
+                "VenusRootLoader disk file logger");
             _initialised = true;
         }
         catch (IOException e)
@@ -60,10 +79,17 @@ public sealed class DiskFileLoggerProvider : ILoggerProvider
     {
         if (!_diskFileLoggerSettings.Enable!.Value || !_initialised)
             return NullLogger.Instance;
-        return new DiskFileLogger(categoryName, _logWriter!, _timeProvider);
+        return new DiskFileLogger(categoryName, _logWriter!, _timeProvider, _asyncLogSink);
     }
 
-    public void Dispose() => _logWriter?.Dispose();
+    public void Dispose()
+    {
+        // The sink must be drained before the writer goes away
+        _asyncLogSink?.Dispose();
+        if (_asyncLogSink is { DroppedEntriesCount: > 0 })
+            _logWriter?.WriteLine($"{_asyncLogSink.DroppedEntriesCount} log entries were dropped due to overflow");
+        _logWriter?.Dispose();
+    }
 
     private void PurgeOldLogFiles(string logsDirectory, int maxLogFiles)
     {
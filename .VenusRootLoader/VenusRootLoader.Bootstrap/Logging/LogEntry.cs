@@ -0,0 +1,39 @@
+using Microsoft.Extensions.Logging;
+
+namespace VenusRootLoader.Bootstrap.Logging;
+
+/// <summary>
+/// Formats and writes a <see cref="LogEntry"/> to a destination. This is implemented by the loggers so the
+/// <see cref="AsyncLogSink"/> can defer their rendering to its writer thread
+/// </summary>
+public interface ILogEntryWriter
+{
+    void WriteEntry(in LogEntry entry);
+}
+
+/// <summary>
+/// A log entry as captured on the logging thread. Only the message is rendered there since the state given to a logger
+/// isn't guaranteed to outlive the call, everything else is formatted later by the <see cref="Writer"/>
+/// </summary>
+public readonly struct LogEntry
+{
+    public readonly DateTimeOffset Timestamp;
+    public readonly LogLevel LogLevel;
+    public readonly string Message;
+    public readonly Exception? Exception;
+    public readonly ILogEntryWriter Writer;
+
+    public LogEntry(
+        DateTimeOffset timestamp,
+        LogLevel logLevel,
+        string message,
+        Exception? exception,
+        ILogEntryWriter writer)
+    {
+        Timestamp = timestamp;
+        LogLevel = logLevel;
+        Message = message;
+        Exception = exception;
+        Writer = writer;
+    }
+}
\ No newline at end of file
@@ -1,8 +1,13 @@
 using Microsoft.Extensions.Logging;
+using System.Collections.Concurrent;
 using System.Runtime.InteropServices;
 
 namespace VenusRootLoader.Bootstrap.Logging;
 
+/// <summary>
+/// Relays the logs of the managed side of the loader to our logs. Every category gets its logger created on the first
+/// log relayed to it which is then reused for every following ones
+/// </summary>
 public static class ManagedLogsRelay
 {
     [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
@@ -10,16 +15,22 @@ public static class ManagedLogsRelay
 
     internal static readonly LogFromMonoManagedFn RelayLogFunction = RelayLogFromManaged;
 
+    private static readonly ConcurrentDictionary<string, ILogger> LoggersByCategory = new();
+
     private static ILoggerFactory _loggerFactory = null!;
 
     public static void Init(ILoggerFactory loggerFactory)
     {
         _loggerFactory = loggerFactory;
+        LoggersByCategory.Clear();
     }
 
     private static void RelayLogFromManaged(string message, string category, LogLevel logLevel)
     {
-        ILogger logger = _loggerFactory.CreateLogger(category);
+        ILogger logger = LoggersByCategory.GetOrAdd(
+            category,
+            static (c, loggerFactory) => loggerFactory.CreateLogger(c),
+            _loggerFactory);
         logger.Log(logLevel, message);
     }
 }
\ No newline at end of file
@@ -1,5 +1,4 @@
 using Microsoft.Extensions.Logging;
-using System.Runtime.InteropServices;
 using VenusRootLoader.Bootstrap.Shared;
 using Windows.Win32.Foundation;
 using Windows.Win32.System.Console;
@@ -9,18 +8,12 @@ namespace VenusRootLoader.Bootstrap.Logging;
 /// <summary>
 /// This service makes sure Unity isn't closing stdout and stderr on us. This can happen because Unity may want to
 /// redirect these streams to their own logs (it might even be possible for Unity to still use the console, but it can
-/// still reset the streams to different handles!). This is achieved with a CloseHandle PltHook.
+/// still reset the streams to different handles!). This is achieved with a CloseHandle sub hook.
 /// </summary>
 internal sealed class StandardStreamsProtector
 {
-    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
-    private delegate BOOL CloseHandleFn(HANDLE hObject);
-
-    private static CloseHandleFn _hookCloseHandleDelegate = null!;
-
     private readonly IWin32 _win32;
-    private readonly IPltHooksManager _pltHooksManager;
-    private readonly IGameExecutionContext _gameExecutionContext;
+    private readonly ICloseHandleSharedHooker _closeHandleSharedHooker;
     private readonly ILogger _logger;
     private readonly IMonoInitLifeCycleEvents _monoInitLifeCycleEvents;
 
@@ -29,17 +22,14 @@ internal sealed class StandardStreamsProtector
 
     public StandardStreamsProtector(
         ILogger<StandardStreamsProtector> logger,
-        IPltHooksManager pltHooksManager,
-        IGameExecutionContext gameExecutionContext,
+        ICloseHandleSharedHooker closeHandleSharedHooker,
         IMonoInitLifeCycleEvents monoInitLifeCycleEvents,
         IWin32 win32)
     {
-        _pltHooksManager = pltHooksManager;
+        _closeHandleSharedHooker = closeHandleSharedHooker;
         _logger = logger;
-        _gameExecutionContext = gameExecutionContext;
         _monoInitLifeCycleEvents = monoInitLifeCycleEvents;
         _win32 = win32;
-        _hookCloseHandleDelegate = HookCloseHandle;
     }
 
     public void ProtectStreams()
@@ -47,23 +37,20 @@ internal sealed class StandardStreamsProtector
         _outputHandle = _win32.GetStdHandle(STD_HANDLE.STD_OUTPUT_HANDLE);
         _errorHandle = _win32.GetStdHandle(STD_HANDLE.STD_ERROR_HANDLE);
 
-        _pltHooksManager.InstallHook(
-            _gameExecutionContext.UnityPlayerDllFileName,
-            "CloseHandle",
-            _hookCloseHandleDelegate);
+        _closeHandleSharedHooker.RegisterHook(nameof(StandardStreamsProtector), HookCloseHandle);
         _monoInitLifeCycleEvents.Subscribe(OnGameLifecycle);
     }
 
     // By this point, we know the streams are safe so we can unhook ourselves
     private void OnGameLifecycle(object? sender, EventArgs e)
     {
-        _pltHooksManager.UninstallHook(_gameExecutionContext.UnityPlayerDllFileName, "CloseHandle");
+        _closeHandleSharedHooker.UnregisterHook(nameof(StandardStreamsProtector));
     }
 
-    private BOOL HookCloseHandle(HANDLE hObject)
+    private bool HookCloseHandle(HANDLE hObject)
     {
         if (!_win32.CompareObjectHandles(hObject, _outputHandle) && !_win32.CompareObjectHandles(hObject, _errorHandle))
-            return _win32.CloseHandle(hObject);
+            return false;
 
         _logger.LogInformation(
             "Prevented the CloseHandle of {StreamName}",
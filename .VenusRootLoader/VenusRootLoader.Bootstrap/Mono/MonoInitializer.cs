@@ -7,6 +7,7 @@ using System.Text;
 using VenusRootLoader.Bootstrap.Logging;
 using VenusRootLoader.Bootstrap.Settings;
 using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tracing;
 using VenusRootLoader.Bootstrap.Unity;
 using VenusRootLoader.Bootstrap.Unity.GlobalManagers;
 using Windows.Win32.Foundation;
@@ -68,7 +69,9 @@ internal sealed class MonoInitializer
     private readonly ISdbWinePathTranslator _sdbWinePathTranslator;
     private readonly IMonoInitLifeCycleEvents _monoInitLifeCycleEvents;
     private readonly IAssembliesListAppender _assembliesListAppender;
+    private readonly ITraceRecorder _traceRecorder;
     private readonly nint _logFunctionPtr;
+    private readonly nint _traceFunctionPtr;
     private readonly nint _gameExecutionContextPtr;
     private readonly nint _basePathPtr;
 
@@ -84,7 +87,8 @@ internal sealed class MonoInitializer
         IWin32 win32,
         IFileSystem fileSystem,
         IMonoFunctions monoFunctions,
-        IAssembliesListAppender assembliesListAppender)
+        IAssembliesListAppender assembliesListAppender,
+        ITraceRecorder traceRecorder)
     {
         _logger = logger;
         _pltHooksManager = pltHooksManager;
@@ -94,12 +98,17 @@ internal sealed class MonoInitializer
         _fileSystem = fileSystem;
         _monoFunctions = monoFunctions;
         _assembliesListAppender = assembliesListAppender;
+        _traceRecorder = traceRecorder;
 
         _gameExecutionContext = gameExecutionContext;
         _playerConnectionDiscovery = playerConnectionDiscovery;
         _debuggerSettings = debuggerSettings.Value;
 
         _logFunctionPtr = Marshal.GetFunctionPointerForDelegate(ManagedLogsRelay.RelayLogFunction);
+        // A null pointer tells the managed side that tracing is disabled so it doesn't even measure anything
+        _traceFunctionPtr = _traceRecorder.IsEnabled
+            ? Marshal.GetFunctionPointerForDelegate(ManagedTracesRelay.RelayTraceFunction)
+            : 0;
 
         _gameExecutionContextPtr = _gameExecutionContext.GetPointer();
         _basePathPtr = Marshal.StringToHGlobalUni(bootstrapEnvironment.BasePath);
@@ -185,6 +194,7 @@ internal sealed class MonoInitializer
         if (_jitInitDone)
             return _monoFunctions.JitInitVersion(domainName, runtimeVersion);
 
+        using TraceSpan monoInitSpan = _traceRecorder.BeginSpan("Mono initialisation", "Mono");
         _logger.LogInformation("In init detour");
         string domainNameStr = Marshal.PtrToStringAnsi(domainName)!;
         string runtimeVersionStr = Marshal.PtrToStringAnsi(runtimeVersion)!;
@@ -226,7 +236,8 @@ internal sealed class MonoInitializer
         _logger.LogInformation("Original init jit version");
         if (_debuggerSettings.Enable.Value && _debuggerSettings.SuspendOnBoot!.Value)
             _logger.LogInformation("Waiting until a debugger is attached...");
-        Domain = _monoFunctions.JitInitVersion(domainName, runtimeVersion);
+        using (_traceRecorder.BeginSpan("mono_jit_init_version", "Mono"))
+            Domain = _monoFunctions.JitInitVersion(domainName, runtimeVersion);
         if (_debuggerSettings.Enable.Value && _debuggerSettings.SuspendOnBoot!.Value)
             _logger.LogInformation("Debugger attached! Resuming boot");
 
@@ -350,6 +361,7 @@ internal sealed class MonoInitializer
 
     private unsafe void TransitionToMonoManagedSide(ManagedEntryPointInfo entryPointInfo)
     {
+        using TraceSpan transitionSpan = _traceRecorder.BeginSpan("Preloader entrypoint", "Mono");
         _logger.LogInformation("Loading entrypoint assembly");
         nint assembly = _monoFunctions.DomainAssemblyOpen(Domain, entryPointInfo.AssemblyPath);
         if (assembly == 0)
@@ -360,17 +372,19 @@ internal sealed class MonoInitializer
 
         nint image = _monoFunctions.AssemblyGetImage(assembly);
         nint interopClass = _monoFunctions.ClassFromName(image, entryPointInfo.Namespace, entryPointInfo.ClassName);
-        nint initMethod = _monoFunctions.ClassGetMethodFromName(interopClass, entryPointInfo.MethodName, 3);
+        nint initMethod = _monoFunctions.ClassGetMethodFromName(interopClass, entryPointInfo.MethodName, 4);
 
         nint ex = 0;
 
         fixed (void* logFunctionPtr = &_logFunctionPtr,
+               traceFunctionPtr = &_traceFunctionPtr,
                gameExecutionContextPtr = &_gameExecutionContextPtr,
                basePathPtr = &_basePathPtr)
         {
             void** initArgs = stackalloc void*[]
             {
                 logFunctionPtr,
+                traceFunctionPtr,
                 gameExecutionContextPtr,
                 basePathPtr
             };
@@ -5,6 +5,7 @@
 extern "C"
 {
     void EntryPoint(HMODULE hModule);
+    void ExitPoint(UINT exitCode);
 }
 
 bool hooked = false;
@@ -15,7 +16,10 @@ UINT UnityMainHook(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLin
 {
     ShowWindow(GetConsoleWindow(), SW_HIDE);
     EntryPoint(thisModuleHandle);
-    return orig(hInstance, hPrevInstance, lpCmdLine, nShowCmd);
+    UINT exitCode = orig(hInstance, hPrevInstance, lpCmdLine, nShowCmd);
+    // The game has exited, but the process is still intact at this point unlike during DLL_PROCESS_DETACH
+    ExitPoint(exitCode);
+    return exitCode;
 }
 
 BOOL InstallHook()
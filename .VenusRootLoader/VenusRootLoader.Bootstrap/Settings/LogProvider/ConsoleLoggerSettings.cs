@@ -9,4 +9,11 @@ public sealed class ConsoleLoggerSettings : ILogProviderSettings
 
     [Required]
     public bool? LogWithColors { get; set; }
+
+    [Required]
+    public LogOverflowPolicy? OverflowPolicy { get; set; }
+
+    [Required]
+    [Range(16, 1 << 20)]
+    public int? QueueCapacity { get; set; }
 }
\ No newline at end of file
@@ -10,4 +10,11 @@ public sealed class DiskFileLoggerSettings : ILogProviderSettings
     [Required]
     [Range(1, int.MaxValue)]
     public int? MaxFilesToKeep { get; set; }
+
+    [Required]
+    public LogOverflowPolicy? OverflowPolicy { get; set; }
+
+    [Required]
+    [Range(16, 1 << 20)]
+    public int? QueueCapacity { get; set; }
 }
\ No newline at end of file
@@ -4,4 +4,6 @@ namespace VenusRootLoader.Bootstrap.Settings.LogProvider;
 public interface ILogProviderSettings
 {
     bool? Enable { get; set; }
+    LogOverflowPolicy? OverflowPolicy { get; set; }
+    int? QueueCapacity { get; set; }
 }
\ No newline at end of file
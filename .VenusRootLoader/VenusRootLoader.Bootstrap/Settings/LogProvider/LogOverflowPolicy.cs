@@ -0,0 +1,23 @@
+namespace VenusRootLoader.Bootstrap.Settings.LogProvider;
+
+/// <summary>
+/// Determines what happens when a log entry is produced while the queue of an asynchronous log provider is full
+/// </summary>
+public enum LogOverflowPolicy
+{
+    /// <summary>
+    /// The logging thread waits until the queue has room for the entry so no entries are ever lost
+    /// </summary>
+    Block,
+
+    /// <summary>
+    /// The oldest queued entry is discarded to make room for the new one
+    /// </summary>
+    DropOldest,
+
+    /// <summary>
+    /// <see cref="Microsoft.Extensions.Logging.LogLevel.Trace"/> entries are discarded while any other entries wait
+    /// until the queue has room for them
+    /// </summary>
+    DropTrace
+}
\ No newline at end of file
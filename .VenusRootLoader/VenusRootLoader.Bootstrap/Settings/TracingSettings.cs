@@ -0,0 +1,13 @@
+using Microsoft.Extensions.Options;
+using System.ComponentModel.DataAnnotations;
+
+namespace VenusRootLoader.Bootstrap.Settings;
+
+public sealed class TracingSettings
+{
+    [Required]
+    public bool? Enable { get; set; }
+}
+
+[OptionsValidator]
+public sealed partial class ValidateTracingSettings : IValidateOptions<TracingSettings>;
\ No newline at end of file
@@ -0,0 +1,114 @@
+using System.Runtime.InteropServices;
+using Windows.Win32.Foundation;
+
+namespace VenusRootLoader.Bootstrap.Shared;
+
+public interface ICloseHandleSharedHooker
+{
+    /// <summary>
+    /// Registers a CloseHandle sub hook
+    /// </summary>
+    /// <param name="name">The name of the hook</param>
+    /// <param name="hook">The CloseHandle sub hook, see the <see cref="CloseHandleSharedHooker.CloseHandleHook"/> documentation to learn more</param>
+    void RegisterHook(string name, CloseHandleSharedHooker.CloseHandleHook hook);
+
+    /// <summary>
+    /// Unregisters a CloseHandle sub hook
+    /// </summary>
+    /// <param name="name">The name of the hook to unregister</param>
+    void UnregisterHook(string name);
+}
+
+/// <summary>
+/// This service allows the bootstrap to use a shared CloseHandle plt hook that many services can use to get notified
+/// of handles being closed. Every sub hook sees every CloseHandle and any of them can prevent the handle from being
+/// closed. Since CloseHandle can be called from any of Unity's threads, the sub hooks are read from an immutable
+/// snapshot that's only replaced when registering or unregistering one
+/// </summary>
+public sealed class CloseHandleSharedHooker : ICloseHandleSharedHooker
+{
+    /// <summary>
+    /// A sub hook to CloseHandle that runs before the handle is closed
+    /// </summary>
+    /// <param name="hObject">The handle about to be closed</param>
+    /// <returns>True if the handle should be prevented from being closed</returns>
+    public delegate bool CloseHandleHook(HANDLE hObject);
+
+    [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+    private delegate BOOL CloseHandleFn(HANDLE hObject);
+
+    private static CloseHandleFn _hookCloseHandleDelegate = null!;
+
+    private readonly IWin32 _win32;
+    private readonly IPltHooksManager _pltHooksManager;
+    private readonly IGameExecutionContext _gameExecutionContext;
+
+    private readonly Lock _hooksLock = new();
+    private volatile KeyValuePair<string, CloseHandleHook>[] _closeHandleHooks = [];
+    private bool _isPltHookInstalled;
+
+    public CloseHandleSharedHooker(
+        IPltHooksManager pltHooksManager,
+        IGameExecutionContext gameExecutionContext,
+        IWin32 win32)
+    {
+        _pltHooksManager = pltHooksManager;
+        _gameExecutionContext = gameExecutionContext;
+        _win32 = win32;
+        _hookCloseHandleDelegate = HookCloseHandle;
+        InstallPltHook();
+    }
+
+    /// <summary>
+    /// Registers a CloseHandle sub hook
+    /// </summary>
+    /// <param name="name">The name of the hook</param>
+    /// <param name="hook">The CloseHandle sub hook, see the <see cref="CloseHandleHook"/> documentation to learn more</param>
+    public void RegisterHook(string name, CloseHandleHook hook)
+    {
+        lock (_hooksLock)
+        {
+            if (_closeHandleHooks.Any(h => h.Key == name))
+                throw new ArgumentException($"A CloseHandle hook named {name} is already registered", nameof(name));
+            _closeHandleHooks = [.._closeHandleHooks, new(name, hook)];
+            // The plt hook was uninstalled when the last sub hook got unregistered
+            if (!_isPltHookInstalled)
+                InstallPltHook();
+        }
+    }
+
+    /// <summary>
+    /// Unregisters a CloseHandle sub hook
+    /// </summary>
+    /// <param name="name">The name of the hook to unregister</param>
+    public void UnregisterHook(string name)
+    {
+        lock (_hooksLock)
+        {
+            _closeHandleHooks = _closeHandleHooks.Where(h => h.Key != name).ToArray();
+            if (_closeHandleHooks.Length > 0 || !_isPltHookInstalled)
+                return;
+
+            _pltHooksManager.UninstallHook(_gameExecutionContext.UnityPlayerDllFileName, "CloseHandle");
+            _isPltHookInstalled = false;
+        }
+    }
+
+    private void InstallPltHook()
+    {
+        _pltHooksManager.InstallHook(
+            _gameExecutionContext.UnityPlayerDllFileName,
+            "CloseHandle",
+            _hookCloseHandleDelegate);
+        _isPltHookInstalled = true;
+    }
+
+    private BOOL HookCloseHandle(HANDLE hObject)
+    {
+        bool preventClose = false;
+        foreach (KeyValuePair<string, CloseHandleHook> hook in _closeHandleHooks)
+            preventClose |= hook.Value(hObject);
+
+        return preventClose ? true : _win32.CloseHandle(hObject);
+    }
+}
\ No newline at end of file
@@ -11,9 +11,12 @@ public interface ICreateFileWSharedHooker
     /// Registers a CreateFileW sub hook
     /// </summary>
     /// <param name="name">The name of the hook</param>
-    /// <param name="predicate">A predicate for the filename that returns true if the hook should execute</param>
+    /// <param name="matchers">The matchers for the filenames the hook should execute on</param>
     /// <param name="hook">The CreateFileW sub hook, see the <see cref="CreateFileWSharedHooker.CreateFileWHook"/> documentation to learn more</param>
-    void RegisterHook(string name, Func<string, bool> predicate, CreateFileWSharedHooker.CreateFileWHook hook);
+    void RegisterHook(
+        string name,
+        IEnumerable<FilePathMatcher> matchers,
+        CreateFileWSharedHooker.CreateFileWHook hook);
 
     /// <summary>
     /// Unregisters a CreateFileW sub hook
@@ -24,8 +27,11 @@ public interface ICreateFileWSharedHooker
 
 /// <summary>
 /// This service allows the bootstrap to use a shared CreateFileW plt hook that many services can use to listen for files
-/// they are interested in. Each service can register a sub hook that only runs on files whose filename matches a predicate,
-/// and they can decide to remove themselves from the hook list or change the handle returned
+/// they are interested in. Each service can register a sub hook that only runs on files whose filename matches one of
+/// its <see cref="FilePathMatcher"/>, and they can decide to remove themselves from the hook list or change the handle
+/// returned. Since CreateFileW can be called from any of Unity's threads, the sub hooks are read from an immutable
+/// snapshot with all their matchers compiled in a <see cref="FilePathIndex{TValue}"/> that's only replaced when
+/// registering or unregistering one. This allows to find the sub hook to execute without allocating
 /// </summary>
 public sealed class CreateFileWSharedHooker : ICreateFileWSharedHooker
 {
@@ -61,7 +67,12 @@ public sealed class CreateFileWSharedHooker : ICreateFileWSharedHooker
     private readonly IPltHooksManager _pltHooksManager;
     private readonly IGameExecutionContext _gameExecutionContext;
 
-    private readonly Dictionary<string, (Func<string, bool> predicate, CreateFileWHook Hook)> _fileHandlesHooks = new();
+    private sealed record RegisteredHook(string Name, FilePathMatcher[] Matchers, CreateFileWHook Hook);
+
+    private sealed record HooksSnapshot(RegisteredHook[] Hooks, FilePathIndex<CreateFileWHook> Index);
+
+    private readonly Lock _hooksLock = new();
+    private volatile HooksSnapshot _hooksSnapshot = new([], FilePathIndex<CreateFileWHook>.Empty);
 
     public unsafe CreateFileWSharedHooker(
         IPltHooksManager pltHooksManager,
@@ -82,11 +93,17 @@ public sealed class CreateFileWSharedHooker : ICreateFileWSharedHooker
     /// Registers a CreateFileW sub hook
     /// </summary>
     /// <param name="name">The name of the hook</param>
-    /// <param name="predicate">A predicate for the filename that returns true if the hook should execute</param>
+    /// <param name="matchers">The matchers for the filenames the hook should execute on</param>
     /// <param name="hook">The CreateFileW sub hook, see the <see cref="CreateFileWHook"/> documentation to learn more</param>
-    public void RegisterHook(string name, Func<string, bool> predicate, CreateFileWHook hook)
+    public void RegisterHook(string name, IEnumerable<FilePathMatcher> matchers, CreateFileWHook hook)
     {
-        _fileHandlesHooks.Add(name, (predicate, hook));
+        lock (_hooksLock)
+        {
+            RegisteredHook[] hooks = _hooksSnapshot.Hooks;
+            if (hooks.Any(h => h.Name == name))
+                throw new ArgumentException($"A CreateFileW hook named {name} is already registered", nameof(name));
+            _hooksSnapshot = CreateSnapshot([..hooks, new(name, matchers.ToArray(), hook)]);
+        }
     }
 
     /// <summary>
@@ -95,11 +112,17 @@ public sealed class CreateFileWSharedHooker : ICreateFileWSharedHooker
     /// <param name="name">The name of the hook to unregister</param>
     public void UnregisterHook(string name)
     {
-        _fileHandlesHooks.Remove(name);
-        if (_fileHandlesHooks.Count <= 0)
-            _pltHooksManager.UninstallHook(_gameExecutionContext.UnityPlayerDllFileName, "CreateFileW");
+        lock (_hooksLock)
+        {
+            _hooksSnapshot = CreateSnapshot(_hooksSnapshot.Hooks.Where(h => h.Name != name).ToArray());
+            if (_hooksSnapshot.Hooks.Length <= 0)
+                _pltHooksManager.UninstallHook(_gameExecutionContext.UnityPlayerDllFileName, "CreateFileW");
+        }
     }
 
+    private static HooksSnapshot CreateSnapshot(RegisteredHook[] hooks) =>
+        new(hooks, new(hooks.SelectMany(h => h.Matchers.Select(matcher => (matcher, h.Hook)))));
+
     private unsafe nint HookCreateFileW(
         PCWSTR lpFileName,
         uint dwDesiredAccess,
@@ -109,12 +132,9 @@ public sealed class CreateFileWSharedHooker : ICreateFileWSharedHooker
         FILE_FLAGS_AND_ATTRIBUTES dwFlagsAndAttributes,
         HANDLE hTemplateFile)
     {
-        foreach ((Func<string, bool> predicate, CreateFileWHook Hook) hookWithPredicate in _fileHandlesHooks.Values)
+        if (_hooksSnapshot.Index.TryMatch(lpFileName.AsSpan(), out CreateFileWHook? hook))
         {
-            if (!hookWithPredicate.predicate(lpFileName.ToString()))
-                continue;
-
-            hookWithPredicate.Hook(
+            hook(
                 out HANDLE fileHandle,
                 lpFileName,
                 dwDesiredAccess,
@@ -0,0 +1,146 @@
+using System.Diagnostics.CodeAnalysis;
+
+namespace VenusRootLoader.Bootstrap.Shared;
+
+/// <summary>
+/// An immutable index of <see cref="FilePathMatcher"/> that can be matched against a native path's span without
+/// allocating. This is meant for file hooks which can run on every file Unity opens from any of its threads.
+/// Exact paths are looked up in a hash table while suffixes and directories are scanned. Paths are compared
+/// case-insensitively and both path separators are considered equal. When several matchers match the same path, the
+/// one added first wins
+/// </summary>
+/// <typeparam name="TValue">The value associated with each matcher</typeparam>
+public sealed class FilePathIndex<TValue>
+{
+    private readonly record struct IndexEntry(string Value, int Order, TValue Item);
+
+    public static readonly FilePathIndex<TValue> Empty = new([]);
+
+    private readonly Dictionary<string, IndexEntry> _exactPaths;
+    private readonly Dictionary<string, IndexEntry>.AlternateLookup<ReadOnlySpan<char>> _exactPathsLookup;
+    private readonly IndexEntry[] _fileNameSuffixes;
+    private readonly IndexEntry[] _directoryPrefixes;
+
+    /// <summary>
+    /// Compiles matchers into an index
+    /// </summary>
+    /// <param name="entries">The matchers with their value in order of priority</param>
+    public FilePathIndex(IEnumerable<(FilePathMatcher Matcher, TValue Value)> entries)
+    {
+        _exactPaths = new(FilePathComparer.Instance);
+        List<IndexEntry> fileNameSuffixes = new();
+        List<IndexEntry> directoryPrefixes = new();
+        int order = 0;
+        foreach ((FilePathMatcher matcher, TValue value) in entries)
+        {
+            switch (matcher.Kind)
+            {
+                case FilePathMatcherKind.ExactPath:
+                    _exactPaths.TryAdd(matcher.Value, new(matcher.Value, order, value));
+                    break;
+                case FilePathMatcherKind.FileNameSuffix:
+                    fileNameSuffixes.Add(new(matcher.Value, order, value));
+                    break;
+                case FilePathMatcherKind.DirectoryPrefix:
+                    directoryPrefixes.Add(new(matcher.Value.TrimEnd('\\', '/'), order, value));
+                    break;
+                default:
+                    throw new ArgumentOutOfRangeException(nameof(entries), matcher.Kind, "Unknown matcher kind");
+            }
+
+            order++;
+        }
+
+        _exactPathsLookup = _exactPaths.GetAlternateLookup<ReadOnlySpan<char>>();
+        _fileNameSuffixes = fileNameSuffixes.ToArray();
+        _directoryPrefixes = directoryPrefixes.ToArray();
+    }
+
+    /// <summary>
+    /// Whether the index doesn't contain any matchers
+    /// </summary>
+    public bool IsEmpty => _exactPaths.Count == 0 && _fileNameSuffixes.Length == 0 && _directoryPrefixes.Length == 0;
+
+    /// <summary>
+    /// Finds the value of the first matcher that matches a path
+    /// </summary>
+    /// <param name="path">The path to match</param>
+    /// <param name="value">The value of the matcher that matched the path</param>
+    /// <returns>True if a matcher matched the path</returns>
+    public bool TryMatch(ReadOnlySpan<char> path, [MaybeNullWhen(false)] out TValue value)
+    {
+        int bestOrder = int.MaxValue;
+        value = default;
+
+        if (_exactPathsLookup.TryGetValue(path, out IndexEntry exactPathEntry))
+        {
+            bestOrder = exactPathEntry.Order;
+            value = exactPathEntry.Item;
+        }
+
+        foreach (IndexEntry entry in _fileNameSuffixes)
+        {
+            if (entry.Order >= bestOrder || path.Length < entry.Value.Length)
+                continue;
+            if (!PathCharsEquals(path[^entry.Value.Length..], entry.Value))
+                continue;
+
+            bestOrder = entry.Order;
+            value = entry.Item;
+        }
+
+        foreach (IndexEntry entry in _directoryPrefixes)
+        {
+            if (entry.Order >= bestOrder || path.Length <= entry.Value.Length || !IsSeparator(path[entry.Value.Length]))
+                continue;
+            if (!PathCharsEquals(path[..entry.Value.Length], entry.Value))
+                continue;
+
+            bestOrder = entry.Order;
+            value = entry.Item;
+        }
+
+        return bestOrder != int.MaxValue;
+    }
+
+    private static bool IsSeparator(char c) => c is '\\' or '/';
+
+    private static char FoldPathChar(char c) => c == '/' ? '\\' : char.ToUpperInvariant(c);
+
+    private static bool PathCharsEquals(ReadOnlySpan<char> left, ReadOnlySpan<char> right)
+    {
+        if (left.Length != right.Length)
+            return false;
+
+        for (int i = 0; i < left.Length; i++)
+        {
+            if (left[i] != right[i] && FoldPathChar(left[i]) != FoldPathChar(right[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+    private sealed class FilePathComparer
+        : IEqualityComparer<string>, IAlternateEqualityComparer<ReadOnlySpan<char>, string>
+    {
+        internal static readonly FilePathComparer Instance = new();
+
+        public bool Equals(string? x, string? y) =>
+            x is null || y is null ? ReferenceEquals(x, y) : PathCharsEquals(x, y);
+
+        public int GetHashCode(string obj) => GetHashCode(obj.AsSpan());
+
+        public bool Equals(ReadOnlySpan<char> alternate, string other) => PathCharsEquals(alternate, other);
+
+        public int GetHashCode(ReadOnlySpan<char> alternate)
+        {
+            HashCode hashCode = new();
+            foreach (char c in alternate)
+                hashCode.Add(FoldPathChar(c));
+            return hashCode.ToHashCode();
+        }
+
+        public string Create(ReadOnlySpan<char> alternate) => alternate.ToString();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+namespace VenusRootLoader.Bootstrap.Shared;
+
+/// <summary>
+/// The kind of rule a <see cref="FilePathMatcher"/> applies to a path
+/// </summary>
+public enum FilePathMatcherKind
+{
+    /// <summary>
+    /// The path must be exactly the matcher's value
+    /// </summary>
+    ExactPath,
+
+    /// <summary>
+    /// The path must end with the matcher's value
+    /// </summary>
+    FileNameSuffix,
+
+    /// <summary>
+    /// The path must be located under the matcher's value, recursively
+    /// </summary>
+    DirectoryPrefix
+}
+
+/// <summary>
+/// A declarative rule describing which paths a file hook is interested in. Matchers are compiled into a
+/// <see cref="FilePathIndex{TValue}"/> which compares paths case-insensitively and treats both path separators as equal
+/// </summary>
+/// <param name="Kind">The kind of rule to apply</param>
+/// <param name="Value">The path, suffix or directory the rule applies to depending on <paramref name="Kind"/></param>
+public readonly record struct FilePathMatcher(FilePathMatcherKind Kind, string Value)
+{
+    /// <summary>
+    /// Matches a single path
+    /// </summary>
+    /// <param name="path">The full path to match</param>
+    /// <returns>The matcher</returns>
+    public static FilePathMatcher ExactPath(string path) => new(FilePathMatcherKind.ExactPath, path);
+
+    /// <summary>
+    /// Matches any path that ends with a suffix such as a filename or an extension
+    /// </summary>
+    /// <param name="suffix">The suffix to match</param>
+    /// <returns>The matcher</returns>
+    public static FilePathMatcher FileNameSuffix(string suffix) => new(FilePathMatcherKind.FileNameSuffix, suffix);
+
+    /// <summary>
+    /// Matches any path located under a directory, recursively
+    /// </summary>
+    /// <param name="directory">The directory's full path</param>
+    /// <returns>The matcher</returns>
+    public static FilePathMatcher DirectoryPrefix(string directory) =>
+        new(FilePathMatcherKind.DirectoryPrefix, directory);
+}
\ No newline at end of file
@@ -49,6 +49,15 @@ public interface IWin32
         GET_FILEEX_INFO_LEVELS fInfoLevelId,
         void* lpFileInformation);
 
+    uint GetCurrentThreadId();
+
+    /// <summary>
+    /// Calls SetUnhandledExceptionFilter on Kernel32.dll with the filter as a function pointer
+    /// </summary>
+    /// <param name="lpTopLevelExceptionFilter">The new top level exception filter or 0 to remove it.</param>
+    /// <returns>The previous top level exception filter or 0 if there was none</returns>
+    nint SetUnhandledExceptionFilter(nint lpTopLevelExceptionFilter);
+
     /// <summary>
     /// Calls wine_get_unix_file_name on Kernel32.dll which is exposed by Wine to convert a DOS path into a UNIX path
     /// </summary>
@@ -93,6 +93,18 @@ internal sealed class Win32 : IWin32
         GET_FILEEX_INFO_LEVELS fInfoLevelId,
         void* lpFileInformation) => PInvoke.GetFileAttributesEx(lpFileName, fInfoLevelId, lpFileInformation);
 
+    public uint GetCurrentThreadId() => PInvoke.GetCurrentThreadId();
+
+    public nint SetUnhandledExceptionFilter(nint lpTopLevelExceptionFilter)
+    {
+        return LocalExternFunction(lpTopLevelExceptionFilter);
+
+        // This is declared here because CsWin32 would only expose the filter as a delegate
+        [DllImport("KERNEL32.dll", ExactSpelling = true, EntryPoint = "SetUnhandledExceptionFilter"),
+         DefaultDllImportSearchPaths(DllImportSearchPath.System32)]
+        static extern nint LocalExternFunction(nint lpTopLevelExceptionFilter);
+    }
+
     public unsafe string? WineGetUnixFileName(string dosW)
     {
         fixed (char* lpProcNameLocal = dosW)
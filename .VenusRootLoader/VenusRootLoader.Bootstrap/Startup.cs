@@ -9,6 +9,7 @@ using VenusRootLoader.Bootstrap.Mono;
 using VenusRootLoader.Bootstrap.Settings;
 using VenusRootLoader.Bootstrap.Settings.LogProvider;
 using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tracing;
 using VenusRootLoader.Bootstrap.Unity;
 using VenusRootLoader.Bootstrap.Unity.GlobalManagers;
 using ValidateLoggingSettings = VenusRootLoader.Bootstrap.Settings.ValidateLoggingSettings;
@@ -31,14 +32,23 @@ internal static class Startup
             $"{nameof(LoggingSettings)}:{nameof(ConsoleLoggerSettings)}:{nameof(ConsoleLoggerSettings.Enable)}",
         ["CONSOLE_COLORS"] =
             $"{nameof(LoggingSettings)}:{nameof(ConsoleLoggerSettings)}:{nameof(ConsoleLoggerSettings.LogWithColors)}",
+        ["CONSOLE_LOGS_OVERFLOW_POLICY"] =
+            $"{nameof(LoggingSettings)}:{nameof(ConsoleLoggerSettings)}:{nameof(ConsoleLoggerSettings.OverflowPolicy)}",
+        ["CONSOLE_LOGS_QUEUE_CAPACITY"] =
+            $"{nameof(LoggingSettings)}:{nameof(ConsoleLoggerSettings)}:{nameof(ConsoleLoggerSettings.QueueCapacity)}",
         ["ENABLE_FILES_LOGS"] =
             $"{nameof(LoggingSettings)}:{nameof(DiskFileLoggerSettings)}:{nameof(DiskFileLoggerSettings.Enable)}",
         ["MAX_FILES_LOGS"] =
             $"{nameof(LoggingSettings)}:{nameof(DiskFileLoggerSettings)}:{nameof(DiskFileLoggerSettings.MaxFilesToKeep)}",
+        ["FILES_LOGS_OVERFLOW_POLICY"] =
+            $"{nameof(LoggingSettings)}:{nameof(DiskFileLoggerSettings)}:{nameof(DiskFileLoggerSettings.OverflowPolicy)}",
+        ["FILES_LOGS_QUEUE_CAPACITY"] =
+            $"{nameof(LoggingSettings)}:{nameof(DiskFileLoggerSettings)}:{nameof(DiskFileLoggerSettings.QueueCapacity)}",
         ["DEBUGGER_ENABLE"] = $"{nameof(MonoDebuggerSettings)}:{nameof(MonoDebuggerSettings.Enable)}",
         ["DEBUGGER_IP_ADDRESS"] = $"{nameof(MonoDebuggerSettings)}:{nameof(MonoDebuggerSettings.IpAddress)}",
         ["DEBUGGER_PORT"] = $"{nameof(MonoDebuggerSettings)}:{nameof(MonoDebuggerSettings.Port)}",
-        ["DEBUGGER_SUSPEND_BOOT"] = $"{nameof(MonoDebuggerSettings)}:{nameof(MonoDebuggerSettings.SuspendOnBoot)}"
+        ["DEBUGGER_SUSPEND_BOOT"] = $"{nameof(MonoDebuggerSettings)}:{nameof(MonoDebuggerSettings.SuspendOnBoot)}",
+        ["ENABLE_TRACING"] = $"{nameof(TracingSettings)}:{nameof(TracingSettings.Enable)}"
     };
 
     internal static ServiceProvider BuildServiceProvider(
@@ -91,16 +101,23 @@ internal static class Startup
         services.AddOptions<MonoDebuggerSettings>()
             .BindConfiguration(nameof(MonoDebuggerSettings), options => options.ErrorOnUnknownConfiguration = true);
 
+        services.AddSingleton<IValidateOptions<TracingSettings>, ValidateTracingSettings>();
+        services.AddOptions<TracingSettings>()
+            .BindConfiguration(nameof(TracingSettings), options => options.ErrorOnUnknownConfiguration = true);
+
         services.AddSingleton(TimeProvider.System);
         services.AddSingleton<IFileSystem, FileSystem>();
         services.AddSingleton<IWin32, Win32>();
         services.AddSingleton<IGameExecutionContext, GameExecutionContext>(_ => gameExecutionContext);
         services.AddSingleton<IBootstrapEnvironment, BootstrapEnvironment>(_ => new() { BasePath = basePath });
+        services.AddSingleton<ITraceRecorder, TraceRecorder>();
 
         services.AddSingleton<IPltHooksManager, PltHooksManager>(sp =>
             new PltHooksManager(sp.GetRequiredService<ILogger<PltHooksManager>>(), new PltHook(), new FileSystem()));
         services.AddSingleton<IMonoInitLifeCycleEvents, MonoInitLifeCycleEvents>();
+        services.AddSingleton<ICloseHandleSharedHooker, CloseHandleSharedHooker>();
         services.AddSingleton<StandardStreamsProtector>();
+        services.AddSingleton<CrashLogsDrainer>();
 
         services.AddSingleton<ICreateFileWSharedHooker, CreateFileWSharedHooker>();
         services.AddSingleton<PlayerLogsMirroring>();
@@ -0,0 +1,32 @@
+using System.Runtime.InteropServices;
+
+namespace VenusRootLoader.Bootstrap.Tracing;
+
+/// <summary>
+/// Relays the trace events of the preloader and the managed side of the loader to our <see cref="ITraceRecorder"/>.
+/// The function pointer of <see cref="RelayTraceFunction"/> is only given to them when tracing is enabled
+/// </summary>
+public static class ManagedTracesRelay
+{
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
+    internal delegate void TraceFromMonoManagedFn(
+        TraceEventPhase phase,
+        string name,
+        string category,
+        long allocatedBytes,
+        int gcCount);
+
+    internal static readonly TraceFromMonoManagedFn RelayTraceFunction = RelayTraceFromManaged;
+
+    private static ITraceRecorder _traceRecorder = null!;
+
+    public static void Init(ITraceRecorder traceRecorder) => _traceRecorder = traceRecorder;
+
+    private static void RelayTraceFromManaged(
+        TraceEventPhase phase,
+        string name,
+        string category,
+        long allocatedBytes,
+        int gcCount) =>
+        _traceRecorder.RecordEvent(phase, name, category, allocatedBytes, gcCount);
+}
\ No newline at end of file
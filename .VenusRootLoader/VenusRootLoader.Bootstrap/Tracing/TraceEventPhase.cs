@@ -0,0 +1,10 @@
+namespace VenusRootLoader.Bootstrap.Tracing;
+
+/// <summary>
+/// The kind of a trace event. The loader and the preloader have their own copy of this enum whose values must match
+/// </summary>
+public enum TraceEventPhase
+{
+    Begin = 0,
+    End = 1
+}
\ No newline at end of file
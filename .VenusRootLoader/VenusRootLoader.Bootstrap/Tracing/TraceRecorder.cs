@@ -0,0 +1,235 @@
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Options;
+using System.Collections.Concurrent;
+using System.IO.Abstractions;
+using System.Text.Json;
+using VenusRootLoader.Bootstrap.Settings;
+using VenusRootLoader.Bootstrap.Shared;
+
+namespace VenusRootLoader.Bootstrap.Tracing;
+
+/// <summary>
+/// A service that records the begin and end events of spans from any thread, including the ones relayed from the
+/// managed side of the loader
+/// </summary>
+public interface ITraceRecorder
+{
+    /// <summary>
+    /// Tells if the events are recorded. When this is false, recording an event does nothing
+    /// </summary>
+    bool IsEnabled { get; }
+
+    /// <summary>
+    /// Records the begin event of a span on the current thread
+    /// </summary>
+    /// <param name="name">The name of the span</param>
+    /// <param name="category">The category of the span which allows to filter them in a trace viewer</param>
+    /// <returns>The span which records its end event when disposed</returns>
+    TraceSpan BeginSpan(string name, string category);
+
+    /// <summary>
+    /// Records an event on the current thread
+    /// </summary>
+    /// <param name="phase">Whether this event begins or ends a span</param>
+    /// <param name="name">The name of the span</param>
+    /// <param name="category">The category of the span</param>
+    /// <param name="allocatedBytes">The amount of bytes allocated during the span, only used for end events</param>
+    /// <param name="gcCount">
+    /// The amount of garbage collections that happened during the span, only used for end events
+    /// </param>
+    void RecordEvent(TraceEventPhase phase, string name, string category, long allocatedBytes, int gcCount);
+}
+
+/// <summary>
+/// Writes the recorded events in the Chrome trace event format to a file named "trace.json" in the Logs directory which
+/// can be opened with Perfetto or chrome://tracing. Recording an event only timestamps it and enqueues it while a
+/// dedicated writer thread periodically drains the queue to the file. The JSON array is only closed when the process
+/// exits, but trace viewers accept an unterminated array so the events written before a crash can still be inspected
+/// </summary>
+public sealed class TraceRecorder : ITraceRecorder, IDisposable
+{
+    private readonly record struct TraceEvent(
+        TraceEventPhase Phase,
+        string Name,
+        string Category,
+        long Timestamp,
+        uint ThreadId,
+        long AllocatedBytes,
+        int GcCount);
+
+    private const string TraceFileName = "trace.json";
+    private static readonly TimeSpan WriteInterval = TimeSpan.FromMilliseconds(500);
+
+    private readonly ConcurrentQueue<TraceEvent> _events = new();
+    private readonly AutoResetEvent _writerSignal = new(false);
+    private readonly TimeProvider _timeProvider;
+    private readonly IWin32 _win32;
+    private readonly long _startTimestamp;
+    private readonly int _processId;
+    private readonly Stream? _traceStream;
+    private readonly Utf8JsonWriter? _jsonWriter;
+    private readonly Thread? _writerThread;
+
+    private volatile bool _disposed;
+
+    public bool IsEnabled { get; }
+
+    public TraceRecorder(
+        IOptions<TracingSettings> tracingSettings,
+        IBootstrapEnvironment bootstrapEnvironment,
+        IFileSystem fileSystem,
+        TimeProvider timeProvider,
+        IWin32 win32,
+        ILogger<TraceRecorder> logger)
+    {
+        _timeProvider = timeProvider;
+        _win32 = win32;
+        _startTimestamp = _timeProvider.GetTimestamp();
+        _processId = Environment.ProcessId;
+        if (!tracingSettings.Value.Enable!.Value)
+            return;
+
+        try
+        {
+            string logsDirectory = fileSystem.Path.Combine(bootstrapEnvironment.BasePath, "Logs");
+            if (!fileSystem.Directory.Exists(logsDirectory))
+                fileSystem.Directory.CreateDirectory(logsDirectory);
+            _traceStream = fileSystem.File.Open(
+                fileSystem.Path.Combine(logsDirectory, TraceFileName),
+                FileMode.Create,
+                FileAccess.Write,
+                FileShare.Read);
+        }
+        catch (IOException e)
+        {
+            logger.LogWarning(
+                e,
+                "Disabling tracing due to an IO error, make sure no other instances of the game are running");
+            return;
+        }
+
+        _jsonWriter = new(_traceStream);
+        _jsonWriter.WriteStartArray();
+        WriteProcessNameMetadata(_jsonWriter);
+        IsEnabled = true;
+
+        _writerThread = new(WriterLoop)
+        {
+            Name = "VenusRootLoader trace writer",
+            IsBackground = true
+        };
+        _writerThread.Start();
+
+        AppDomain.CurrentDomain.ProcessExit += OnProcessExit;
+    }
+
+    public TraceSpan BeginSpan(string name, string category) =>
+        IsEnabled ? new TraceSpan(this, name, category) : default;
+
+    public void RecordEvent(TraceEventPhase phase, string name, string category, long allocatedBytes, int gcCount)
+    {
+        if (!IsEnabled || _disposed)
+            return;
+
+        _events.Enqueue(
+            new(
+                phase,
+                name,
+                category,
+                _timeProvider.GetTimestamp(),
+                _win32.GetCurrentThreadId(),
+                allocatedBytes,
+                gcCount));
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+            return;
+
+        _disposed = true;
+        if (!IsEnabled)
+            return;
+
+        AppDomain.CurrentDomain.ProcessExit -= OnProcessExit;
+        _writerSignal.Set();
+        _writerThread!.Join();
+
+        WritePendingEvents();
+        try
+        {
+            _jsonWriter!.WriteEndArray();
+            _jsonWriter.Flush();
+        }
+        catch (IOException)
+        {
+            // The events already written are still readable by trace viewers without the end of the array
+        }
+
+        _jsonWriter!.Dispose();
+        _traceStream!.Dispose();
+        _writerSignal.Dispose();
+    }
+
+    private void OnProcessExit(object? sender, EventArgs e) => Dispose();
+
+    private void WriterLoop()
+    {
+        while (!_disposed)
+        {
+            _writerSignal.WaitOne(WriteInterval);
+            WritePendingEvents();
+        }
+    }
+
+    private void WritePendingEvents()
+    {
+        if (_events.IsEmpty)
+            return;
+
+        try
+        {
+            while (_events.TryDequeue(out TraceEvent traceEvent))
+                WriteEvent(_jsonWriter!, traceEvent);
+            _jsonWriter!.Flush();
+        }
+        catch (IOException)
+        {
+            // There's nowhere to report a failure to write the trace so the events are lost
+        }
+    }
+
+    private void WriteEvent(Utf8JsonWriter writer, in TraceEvent traceEvent)
+    {
+        writer.WriteStartObject();
+        writer.WriteString("name", traceEvent.Name);
+        writer.WriteString("cat", traceEvent.Category);
+        writer.WriteString("ph", traceEvent.Phase == TraceEventPhase.Begin ? "B" : "E");
+        writer.WriteNumber(
+            "ts",
+            (traceEvent.Timestamp - _startTimestamp) * 1_000_000.0 / _timeProvider.TimestampFrequency);
+        writer.WriteNumber("pid", _processId);
+        writer.WriteNumber("tid", traceEvent.ThreadId);
+        if (traceEvent.Phase == TraceEventPhase.End)
+        {
+            writer.WriteStartObject("args");
+            writer.WriteNumber("allocatedBytes", traceEvent.AllocatedBytes);
+            writer.WriteNumber("gcCount", traceEvent.GcCount);
+            writer.WriteEndObject();
+        }
+
+        writer.WriteEndObject();
+    }
+
+    private void WriteProcessNameMetadata(Utf8JsonWriter writer)
+    {
+        writer.WriteStartObject();
+        writer.WriteString("name", "process_name");
+        writer.WriteString("ph", "M");
+        writer.WriteNumber("pid", _processId);
+        writer.WriteStartObject("args");
+        writer.WriteString("name", Path.GetFileNameWithoutExtension(Environment.ProcessPath));
+        writer.WriteEndObject();
+        writer.WriteEndObject();
+    }
+}
\ No newline at end of file
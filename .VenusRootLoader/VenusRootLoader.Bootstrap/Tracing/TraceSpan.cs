@@ -0,0 +1,35 @@
+namespace VenusRootLoader.Bootstrap.Tracing;
+
+/// <summary>
+/// A span of time recorded by an <see cref="ITraceRecorder"/> that ends when disposed. The end event carries the
+/// amount of bytes allocated by the current thread and the amount of garbage collections that happened during the span.
+/// A default instance does nothing which is what is returned when tracing is disabled
+/// </summary>
+public readonly struct TraceSpan : IDisposable
+{
+    private readonly ITraceRecorder? _traceRecorder;
+    private readonly string _name;
+    private readonly string _category;
+    private readonly long _allocatedBytesAtBegin;
+    private readonly int _gcCountAtBegin;
+
+    internal TraceSpan(ITraceRecorder traceRecorder, string name, string category)
+    {
+        _traceRecorder = traceRecorder;
+        _name = name;
+        _category = category;
+        _allocatedBytesAtBegin = GC.GetAllocatedBytesForCurrentThread();
+        _gcCountAtBegin = GC.CollectionCount(0);
+        traceRecorder.RecordEvent(TraceEventPhase.Begin, name, category, 0, 0);
+    }
+
+    public void Dispose()
+    {
+        _traceRecorder?.RecordEvent(
+            TraceEventPhase.End,
+            _name,
+            _category,
+            GC.GetAllocatedBytesForCurrentThread() - _allocatedBytesAtBegin,
+            GC.CollectionCount(0) - _gcCountAtBegin);
+    }
+}
\ No newline at end of file
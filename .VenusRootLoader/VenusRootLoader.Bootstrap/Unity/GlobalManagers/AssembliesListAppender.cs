@@ -70,6 +70,11 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
 
     private readonly Dictionary<string, string> _assemblyNames = new();
 
+    // Maps the path Unity expects each assembly to be at to its redirected path. This is shared by the PathFileExistsW,
+    // GetFileAttributesExW and CreateFileW hooks so they can match the paths they receive without allocating and it's
+    // replaced whenever an assembly no longer needs to be redirected since they can run on any of Unity's threads.
+    private volatile FilePathIndex<string> _redirectedAssemblies = FilePathIndex<string>.Empty;
+
     public unsafe AssembliesListAppender(
         ILogger<AssembliesListAppender> logger,
         IGameExecutionContext gameExecutionContext,
@@ -88,6 +93,7 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
         _managedDirectoryPath = _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "Managed");
 
         PopulateAssembliesList(bootstrapEnvironment, gameExecutionContext, fileSystem);
+        _redirectedAssemblies = CreateRedirectedAssembliesIndex();
 
         _hookPathFileExistsDelegate = HookPathFileExistsW;
         _hookGetFileAttributesExDelegate = HookGetFileAttributesEx;
@@ -99,9 +105,15 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
             _gameExecutionContext.UnityPlayerDllFileName,
             "GetFileAttributesExW",
             _hookGetFileAttributesExDelegate);
-        _createFileWSharedHooker.RegisterHook(nameof(AssembliesListAppender), IsCustomAssemblyFile, HookFileHandle);
+        _createFileWSharedHooker.RegisterHook(
+            nameof(AssembliesListAppender),
+            _assemblyNames.Keys.Select(GetManagedAssemblyMatcher),
+            HookFileHandle);
     }
 
+    public string GetInputsFingerprint() =>
+        string.Join("\n", _assemblyNames.Keys.OrderBy(x => x, StringComparer.Ordinal));
+
     public bool ShouldPatch(AssetsManager assetsManager, AssetsFileInstance globalManagersFileInstance)
     {
         _logger.LogDebug("\tReading MonoManager.m_AssemblyNames");
@@ -233,28 +245,20 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
         }
     }
 
+    private FilePathMatcher GetManagedAssemblyMatcher(string assemblyFileName) =>
+        FilePathMatcher.ExactPath(_fileSystem.Path.Combine(_managedDirectoryPath, assemblyFileName));
+
+    private FilePathIndex<string> CreateRedirectedAssembliesIndex() =>
+        new(_assemblyNames.Select(x => (GetManagedAssemblyMatcher(x.Key), x.Value)));
+
     private BOOL HookPathFileExistsW(PCWSTR pszPath)
     {
-        if (!pszPath.AsSpan().StartsWith(_managedDirectoryPath))
-            return _win32.PathFileExists(pszPath);
-
-        string path = pszPath.ToString();
-        string fileName = _fileSystem.Path.GetFileName(path);
-        if (_assemblyNames.ContainsKey(fileName))
+        if (_redirectedAssemblies.TryMatch(pszPath.AsSpan(), out _))
             return true;
 
         return _win32.PathFileExists(pszPath);
     }
 
-    private bool IsCustomAssemblyFile(string path)
-    {
-        if (!path.StartsWith(_managedDirectoryPath))
-            return false;
-
-        string fileName = _fileSystem.Path.GetFileName(path);
-        return _assemblyNames.ContainsKey(fileName);
-    }
-
     private unsafe void HookFileHandle(
         out HANDLE originalHandle,
         PCWSTR lpFileName,
@@ -265,13 +269,23 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
         FILE_FLAGS_AND_ATTRIBUTES dwFlagsAndAttributes,
         HANDLE hTemplateFile)
     {
-        string path = lpFileName.ToString();
-        string fileName = _fileSystem.Path.GetFileName(path);
-        string redirectedPath = _assemblyNames[fileName];
+        // The assembly may have been loaded by Mono since this hook was matched in which case it's no longer redirected
+        if (!_redirectedAssemblies.TryMatch(lpFileName.AsSpan(), out string? redirectedPath))
+        {
+            originalHandle = _win32.CreateFile(
+                lpFileName,
+                dwDesiredAccess,
+                dwShareMode,
+                new(lpSecurityAttributes),
+                dwCreationDisposition,
+                dwFlagsAndAttributes,
+                hTemplateFile);
+            return;
+        }
 
         _logger.LogTrace(
             "Redirecting {originalPath} Unity's Managed assembly to {redirectedPath}",
-            path,
+            lpFileName.ToString(),
             redirectedPath);
         fixed (char* fileNamePtr = redirectedPath)
         {
@@ -291,17 +305,12 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
         GET_FILEEX_INFO_LEVELS fInfoLevelId,
         void* lpFileInformation)
     {
-        if (!lpFileName.AsSpan().StartsWith(_managedDirectoryPath))
-            return _win32.GetFileAttributesExW(lpFileName, fInfoLevelId, lpFileInformation);
-
-        string path = lpFileName.ToString();
-        string fileName = _fileSystem.Path.GetFileName(path);
-        if (!_assemblyNames.TryGetValue(fileName, out string? redirectedPath))
+        if (!_redirectedAssemblies.TryMatch(lpFileName.AsSpan(), out string? redirectedPath))
             return _win32.GetFileAttributesExW(lpFileName, fInfoLevelId, lpFileInformation);
 
         _logger.LogTrace(
             "Redirecting {originalPath} Unity's Managed file attributes assembly to {redirectedPath}",
-            path,
+            lpFileName.ToString(),
             redirectedPath);
         fixed (char* fileNamePtr = redirectedPath)
             return _win32.GetFileAttributesExW(fileNamePtr, fInfoLevelId, lpFileInformation);
@@ -316,6 +325,7 @@ internal sealed class AssembliesListAppender : IGlobalManagersPatcher, IAssembli
         if (!_assemblyNames.Remove(fileName, out string? redirectedPath))
             return originalName;
 
+        _redirectedAssemblies = CreateRedirectedAssembliesIndex();
         if (_assemblyNames.Count == 0)
         {
             _pltHooksManager.UninstallHook(_gameExecutionContext.UnityPlayerDllFileName, "PathFileExistsW");
@@ -0,0 +1,91 @@
+namespace VenusRootLoader.Bootstrap.Unity.GlobalManagers;
+
+/// <summary>
+/// A read only seekable stream that presents ranges of other streams one after the other without copying them. The
+/// streams of the segments are not owned so they aren't disposed with this stream.
+/// </summary>
+internal sealed class ConcatenatedReadStream : Stream
+{
+    internal readonly record struct Segment(Stream Stream, long Offset, long Length);
+
+    private readonly Segment[] _segments;
+
+    // The position in this stream where each segment starts
+    private readonly long[] _segmentsStarts;
+    private readonly long _length;
+    private long _position;
+
+    internal ConcatenatedReadStream(IEnumerable<Segment> segments)
+    {
+        // Empty segments would start at the same position as the next one which would make the lookup ambiguous
+        _segments = segments.Where(s => s.Length > 0).ToArray();
+        _segmentsStarts = new long[_segments.Length];
+        for (int i = 0; i < _segments.Length; i++)
+        {
+            _segmentsStarts[i] = _length;
+            _length += _segments[i].Length;
+        }
+    }
+
+    public override bool CanRead => true;
+    public override bool CanSeek => true;
+    public override bool CanWrite => false;
+    public override long Length => _length;
+
+    public override long Position
+    {
+        get => _position;
+        set
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(value);
+            _position = value;
+        }
+    }
+
+    public override int Read(byte[] buffer, int offset, int count) => Read(buffer.AsSpan(offset, count));
+
+    public override int Read(Span<byte> buffer)
+    {
+        int totalRead = 0;
+        while (totalRead < buffer.Length && _position < _length)
+        {
+            int segmentIndex = Array.BinarySearch(_segmentsStarts, _position);
+            // Without an exact match, this is the complement of the index of the next segment
+            if (segmentIndex < 0)
+                segmentIndex = ~segmentIndex - 1;
+
+            Segment segment = _segments[segmentIndex];
+            long positionInSegment = _position - _segmentsStarts[segmentIndex];
+            int toRead = (int)Math.Min(buffer.Length - totalRead, segment.Length - positionInSegment);
+            segment.Stream.Position = segment.Offset + positionInSegment;
+            int read = segment.Stream.Read(buffer.Slice(totalRead, toRead));
+            if (read == 0)
+                throw new EndOfStreamException("A segment is longer than the data left in its stream");
+
+            totalRead += read;
+            _position += read;
+        }
+
+        return totalRead;
+    }
+
+    public override long Seek(long offset, SeekOrigin origin)
+    {
+        Position = origin switch
+        {
+            SeekOrigin.Begin => offset,
+            SeekOrigin.Current => _position + offset,
+            SeekOrigin.End => _length + offset,
+            _ => throw new ArgumentOutOfRangeException(nameof(origin))
+        };
+        return _position;
+    }
+
+    public override void Flush()
+    {
+    }
+
+    public override void SetLength(long value) => throw new NotSupportedException();
+
+    public override void Write(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+}
\ No newline at end of file
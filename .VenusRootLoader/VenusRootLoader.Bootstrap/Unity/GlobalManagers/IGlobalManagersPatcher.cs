@@ -4,6 +4,14 @@ namespace VenusRootLoader.Bootstrap.Unity.GlobalManagers;
 
 internal interface IGlobalManagersPatcher
 {
+    /// <summary>
+    /// Describes everything the patcher's result depends on other than the original bundle. It is part of the
+    /// fingerprint <see cref="RootGlobalManagersPatcher"/> stores next to the modified bundle so the bundle only gets
+    /// regenerated when this value or the original bundle changes.
+    /// </summary>
+    /// <returns>A string that is equal across boots if and only if the patcher would produce the same result.</returns>
+    string GetInputsFingerprint();
+
     bool ShouldPatch(AssetsManager assetsManager, AssetsFileInstance globalManagersFileInstance);
     void Patch(AssetsManager assetsManager, AssetsFileInstance globalManagersFileInstance);
 }
\ No newline at end of file
@@ -2,7 +2,10 @@ using AssetsTools.NET;
 using AssetsTools.NET.Extra;
 using Microsoft.Extensions.Logging;
 using System.IO.Abstractions;
+using System.Security.Cryptography;
+using System.Text;
 using VenusRootLoader.Bootstrap.Shared;
+using VenusRootLoader.Bootstrap.Tracing;
 using Windows.Win32.Foundation;
 using Windows.Win32.Security;
 using Windows.Win32.Storage.FileSystem;
@@ -11,16 +14,35 @@ namespace VenusRootLoader.Bootstrap.Unity.GlobalManagers;
 
 internal sealed class RootGlobalManagersPatcher
 {
+    /// <summary>
+    /// Identifies what a modified bundle was generated from. The original bundle is identified by its size and last
+    /// write time with its SHA256 hash as a fallback when only the last write time changed. The patchers' inputs are
+    /// identified by a SHA256 hash of all their <see cref="IGlobalManagersPatcher.GetInputsFingerprint"/>.
+    /// </summary>
+    internal record struct BundleFingerprint(
+        long OriginalBundleSize,
+        long OriginalBundleLastWriteTimeUtcTicks,
+        string OriginalBundleHash,
+        string PatchersInputsHash);
+
+    // This must be incremented whenever the way the modified bundle is generated changes
+    private const int FingerprintFormatVersion = 1;
+
     private static bool _hasModifiedBundle;
 
     private readonly IFileSystem _fileSystem;
+    private readonly string _gameBundlePath;
     private readonly string _modifiedGameBundlePath;
+    private readonly string _modifiedGameBundleFingerprintPath;
+    private readonly string _temporaryModifiedGameBundlePath;
+    private readonly string _temporaryModifiedGameBundleFingerprintPath;
     private readonly string _classDataTpkPath;
 
     private readonly IWin32 _win32;
     private readonly ILogger<RootGlobalManagersPatcher> _logger;
     private readonly ICreateFileWSharedHooker _createFileWSharedHooker;
     private readonly IGameExecutionContext _gameExecutionContext;
+    private readonly ITraceRecorder _traceRecorder;
     private readonly List<IGlobalManagersPatcher> _globalManagersPatchers;
 
     public RootGlobalManagersPatcher(
@@ -29,18 +51,24 @@ internal sealed class RootGlobalManagersPatcher
         ICreateFileWSharedHooker createFileWSharedHooker,
         IGameExecutionContext gameExecutionContext,
         IWin32 win32,
-        IFileSystem fileSystem)
+        IFileSystem fileSystem,
+        ITraceRecorder traceRecorder)
     {
         _logger = logger;
+        _traceRecorder = traceRecorder;
         _fileSystem = fileSystem;
         _globalManagersPatchers = globalManagersPatchers.ToList();
         _gameExecutionContext = gameExecutionContext;
         _win32 = win32;
         _createFileWSharedHooker = createFileWSharedHooker;
+        _gameBundlePath = _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "data.unity3d");
         _modifiedGameBundlePath = _fileSystem.Path.Combine(
             _gameExecutionContext.GameDir,
             "VenusRootLoader",
             "data.unity3d.modified");
+        _modifiedGameBundleFingerprintPath = _modifiedGameBundlePath + ".fingerprint";
+        _temporaryModifiedGameBundlePath = _modifiedGameBundlePath + ".tmp";
+        _temporaryModifiedGameBundleFingerprintPath = _modifiedGameBundleFingerprintPath + ".tmp";
         _classDataTpkPath = _fileSystem.Path.Combine(
             _gameExecutionContext.GameDir,
             "VenusRootLoader",
@@ -49,12 +77,12 @@ internal sealed class RootGlobalManagersPatcher
 
     public unsafe void SetupPatchers()
     {
-        _createFileWSharedHooker.RegisterHook(nameof(RootGlobalManagersPatcher), IsGameBundleFile, HookFileHandle);
+        _createFileWSharedHooker.RegisterHook(
+            nameof(RootGlobalManagersPatcher),
+            [FilePathMatcher.ExactPath(_gameBundlePath)],
+            HookFileHandle);
     }
 
-    private bool IsGameBundleFile(string filename) =>
-        filename == _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "data.unity3d");
-
     private unsafe void HookFileHandle(
         out HANDLE originalHandle,
         PCWSTR lpFileName,
@@ -69,6 +97,7 @@ internal sealed class RootGlobalManagersPatcher
         {
             try
             {
+                using TraceSpan editGameBundleSpan = _traceRecorder.BeginSpan("Game bundle rewrite", "GlobalManagers");
                 EditGameBundle(lpFileName.ToString());
             }
             catch (Exception e)
@@ -94,6 +123,19 @@ internal sealed class RootGlobalManagersPatcher
 
     private void EditGameBundle(string originalGameBundlePath)
     {
+        IFileInfo originalGameBundleInfo = _fileSystem.FileInfo.New(originalGameBundlePath);
+        string patchersInputsHash = ComputePatchersInputsHash();
+        if (IsModifiedGameBundleUpToDate(originalGameBundleInfo, patchersInputsHash))
+        {
+            _logger.LogDebug("\tThe modified bundle is already up to date");
+            _hasModifiedBundle = true;
+            return;
+        }
+
+        // The fingerprint is removed first so an interrupted generation can never be considered up to date
+        if (_fileSystem.File.Exists(_modifiedGameBundleFingerprintPath))
+            _fileSystem.File.Delete(_modifiedGameBundleFingerprintPath);
+
         _logger.LogDebug(
             "Using AssetTools.NET to create a modified game bundle using the one from {gameBundlePath}...",
             originalGameBundlePath);
@@ -102,72 +144,32 @@ internal sealed class RootGlobalManagersPatcher
         _logger.LogDebug("\tLoading the classdata.tpk file");
         manager.LoadClassPackage(_classDataTpkPath);
 
-        string modifiedBundleVersion = "";
-        AssetsFileInstance? modifiedAssetsFileInstance = null;
-        List<bool> runPatchers = new();
-        if (_fileSystem.File.Exists(_modifiedGameBundlePath))
-        {
-            _logger.LogDebug("\tLoading the modified bundle file");
-            BundleFileInstance modifiedBundleInstance = manager.LoadBundleFile(_modifiedGameBundlePath);
-
-            _logger.LogDebug("\tLoading the modified globalmanagers assets file");
-            modifiedAssetsFileInstance = manager.LoadAssetsFileFromBundle(modifiedBundleInstance, 0);
-
-            LoadClassDatabase(manager, modifiedAssetsFileInstance.file);
-
-            modifiedBundleVersion = ReadBundleVersion(manager, modifiedAssetsFileInstance);
-            foreach (IGlobalManagersPatcher patcher in _globalManagersPatchers)
-            {
-                bool runPatcher = patcher.ShouldPatch(manager, modifiedAssetsFileInstance);
-                runPatchers.Add(runPatcher);
-            }
-        }
-        else
-        {
-            for (int i = 0; i < _globalManagersPatchers.Count; i++)
-                runPatchers.Add(true);
-        }
-
         _logger.LogDebug("\tLoading the original bundle file");
         BundleFileInstance bundleInstance = manager.LoadBundleFile(originalGameBundlePath);
         AssetBundleFile bundleFile = bundleInstance.file;
 
         _logger.LogDebug("\tLoading the original globalmanagers assets file");
-        AssetsFileInstance originalAssetsFileInstance = manager.LoadAssetsFileFromBundle(bundleInstance, 0);
-        AssetsFile originalAssetFile = originalAssetsFileInstance.file;
-
-        if (manager.ClassDatabase is null)
-            LoadClassDatabase(manager, originalAssetFile);
+        AssetsFileInstance globalManagersFileInstance = manager.LoadAssetsFileFromBundle(bundleInstance, 0);
+        LoadClassDatabase(manager, globalManagersFileInstance.file);
 
-        string originalBundleVersion = ReadBundleVersion(manager, originalAssetsFileInstance);
-        bool patchesNeedsToRun = runPatchers.Any(x => x);
-        if (!patchesNeedsToRun
-            && modifiedAssetsFileInstance is not null
-            && originalBundleVersion == modifiedBundleVersion)
+        foreach (IGlobalManagersPatcher patcher in _globalManagersPatchers)
         {
-            _logger.LogDebug("\tThe modified bundle is already up to date, closing the AssetsManager");
-            manager.UnloadAll(true);
-            _hasModifiedBundle = true;
-            return;
-        }
-
-        AssetsFileInstance assetsFileInstance = patchesNeedsToRun && modifiedAssetsFileInstance is not null
-            ? modifiedAssetsFileInstance
-            : originalAssetsFileInstance;
-        for (int i = 0; i < _globalManagersPatchers.Count; i++)
-        {
-            IGlobalManagersPatcher patcher = _globalManagersPatchers[i];
-            if (!runPatchers[i])
-                continue;
-
-            patcher.Patch(manager, assetsFileInstance);
+            using TraceSpan patcherSpan = _traceRecorder.BeginSpan(patcher.GetType().Name, "GlobalManagers");
+            if (patcher.ShouldPatch(manager, globalManagersFileInstance))
+                patcher.Patch(manager, globalManagersFileInstance);
         }
 
         _logger.LogInformation("Generating a modified data.unity3d bundle");
-        GenerateModifiedGameBundle(manager, bundleFile, assetsFileInstance, _modifiedGameBundlePath);
+        using (_traceRecorder.BeginSpan("Modified game bundle generation", "GlobalManagers"))
+            GenerateModifiedGameBundle(manager, bundleFile, globalManagersFileInstance);
 
-        _logger.LogDebug("\tClosing the AssetsManager");
-        manager.UnloadAll(true);
+        _logger.LogDebug("\tWriting the modified bundle fingerprint");
+        WriteFingerprint(
+            new(
+                originalGameBundleInfo.Length,
+                originalGameBundleInfo.LastWriteTimeUtc.Ticks,
+                ComputeFileHash(originalGameBundlePath),
+                patchersInputsHash));
 
         _logger.LogInformation(
             "Modified bundle file written successfully at {ModifiedGameBundlePath}",
@@ -179,47 +181,145 @@ internal sealed class RootGlobalManagersPatcher
     private void GenerateModifiedGameBundle(
         AssetsManager manager,
         AssetBundleFile originalBundleFile,
-        AssetsFileInstance newGlobalManagersInstance,
-        string modifiedGameBundlePath)
+        AssetsFileInstance newGlobalManagersInstance)
     {
-        _logger.LogDebug("\tSetting the new globalmanagers data in the bundle");
-        originalBundleFile.BlockAndDirInfo.DirectoryInfos[0].SetNewData(newGlobalManagersInstance.file);
+        _logger.LogDebug("\tSerializing the new globalmanagers assets file");
+        using MemoryStream newGlobalManagersData = new();
+        AssetsFileWriter globalManagersWriter = new(newGlobalManagersData);
+        newGlobalManagersInstance.file.Write(globalManagersWriter);
+        globalManagersWriter.Flush();
 
-        _logger.LogDebug("\tWriting the modified bundle file");
-        string uncompressedBundlePath = _modifiedGameBundlePath + ".uncompressed";
-        using (AssetsFileWriter writer = new(uncompressedBundlePath))
-            originalBundleFile.Write(writer);
+        try
+        {
+            _logger.LogDebug("\tPacking the modified bundle file...");
+            ReplaceDirectoryData(originalBundleFile, 0, newGlobalManagersData);
+            using (AssetsFileWriter writer = new(_fileSystem.File.Create(_temporaryModifiedGameBundlePath)))
+                originalBundleFile.Pack(writer, AssetBundleCompressionType.LZ4Fast);
 
-        _logger.LogDebug("\tClosing the modified bundle file (if it exists)...");
-        manager.UnloadBundleFile(modifiedGameBundlePath);
+            // The existing modified bundle is only replaced once the new one is complete
+            _fileSystem.File.Move(_temporaryModifiedGameBundlePath, _modifiedGameBundlePath, true);
+        }
+        finally
+        {
+            _logger.LogDebug("\tClosing the AssetsManager");
+            manager.UnloadAll(true);
+            if (_fileSystem.File.Exists(_temporaryModifiedGameBundlePath))
+                _fileSystem.File.Delete(_temporaryModifiedGameBundlePath);
+        }
+    }
 
-        _logger.LogDebug("\tCompressing the modified bundle file...");
-        AssetBundleFile newUncompressedBundle = new();
-        newUncompressedBundle.Read(new AssetsFileReader(_fileSystem.File.OpenRead(uncompressedBundlePath)));
-        using (AssetsFileWriter writer = new(_modifiedGameBundlePath))
-            newUncompressedBundle.Pack(writer, AssetBundleCompressionType.LZ4Fast);
-        newUncompressedBundle.Close();
+    /// <summary>
+    /// Lays out the directory entries of a decompressed bundle again with the data of one of them replaced so it can be
+    /// packed directly. The data of the other entries keeps being read from the bundle's decompressed data which means
+    /// the uncompressed modified bundle is never written to memory or to disk.
+    /// </summary>
+    /// <param name="bundleFile">The decompressed bundle.</param>
+    /// <param name="directoryIndex">The index of the directory entry whose data is replaced.</param>
+    /// <param name="newData">The new data of the directory entry. It must stay open until the bundle is packed.</param>
+    internal static void ReplaceDirectoryData(AssetBundleFile bundleFile, int directoryIndex, Stream newData)
+    {
+        IList<AssetBundleDirectoryInfo> directoryInfos = bundleFile.BlockAndDirInfo.DirectoryInfos;
+        AssetBundleDirectoryInfo replacedDirectoryInfo = directoryInfos[directoryIndex];
+        Stream originalData = bundleFile.DataReader.BaseStream;
 
-        _fileSystem.File.Delete(uncompressedBundlePath);
+        List<ConcatenatedReadStream.Segment> segments = [];
+        long offset = 0;
+        foreach (AssetBundleDirectoryInfo directoryInfo in directoryInfos.OrderBy(d => d.Offset).ToList())
+        {
+            ConcatenatedReadStream.Segment segment = ReferenceEquals(directoryInfo, replacedDirectoryInfo)
+                ? new(newData, 0, newData.Length)
+                : new(originalData, directoryInfo.Offset, directoryInfo.DecompressedSize);
+            segments.Add(segment);
+            directoryInfo.Offset = offset;
+            directoryInfo.DecompressedSize = segment.Length;
+            offset += segment.Length;
+        }
+
+        bundleFile.DataReader = new(new ConcatenatedReadStream(segments));
     }
 
-    private void LoadClassDatabase(AssetsManager manager, AssetsFile globalManagersAssetFile)
+    internal bool IsModifiedGameBundleUpToDate(IFileInfo originalGameBundleInfo, string patchersInputsHash)
     {
-        _logger.LogDebug("\tLoading the class database using the assets file's Unity version");
-        manager.LoadClassDatabaseFromPackage(globalManagersAssetFile.Metadata.UnityVersion);
+        if (!_fileSystem.File.Exists(_modifiedGameBundlePath) || !TryReadFingerprint(out BundleFingerprint fingerprint))
+            return false;
+
+        if (fingerprint.PatchersInputsHash != patchersInputsHash
+            || fingerprint.OriginalBundleSize != originalGameBundleInfo.Length)
+        {
+            return false;
+        }
+
+        if (fingerprint.OriginalBundleLastWriteTimeUtcTicks == originalGameBundleInfo.LastWriteTimeUtc.Ticks)
+            return true;
+
+        // The original bundle may have been touched without its content changing such as when the game files are
+        // verified so we only regenerate if the content is actually different.
+        _logger.LogDebug("\tThe original bundle's last write time changed, comparing its hash");
+        if (fingerprint.OriginalBundleHash != ComputeFileHash(originalGameBundleInfo.FullName))
+            return false;
+
+        WriteFingerprint(
+            fingerprint with { OriginalBundleLastWriteTimeUtcTicks = originalGameBundleInfo.LastWriteTimeUtc.Ticks });
+        return true;
     }
 
-    private string ReadBundleVersion(
-        AssetsManager manager,
-        AssetsFileInstance globalManagersInstance)
+    internal string ComputePatchersInputsHash()
     {
-        _logger.LogDebug("\tReading PlayerSettings.bundleVersion");
-        AssetFileInfo playerSettingAsset = globalManagersInstance.file.GetAssetInfo(1);
-        AssetTypeValueField playerSettingsTypeValueField =
-            manager.GetBaseField(globalManagersInstance, playerSettingAsset);
-
-        string modifiedBundleVersion = playerSettingsTypeValueField["bundleVersion"].AsString;
-        _logger.LogDebug("\tRead {bundleVersion}", modifiedBundleVersion);
-        return modifiedBundleVersion;
+        StringBuilder sb = new();
+        sb.Append(FingerprintFormatVersion);
+        foreach (IGlobalManagersPatcher patcher in _globalManagersPatchers)
+        {
+            sb.Append('\n');
+            sb.Append(patcher.GetType().Name);
+            sb.Append('\n');
+            sb.Append(patcher.GetInputsFingerprint());
+        }
+
+        return Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(sb.ToString())));
+    }
+
+    private string ComputeFileHash(string path)
+    {
+        using Stream stream = _fileSystem.File.OpenRead(path);
+        return Convert.ToHexString(SHA256.HashData(stream));
+    }
+
+    internal bool TryReadFingerprint(out BundleFingerprint fingerprint)
+    {
+        fingerprint = default;
+        if (!_fileSystem.File.Exists(_modifiedGameBundleFingerprintPath))
+            return false;
+
+        string[] lines = _fileSystem.File.ReadAllLines(_modifiedGameBundleFingerprintPath);
+        if (lines.Length != 4
+            || !long.TryParse(lines[0], out long originalBundleSize)
+            || !long.TryParse(lines[1], out long originalBundleLastWriteTimeUtcTicks))
+        {
+            _logger.LogWarning("The modified bundle fingerprint is invalid, the bundle will be regenerated");
+            return false;
+        }
+
+        fingerprint = new(originalBundleSize, originalBundleLastWriteTimeUtcTicks, lines[2], lines[3]);
+        return true;
+    }
+
+    // The fingerprint is written to a temporary file first so it is never seen partially written
+    internal void WriteFingerprint(BundleFingerprint fingerprint)
+    {
+        _fileSystem.File.WriteAllLines(
+            _temporaryModifiedGameBundleFingerprintPath,
+            [
+                fingerprint.OriginalBundleSize.ToString(),
+                fingerprint.OriginalBundleLastWriteTimeUtcTicks.ToString(),
+                fingerprint.OriginalBundleHash,
+                fingerprint.PatchersInputsHash
+            ]);
+        _fileSystem.File.Move(_temporaryModifiedGameBundleFingerprintPath, _modifiedGameBundleFingerprintPath, true);
+    }
+
+    private void LoadClassDatabase(AssetsManager manager, AssetsFile globalManagersAssetFile)
+    {
+        _logger.LogDebug("\tLoading the class database using the assets file's Unity version");
+        manager.LoadClassDatabaseFromPackage(globalManagersAssetFile.Metadata.UnityVersion);
     }
 }
\ No newline at end of file
@@ -29,6 +29,8 @@ internal sealed class SplashScreenSkipper : IGlobalManagersPatcher
         _enableSkipper = globalSettings.Value.SkipUnitySplashScreen!.Value;
     }
 
+    public string GetInputsFingerprint() => $"{nameof(_enableSkipper)}={_enableSkipper}";
+
     public bool ShouldPatch(AssetsManager assetsManager, AssetsFileInstance globalManagersFileInstance)
     {
         _logger.LogDebug("\tReading PlayerSettings.m_ShowUnitySplashScreen");
@@ -1,4 +1,5 @@
 using Microsoft.Extensions.Logging;
+using System.Collections.Concurrent;
 using System.Runtime.InteropServices;
 using VenusRootLoader.Bootstrap.Shared;
 using Windows.Win32.Foundation;
@@ -10,10 +11,33 @@ namespace VenusRootLoader.Bootstrap.Unity;
 
 /// <summary>
 /// This service contains all the machinery needed to fully capture and mirror stdout, stderr and Unity's player logs
-/// into our logs
+/// into our logs. Every WriteFile done by Unity goes through here, including the ones that aren't logs, so each handle
+/// is only classified once and the classification is cached until the handle gets closed through our CloseHandle hook.
+/// The logs are accumulated per handle with a <see cref="Utf8LinesAccumulator"/> so only complete lines gets logged
 /// </summary>
 internal sealed class PlayerLogsMirroring
 {
+    private enum MirroredHandleKind
+    {
+        NotMirrored,
+        PlayerLog,
+        StandardStream
+    }
+
+    private sealed class MirroredHandle
+    {
+        internal static readonly MirroredHandle NotMirrored = new(MirroredHandleKind.NotMirrored, null);
+
+        internal readonly MirroredHandleKind Kind;
+        internal readonly Utf8LinesAccumulator? Lines;
+
+        internal MirroredHandle(MirroredHandleKind kind, Utf8LinesAccumulator? lines)
+        {
+            Kind = kind;
+            Lines = lines;
+        }
+    }
+
     [UnmanagedFunctionPointer(CallingConvention.StdCall)]
     private unsafe delegate int WriteFileFn(
         HANDLE hFile,
@@ -22,6 +46,12 @@ internal sealed class PlayerLogsMirroring
         uint* lpNumberOfBytesWritten,
         NativeOverlapped* lpOverlapped);
 
+    private static readonly FilePathMatcher[] UnityPlayerLogMatchers =
+    [
+        FilePathMatcher.FileNameSuffix("Player.log"),
+        FilePathMatcher.FileNameSuffix("output_log.txt")
+    ];
+
     private static WriteFileFn _hookWriteFileDelegate = null!;
 
     private HANDLE _outputHandle;
@@ -32,13 +62,17 @@ internal sealed class PlayerLogsMirroring
     private readonly IPltHooksManager _pltHooksManager;
     private readonly ILogger _logger;
     private readonly ICreateFileWSharedHooker _createFileWSharedHooker;
+    private readonly ICloseHandleSharedHooker _closeHandleSharedHooker;
     private readonly IGameExecutionContext _gameExecutionContext;
     private readonly IMonoInitLifeCycleEvents _monoInitLifeCycleEvents;
 
+    private readonly ConcurrentDictionary<nint, MirroredHandle> _mirroredHandles = new();
+
     public unsafe PlayerLogsMirroring(
         ILoggerFactory loggerFactory,
         IPltHooksManager pltHooksManager,
         ICreateFileWSharedHooker createFileWSharedHooker,
+        ICloseHandleSharedHooker closeHandleSharedHooker,
         IGameExecutionContext gameExecutionContext,
         IMonoInitLifeCycleEvents monoInitLifeCycleEvents,
         IWin32 win32)
@@ -46,6 +80,7 @@ internal sealed class PlayerLogsMirroring
         _pltHooksManager = pltHooksManager;
         _logger = loggerFactory.CreateLogger("UNITY");
         _createFileWSharedHooker = createFileWSharedHooker;
+        _closeHandleSharedHooker = closeHandleSharedHooker;
         _gameExecutionContext = gameExecutionContext;
         _monoInitLifeCycleEvents = monoInitLifeCycleEvents;
         _win32 = win32;
@@ -58,7 +93,8 @@ internal sealed class PlayerLogsMirroring
         _errorHandle = _win32.GetStdHandle(STD_HANDLE.STD_ERROR_HANDLE);
 
         _pltHooksManager.InstallHook(_gameExecutionContext.UnityPlayerDllFileName, "WriteFile", _hookWriteFileDelegate);
-        _createFileWSharedHooker.RegisterHook(nameof(PlayerLogsMirroring), IsUnityPlayerLogFilename, HookFileHandle);
+        _createFileWSharedHooker.RegisterHook(nameof(PlayerLogsMirroring), UnityPlayerLogMatchers, HookFileHandle);
+        _closeHandleSharedHooker.RegisterHook(nameof(PlayerLogsMirroring), HookCloseHandle);
         _monoInitLifeCycleEvents.Subscribe(OnGameLifecycle);
     }
 
@@ -67,9 +103,6 @@ internal sealed class PlayerLogsMirroring
         _createFileWSharedHooker.UnregisterHook(nameof(PlayerLogsMirroring));
     }
 
-    private static bool IsUnityPlayerLogFilename(string lpFilename) =>
-        lpFilename.EndsWith("Player.log") || lpFilename.EndsWith("output_log.txt");
-
     private unsafe void HookFileHandle(
         out HANDLE originalHandle,
         PCWSTR lpFileName,
@@ -89,9 +122,39 @@ internal sealed class PlayerLogsMirroring
             dwFlagsAndAttributes,
             hTemplateFile);
         _playerLogHandle = originalHandle;
+        // The handle's value could have been cached as something else if it was used before and closed without us
+        // knowing so it needs to be classified right away
+        _mirroredHandles[originalHandle.Value] = new(MirroredHandleKind.PlayerLog, new(_logger));
         _createFileWSharedHooker.UnregisterHook(nameof(PlayerLogsMirroring));
     }
 
+    // Closing a handle allows its value to be reused by a new one so its classification can no longer be trusted
+    private bool HookCloseHandle(HANDLE hObject)
+    {
+        if (!_mirroredHandles.TryRemove(hObject.Value, out MirroredHandle? mirroredHandle))
+            return false;
+
+        mirroredHandle.Lines?.Flush();
+        if (mirroredHandle.Kind == MirroredHandleKind.PlayerLog)
+            _playerLogHandle = (HANDLE)nint.Zero;
+        return false;
+    }
+
+    private MirroredHandle GetMirroredHandle(HANDLE hFile) =>
+        _mirroredHandles.GetOrAdd(
+            hFile.Value,
+            static (_, state) => state.sut.ClassifyHandle(state.hFile),
+            (sut: this, hFile));
+
+    private MirroredHandle ClassifyHandle(HANDLE hFile)
+    {
+        if (_win32.CompareObjectHandles(_playerLogHandle, hFile))
+            return new(MirroredHandleKind.PlayerLog, new(_logger));
+        if (_win32.CompareObjectHandles(hFile, _outputHandle) || _win32.CompareObjectHandles(hFile, _errorHandle))
+            return new(MirroredHandleKind.StandardStream, new(_logger));
+        return MirroredHandle.NotMirrored;
+    }
+
     // This hook is what collects every stdout, stderr or player logs done by Unity and writes them to our logs
     private unsafe int HookWriteFile(
         HANDLE hFile,
@@ -100,23 +163,9 @@ internal sealed class PlayerLogsMirroring
         uint* lpNumberOfBytesWritten,
         NativeOverlapped* lpOverlapped)
     {
-        BOOL writeToPlayerLog = _win32.CompareObjectHandles(_playerLogHandle, hFile);
-        bool writeToStandardHandles = _win32.CompareObjectHandles(hFile, _outputHandle) ||
-                                      _win32.CompareObjectHandles(hFile, _errorHandle);
-        if (!writeToPlayerLog && !writeToStandardHandles)
-        {
-            return _win32.WriteFile(
-                hFile,
-                new(lpBuffer),
-                nNumberOfBytesToWrite,
-                new(lpNumberOfBytesWritten),
-                new(lpOverlapped));
-        }
-
-        if (!_logger.IsEnabled(LogLevel.Trace))
+        MirroredHandle mirroredHandle = GetMirroredHandle(hFile);
+        if (mirroredHandle.Kind == MirroredHandleKind.NotMirrored)
         {
-            if (writeToStandardHandles)
-                return 1;
             return _win32.WriteFile(
                 hFile,
                 new(lpBuffer),
@@ -125,10 +174,10 @@ internal sealed class PlayerLogsMirroring
                 new(lpOverlapped));
         }
 
-        string log = Marshal.PtrToStringUTF8((nint)lpBuffer, (int)nNumberOfBytesToWrite);
-        _logger.LogTrace(log.TrimEnd("\r\n").ToString());
+        if (_logger.IsEnabled(LogLevel.Trace))
+            mirroredHandle.Lines!.Append(new(lpBuffer, (int)nNumberOfBytesToWrite));
 
-        if (writeToStandardHandles)
+        if (mirroredHandle.Kind == MirroredHandleKind.StandardStream)
             return 1;
 
         return _win32.WriteFile(
@@ -0,0 +1,129 @@
+using Microsoft.Extensions.Logging;
+using System.Text;
+
+namespace VenusRootLoader.Bootstrap.Unity;
+
+/// <summary>
+/// Logs the UTF-8 text written to a single handle as <see cref="LogLevel.Trace"/> entries, but only once it forms
+/// complete lines. A write can end in the middle of a line in which case the rest of the line is kept until a following
+/// write completes it. Everything up to the last line ending of a write is logged as one entry without its trailing
+/// line ending so a write of complete lines is logged exactly as it was written. The pending bytes live in a reused
+/// buffer so writes of complete lines are decoded directly from the written buffer without any intermediate copies
+/// </summary>
+internal sealed class Utf8LinesAccumulator
+{
+    /// <summary>
+    /// The amount of pending bytes without a line ending after which they are logged anyway, up to their last complete
+    /// code point
+    /// </summary>
+    internal const int MaxPendingBytes = 16 * 1024;
+
+    private static readonly Func<string, Exception?, string> MessageFormatter = static (message, _) => message;
+
+    private readonly ILogger _logger;
+    private readonly Lock _lock = new();
+
+    private byte[] _pendingBytes = [];
+    private int _pendingBytesLength;
+
+    internal Utf8LinesAccumulator(ILogger logger)
+    {
+        _logger = logger;
+    }
+
+    internal void Append(ReadOnlySpan<byte> bytes)
+    {
+        lock (_lock)
+        {
+            int lastLineEndingIndex = bytes.LastIndexOf((byte)'\n');
+            if (lastLineEndingIndex < 0)
+            {
+                AppendPendingBytes(bytes);
+                if (_pendingBytesLength >= MaxPendingBytes)
+                    LogPendingCompleteCodePoints();
+                return;
+            }
+
+            ReadOnlySpan<byte> completedLines = bytes[..(lastLineEndingIndex + 1)];
+            if (_pendingBytesLength == 0)
+            {
+                LogLines(completedLines);
+            }
+            else
+            {
+                AppendPendingBytes(completedLines);
+                LogPendingBytes();
+            }
+
+            AppendPendingBytes(bytes[(lastLineEndingIndex + 1)..]);
+        }
+    }
+
+    /// <summary>
+    /// Logs the pending bytes even if they don't end with a line ending. This is meant to be called when nothing more
+    /// will be written to the handle
+    /// </summary>
+    internal void Flush()
+    {
+        lock (_lock)
+        {
+            if (_pendingBytesLength > 0)
+                LogPendingBytes();
+        }
+    }
+
+    private void AppendPendingBytes(ReadOnlySpan<byte> bytes)
+    {
+        if (bytes.IsEmpty)
+            return;
+
+        int requiredLength = _pendingBytesLength + bytes.Length;
+        if (requiredLength > _pendingBytes.Length)
+            Array.Resize(ref _pendingBytes, Math.Max(requiredLength, Math.Max(256, _pendingBytes.Length * 2)));
+
+        bytes.CopyTo(_pendingBytes.AsSpan(_pendingBytesLength));
+        _pendingBytesLength = requiredLength;
+    }
+
+    private void LogPendingBytes()
+    {
+        LogLines(_pendingBytes.AsSpan(0, _pendingBytesLength));
+        _pendingBytesLength = 0;
+    }
+
+    // The rest of a code point split by the write is still to come so it's kept pending instead of being decoded as
+    // replacement characters
+    private void LogPendingCompleteCodePoints()
+    {
+        Span<byte> pendingBytes = _pendingBytes.AsSpan(0, _pendingBytesLength);
+        int completeCodePointsLength = GetCompleteCodePointsLength(pendingBytes);
+        LogLines(pendingBytes[..completeCodePointsLength]);
+        pendingBytes[completeCodePointsLength..].CopyTo(_pendingBytes);
+        _pendingBytesLength -= completeCodePointsLength;
+    }
+
+    private static int GetCompleteCodePointsLength(ReadOnlySpan<byte> bytes)
+    {
+        // A UTF-8 code point is at most 4 bytes long so only its last 3 bytes can be an incomplete one
+        for (int i = bytes.Length - 1; i >= Math.Max(0, bytes.Length - 3); i--)
+        {
+            byte b = bytes[i];
+            if ((b & 0b1100_0000) == 0b1000_0000)
+                continue;
+
+            int codePointLength = (b & 0b1110_0000) == 0b1100_0000 ? 2
+                : (b & 0b1111_0000) == 0b1110_0000 ? 3
+                : (b & 0b1111_1000) == 0b1111_0000 ? 4
+                : 1;
+            return bytes.Length - i < codePointLength ? i : bytes.Length;
+        }
+
+        return bytes.Length;
+    }
+
+    private void LogLines(ReadOnlySpan<byte> lines)
+    {
+        string message = Encoding.UTF8.GetString(lines.TrimEnd("\r\n"u8));
+        _logger.Log(LogLevel.Trace, default, message, null, MessageFormatter);
+    }
+}
\ No newline at end of file
@@ -32,13 +32,34 @@ internal sealed class Entry
         None = 6,
     }
 
+    /// <summary>
+    /// Copied from the bootstrap, the values must match
+    /// </summary>
+    internal enum TraceEventPhase
+    {
+        Begin = 0,
+        End = 1
+    }
+
     [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
     internal delegate void BootstrapLogFn(string message, string category, LogLevel logLevel);
 
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
+    internal delegate void BootstrapTraceFn(
+        TraceEventPhase phase,
+        string name,
+        string category,
+        long allocatedBytes,
+        int gcCount);
+
     // We want some minimal logging capabilities to monitor the booting so we use the log function directly.
     internal static BootstrapLogFn BootstrapLog = null!;
 
+    // This is null when tracing is disabled
+    internal static BootstrapTraceFn? BootstrapTrace;
+
     internal static nint BootstrapLogFunctionPtr;
+    internal static nint BootstrapTraceFunctionPtr;
     internal static nint GameExecutionContextPtr;
     internal static nint BasePathPtr;
 
@@ -73,12 +94,18 @@ internal sealed class Entry
     ];
 
     /// <summary>
-    /// This is the entry method called by the bootstrap. It receives 2 parameters that are meant to be forwarded to the loader.
+    /// This is the entry method called by the bootstrap. It receives 4 parameters that are meant to be forwarded to the loader.
     /// </summary>
     /// <param name="bootstrapLogFunctionPtr">A raw pointer to a <see cref="BootstrapLogFn"/> function for logging</param>
+    /// <param name="bootstrapTraceFunctionPtr">A raw pointer to a <see cref="BootstrapTraceFn"/> function for tracing
+    /// or 0 if tracing is disabled</param>
     /// <param name="gameExecutionContextPtr">A raw pointer to a struct containing information about the execution</param>
     /// <param name="basePathPtr">A raw pointer to a string containing the full path to use as the base directory</param>
-    internal static void Main(nint bootstrapLogFunctionPtr, nint gameExecutionContextPtr, nint basePathPtr)
+    internal static void Main(
+        nint bootstrapLogFunctionPtr,
+        nint bootstrapTraceFunctionPtr,
+        nint gameExecutionContextPtr,
+        nint basePathPtr)
     {
         string pathAssemblies = Path.Combine(AppDomain.CurrentDomain.BaseDirectory, "VenusRootLoader");
         foreach (string ass in ForceLoadAssemblies)
@@ -86,6 +113,9 @@ internal sealed class Entry
 
         BootstrapLogFunctionPtr = bootstrapLogFunctionPtr;
         BootstrapLog = Marshal.GetDelegateForFunctionPointer<BootstrapLogFn>(bootstrapLogFunctionPtr);
+        BootstrapTraceFunctionPtr = bootstrapTraceFunctionPtr;
+        if (bootstrapTraceFunctionPtr != 0)
+            BootstrapTrace = Marshal.GetDelegateForFunctionPointer<BootstrapTraceFn>(bootstrapTraceFunctionPtr);
         GameExecutionContextPtr = gameExecutionContextPtr;
         BasePathPtr = basePathPtr;
 
@@ -146,6 +176,21 @@ internal sealed class Entry
             .GetMethod("Main", BindingFlags.Static | BindingFlags.NonPublic)!;
         AppDomain.CurrentDomain.UnhandledException -= OnUnhandledException;
 
-        entryMethod.Invoke(null, [BootstrapLogFunctionPtr, GameExecutionContextPtr, BasePathPtr]);
+        // This span covers the entire boot of the loader
+        const string spanName = GameLoadHookMethodName + " hook";
+        long totalMemoryAtBegin = GC.GetTotalMemory(false);
+        int gcCountAtBegin = GC.CollectionCount(0);
+        BootstrapTrace?.Invoke(TraceEventPhase.Begin, spanName, LogCategory, 0, 0);
+
+        entryMethod.Invoke(
+            null,
+            [BootstrapLogFunctionPtr, BootstrapTraceFunctionPtr, GameExecutionContextPtr, BasePathPtr]);
+
+        BootstrapTrace?.Invoke(
+            TraceEventPhase.End,
+            spanName,
+            LogCategory,
+            GC.GetTotalMemory(false) - totalMemoryAtBegin,
+            GC.CollectionCount(0) - gcCountAtBegin);
     }
 }
\ No newline at end of file
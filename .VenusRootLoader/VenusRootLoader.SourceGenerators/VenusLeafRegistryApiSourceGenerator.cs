@@ -1,5 +1,7 @@
 using Humanizer;
 using Microsoft.CodeAnalysis;
+using Microsoft.CodeAnalysis.CSharp;
+using Microsoft.CodeAnalysis.CSharp.Syntax;
 using Microsoft.CodeAnalysis.Text;
 using System.Collections.Immutable;
 using System.Text;
@@ -33,6 +35,7 @@ public class VenusLeafRegistryApiSourceGenerator : IIncrementalGenerator
     }
 
     private const string MethodParameterSeparator = ",\n        ";
+    private const string LeafBaseTypeName = "VenusRootLoader.Api.Leaves.Leaf";
     private const string Namespace = "VenusRootLoader.SourceGenerators";
     private const string ExposeFromVenusAttribute = "ExposeFromVenusAttribute";
     private const string LeafInitializeFromNewAttribute = "LeafInitializeFromNewAttribute";
@@ -151,6 +154,31 @@ public class VenusLeafRegistryApiSourceGenerator : IIncrementalGenerator
             }
         """;
 
+    private const string LeafFactoriesSourceCodeTemplate =
+        """
+        // <auto-generated />
+
+        #nullable enable
+        namespace VenusRootLoader.Registry;
+
+        internal static partial class LeafFactories
+        {
+            static partial void AddGeneratedFactories(
+                System.Collections.Generic.Dictionary<System.Type, System.Delegate> factoriesByLeafTypes)
+            {
+        {{factories}}
+            }
+        }
+        """;
+
+    private const string LeafFactoryTemplate =
+        """
+                factoriesByLeafTypes.Add(
+                    typeof({{leafTypeName}}),
+                    new System.Func<int, string, string, {{leafTypeName}}>(
+                        static (gameId, creatorId, namedId) => new {{leafTypeName}}(gameId, creatorId, namedId)));
+        """;
+
     private const string VenusLeafGetMethodsTemplate =
         """
             public {{leafTypeName}} Get{{leafTypeNameWithoutLeafSuffix}}(string creatorId, string namedId)
@@ -245,12 +273,71 @@ public class VenusLeafRegistryApiSourceGenerator : IIncrementalGenerator
                 TransformLeafInitializationMethod)
             .Collect();
 
+        IncrementalValueProvider<ImmutableArray<string>> providerLeafFactories = context
+            .SyntaxProvider
+            .CreateSyntaxProvider(IsConcreteClassWithBaseType, TransformLeafFactoryType)
+            .Where(x => x is not null)
+            .Select((x, _) => x!)
+            .Collect();
+
         context.RegisterSourceOutput(finalProvider, GenerateCode);
         context.RegisterSourceOutput(providerMapEntityInitialization, GenerateCodeMapEntityRegistration);
+        context.RegisterSourceOutput(providerLeafFactories, GenerateCodeLeafFactories);
     }
 
     private static bool DummyPredicate(SyntaxNode syntaxNode, CancellationToken cancellationToken) => true;
 
+    private static bool IsConcreteClassWithBaseType(SyntaxNode syntaxNode, CancellationToken cancellationToken)
+    {
+        return syntaxNode is ClassDeclarationSyntax { BaseList: not null, TypeParameterList: null } classDeclaration &&
+               !classDeclaration.Modifiers.Any(SyntaxKind.AbstractKeyword) &&
+               !classDeclaration.Modifiers.Any(SyntaxKind.StaticKeyword);
+    }
+
+    // Returns the fully qualified name of the leaf type if it can be created by a generated factory
+    private static string? TransformLeafFactoryType(
+        GeneratorSyntaxContext syntaxContext,
+        CancellationToken cancellationToken)
+    {
+        if (syntaxContext.SemanticModel.GetDeclaredSymbol(syntaxContext.Node, cancellationToken)
+            is not INamedTypeSymbol leafTypeSymbol)
+        {
+            return null;
+        }
+
+        bool isLeaf = false;
+        for (INamedTypeSymbol? baseType = leafTypeSymbol.BaseType; baseType is not null; baseType = baseType.BaseType)
+        {
+            if (baseType.ToDisplayString() != LeafBaseTypeName)
+                continue;
+
+            isLeaf = true;
+            break;
+        }
+
+        if (!isLeaf)
+            return null;
+
+        for (INamedTypeSymbol? type = leafTypeSymbol; type is not null; type = type.ContainingType)
+        {
+            if (type.DeclaredAccessibility is Accessibility.Private or Accessibility.Protected
+                or Accessibility.ProtectedAndInternal)
+            {
+                return null;
+            }
+        }
+
+        bool hasLeafConstructor = leafTypeSymbol.InstanceConstructors.Any(c =>
+            c.DeclaredAccessibility is Accessibility.Public or Accessibility.Internal
+                or Accessibility.ProtectedOrInternal &&
+            c.Parameters.Length == 3 &&
+            c.Parameters[0].Type.SpecialType == SpecialType.System_Int32 &&
+            c.Parameters[1].Type.SpecialType == SpecialType.System_String &&
+            c.Parameters[2].Type.SpecialType == SpecialType.System_String);
+
+        return hasLeafConstructor ? leafTypeSymbol.ToDisplayString(SymbolDisplayFormat.FullyQualifiedFormat) : null;
+    }
+
     private static LeafTypeInfo TransformLeafType(
         GeneratorAttributeSyntaxContext syntaxContext,
         CancellationToken cancellationToken)
@@ -354,6 +441,22 @@ public class VenusLeafRegistryApiSourceGenerator : IIncrementalGenerator
         context.AddSource("VenusMapEntityRegistration.g.cs", SourceText.From(venusSourceCode, Encoding.UTF8));
     }
 
+    private static void GenerateCodeLeafFactories(
+        SourceProductionContext context,
+        ImmutableArray<string> leafTypeNames)
+    {
+        // A partial class may have more than one declaration with a base list, but it must only be added once
+        string factoriesSourceCode = string.Join(
+            "\n",
+            leafTypeNames
+                .Distinct()
+                .OrderBy(x => x, StringComparer.Ordinal)
+                .Select(x => LeafFactoryTemplate.Replace("{{leafTypeName}}", x)));
+        string leafFactoriesSourceCode = LeafFactoriesSourceCodeTemplate.Replace("{{factories}}", factoriesSourceCode);
+
+        context.AddSource("LeafFactories.g.cs", SourceText.From(leafFactoriesSourceCode, Encoding.UTF8));
+    }
+
     private static string BuildVenusMapEntityRegisterMethodSourceCode(
         LeafInitializationMethodInfo venusMapEntityRegisterMethodInfo)
     {
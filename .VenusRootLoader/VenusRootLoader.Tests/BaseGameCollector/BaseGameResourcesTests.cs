@@ -0,0 +1,108 @@
+using AwesomeAssertions;
+using NSubstitute;
+using UnityEngine;
+using VenusRootLoader.BaseGameCollector;
+using VenusRootLoader.Utility;
+
+namespace VenusRootLoader.Tests.BaseGameCollector;
+
+// Reading what the snapshot doesn't have requires Unity so only the reads from a valid snapshot can be tested
+public sealed class BaseGameResourcesTests
+{
+    private const string DialogueBleepsResourcesPath =
+        $"{ResourcesPaths.RootAudioPathPrefix}{ResourcesPaths.AudioSoundsDialogueDirectory}";
+
+    private readonly IBaseGameSnapshotCache _baseGameSnapshotCache = Substitute.For<IBaseGameSnapshotCache>();
+    private readonly BaseGameSnapshot _snapshot = new();
+
+    [Fact]
+    public void ReadTextAssetLines_ReturnsTheTrimmedLinesFromTheSnapshot_WhenTheSnapshotHasTheTextAsset()
+    {
+        _snapshot.TextAssetsTexts[$"{ResourcesPaths.RootDataPathPrefix}{ResourcesPaths.DataItemsPath}"] =
+            "\nItem 0\nItem 1\n";
+        BaseGameResources sut = CreateSutFromValidSnapshot();
+
+        TextAssetLines lines = sut.ReadTextAssetLines(ResourcesPaths.DataItemsPath);
+
+        lines.Lines.Should().Equal("Item 0", "Item 1");
+    }
+
+    [Fact]
+    public void ReadWholeTextAsset_ReturnsTheTrimmedTextFromTheSnapshot_WhenTheSnapshotHasTheTextAsset()
+    {
+        _snapshot.TextAssetsTexts[$"{ResourcesPaths.RootDataPathPrefix}{ResourcesPaths.DataMedalsOrderingPath}"] =
+            "1,0,2\n";
+        BaseGameResources sut = CreateSutFromValidSnapshot();
+
+        string text = sut.ReadWholeTextAsset(ResourcesPaths.DataMedalsOrderingPath);
+
+        text.Should().Be("1,0,2");
+    }
+
+    [Fact]
+    public void ReadAssetsNames_ReturnsTheNamesFromTheSnapshot_WhenTheSnapshotHasTheDirectoryOfThatType()
+    {
+        _snapshot.AssetsNames[$"{nameof(AudioClip)}:{DialogueBleepsResourcesPath}"] = ["Dialogue0", "Dialogue1"];
+        BaseGameResources sut = CreateSutFromValidSnapshot();
+
+        string[] names = sut.ReadAssetsNames<AudioClip>(DialogueBleepsResourcesPath);
+
+        names.Should().Equal("Dialogue0", "Dialogue1");
+    }
+
+    [Fact]
+    public void GetOrCollectMapsAssetsData_DoesNotCollect_WhenTheSnapshotHasTheData()
+    {
+        MapsAssetsData mapsAssetsData = CreateMapsAssetsData();
+        _snapshot.MapsAssetsData = mapsAssetsData;
+        BaseGameResources sut = CreateSutFromValidSnapshot();
+
+        MapsAssetsData result = sut.GetOrCollectMapsAssetsData(() => throw new InvalidOperationException());
+
+        result.Should().BeSameAs(mapsAssetsData);
+    }
+
+    [Fact]
+    public void SaveSnapshotIfChanged_DoesNotSave_WhenEverythingWasReadFromTheSnapshot()
+    {
+        _snapshot.TextAssetsTexts[$"{ResourcesPaths.RootDataPathPrefix}{ResourcesPaths.DataItemsPath}"] = "Item 0";
+        _snapshot.MapsAssetsData = CreateMapsAssetsData();
+        BaseGameResources sut = CreateSutFromValidSnapshot();
+        sut.ReadTextAssetLines(ResourcesPaths.DataItemsPath);
+        sut.GetOrCollectMapsAssetsData(CreateMapsAssetsData);
+
+        sut.SaveSnapshotIfChanged();
+
+        _baseGameSnapshotCache.DidNotReceive().Save(Arg.Any<BaseGameSnapshot>());
+    }
+
+    [Fact]
+    public void SaveSnapshotIfChanged_SavesTheCollectedDataOnce_WhenNoValidSnapshotExists()
+    {
+        _baseGameSnapshotCache.TryLoad(out Arg.Any<BaseGameSnapshot?>()).Returns(false);
+        BaseGameResources sut = new(_baseGameSnapshotCache);
+        MapsAssetsData mapsAssetsData = sut.GetOrCollectMapsAssetsData(CreateMapsAssetsData);
+
+        sut.SaveSnapshotIfChanged();
+        sut.SaveSnapshotIfChanged();
+
+        _baseGameSnapshotCache.Received(1).Save(Arg.Is<BaseGameSnapshot>(s => s.MapsAssetsData == mapsAssetsData));
+    }
+
+    private BaseGameResources CreateSutFromValidSnapshot()
+    {
+        _baseGameSnapshotCache.TryLoad(out Arg.Any<BaseGameSnapshot?>()).Returns(x =>
+        {
+            x[0] = _snapshot;
+            return true;
+        });
+        return new(_baseGameSnapshotCache);
+    }
+
+    private static MapsAssetsData CreateMapsAssetsData() =>
+        new()
+        {
+            MapControlsByGameIds = new() { [0] = new() },
+            MapGameIdsWithHoleHazards = []
+        };
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Testing;
+using System.IO.Abstractions.TestingHelpers;
+using System.Runtime.InteropServices;
+using UnityEngine;
+using VenusRootLoader.Api;
+using VenusRootLoader.BaseGameCollector;
+
+namespace VenusRootLoader.Tests.BaseGameCollector;
+
+public sealed class BaseGameSnapshotCacheTests
+{
+    private static readonly string RootPath = RuntimeInformation.IsOSPlatform(OSPlatform.Linux) ? "/" : "C:\\";
+    private static readonly string GamePath = Path.Combine(RootPath, "Game");
+    private static readonly string DataPath = Path.Combine(GamePath, "Bug Fables_Data");
+    private static readonly string LoaderPath = Path.Combine(RootPath, nameof(VenusRootLoader));
+    private static readonly string GameBundlePath = Path.Combine(DataPath, "data.unity3d");
+    private static readonly string AssemblyCSharpPath = Path.Combine(DataPath, "Managed", "Assembly-CSharp.dll");
+    private static readonly string SnapshotPath = Path.Combine(LoaderPath, BaseGameSnapshotCache.SnapshotFileName);
+    private static readonly DateTime InitialLastWriteTime = new(2024, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+
+    private readonly MockFileSystem _fileSystem = new();
+    private readonly FakeLogger<BaseGameSnapshotCache> _logger = new();
+
+    private readonly BaseGameSnapshotCache _sut;
+
+    public BaseGameSnapshotCacheTests()
+    {
+        _fileSystem.AddFile(GameBundlePath, new(new byte[] { 1, 2, 3, 4 }));
+        _fileSystem.AddFile(AssemblyCSharpPath, new(new byte[] { 5, 6, 7 }));
+        _fileSystem.AddDirectory(LoaderPath);
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, InitialLastWriteTime);
+        _fileSystem.File.SetLastWriteTimeUtc(AssemblyCSharpPath, InitialLastWriteTime);
+
+        _sut = new(
+            _fileSystem,
+            _logger,
+            new()
+            {
+                GameDir = GamePath,
+                DataDir = DataPath,
+                UnityPlayerDllFileName = Path.Combine(GamePath, "UnityPlayer.dll"),
+                IsWine = false
+            },
+            new BudLoaderContext
+            {
+                BudsPath = Path.Combine(RootPath, "Buds"),
+                SaveDataPath = Path.Combine(RootPath, "SaveData"),
+                ConfigPath = Path.Combine(RootPath, "Config"),
+                LoaderPath = LoaderPath
+            });
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsFalse_WhenNoSnapshotExists()
+    {
+        bool result = _sut.TryLoad(out BaseGameSnapshot? snapshot);
+
+        result.Should().BeFalse();
+        snapshot.Should().BeNull();
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsSavedData_WhenGameFilesDidNotChange()
+    {
+        BaseGameSnapshot savedSnapshot = CreateSnapshot();
+        _sut.Save(savedSnapshot);
+
+        bool result = _sut.TryLoad(out BaseGameSnapshot? loadedSnapshot);
+
+        result.Should().BeTrue();
+        _fileSystem.File.Exists(SnapshotPath).Should().BeTrue();
+        loadedSnapshot.Should().BeEquivalentTo(savedSnapshot, options => options.IncludingInternalProperties());
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsSavedData_WhenGameFilesWereOnlyTouched()
+    {
+        BaseGameSnapshot savedSnapshot = CreateSnapshot();
+        _sut.Save(savedSnapshot);
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, InitialLastWriteTime.AddDays(1));
+
+        bool result = _sut.TryLoad(out BaseGameSnapshot? loadedSnapshot);
+
+        result.Should().BeTrue();
+        loadedSnapshot.Should().BeEquivalentTo(savedSnapshot, options => options.IncludingInternalProperties());
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsSavedSnapshot_WhenMapsAssetsDataWasNotCollected()
+    {
+        BaseGameSnapshot savedSnapshot = new();
+        savedSnapshot.TextAssetsTexts["Data/Items"] = "Item 0";
+        _sut.Save(savedSnapshot);
+
+        bool result = _sut.TryLoad(out BaseGameSnapshot? loadedSnapshot);
+
+        result.Should().BeTrue();
+        loadedSnapshot.Should().BeEquivalentTo(savedSnapshot, options => options.IncludingInternalProperties());
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsFalse_WhenGameBundleContentChanged()
+    {
+        _sut.Save(CreateSnapshot());
+        _fileSystem.File.WriteAllBytes(GameBundlePath, [4, 3, 2, 1]);
+        _fileSystem.File.SetLastWriteTimeUtc(GameBundlePath, InitialLastWriteTime.AddDays(1));
+
+        bool result = _sut.TryLoad(out BaseGameSnapshot? loadedSnapshot);
+
+        result.Should().BeFalse();
+        loadedSnapshot.Should().BeNull();
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsFalse_WhenAssemblyCSharpSizeChanged()
+    {
+        _sut.Save(CreateSnapshot());
+        _fileSystem.File.WriteAllBytes(AssemblyCSharpPath, [5, 6, 7, 8]);
+        _fileSystem.File.SetLastWriteTimeUtc(AssemblyCSharpPath, InitialLastWriteTime);
+
+        bool result = _sut.TryLoad(out BaseGameSnapshot? loadedSnapshot);
+
+        result.Should().BeFalse();
+        loadedSnapshot.Should().BeNull();
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsFalseAndLogsWarning_WhenSnapshotIsCorrupted()
+    {
+        _sut.Save(CreateSnapshot());
+        byte[] snapshotBytes = _fileSystem.File.ReadAllBytes(SnapshotPath);
+        _fileSystem.File.WriteAllBytes(SnapshotPath, snapshotBytes.Take(snapshotBytes.Length / 2).ToArray());
+
+        bool result = _sut.TryLoad(out BaseGameSnapshot? loadedSnapshot);
+
+        result.Should().BeFalse();
+        loadedSnapshot.Should().BeNull();
+        _logger.LatestRecord.Level.Should().Be(LogLevel.Warning);
+    }
+
+    private static BaseGameSnapshot CreateSnapshot()
+    {
+        MapControlData mapControlData = new()
+        {
+            AreaId = 3,
+            CamOffset = new(1f, 2f, 3f),
+            CamLimitPos = new(100f, 50f, 100f),
+            RotateCam = true,
+            FogColor = new(0.1f, 0.2f, 0.3f, 1f),
+            SkyboxMaterialName = "Sky",
+            TattleId = -4,
+            YLimit = -20f,
+            MainMeshTransformPath = "Base/Mesh",
+            ReadDataFromOtherMap = 12
+        };
+        mapControlData.MusicNames.AddRange(["Field1", null]);
+        mapControlData.MusicFlags.Add(new(-1, 1));
+        mapControlData.InsidesTransformPaths.Add("Insides/House");
+        mapControlData.InsideTypes.Add(2);
+        mapControlData.CanFollowIds.AddRange([0, 1]);
+        mapControlData.DiscoveryIds.Add(7);
+        mapControlData.AutoEvents.Add(new(10f, 20f));
+        mapControlData.EventPointersTransformPaths.Add("Events/Pointer");
+
+        BaseGameSnapshot snapshot = new()
+        {
+            MapsAssetsData = new()
+            {
+                MapControlsByGameIds = new() { [1] = mapControlData, [2] = new() },
+                MapGameIdsWithHoleHazards = [2]
+            }
+        };
+        snapshot.TextAssetsTexts["Data/Items"] = "Item 0\nItem 1\n";
+        snapshot.TextAssetsTexts["Data/Dialogues0/Maps/TestRoom"] = "";
+        snapshot.AssetsNames["AudioClip:Audio/Sounds/Dialogue"] = ["Dialogue0", "Dialogue1", "Dialogue3old"];
+        snapshot.AssetsNames["Sprite:Sprites/Objects/grass"] = [];
+        return snapshot;
+    }
+}
\ No newline at end of file
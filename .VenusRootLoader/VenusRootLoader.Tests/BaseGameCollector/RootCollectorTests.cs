@@ -0,0 +1,295 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.DependencyInjection;
+using Microsoft.Extensions.Logging.Testing;
+using NSubstitute;
+using System.Collections.Concurrent;
+using System.Runtime.Serialization;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.BaseGameCollector;
+using VenusRootLoader.Extensions;
+using VenusRootLoader.Registry;
+using VenusRootLoader.Tracing;
+
+namespace VenusRootLoader.Tests.BaseGameCollector;
+
+public sealed class RootCollectorTests
+{
+    private const int LinesAmount = 2000;
+
+    private readonly FakeLogger<RootCollector> _logger = new();
+    private readonly IBaseGameResources _baseGameResources = Substitute.For<IBaseGameResources>();
+    private readonly Tracer _tracer = new(new BootstrapFunctions { BootstrapLog = (_, _, _) => { } });
+    private readonly ConcurrentQueue<string> _events = new();
+
+    [Fact]
+    public void CollectAndRegisterBaseGameData_ProducesTheSameRegistriesAsASequentialCollection()
+    {
+        FakeRankBonusesCollector[] sequentialCollectors = CreateCollectors(new());
+        foreach (FakeRankBonusesCollector collector in sequentialCollectors)
+        {
+            collector.RegisterBaseGameData();
+            collector.ParseBaseGameData();
+        }
+
+        FakeRankBonusesCollector[] collectors = CreateCollectors(_events);
+        RootCollector sut = new(collectors, _baseGameResources, _tracer, _logger);
+
+        sut.CollectAndRegisterBaseGameData();
+
+        for (int i = 0; i < collectors.Length; i++)
+        {
+            collectors[i].Registry.Select(DescribeLeaf).Should()
+                .Equal(sequentialCollectors[i].Registry.Select(DescribeLeaf));
+        }
+    }
+
+    [Fact]
+    public void CollectAndRegisterBaseGameData_RegistersInOrderBeforeParsingAfterTheDependencies()
+    {
+        FakeRankBonusesCollector[] collectors = CreateCollectors(_events);
+        RootCollector sut = new(collectors, _baseGameResources, _tracer, _logger);
+
+        sut.CollectAndRegisterBaseGameData();
+
+        List<string> events = _events.ToList();
+        events.Take(3).Should().Equal(
+            $"{nameof(FirstCollector)}.Register",
+            $"{nameof(SecondCollector)}.Register",
+            $"{nameof(ThirdCollector)}.Register");
+        events.Skip(3).Should().BeEquivalentTo(
+            $"{nameof(FirstCollector)}.Parsed",
+            $"{nameof(SecondCollector)}.Parsed",
+            $"{nameof(ThirdCollector)}.Parsed");
+        events.IndexOf($"{nameof(SecondCollector)}.Parsed").Should()
+            .BeGreaterThan(events.IndexOf($"{nameof(FirstCollector)}.Parsed"));
+    }
+
+    [Fact]
+    public void CollectAndRegisterBaseGameData_ReportsTheParseDurationOfEveryCollector()
+    {
+        FakeRankBonusesCollector[] collectors = CreateCollectors(_events);
+        RootCollector sut = new(collectors, _baseGameResources, _tracer, _logger);
+
+        sut.CollectAndRegisterBaseGameData();
+
+        sut.ParseDurations.Keys.Should().BeEquivalentTo(
+            typeof(FirstCollector),
+            typeof(SecondCollector),
+            typeof(ThirdCollector));
+        sut.ParseDurations.Values.Should().AllSatisfy(d => d.Should().BeGreaterThanOrEqualTo(TimeSpan.Zero));
+    }
+
+    [Fact]
+    public void CollectAndRegisterBaseGameData_ThrowsInvalidOperationException_WhenADependencyIsRegisteredAfter()
+    {
+        FakeRankBonusesCollector[] collectors = CreateCollectors(_events);
+        RootCollector sut = new([collectors[1], collectors[0], collectors[2]], _baseGameResources, _tracer, _logger);
+
+        Action act = () => sut.CollectAndRegisterBaseGameData();
+
+        act.Should().Throw<InvalidOperationException>();
+    }
+
+    [Fact]
+    public void CollectAndRegisterBaseGameData_DoesNotParseDependents_WhenADependencyFailsToParse()
+    {
+        FakeRankBonusesCollector[] collectors = CreateCollectors(_events);
+        collectors[0].ThrowOnParse = true;
+        RootCollector sut = new(collectors, _baseGameResources, _tracer, _logger);
+
+        Action act = () => sut.CollectAndRegisterBaseGameData();
+
+        act.Should().Throw<AggregateException>()
+            .Which.InnerExceptions.Should().ContainSingle()
+            .Which.Should().BeOfType<InvalidDataException>();
+        _events.Should().NotContain($"{nameof(SecondCollector)}.Parsed");
+        _events.Should().Contain($"{nameof(ThirdCollector)}.Parsed");
+    }
+
+    // The real collectors can't be constructed outside the game so their ParsingDependencies are read from
+    // uninitialized instances and the leaves their parsing touches are approximated by the registries they and their
+    // parsers take. The owner of a leaf type is the first collector taking its registry. Some collectors only read
+    // other collectors' leaves during the sequential registration which only requires their owner to be registered
+    // before.
+    [Fact]
+    public void AddBaseGameCollectors_RegistersCollectorsDependingOnTheOwnersOfTheLeavesTheyTouch()
+    {
+        Dictionary<Type, Type[]> registrationOnlyLeafTypes = new()
+        {
+            [typeof(PrizeMedalsCollector)] = [typeof(MedalLeaf), typeof(FlagvarLeaf)],
+            [typeof(MedalFortuneTellerHintCollector)] = [typeof(FlagLeaf)],
+            [typeof(LoreBooksCollector)] = [typeof(FlagLeaf)],
+            [typeof(MedalShopsCollector)] = [typeof(FlagLeaf), typeof(MedalLeaf)]
+        };
+        Type[] collectorTypes = new ServiceCollection()
+            .AddBaseGameCollectors()
+            .Where(d => d.ServiceType == typeof(IBaseGameCollector))
+            .Select(d => d.ImplementationType!)
+            .ToArray();
+        Dictionary<Type, IReadOnlyCollection<Type>> parsingDependencies = collectorTypes.ToDictionary(
+            t => t,
+            t => ((IBaseGameCollector)FormatterServices.GetUninitializedObject(t)).ParsingDependencies);
+        Dictionary<Type, Type> leafTypesOwners = new();
+        foreach (Type collectorType in collectorTypes)
+        {
+            foreach (Type leafType in GetRegistriesLeafTypes(collectorType))
+            {
+                if (!leafTypesOwners.ContainsKey(leafType))
+                    leafTypesOwners[leafType] = collectorType;
+            }
+        }
+
+        List<string> violations = new();
+        for (int i = 0; i < collectorTypes.Length; i++)
+        {
+            Type collectorType = collectorTypes[i];
+            HashSet<Type> dependencies = GetTransitiveDependencies(collectorType, parsingDependencies);
+            HashSet<Type> touchedLeafTypes = GetTouchedLeafTypes(collectorType);
+            registrationOnlyLeafTypes.TryGetValue(collectorType, out Type[]? collectorRegistrationOnlyLeafTypes);
+            foreach (Type leafType in touchedLeafTypes)
+            {
+                Type owner = leafTypesOwners[leafType];
+                bool isRegistrationOnly = collectorRegistrationOnlyLeafTypes?.Contains(leafType) ?? false;
+                bool isSatisfied = owner == collectorType
+                                   || (isRegistrationOnly
+                                       ? Array.IndexOf(collectorTypes, owner) < i
+                                       : dependencies.Contains(owner));
+                if (!isSatisfied)
+                    violations.Add($"{collectorType.Name} touches {leafType.Name} owned by {owner.Name}");
+            }
+
+            foreach (Type dependency in parsingDependencies[collectorType])
+            {
+                int dependencyIndex = Array.IndexOf(collectorTypes, dependency);
+                if (dependencyIndex < 0 || dependencyIndex >= i)
+                    violations.Add($"{collectorType.Name} depends on {dependency.Name} which isn't registered before");
+            }
+        }
+
+        violations.Should().BeEmpty();
+    }
+
+    private static HashSet<Type> GetTransitiveDependencies(
+        Type collectorType,
+        Dictionary<Type, IReadOnlyCollection<Type>> parsingDependencies)
+    {
+        HashSet<Type> dependencies = new();
+        Stack<Type> toVisit = new(parsingDependencies[collectorType]);
+        while (toVisit.Count > 0)
+        {
+            Type dependency = toVisit.Pop();
+            if (!dependencies.Add(dependency))
+                continue;
+            foreach (Type nextDependency in parsingDependencies[dependency])
+                toVisit.Push(nextDependency);
+        }
+
+        return dependencies;
+    }
+
+    // The leaves touched by a collector are the ones of the registries it takes and the ones its parsers take
+    private static HashSet<Type> GetTouchedLeafTypes(Type collectorType)
+    {
+        HashSet<Type> leafTypes = new(GetRegistriesLeafTypes(collectorType));
+        IEnumerable<Type> parserTypes = collectorType.GetConstructors().Single().GetParameters()
+            .Select(p => p.ParameterType)
+            .Where(t => t.IsInterface && t.Name.Contains("TextAssetParser"));
+        foreach (Type parserType in parserTypes)
+        {
+            IEnumerable<Type> parserImplementations = typeof(RootCollector).Assembly.GetTypes()
+                .Where(t => t is { IsClass: true, IsAbstract: false } && parserType.IsAssignableFrom(t));
+            foreach (Type parserImplementation in parserImplementations)
+                leafTypes.UnionWith(GetRegistriesLeafTypes(parserImplementation));
+        }
+
+        return leafTypes;
+    }
+
+    private static IEnumerable<Type> GetRegistriesLeafTypes(Type type) =>
+        type.GetConstructors()
+            .SelectMany(c => c.GetParameters())
+            .Select(p => p.ParameterType)
+            .Where(t => t.IsGenericType
+                        && (t.GetGenericTypeDefinition() == typeof(ILeavesRegistry<>)
+                            || t.GetGenericTypeDefinition() == typeof(IOrderedLeavesRegistry<>)))
+            .Select(t => t.GetGenericArguments()[0]);
+
+    private static FakeRankBonusesCollector[] CreateCollectors(ConcurrentQueue<string> events)
+    {
+        FirstCollector first = new(events);
+        return [first, new SecondCollector(events, first), new ThirdCollector(events)];
+    }
+
+    private static (int GameId, string NamedId, int RankNeeded, int FirstParameter) DescribeLeaf(
+        RankBonusLeaf leaf) => (leaf.GameId, leaf.NamedId, leaf.RankNeeded, leaf.FirstParameter);
+
+    private abstract class FakeRankBonusesCollector : IBaseGameCollector
+    {
+        private readonly string[] _lines;
+        private readonly ConcurrentQueue<string> _events;
+
+        protected FakeRankBonusesCollector(
+            ConcurrentQueue<string> events,
+            int multiplier,
+            IReadOnlyCollection<Type> parsingDependencies)
+        {
+            _events = events;
+            _lines = Enumerable.Range(0, LinesAmount).Select(i => $"{i},{i * multiplier}").ToArray();
+            ParsingDependencies = parsingDependencies;
+        }
+
+        internal AutoSequentialIdBasedRegistry<RankBonusLeaf> Registry { get; } =
+            new(new FakeLogger(), IdSequenceDirection.Increment);
+
+        internal bool ThrowOnParse { get; set; }
+
+        public IReadOnlyCollection<Type> ParsingDependencies { get; }
+
+        public void RegisterBaseGameData()
+        {
+            _events.Enqueue($"{GetType().Name}.Register");
+            for (int i = 0; i < _lines.Length; i++)
+                Registry.RegisterExisting(i, i.ToString());
+        }
+
+        public void ParseBaseGameData()
+        {
+            if (ThrowOnParse)
+                throw new InvalidDataException();
+
+            for (int i = 0; i < _lines.Length; i++)
+            {
+                string[] fields = _lines[i].Split(',');
+                RankBonusLeaf leaf = Registry.GetByGameId(i);
+                leaf.RankNeeded = int.Parse(fields[0]) + ReadDependencyData(i);
+                leaf.FirstParameter = int.Parse(fields[1]);
+            }
+
+            _events.Enqueue($"{GetType().Name}.Parsed");
+        }
+
+        protected virtual int ReadDependencyData(int gameId) => 0;
+    }
+
+    private sealed class FirstCollector : FakeRankBonusesCollector
+    {
+        internal FirstCollector(ConcurrentQueue<string> events) : base(events, 2, []) { }
+    }
+
+    // This collector reads the data parsed by the first one so it must not be parsed before it
+    private sealed class SecondCollector : FakeRankBonusesCollector
+    {
+        private readonly FirstCollector _firstCollector;
+
+        internal SecondCollector(ConcurrentQueue<string> events, FirstCollector firstCollector)
+            : base(events, 3, [typeof(FirstCollector)]) => _firstCollector = firstCollector;
+
+        protected override int ReadDependencyData(int gameId) =>
+            _firstCollector.Registry.GetByGameId(gameId).FirstParameter;
+    }
+
+    private sealed class ThirdCollector : FakeRankBonusesCollector
+    {
+        internal ThirdCollector(ConcurrentQueue<string> events) : base(events, 5, []) { }
+    }
+}
\ No newline at end of file
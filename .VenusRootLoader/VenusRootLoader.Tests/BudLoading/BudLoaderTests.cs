@@ -14,6 +14,7 @@ using System.Runtime.InteropServices;
 using System.Security.Permissions;
 using VenusRootLoader.Api;
 using VenusRootLoader.BudLoading;
+using VenusRootLoader.Tracing;
 using CustomAttributeNamedArgument = AsmResolver.DotNet.Signatures.CustomAttributeNamedArgument;
 using MethodAttributes = AsmResolver.PE.DotNet.Metadata.Tables.MethodAttributes;
 using SecurityAction = AsmResolver.PE.DotNet.Metadata.Tables.SecurityAction;
@@ -38,6 +39,7 @@ public sealed class BudLoaderTests
     private readonly ILoggerFactory _loggerFactory = Substitute.For<ILoggerFactory>();
     private readonly IVenusFactory _venusFactory = Substitute.For<IVenusFactory>();
     private readonly IBudConfigManager _budConfigManager = Substitute.For<IBudConfigManager>();
+    private readonly ITracer _tracer = Substitute.For<ITracer>();
     private readonly FakeLogger<BudLoader> _logger = new();
     private readonly MockFileSystem _fileSystem = new();
 
@@ -67,7 +69,8 @@ public sealed class BudLoaderTests
             _logger,
             _loggerFactory,
             _venusFactory,
-            _budConfigManager);
+            _budConfigManager,
+            _tracer);
     }
 
     [Fact]
@@ -445,7 +448,7 @@ public sealed class BudLoaderTests
                 BudIncompatibilities = []
             },
             BudAssemblyPath = Path.Combine(BudsPath, budId, assemblyName),
-            BudType = budType
+            BudTypeFullName = budType.FullName
         };
         return bud;
     }
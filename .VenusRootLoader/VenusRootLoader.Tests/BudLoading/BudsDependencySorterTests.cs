@@ -1,4 +1,3 @@
-using AsmResolver.PE.DotNet.Metadata.Tables;
 using AwesomeAssertions;
 using Microsoft.Extensions.Logging.Testing;
 using VenusRootLoader.Api;
@@ -115,7 +114,7 @@ public sealed class BudsDependencySorterTests
                 BudIncompatibilities = []
             },
             BudAssemblyPath = $"{budId}.dll",
-            BudType = new("namespace", budId, TypeAttributes.Class)
+            BudTypeFullName = $"namespace.{budId}"
         };
     }
 }
\ No newline at end of file
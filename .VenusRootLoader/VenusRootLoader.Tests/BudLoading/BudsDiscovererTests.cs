@@ -65,6 +65,7 @@ public sealed class BudsDiscovererTests
         }
     };
 
+    private readonly BudsDiscoveryCache _budsDiscoveryCache;
     private readonly BudsDiscoverer _sut;
 
     public BudsDiscovererTests()
@@ -73,7 +74,8 @@ public sealed class BudsDiscovererTests
         _fileSystem.Directory.CreateDirectory(ConfigPath);
         _fileSystem.Directory.CreateDirectory(LoaderPath);
 
-        _sut = new BudsDiscoverer(_fileSystem, _logger, _budLoaderContext);
+        _budsDiscoveryCache = new(_fileSystem, new FakeLogger<BudsDiscoveryCache>(), _budLoaderContext);
+        _sut = new BudsDiscoverer(_fileSystem, _logger, _budLoaderContext, _budsDiscoveryCache);
     }
 
     [Fact]
@@ -102,13 +104,13 @@ public sealed class BudsDiscovererTests
 
         buds.Should().HaveCount(3);
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "a", "a.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("aType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.aType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestA);
         buds[1].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[1].BudType.Name!.Value.Should().Be("bType0");
+        buds[1].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[1].BudManifest.Should().BeEquivalentTo(budManifestB);
         buds[2].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "c", "c.dll"));
-        buds[2].BudType.Name!.Value.Should().Be("cType0");
+        buds[2].BudTypeFullName.Should().Be("Namespace.cType0");
         buds[2].BudManifest.Should().BeEquivalentTo(budManifestC);
     }
 
@@ -126,7 +128,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -144,7 +146,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -162,7 +164,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -180,7 +182,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -198,7 +200,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -216,7 +218,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -234,7 +236,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -252,7 +254,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -273,7 +275,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -294,7 +296,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -315,7 +317,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -336,7 +338,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -361,7 +363,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -378,7 +380,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -396,7 +398,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -417,7 +419,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -438,7 +440,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -459,7 +461,7 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -480,7 +482,65 @@ public sealed class BudsDiscovererTests
 
         buds.Should().ContainSingle();
         buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
-        buds[0].BudType.Name!.Value.Should().Be("bType0");
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
+        buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
+    }
+
+    [Fact]
+    public void DiscoverAllBudsFromDisk_ReturnsCachedBuds_WhenBudsDidNotChangeSinceLastDiscovery()
+    {
+        BudManifest budManifestA = CreateBudManifest("a", BudManifestFileState.Valid);
+        CreateAssemblyForBud(budManifestA);
+        BudManifest budManifestB = CreateBudManifest("b", BudManifestFileState.Valid);
+        CreateAssemblyForBud(budManifestB);
+        _sut.DiscoverAllBudsFromDisk();
+
+        // The assembly is corrupted without changing its size or last write time which would fail the discovery if
+        // it was inspected again
+        string budAssemblyPathA = Path.Combine(BudsPath, "a", "a.dll");
+        DateTime lastWriteTimeUtc = _fileSystem.File.GetLastWriteTimeUtc(budAssemblyPathA);
+        _fileSystem.File.WriteAllBytes(budAssemblyPathA, new byte[_fileSystem.FileInfo.New(budAssemblyPathA).Length]);
+        _fileSystem.File.SetLastWriteTimeUtc(budAssemblyPathA, lastWriteTimeUtc);
+
+        BudsDiscoveryCache budsDiscoveryCache = new(
+            _fileSystem,
+            new FakeLogger<BudsDiscoveryCache>(),
+            _budLoaderContext);
+        BudsDiscoverer sut = new(_fileSystem, _logger, _budLoaderContext, budsDiscoveryCache);
+        IList<BudInfo> buds = sut.DiscoverAllBudsFromDisk();
+
+        TestUtility.AssertErrorLogs(_logger, 0);
+
+        budsDiscoveryCache.Hits.Should().Be(2);
+        budsDiscoveryCache.Misses.Should().Be(0);
+        buds.Should().HaveCount(2);
+        buds[0].BudAssemblyPath.Should().Be(budAssemblyPathA);
+        buds[0].BudTypeFullName.Should().Be("Namespace.aType0");
+        buds[0].BudManifest.Should().BeEquivalentTo(budManifestA);
+        buds[1].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
+        buds[1].BudTypeFullName.Should().Be("Namespace.bType0");
+        buds[1].BudManifest.Should().BeEquivalentTo(budManifestB);
+    }
+
+    [Fact]
+    public void DiscoverAllBudsFromDisk_DiscoversBudsAgain_WhenTheirManifestChangedSinceLastDiscovery()
+    {
+        BudManifest budManifestA = CreateBudManifest("a", BudManifestFileState.Valid);
+        CreateAssemblyForBud(budManifestA);
+        BudManifest budManifestB = CreateBudManifest("b", BudManifestFileState.Valid);
+        CreateAssemblyForBud(budManifestB);
+        _sut.DiscoverAllBudsFromDisk();
+
+        CreateBudManifest("a", BudManifestFileState.Corrupt);
+        IList<BudInfo> buds = _sut.DiscoverAllBudsFromDisk();
+
+        TestUtility.AssertErrorLogs(_logger, 1);
+
+        _budsDiscoveryCache.Hits.Should().Be(1);
+        _budsDiscoveryCache.Misses.Should().Be(1);
+        buds.Should().ContainSingle();
+        buds[0].BudAssemblyPath.Should().Be(Path.Combine(BudsPath, "b", "b.dll"));
+        buds[0].BudTypeFullName.Should().Be("Namespace.bType0");
         buds[0].BudManifest.Should().BeEquivalentTo(budManifestB);
     }
 
@@ -1,4 +1,3 @@
-using AsmResolver.PE.DotNet.Metadata.Tables;
 using AwesomeAssertions;
 using Microsoft.Extensions.Logging;
 using Microsoft.Extensions.Logging.Testing;
@@ -35,7 +34,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -50,7 +49,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -65,7 +64,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -102,7 +101,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -117,7 +116,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -132,7 +131,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -169,7 +168,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -192,7 +191,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -207,7 +206,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -254,7 +253,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -277,7 +276,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -292,7 +291,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -334,7 +333,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -357,7 +356,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -372,7 +371,7 @@ public sealed class BudsLoadOrderEnumeratorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -1,4 +1,3 @@
-using AsmResolver.PE.DotNet.Metadata.Tables;
 using AwesomeAssertions;
 using Microsoft.Extensions.Logging;
 using Microsoft.Extensions.Logging.Testing;
@@ -35,7 +34,7 @@ public sealed class BudsValidatorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -50,7 +49,7 @@ public sealed class BudsValidatorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -65,7 +64,7 @@ public sealed class BudsValidatorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -96,7 +95,7 @@ public sealed class BudsValidatorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -111,7 +110,7 @@ public sealed class BudsValidatorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -126,7 +125,7 @@ public sealed class BudsValidatorTests
                     BudIncompatibilities = []
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
         List<BudInfo> buds = buds1;
@@ -169,7 +168,7 @@ public sealed class BudsValidatorTests
                     ]
                 },
                 BudAssemblyPath = "a.dll",
-                BudType = new("a", "a", TypeAttributes.Class)
+                BudTypeFullName = "a.a"
             },
             new()
             {
@@ -191,7 +190,7 @@ public sealed class BudsValidatorTests
                     ]
                 },
                 BudAssemblyPath = "b.dll",
-                BudType = new("b", "b", TypeAttributes.Class)
+                BudTypeFullName = "b.b"
             },
             new()
             {
@@ -213,7 +212,7 @@ public sealed class BudsValidatorTests
                     ]
                 },
                 BudAssemblyPath = "c.dll",
-                BudType = new("c", "c", TypeAttributes.Class)
+                BudTypeFullName = "c.c"
             }
         ];
 
@@ -0,0 +1,81 @@
+using AwesomeAssertions;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers;
+
+namespace VenusRootLoader.Tests.Patching.Resources.TextAssetPatchers;
+
+public sealed class TextAssetPatchCacheTests
+{
+    private readonly TextAssetPatchCache _sut = new();
+
+    [Fact]
+    public void TryGetPatchedText_ReturnsFalseAndCountsMiss_WhenNothingWasCached()
+    {
+        bool found = _sut.TryGetPatchedText(
+            "ItemData",
+            TextAssetPatchCache.NonLocalizedLanguageId,
+            0,
+            out string? text);
+
+        found.Should().BeFalse();
+        text.Should().BeNull();
+        _sut.Hits.Should().Be(0);
+        _sut.Misses.Should().Be(1);
+    }
+
+    [Fact]
+    public void TryGetPatchedText_ReturnsSameCachedInstanceAndCountsHit_WhenVersionMatches()
+    {
+        string cachedText = "line1\nline2\n";
+        _sut.SetPatchedText("ItemData", TextAssetPatchCache.NonLocalizedLanguageId, 3, cachedText);
+
+        bool found = _sut.TryGetPatchedText(
+            "itemdata",
+            TextAssetPatchCache.NonLocalizedLanguageId,
+            3,
+            out string? text);
+
+        found.Should().BeTrue();
+        text.Should().BeSameAs(cachedText);
+        _sut.Hits.Should().Be(1);
+        _sut.Misses.Should().Be(0);
+    }
+
+    [Fact]
+    public void TryGetPatchedText_ReturnsFalse_WhenVersionChanged()
+    {
+        _sut.SetPatchedText("ItemData", TextAssetPatchCache.NonLocalizedLanguageId, 3, "line1");
+
+        bool found = _sut.TryGetPatchedText(
+            "ItemData",
+            TextAssetPatchCache.NonLocalizedLanguageId,
+            4,
+            out string? text);
+
+        found.Should().BeFalse();
+        text.Should().BeNull();
+        _sut.Misses.Should().Be(1);
+    }
+
+    [Fact]
+    public void TryGetPatchedText_ReturnsFalse_WhenLanguageDiffers()
+    {
+        _sut.SetPatchedText("Dialogues0/Items", 0, 1, "line1");
+
+        bool found = _sut.TryGetPatchedText("Dialogues0/Items", 1, 1, out string? _);
+
+        found.Should().BeFalse();
+    }
+
+    [Fact]
+    public void SetPatchedText_ReplacesExistingEntry_WhenCalledAgain()
+    {
+        _sut.SetPatchedText("ItemData", TextAssetPatchCache.NonLocalizedLanguageId, 1, "old");
+        _sut.SetPatchedText("ItemData", TextAssetPatchCache.NonLocalizedLanguageId, 2, "new");
+
+        _sut.TryGetPatchedText("ItemData", TextAssetPatchCache.NonLocalizedLanguageId, 1, out string? _)
+            .Should().BeFalse();
+        _sut.TryGetPatchedText("ItemData", TextAssetPatchCache.NonLocalizedLanguageId, 2, out string? text)
+            .Should().BeTrue();
+        text.Should().Be("new");
+    }
+}
\ No newline at end of file
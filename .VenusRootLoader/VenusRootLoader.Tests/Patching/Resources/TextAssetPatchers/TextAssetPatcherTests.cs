@@ -0,0 +1,117 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging.Testing;
+using NSubstitute;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers;
+using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers.GlobalData;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Tests.Patching.Resources.TextAssetPatchers;
+
+// Modifying a rank bonus invalidates the cache so these tests can't run while other tests create or modify leaves
+[CollectionDefinition(nameof(TextAssetPatcherTests), DisableParallelization = true)]
+public sealed class TextAssetPatcherTestsCollection;
+
+[Collection(nameof(TextAssetPatcherTests))]
+public sealed class TextAssetPatcherTests
+{
+    private const string RankBonusesPath = "RankBonus";
+
+    private readonly FakeLogger<TextAssetPatcher<RankBonusLeaf>> _logger = new();
+    private readonly ITextAssetDumper _textAssetDumper = Substitute.For<ITextAssetDumper>();
+    private readonly TextAssetPatchCache _textAssetPatchCache = new();
+    private readonly AutoSequentialIdBasedRegistry<RankBonusLeaf> _registry;
+    private readonly TextAssetPatcher<RankBonusLeaf> _sut;
+    private int _otherLeavesVersion;
+
+    public TextAssetPatcherTests()
+    {
+        _registry = new(new FakeLogger(), IdSequenceDirection.Increment);
+        _sut = new(
+            [RankBonusesPath],
+            _logger,
+            _textAssetDumper,
+            _textAssetPatchCache,
+            _registry,
+            new RankBonusTextAssetParser(),
+            null,
+            () => _otherLeavesVersion);
+    }
+
+    [Fact]
+    public void GetPatchedText_ReturnsCachedText_WhenLeavesWereOnlyReadSinceItWasBuilt()
+    {
+        RankBonusLeaf leaf = _registry.RegisterExisting(0, "0");
+        leaf.RankNeeded = 2;
+        leaf.FirstParameter = 1;
+        string builtText = _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        foreach (RankBonusLeaf registeredLeaf in _registry)
+            _ = registeredLeaf.RankNeeded + registeredLeaf.FirstParameter + registeredLeaf.SecondParameter;
+        _registry.Get(leaf.CreatorId, leaf.NamedId).ThirdParameter.Should().Be(0);
+        _registry.GetAll().Should().ContainSingle();
+        string text = _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        builtText.Should().Be("2,0,1,0,0");
+        text.Should().BeSameAs(builtText);
+        _textAssetPatchCache.Hits.Should().Be(1);
+        _textAssetPatchCache.Misses.Should().Be(1);
+    }
+
+    [Fact]
+    public void GetPatchedText_RebuildsText_WhenALeafSetterWasCalledSinceItWasBuilt()
+    {
+        RankBonusLeaf leaf = _registry.RegisterExisting(0, "0");
+        leaf.RankNeeded = 2;
+        string builtText = _sut.GetPatchedText(RankBonusesPath, () => true);
+
+        leaf.SecondParameter = 7;
+        string text = _sut.GetPatchedText(RankBonusesPath, () => true);
+
+        builtText.Should().Be("2,0,0,0,0\n");
+        text.Should().Be("2,0,0,7,0\n");
+        _textAssetPatchCache.Hits.Should().Be(0);
+        _textAssetPatchCache.Misses.Should().Be(2);
+    }
+
+    [Fact]
+    public void GetPatchedText_RebuildsText_WhenALeafWasRegisteredSinceItWasBuilt()
+    {
+        _registry.RegisterExisting(0, "0").RankNeeded = 2;
+        string builtText = _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        _registry.RegisterNew("Creator", "New").RankNeeded = 5;
+        string text = _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        builtText.Should().Be("2,0,0,0,0");
+        text.Should().Be("2,0,0,0,0\n5,0,0,0,0");
+        _textAssetPatchCache.Misses.Should().Be(2);
+    }
+
+    [Fact]
+    public void GetPatchedText_ReturnsCachedText_WhenOnlyLeavesOfAnotherTypeWereModifiedSinceItWasBuilt()
+    {
+        AutoSequentialIdBasedRegistry<ItemLeaf> itemsRegistry = new(new FakeLogger(), IdSequenceDirection.Increment);
+        _registry.RegisterExisting(0, "0").RankNeeded = 2;
+        string builtText = _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        itemsRegistry.RegisterNew("Creator", "New").BuyingPrice = 5;
+        string text = _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        text.Should().BeSameAs(builtText);
+        _textAssetPatchCache.Hits.Should().Be(1);
+    }
+
+    [Fact]
+    public void GetPatchedText_RebuildsText_WhenTheOtherLeavesItReadsWereModifiedSinceItWasBuilt()
+    {
+        _registry.RegisterExisting(0, "0").RankNeeded = 2;
+        _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        _otherLeavesVersion++;
+        _sut.GetPatchedText(RankBonusesPath, () => false);
+
+        _textAssetPatchCache.Hits.Should().Be(0);
+        _textAssetPatchCache.Misses.Should().Be(2);
+    }
+}
\ No newline at end of file
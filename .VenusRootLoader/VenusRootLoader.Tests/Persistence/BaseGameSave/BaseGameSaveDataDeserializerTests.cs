@@ -8,6 +8,7 @@ using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.Persistence;
 using VenusRootLoader.Persistence.BaseGameSave;
 using VenusRootLoader.Registry;
+using VenusRootLoader.Utility;
 
 namespace VenusRootLoader.Tests.Persistence.BaseGameSave;
 
@@ -1494,6 +1495,98 @@ public sealed class BaseGameSaveDataDeserializerTests
         return Verify(JsonSerializer.Serialize(stagingLoadData, _jsonSerializerOptions));
     }
 
+    [Theory]
+    [InlineData("MinimalValidData.txt")]
+    [InlineData("FullValidData.txt")]
+    public void DeserializeFullBaseGameSaveData_ReturnsDataThatSerializesToTheSameSaveData_WhenSaveDataIsValid(
+        string saveDataFileName)
+    {
+        string saveData =
+            File.ReadAllText(Path.Combine("Persistence", "BaseGameSave", "TestFiles", saveDataFileName));
+
+        FullMockingSetup(MainManager.Maps.BugariaMainPlaza, MainManager.Areas.BugariaCity);
+
+        IGameDataRuntimeState gameDataRuntimeState = Substitute.For<IGameDataRuntimeState>();
+        BaseGameSaveDataSerializer serializer = CreateSerializer(gameDataRuntimeState);
+
+        StagingLoadData stagingLoadData = new();
+        MainManager.LoadData loadData = _sut.DeserializeFullBaseGameSaveData(saveData, stagingLoadData);
+        stagingLoadData.CommitToRuntimeState(gameDataRuntimeState);
+        gameDataRuntimeState.MapName.Returns(loadData.mapid.ToString());
+        string result = serializer.GetBaseGameSaveDataFromRuntimeState(loadData.loadpos);
+
+        _logger.Collector.Count.Should().Be(0);
+        result.Should().Be(saveData);
+    }
+
+    [Fact]
+    public void DeserializeFullBaseGameSaveData_OnlyAllocatesTheParsedFlags_WhenThereAreManyFlags()
+    {
+        int fewFlagsAmount = 750;
+        int manyFlagsAmount = fewFlagsAmount + 20_000;
+        string fewFlagsSaveData = CreateFullSaveDataWithFlags(fewFlagsAmount);
+        string manyFlagsSaveData = CreateFullSaveDataWithFlags(manyFlagsAmount);
+
+        FullMockingSetup(MainManager.Maps.BugariaMainPlaza, MainManager.Areas.BugariaCity);
+
+        _flagsLeafRegistry.CountBaseGame.Returns(fewFlagsAmount);
+        long fewFlagsAllocatedBytes = TestUtility.MeasureAllocatedBytesPerCall(
+            () => _sut.DeserializeFullBaseGameSaveData(fewFlagsSaveData, new()),
+            10);
+        _flagsLeafRegistry.CountBaseGame.Returns(manyFlagsAmount);
+        long manyFlagsAllocatedBytes = TestUtility.MeasureAllocatedBytesPerCall(
+            () => _sut.DeserializeFullBaseGameSaveData(manyFlagsSaveData, new()),
+            10);
+
+        // Growing the list of parsed flags costs a few bytes per flag while splitting the line would allocate a string
+        // of more than 20 bytes for each of them
+        double allocatedBytesPerFlag =
+            (double)(manyFlagsAllocatedBytes - fewFlagsAllocatedBytes) / (manyFlagsAmount - fewFlagsAmount);
+        allocatedBytesPerFlag.Should().BeLessThan(8);
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void DeserializeFullBaseGameSaveData_ReturnsDataThatSerializesWithoutAllocatingPerFlag_WhenBufferIsWarm()
+    {
+        int fewFlagsAmount = 750;
+        int manyFlagsAmount = fewFlagsAmount + 20_000;
+
+        FullMockingSetup(MainManager.Maps.BugariaMainPlaza, MainManager.Areas.BugariaCity);
+
+        IGameDataRuntimeState gameDataRuntimeState = Substitute.For<IGameDataRuntimeState>();
+        BaseGameSaveDataSerializer serializer = CreateSerializer(gameDataRuntimeState);
+        _flagsLeafRegistry.CountBaseGame.Returns(manyFlagsAmount);
+        StagingLoadData stagingLoadData = new();
+        MainManager.LoadData loadData =
+            _sut.DeserializeFullBaseGameSaveData(CreateFullSaveDataWithFlags(manyFlagsAmount), stagingLoadData);
+        stagingLoadData.CommitToRuntimeState(gameDataRuntimeState);
+        gameDataRuntimeState.MapName.Returns(loadData.mapid.ToString());
+        using PooledCharBufferWriter writer = new(1);
+
+        _flagsLeafRegistry.CountBaseGame.Returns(fewFlagsAmount);
+        long fewFlagsAllocatedBytes = TestUtility.MeasureAllocatedBytesPerCall(
+            () =>
+            {
+                writer.Clear();
+                serializer.WriteBaseGameSaveDataFromRuntimeState(writer, loadData.loadpos);
+            },
+            10);
+        _flagsLeafRegistry.CountBaseGame.Returns(manyFlagsAmount);
+        long manyFlagsAllocatedBytes = TestUtility.MeasureAllocatedBytesPerCall(
+            () =>
+            {
+                writer.Clear();
+                serializer.WriteBaseGameSaveDataFromRuntimeState(writer, loadData.loadpos);
+            },
+            10);
+
+        // The measurement isn't exact, but writing each flag to a string would allocate more than 20 bytes per flag
+        double allocatedBytesPerFlag =
+            (double)(manyFlagsAllocatedBytes - fewFlagsAllocatedBytes) / (manyFlagsAmount - fewFlagsAmount);
+        allocatedBytesPerFlag.Should().BeLessThan(4);
+    }
+
     private void FullMockingSetup(MainManager.Maps map, MainManager.Areas area)
     {
         int flagsAmount = 750;
@@ -1685,4 +1778,31 @@ public sealed class BaseGameSaveDataDeserializerTests
             crystalBerryLeaves.Add(new(i, "SomeBud", i.ToString()));
         TestUtility.MockRegistry(_crystalBerriesLeafRegistry, crystalBerryLeaves);
     }
+
+    private string CreateFullSaveDataWithFlags(int flagsAmount)
+    {
+        string[] saveData = _fullSaveData.Split('\n');
+        saveData[11] = string.Join(",", Enumerable.Range(0, flagsAmount).Select(i => i % 3 == 0 ? "True" : "False"));
+        return string.Join("\n", saveData);
+    }
+
+    private BaseGameSaveDataSerializer CreateSerializer(IGameDataRuntimeState gameDataRuntimeState) =>
+        new(
+            gameDataRuntimeState,
+            _animIdsLeafRegistry,
+            _mapsLeafRegistry,
+            _areasLeafRegistry,
+            _medalsLeafRegistry,
+            _questsLeafRegistry,
+            _itemsLeafRegistry,
+            _musicsLeafRegistry,
+            _discoveriesLeafRegistry,
+            _enemiesLeafRegistry,
+            _recipeLibraryEntriesLeafRegistry,
+            _recordsLeafRegistry,
+            _flagsLeafRegistry,
+            _flagstringsLeafRegistry,
+            _spyCardsLeafRegistry,
+            _flagvarsLeafRegistry,
+            _crystalBerriesLeafRegistry);
 }
\ No newline at end of file
@@ -191,7 +191,7 @@ public sealed class BaseGameSaveDataSerializerTests
         _ = _gameDataRuntimeState.Received().SamiraMusics;
         _ = _gameDataRuntimeState.Received().StatBonus;
         _ = _gameDataRuntimeState.Received().LibraryStuff;
-        _ = _gameDataRuntimeState.Received(flagsAmount + 6 + 7).Flags;
+        _ = _gameDataRuntimeState.Received(1 + 6 + 7).Flags;
         _ = _gameDataRuntimeState.Received(flagstringAmount + 3 + 1).Flagstring;
         _ = _gameDataRuntimeState.Received(flagvarAmount).Flagvar;
         _ = _gameDataRuntimeState.Received(100).RegionalFlags;
@@ -537,7 +537,7 @@ public sealed class BaseGameSaveDataSerializerTests
         _ = _gameDataRuntimeState.Received().SamiraMusics;
         _ = _gameDataRuntimeState.Received().StatBonus;
         _ = _gameDataRuntimeState.Received().LibraryStuff;
-        _ = _gameDataRuntimeState.Received(flagsAmount + 6 + 7).Flags;
+        _ = _gameDataRuntimeState.Received(1 + 6 + 7).Flags;
         _ = _gameDataRuntimeState.Received(flagstringAmount + 3 + 1).Flagstring;
         _ = _gameDataRuntimeState.Received(flagvarAmount).Flagvar;
         _ = _gameDataRuntimeState.Received(100).RegionalFlags;
@@ -93,7 +93,7 @@ public sealed class BudsSaveDataSerializerTests
         List<CrystalBerryLeaf> crystalBerryLeaves = new() { new(0, Constants.BaseGameCreatorId, "0") };
         TestUtility.MockRegistry(_crystalBerriesLeafRegistry, crystalBerryLeaves);
 
-        Dictionary<string, string> result = _sut.GetBudsSaveDataFromRuntimeState();
+        Dictionary<string, BudSaveData> result = _sut.GetBudsSaveDataFromRuntimeState();
 
         result.Should().BeEmpty();
 
@@ -209,7 +209,7 @@ public sealed class BudsSaveDataSerializerTests
         };
         TestUtility.MockRegistry(_crystalBerriesLeafRegistry, crystalBerryLeaves);
 
-        Dictionary<string, string> result = _sut.GetBudsSaveDataFromRuntimeState();
+        Dictionary<string, BudSaveData> result = _sut.GetBudsSaveDataFromRuntimeState();
 
         _ = _gameDataRuntimeState.Received(1).AvailableBadgePool;
         _ = _gameDataRuntimeState.Received(1).BadgeShops;
@@ -220,6 +220,6 @@ public sealed class BudsSaveDataSerializerTests
         _ = _gameDataRuntimeState.Received(1).Flagvar;
         _ = _gameDataRuntimeState.Received(1).CrystalBFlags;
 
-        return Verify(result);
+        return Verify(result.ToDictionary(b => b.Key, b => _sut.SerializeBudSaveData(b.Value)));
     }
 }
\ No newline at end of file
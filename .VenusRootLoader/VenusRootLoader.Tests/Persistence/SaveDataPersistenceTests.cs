@@ -22,6 +22,9 @@ public sealed class SaveDataPersistenceTests
     private static readonly string ConfigPath = Path.Combine(RootPath, "Config");
     private static readonly string LoaderPath = Path.Combine(RootPath, nameof(VenusRootLoader));
 
+    // The serializer is mocked to give this flagstring's value as the serialized content of a bud save data
+    private const string SerializedBudSaveDataFlagstring = "SerializedContent";
+
     private readonly BudLoaderContext _budLoaderContext = new()
     {
         BudsPath = BudsPath,
@@ -43,6 +46,7 @@ public sealed class SaveDataPersistenceTests
         Substitute.For<IBaseGameSaveDataSerializer>();
 
     private readonly IBudsSaveDataSerializer _budsSaveDataSerializer = Substitute.For<IBudsSaveDataSerializer>();
+    private readonly IFileHardLinker _fileHardLinker = Substitute.For<IFileHardLinker>();
 
     private readonly SaveDataPersistence _sut;
 
@@ -56,7 +60,11 @@ public sealed class SaveDataPersistenceTests
             _baseGameSaveDataDeserializer,
             _budsSaveDataDeserializer,
             _baseGameSaveDataSerializer,
-            _budsSaveDataSerializer);
+            _budsSaveDataSerializer,
+            _fileHardLinker);
+
+        _budsSaveDataSerializer.SerializeBudSaveData(Arg.Any<BudSaveData>())
+            .Returns(x => x.Arg<BudSaveData>().Flagstrings[SerializedBudSaveDataFlagstring]);
     }
 
     [Fact]
@@ -339,7 +347,7 @@ public sealed class SaveDataPersistenceTests
         _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
             .Returns("BaseGameData");
         _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
-            .Returns(new Dictionary<string, string>());
+            .Returns(CreateBudsSaveData(new Dictionary<string, string>()));
 
         bool result = _sut.WriteSaveDataToSaveSlot(0, null);
 
@@ -362,12 +370,12 @@ public sealed class SaveDataPersistenceTests
         _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
             .Returns("BaseGameData");
         _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
-            .Returns(
+            .Returns(CreateBudsSaveData(
                 new Dictionary<string, string>
                 {
                     ["Bud1"] = "Bud1GameData",
                     ["Bud2"] = "Bud2GameData"
-                });
+                }));
 
         bool result = _sut.WriteSaveDataToSaveSlot(0, new(1, 2, 3));
 
@@ -394,24 +402,24 @@ public sealed class SaveDataPersistenceTests
         _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
             .Returns("OldGameData");
         _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
-            .Returns(
+            .Returns(CreateBudsSaveData(
                 new Dictionary<string, string>
                 {
                     ["Bud1"] = "OldBud1GameData",
                     ["Bud2"] = "OldBud2GameData"
-                });
+                }));
 
         _sut.WriteSaveDataToSaveSlot(0, null);
 
         _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
             .Returns("BaseGameData");
         _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
-            .Returns(
+            .Returns(CreateBudsSaveData(
                 new Dictionary<string, string>
                 {
                     ["Bud1"] = "Bud1GameData",
                     ["Bud2"] = "Bud2GameData"
-                });
+                }));
 
         _sut.WriteSaveDataToSaveSlot(0, null);
 
@@ -493,6 +501,163 @@ public sealed class SaveDataPersistenceTests
         logRecord.Message.Should().Be($"An error occured while writing save data to {directory}\n");
     }
 
+    [Fact]
+    public void WriteSaveDataToCurrentSaveSlot_OnlyWritesChangedBudsSaveData_WhenExistingSaveExists()
+    {
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("OldGameData");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(CreateBudsSaveData(
+                new Dictionary<string, string>
+                {
+                    ["Bud1"] = "Bud1GameData",
+                    ["Bud2"] = "OldBud2GameData"
+                }));
+
+        _sut.WriteSaveDataToSaveSlot(0, null);
+
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("BaseGameData");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(CreateBudsSaveData(
+                new Dictionary<string, string>
+                {
+                    ["Bud1"] = "Bud1GameData",
+                    ["Bud2"] = "Bud2GameData"
+                }));
+
+        bool result = _sut.WriteSaveDataToSaveSlot(0, null);
+
+        result.Should().BeTrue();
+
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0", "BaseGame.dat")).TextContents
+            .Should().Be("BaseGameData");
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0", "Bud1.json")).TextContents
+            .Should().Be("Bud1GameData");
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0", "Bud2.json")).TextContents
+            .Should().Be("Bud2GameData");
+
+        // The unchanged file is kept from the previous save without moving it so the backup stays complete
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0backup", "Bud1.json")).TextContents
+            .Should().Be("Bud1GameData");
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0backup", "Bud2.json")).TextContents
+            .Should().Be("OldBud2GameData");
+
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void LoadLiteSaveDataFromSlot_OnlyUsesTheSaveSlotIndex_WhenItWasWrittenWithTheSave()
+    {
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("Header\nParty\nGeneralInformation\nMedalShops");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(CreateBudsSaveData(new Dictionary<string, string>()));
+
+        _sut.WriteSaveDataToSaveSlot(0, null);
+        _sut.LoadLiteSaveDataFromSlot(0);
+
+        _baseGameSaveDataDeserializer.Received(1).DeserializeLiteBaseGameSaveData("Header\n\nGeneralInformation");
+        _baseGameSaveDataDeserializer.DidNotReceive()
+            .DeserializeLiteBaseGameSaveData("Header\nParty\nGeneralInformation\nMedalShops");
+
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void WriteSaveDataToCurrentSaveSlot_RewritesUnchangedBudsSaveData_WhenTheFileChangedOnDisk()
+    {
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("BaseGameData");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(CreateBudsSaveData(new Dictionary<string, string> { ["Bud1"] = "Bud1GameData" }));
+
+        _sut.WriteSaveDataToSaveSlot(0, null);
+        _fileSystem.File.WriteAllText(Path.Combine(SaveDataPath, "0", "Bud1.json"), "CorruptedBud1GameData");
+
+        bool result = _sut.WriteSaveDataToSaveSlot(0, null);
+
+        result.Should().BeTrue();
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0", "Bud1.json")).TextContents
+            .Should().Be("Bud1GameData");
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0backup", "Bud1.json")).TextContents
+            .Should().Be("CorruptedBud1GameData");
+
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void WriteSaveDataToCurrentSaveSlot_DoesNotSerializeUnchangedBudsSaveData_WhenTheSlotWasWrittenBefore()
+    {
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("BaseGameData");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(
+                CreateBudsSaveData(new Dictionary<string, string> { ["Bud1"] = "Bud1GameData" }),
+                CreateBudsSaveData(new Dictionary<string, string> { ["Bud1"] = "Bud1GameData" }));
+
+        _sut.WriteSaveDataToSaveSlot(0, null);
+        bool result = _sut.WriteSaveDataToSaveSlot(0, null);
+
+        result.Should().BeTrue();
+        _budsSaveDataSerializer.ReceivedWithAnyArgs(1).SerializeBudSaveData(null!);
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0", "Bud1.json")).TextContents
+            .Should().Be("Bud1GameData");
+        _fileSystem.GetFile(Path.Combine(SaveDataPath, "0backup", "Bud1.json")).TextContents
+            .Should().Be("Bud1GameData");
+
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void WriteSaveDataToCurrentSaveSlot_LinksUnchangedBudsSaveFiles_WhenHardLinksAreSupported()
+    {
+        string existingBudSaveFilePath = Path.Combine(SaveDataPath, "0", "Bud1.json");
+        string temporaryBudSaveFilePath = Path.Combine(SaveDataPath, "0temp", "Bud1.json");
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("BaseGameData");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(CreateBudsSaveData(new Dictionary<string, string> { ["Bud1"] = "Bud1GameData" }));
+        // The mock file system doesn't support hard links so it's simulated with a copy that keeps the file's metadata
+        _fileHardLinker.TryCreateHardLink(temporaryBudSaveFilePath, existingBudSaveFilePath)
+            .Returns(_ =>
+            {
+                _fileSystem.AddFile(temporaryBudSaveFilePath, _fileSystem.GetFile(existingBudSaveFilePath));
+                return true;
+            });
+
+        _sut.WriteSaveDataToSaveSlot(0, null);
+        bool result = _sut.WriteSaveDataToSaveSlot(0, null);
+        _sut.WriteSaveDataToSaveSlot(0, null);
+
+        result.Should().BeTrue();
+        _fileHardLinker.Received(2).TryCreateHardLink(temporaryBudSaveFilePath, existingBudSaveFilePath);
+        _budsSaveDataSerializer.ReceivedWithAnyArgs(1).SerializeBudSaveData(null!);
+        _fileSystem.GetFile(existingBudSaveFilePath).TextContents.Should().Be("Bud1GameData");
+
+        _logger.Collector.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void LoadFullSaveDataFromSlot_DoesNotLoadTheSaveSlotIndexAsABudSaveData_WhenItWasWrittenWithTheSave()
+    {
+        _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(Arg.Any<Vector3?>())
+            .Returns("BaseGameData");
+        _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState()
+            .Returns(CreateBudsSaveData(new Dictionary<string, string> { ["Bud1"] = "Bud1GameData" }));
+
+        _sut.WriteSaveDataToSaveSlot(0, null);
+        _sut.LoadFullSaveDataFromSlot(0);
+
+        _fileSystem.FileExists(Path.Combine(SaveDataPath, "0", "SaveIndex.json")).Should().BeTrue();
+        _budsSaveDataDeserializer.Received(1)
+            .DeserializeBudsSaveData(
+                Arg.Is<Dictionary<string, string>>(x => x!.Count == 1 && x["Bud1"] == "Bud1GameData"),
+                Arg.Any<StagingLoadData>());
+
+        _logger.Collector.Count.Should().Be(0);
+    }
+
     [Fact]
     public void DeleteSaveSlot_ReturnsTrue_WhenDeletionSucceeds()
     {
@@ -529,7 +694,8 @@ public sealed class SaveDataPersistenceTests
             _baseGameSaveDataDeserializer,
             _budsSaveDataDeserializer,
             _baseGameSaveDataSerializer,
-            _budsSaveDataSerializer);
+            _budsSaveDataSerializer,
+            _fileHardLinker);
 
         bool result = sut.DeleteSaveSlot(0);
 
@@ -637,7 +803,8 @@ public sealed class SaveDataPersistenceTests
             _baseGameSaveDataDeserializer,
             _budsSaveDataDeserializer,
             _baseGameSaveDataSerializer,
-            _budsSaveDataSerializer);
+            _budsSaveDataSerializer,
+            _fileHardLinker);
         bool result = sut.CopySaveSlot(0, 1);
 
         result.Should().BeFalse();
@@ -659,4 +826,24 @@ public sealed class SaveDataPersistenceTests
         logRecord.Message.Should().Be(
             $"An error occured while copying the save data from {sourceDirectory} to {destinationDirectory}\n");
     }
+
+    private static Dictionary<string, BudSaveData> CreateBudsSaveData(
+        Dictionary<string, string> serializedBudsSaveData)
+    {
+        return serializedBudsSaveData.ToDictionary(
+            budSaveData => budSaveData.Key,
+            budSaveData => new BudSaveData
+            {
+                MedalShops = new(),
+                DiscoveryUnlocks = new(),
+                Enemies = new(),
+                RecipeLibraryEntryUnlocks = new(),
+                RecordUnlocks = new(),
+                AreaUnlocks = new(),
+                Flags = new(),
+                Flagstrings = new() { [SerializedBudSaveDataFlagstring] = budSaveData.Value },
+                Flagvars = new(),
+                CrystalBerries = new()
+            });
+    }
 }
\ No newline at end of file
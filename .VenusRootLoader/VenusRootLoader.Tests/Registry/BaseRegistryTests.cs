@@ -0,0 +1,94 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging.Testing;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Tests.Registry;
+
+public sealed class BaseRegistryTests
+{
+    private readonly FakeLogger _logger = new();
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Lookups_ReturnTheSameLeaves_WhenRegistryIsFrozen(bool isDecrementing)
+    {
+        AutoSequentialIdBasedRegistry<FlagLeaf> sut = isDecrementing
+            ? new(_logger, IdSequenceDirection.Decrement, -1)
+            : new(_logger, IdSequenceDirection.Increment);
+        for (int i = 0; i < 10; i++)
+            sut.RegisterExisting(isDecrementing ? -1 - i : i, $"Existing{i}");
+        sut.RegisterExisting(30, "Sparse");
+        sut.RegisterExisting(-1000, "Negative");
+        for (int i = 0; i < 5; i++)
+            sut.RegisterNew("Creator", $"New{i}");
+
+        List<FlagLeaf> leavesBeforeFreezing = sut.ToList();
+        List<FlagLeaf> allLeavesBeforeFreezing = sut.GetAll().ToList();
+        sut.Freeze();
+
+        sut.IsFrozen.Should().BeTrue();
+        sut.ToList().Should().Equal(leavesBeforeFreezing);
+        sut.GetAll().Should().Equal(allLeavesBeforeFreezing);
+        sut.Count.Should().Be(leavesBeforeFreezing.Count);
+        foreach (FlagLeaf leaf in leavesBeforeFreezing)
+        {
+            sut.GetByGameId(leaf.GameId).Should().BeSameAs(leaf);
+            sut.GetByEffectiveId(leaf.EffectiveId).Should().BeSameAs(leaf);
+            sut.Get(leaf.CreatorId, leaf.NamedId).Should().BeSameAs(leaf);
+        }
+    }
+
+    [Theory]
+    [InlineData(500)]
+    [InlineData(-500)]
+    public void GetByGameId_ThrowsArgumentException_WhenLeafDoesNotExistAndRegistryIsFrozen(int gameId)
+    {
+        AutoSequentialIdBasedRegistry<FlagLeaf> sut = new(_logger, IdSequenceDirection.Increment);
+        sut.RegisterExisting(0, "Existing0");
+        sut.RegisterExisting(2, "Existing2");
+        sut.Freeze();
+
+        Action act = () => sut.GetByGameId(1);
+        Action actOutOfRange = () => sut.GetByGameId(gameId);
+
+        act.Should().Throw<ArgumentException>();
+        actOutOfRange.Should().Throw<ArgumentException>();
+    }
+
+    [Fact]
+    public void Register_ThrowsInvalidOperationException_WhenRegistryIsFrozen()
+    {
+        AutoSequentialIdBasedRegistry<FlagLeaf> sut = new(_logger, IdSequenceDirection.Increment);
+        sut.RegisterExisting(0, "Existing");
+        sut.Freeze();
+
+        Action actNew = () => sut.RegisterNew("Creator", "New");
+        Action actExisting = () => sut.RegisterExisting(1, "Existing1");
+
+        actNew.Should().Throw<InvalidOperationException>();
+        actExisting.Should().Throw<InvalidOperationException>();
+        sut.Count.Should().Be(1);
+    }
+
+    [Fact]
+    public void GetAll_ReturnsTheSameCollection_WhenRegistryIsFrozen()
+    {
+        AutoSequentialIdBasedRegistry<FlagLeaf> sut = new(_logger, IdSequenceDirection.Increment);
+        sut.RegisterExisting(0, "Existing");
+        sut.Freeze();
+
+        sut.GetAll().Should().BeSameAs(sut.GetAll());
+    }
+
+    [Fact]
+    public void LeafFactory_CreatesLeavesWithTheirIds_WhenLeafTypeIsConcrete()
+    {
+        FlagLeaf leaf = LeafFactory<FlagLeaf>.Create(42, "Creator", "Named");
+
+        leaf.GameId.Should().Be(42);
+        leaf.CreatorId.Should().Be("Creator");
+        leaf.NamedId.Should().Be("Named");
+    }
+}
\ No newline at end of file
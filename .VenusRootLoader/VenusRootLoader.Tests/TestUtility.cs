@@ -60,4 +60,33 @@ public static class TestUtility
         registry.GetEnumerator().Returns(_ => leaves.GetEnumerator());
         registry.GetAll().Returns(leaves.ToList());
     }
+
+    /// <summary>
+    /// Measures the average amount of bytes allocated by a call of an action from the growth of the managed heap which
+    /// works on every runtime the tests run on. A garbage collection during the calls makes the growth meaningless so
+    /// the measurement is retried with fewer iterations until none happens.
+    /// </summary>
+    internal static long MeasureAllocatedBytesPerCall(Action action, int iterations)
+    {
+        // Warm up so any lazy initialisation or JIT allocations aren't measured
+        action();
+        while (true)
+        {
+            for (int attempt = 0; attempt < 3; attempt++)
+            {
+                long heapSizeBefore = GC.GetTotalMemory(true);
+                int collectionsCountBefore = GC.CollectionCount(0);
+                for (int i = 0; i < iterations; i++)
+                    action();
+                long heapSizeAfter = GC.GetTotalMemory(false);
+                if (GC.CollectionCount(0) == collectionsCountBefore)
+                    return (heapSizeAfter - heapSizeBefore) / iterations;
+            }
+
+            if (iterations == 1)
+                throw new InvalidOperationException("A garbage collection happened during every measurement");
+
+            iterations /= 2;
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+using AwesomeAssertions;
+using VenusRootLoader.Tracing;
+
+namespace VenusRootLoader.Tests.Tracing;
+
+public sealed class TracerTests
+{
+    private readonly List<(TraceEventPhase Phase, string Name, string Category)> _recordedEvents = [];
+
+    [Fact]
+    public void BeginSpan_RecordsTheBeginAndEndEvents_WhenTracingIsEnabled()
+    {
+        Tracer sut = new(
+            new BootstrapFunctions
+            {
+                BootstrapLog = (_, _, _) => { },
+                BootstrapTrace = (phase, name, category, _, _) => _recordedEvents.Add((phase, name, category))
+            });
+
+        using (sut.BeginSpan("Span", "Category"))
+            _recordedEvents.Should().ContainSingle();
+
+        sut.IsEnabled.Should().BeTrue();
+        _recordedEvents.Should().Equal(
+            (TraceEventPhase.Begin, "Span", "Category"),
+            (TraceEventPhase.End, "Span", "Category"));
+    }
+
+    [Fact]
+    public void BeginSpan_DoesNothing_WhenTracingIsDisabled()
+    {
+        Tracer sut = new(new BootstrapFunctions { BootstrapLog = (_, _, _) => { } });
+
+        using (sut.BeginSpan("Span", "Category")) { }
+
+        sut.IsEnabled.Should().BeFalse();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Testing;
+using VenusRootLoader.Unity.CustomAudioClip;
+
+namespace VenusRootLoader.Tests.Unity.CustomAudioClip;
+
+public sealed class AudioDecodingWorkerPoolTests
+{
+    private readonly FakeLogger<AudioDecodingWorkerPool> _logger = new();
+
+    [Fact]
+    public void Schedule_LogsTheFailureAndKeepsRunningWork_WhenAWorkItemThrows()
+    {
+        using AudioDecodingWorkerPool sut = new(_logger, 1);
+        InvalidOperationException exception = new();
+        using ManualResetEventSlim nextWorkItemRan = new();
+
+        sut.Schedule(() => throw exception);
+        sut.Schedule(nextWorkItemRan.Set);
+
+        nextWorkItemRan.Wait(TimeSpan.FromSeconds(30)).Should().BeTrue();
+        _logger.Collector.Count.Should().Be(1);
+        _logger.LatestRecord.Level.Should().Be(LogLevel.Error);
+        _logger.LatestRecord.Exception.Should().BeSameAs(exception);
+    }
+
+    [Fact]
+    public void Schedule_DoesNotRunTheWork_WhenThePoolIsDisposed()
+    {
+        AudioDecodingWorkerPool sut = new(_logger, 1);
+        bool hasWorkItemRan = false;
+
+        sut.Dispose();
+        sut.Schedule(() => hasWorkItemRan = true);
+        Thread.Sleep(100);
+
+        hasWorkItemRan.Should().BeFalse();
+    }
+}
\ No newline at end of file
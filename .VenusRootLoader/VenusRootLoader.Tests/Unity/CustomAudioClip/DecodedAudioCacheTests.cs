@@ -0,0 +1,93 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging.Testing;
+using System.IO.Abstractions.TestingHelpers;
+using System.Runtime.InteropServices;
+using VenusRootLoader.Api;
+using VenusRootLoader.Unity.CustomAudioClip;
+
+namespace VenusRootLoader.Tests.Unity.CustomAudioClip;
+
+public sealed class DecodedAudioCacheTests
+{
+    private static readonly string RootPath = RuntimeInformation.IsOSPlatform(OSPlatform.Linux) ? "/" : "C:\\";
+    private static readonly string LoaderPath = Path.Combine(RootPath, nameof(VenusRootLoader));
+    private static readonly string AudioFilePath = Path.Combine(RootPath, "Buds", "Bud", "music.flac");
+
+    private readonly MockFileSystem _fileSystem = new();
+    private readonly FakeLogger<DecodedAudioCache> _logger = new();
+
+    private readonly DecodedAudioCache _sut;
+
+    public DecodedAudioCacheTests()
+    {
+        _fileSystem.AddFile(AudioFilePath, new(new byte[] { 1, 2, 3, 4 }));
+        _fileSystem.AddDirectory(LoaderPath);
+
+        _sut = new(
+            _fileSystem,
+            _logger,
+            new BudLoaderContext
+            {
+                BudsPath = Path.Combine(RootPath, "Buds"),
+                SaveDataPath = Path.Combine(RootPath, "SaveData"),
+                ConfigPath = Path.Combine(RootPath, "Config"),
+                LoaderPath = LoaderPath
+            });
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsTheSavedSamples_WhenTheyWereSavedBefore()
+    {
+        DecodedAudio decodedAudio = new()
+        {
+            Samples = Enumerable.Range(0, 100_001).Select(x => x * 0.5f).ToArray(),
+            Channels = 1,
+            SampleRate = 22050
+        };
+        string fileHash = _sut.ComputeFileHash(AudioFilePath);
+
+        _sut.Save(fileHash, decodedAudio);
+        bool result = _sut.TryLoad(fileHash, out DecodedAudio? loadedDecodedAudio);
+
+        result.Should().BeTrue();
+        loadedDecodedAudio!.Samples.Should().Equal(decodedAudio.Samples);
+        loadedDecodedAudio.Channels.Should().Be(decodedAudio.Channels);
+        loadedDecodedAudio.SampleRate.Should().Be(decodedAudio.SampleRate);
+        _fileSystem.Directory.GetFiles(Path.Combine(LoaderPath, DecodedAudioCache.CacheDirectoryName))
+            .Should().ContainSingle();
+    }
+
+    [Fact]
+    public void TryLoad_ReturnsFalse_WhenTheCacheFileIsTruncated()
+    {
+        string fileHash = _sut.ComputeFileHash(AudioFilePath);
+        _sut.Save(
+            fileHash,
+            new()
+            {
+                Samples = new float[1000],
+                Channels = 2,
+                SampleRate = 44100
+            });
+        string cacheFilePath = Path.Combine(LoaderPath, DecodedAudioCache.CacheDirectoryName, $"{fileHash}.pcm");
+        byte[] cacheFileContent = _fileSystem.File.ReadAllBytes(cacheFilePath);
+        _fileSystem.File.WriteAllBytes(cacheFilePath, cacheFileContent.Take(cacheFileContent.Length / 2).ToArray());
+
+        bool result = _sut.TryLoad(fileHash, out DecodedAudio? loadedDecodedAudio);
+
+        result.Should().BeFalse();
+        loadedDecodedAudio.Should().BeNull();
+    }
+
+    [Fact]
+    public void ComputeFileHash_ReturnsADifferentHash_WhenTheFileContentChanges()
+    {
+        string fileHashBefore = _sut.ComputeFileHash(AudioFilePath);
+        _fileSystem.File.WriteAllBytes(AudioFilePath, [1, 2, 3, 5]);
+
+        string fileHashAfter = _sut.ComputeFileHash(AudioFilePath);
+
+        fileHashAfter.Should().NotBe(fileHashBefore);
+        _sut.TryLoad(fileHashAfter, out _).Should().BeFalse();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+using AwesomeAssertions;
+using VenusRootLoader.Unity.CustomAudioClip;
+
+namespace VenusRootLoader.Tests.Unity.CustomAudioClip;
+
+public sealed class SampleRingBufferTests
+{
+    [Fact]
+    public void Read_ReturnsWrittenSamplesInOrder_WhenPositionsWrapAround()
+    {
+        SampleRingBuffer sut = new(8);
+        float[] destination = new float[8];
+
+        sut.Write([1, 2, 3, 4, 5, 6]);
+        sut.Read(destination.AsSpan(0, 5));
+        sut.Write([7, 8, 9, 10, 11]);
+        int read = sut.Read(destination);
+
+        read.Should().Be(6);
+        destination.Take(read).Should().Equal(6, 7, 8, 9, 10, 11);
+        sut.Count.Should().Be(0);
+    }
+
+    [Fact]
+    public void Write_WritesOnlyUntilTheBufferIsFull_WhenThereAreMoreSamplesThanFreeSpace()
+    {
+        SampleRingBuffer sut = new(4);
+
+        int written = sut.Write([1, 2, 3, 4, 5, 6]);
+
+        written.Should().Be(4);
+        sut.FreeCount.Should().Be(0);
+    }
+
+    [Fact]
+    public void Clear_DiscardsEveryBufferedSample_WhenCalled()
+    {
+        SampleRingBuffer sut = new(4);
+        sut.Write([1, 2, 3]);
+
+        sut.Clear();
+
+        sut.Count.Should().Be(0);
+        sut.Read(new float[4]).Should().Be(0);
+    }
+
+    [Fact]
+    public void ReadAndWrite_PreserveTheOrderOfSamples_WhenUsedFromTwoThreads()
+    {
+        const int samplesAmount = 200_000;
+        SampleRingBuffer sut = new(256);
+        float[] readSamples = new float[samplesAmount];
+
+        Thread producer = new(() =>
+        {
+            float[] chunk = new float[100];
+            int nextSample = 0;
+            while (nextSample < samplesAmount)
+            {
+                int chunkLength = Math.Min(chunk.Length, samplesAmount - nextSample);
+                for (int i = 0; i < chunkLength; i++)
+                    chunk[i] = nextSample + i;
+
+                int written = 0;
+                while (written < chunkLength)
+                    written += sut.Write(chunk.AsSpan(written, chunkLength - written));
+                nextSample += chunkLength;
+            }
+        });
+        producer.Start();
+
+        int totalRead = 0;
+        while (totalRead < samplesAmount)
+            totalRead += sut.Read(readSamples.AsSpan(totalRead, Math.Min(77, samplesAmount - totalRead)));
+        producer.Join();
+
+        readSamples.Should().Equal(Enumerable.Range(0, samplesAmount).Select(x => (float)x));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+using AwesomeAssertions;
+using Microsoft.Extensions.Logging;
+using Microsoft.Extensions.Logging.Testing;
+using NAudio.Utils;
+using NAudio.Wave;
+using NSubstitute;
+using VenusRootLoader.Unity.CustomAudioClip;
+
+namespace VenusRootLoader.Tests.Unity.CustomAudioClip;
+
+public sealed class StreamedNAudioTests : IDisposable
+{
+    private const int Channels = 2;
+    private const int SampleRate = 44100;
+
+    private readonly FakeLogger<StreamedNAudio> _logger = new();
+    private readonly FakeLogger<AudioDecodingWorkerPool> _workerPoolLogger = new();
+
+    // A pool without workers never runs the scheduled decoding so the tests control when it happens
+    private readonly AudioDecodingWorkerPool _workerPool;
+
+    public StreamedNAudioTests() => _workerPool = new(_workerPoolLogger, 0);
+
+    public void Dispose() => _workerPool.Dispose();
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(70_001)]
+    [InlineData(200_000)]
+    public void DecodeAllSamples_ReturnsEverySample_WhenStreamIsDecodedFully(int sampleFrames)
+    {
+        float[] samples = CreateSamples(sampleFrames);
+        using WaveStream waveStream = CreateWaveStream(samples);
+
+        DecodedAudio decodedAudio = NAudioDecoder.DecodeAllSamples(waveStream);
+
+        decodedAudio.Samples.Should().Equal(samples);
+        decodedAudio.Channels.Should().Be(Channels);
+        decodedAudio.SampleRate.Should().Be(SampleRate);
+        decodedAudio.SampleFrames.Should().Be(sampleFrames);
+    }
+
+    [Fact]
+    public void DecodeFile_ReturnsTheCachedSamples_WhenTheFileWasDecodedBefore()
+    {
+        DecodedAudio cachedDecodedAudio = new()
+        {
+            Samples = CreateSamples(10),
+            Channels = Channels,
+            SampleRate = SampleRate
+        };
+        IDecodedAudioCache decodedAudioCache = Substitute.For<IDecodedAudioCache>();
+        decodedAudioCache.ComputeFileHash("music.flac").Returns("hash");
+        decodedAudioCache.TryLoad("hash", out Arg.Any<DecodedAudio?>()).Returns(x =>
+        {
+            x[1] = cachedDecodedAudio;
+            return true;
+        });
+
+        DecodedAudio decodedAudio = NAudioDecoder.DecodeFile("music.flac", AudioFileFormat.Flac, decodedAudioCache);
+
+        decodedAudio.Should().BeSameAs(cachedDecodedAudio);
+        decodedAudioCache.DidNotReceiveWithAnyArgs().Save(default!, default!);
+    }
+
+    [Fact]
+    public void DecodeFile_SavesTheSamplesToTheCache_WhenTheFileWasNotDecodedBefore()
+    {
+        float[] samples = CreateSamples(1000);
+        string filePath = Path.Combine(Path.GetTempPath(), $"{Guid.NewGuid():N}.wav");
+        IDecodedAudioCache decodedAudioCache = Substitute.For<IDecodedAudioCache>();
+        decodedAudioCache.ComputeFileHash(filePath).Returns("hash");
+        try
+        {
+            using (WaveFileWriter writer = new(filePath, WaveFormat.CreateIeeeFloatWaveFormat(SampleRate, Channels)))
+                writer.WriteSamples(samples, 0, samples.Length);
+
+            DecodedAudio decodedAudio = NAudioDecoder.DecodeFile(filePath, AudioFileFormat.Wav, decodedAudioCache);
+
+            decodedAudio.Samples.Should().Equal(samples);
+            decodedAudioCache.Received(1).Save("hash", decodedAudio);
+        }
+        finally
+        {
+            File.Delete(filePath);
+        }
+    }
+
+    [Fact]
+    public void OnRead_ReadsTheSameSamplesAsDecodingFully_WhenDecodingKeepsUp()
+    {
+        float[] samples = CreateSamples(10_000);
+        using WaveStream waveStream = CreateWaveStream(samples);
+        StreamedNAudio sut = new(_logger, waveStream.ToSampleProvider(), waveStream, _workerPool, 4096);
+
+        List<float> readSamples = [];
+        float[] data = new float[1000];
+        while (readSamples.Count < samples.Length)
+        {
+            sut.DecodeAhead();
+            sut.OnRead(data);
+            readSamples.AddRange(data.Take(Math.Min(data.Length, samples.Length - readSamples.Count)));
+        }
+
+        readSamples.Should().Equal(samples);
+    }
+
+    [Fact]
+    public void OnRead_ReadsSilence_WhenDecodingDidNotKeepUp()
+    {
+        float[] samples = CreateSamples(100);
+        using WaveStream waveStream = CreateWaveStream(samples);
+        StreamedNAudio sut = new(_logger, waveStream.ToSampleProvider(), waveStream, _workerPool, 1024);
+
+        float[] data = Enumerable.Repeat(1f, 64).ToArray();
+        sut.OnRead(data);
+
+        data.Should().AllSatisfy(x => x.Should().Be(0));
+    }
+
+    [Fact]
+    public void OnRead_ReadsFromTheSeekPosition_OnlyOnceTheSeekIsApplied()
+    {
+        float[] samples = CreateSamples(5000);
+        using WaveStream waveStream = CreateWaveStream(samples);
+        StreamedNAudio sut = new(_logger, waveStream.ToSampleProvider(), waveStream, _workerPool, 1024);
+        sut.DecodeAhead();
+        float[] data = new float[8];
+
+        sut.OnSeek(3000);
+        sut.OnRead(data);
+        float[] dataBeforeSeekIsApplied = data.ToArray();
+        sut.DecodeAhead();
+        sut.OnRead(data);
+
+        dataBeforeSeekIsApplied.Should().AllSatisfy(x => x.Should().Be(0));
+        data.Should().Equal(samples.Skip(3000 * Channels).Take(data.Length));
+    }
+
+    [Fact]
+    public void OnRead_ReadsEverySample_WhenDecodingIsDoneByWorkers()
+    {
+        float[] samples = CreateSamples(50_000);
+        using WaveStream waveStream = CreateWaveStream(samples);
+        using AudioDecodingWorkerPool workerPool = new(_workerPoolLogger, 1);
+        StreamedNAudio sut = new(_logger, waveStream.ToSampleProvider(), waveStream, workerPool, 4096);
+        sut.DecodeAhead();
+
+        List<float> readSamples = [];
+        float[] data = new float[512];
+        DateTime timeout = DateTime.UtcNow.AddSeconds(30);
+        while (readSamples.Count < samples.Length && DateTime.UtcNow < timeout)
+        {
+            // Only reading what's buffered avoids mixing the silence of an underrun with the samples
+            if (sut.BufferedSamplesCount < Math.Min(data.Length, samples.Length - readSamples.Count))
+            {
+                Thread.Yield();
+                continue;
+            }
+
+            sut.OnRead(data);
+            readSamples.AddRange(data.Take(Math.Min(data.Length, samples.Length - readSamples.Count)));
+        }
+
+        readSamples.Should().Equal(samples);
+    }
+
+    [Fact]
+    public void DecodeAhead_LogsTheFailureAndReadsSilence_WhenDecodingThrows()
+    {
+        float[] samples = CreateSamples(100);
+        using WaveStream waveStream = CreateWaveStream(samples);
+        ISampleProvider sampleProvider = Substitute.For<ISampleProvider>();
+        InvalidDataException exception = new();
+        sampleProvider.Read(default!, default, default).ReturnsForAnyArgs(_ => throw exception);
+        StreamedNAudio sut = new(_logger, sampleProvider, waveStream, _workerPool, 1024);
+
+        sut.DecodeAhead();
+        float[] data = Enumerable.Repeat(1f, 64).ToArray();
+        sut.OnRead(data);
+
+        data.Should().AllSatisfy(x => x.Should().Be(0));
+        _logger.Collector.Count.Should().Be(1);
+        _logger.LatestRecord.Level.Should().Be(LogLevel.Error);
+        _logger.LatestRecord.Exception.Should().BeSameAs(exception);
+    }
+
+    private static float[] CreateSamples(int sampleFrames)
+    {
+        float[] samples = new float[sampleFrames * Channels];
+        for (int i = 0; i < samples.Length; i++)
+            samples[i] = (float)Math.Sin(i * 0.01);
+        return samples;
+    }
+
+    private static WaveStream CreateWaveStream(float[] samples)
+    {
+        MemoryStream memoryStream = new();
+        using (WaveFileWriter writer = new(
+                   new IgnoreDisposeStream(memoryStream),
+                   WaveFormat.CreateIeeeFloatWaveFormat(SampleRate, Channels)))
+        {
+            writer.WriteSamples(samples, 0, samples.Length);
+        }
+
+        memoryStream.Position = 0;
+        return new WaveFileReader(memoryStream);
+    }
+}
\ No newline at end of file
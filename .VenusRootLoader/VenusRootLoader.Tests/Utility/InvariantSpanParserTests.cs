@@ -0,0 +1,52 @@
+using AwesomeAssertions;
+using System.Globalization;
+using VenusRootLoader.Utility;
+
+namespace VenusRootLoader.Tests.Utility;
+
+public sealed class InvariantSpanParserTests
+{
+    [Theory]
+    [InlineData("0")]
+    [InlineData("42")]
+    [InlineData("-42")]
+    [InlineData("+42")]
+    [InlineData(" 7 ")]
+    [InlineData("2147483647")]
+    [InlineData("-2147483648")]
+    public void ParseInt32_ReturnsTheSameValueAsIntParse_WhenValueIsValid(string value)
+    {
+        InvariantSpanParser.ParseInt32(value.AsSpan()).Should().Be(int.Parse(value, CultureInfo.InvariantCulture));
+    }
+
+    [Theory]
+    [InlineData("")]
+    [InlineData("-")]
+    [InlineData("1a")]
+    [InlineData("1.5")]
+    public void ParseInt32_ThrowsFormatException_WhenValueIsNotAnInteger(string value)
+    {
+        Action act = () => InvariantSpanParser.ParseInt32(value.AsSpan());
+
+        act.Should().Throw<FormatException>();
+    }
+
+    [Theory]
+    [InlineData("2147483648")]
+    [InlineData("-2147483649")]
+    public void ParseInt32_ThrowsOverflowException_WhenValueDoesNotFitInAnInteger(string value)
+    {
+        Action act = () => InvariantSpanParser.ParseInt32(value.AsSpan());
+
+        act.Should().Throw<OverflowException>();
+    }
+
+    [Theory]
+    [InlineData("True")]
+    [InlineData("false")]
+    [InlineData(" TRUE ")]
+    public void ParseBoolean_ReturnsTheSameValueAsBoolParse_WhenValueIsValid(string value)
+    {
+        InvariantSpanParser.ParseBoolean(value.AsSpan()).Should().Be(bool.Parse(value));
+    }
+}
\ No newline at end of file
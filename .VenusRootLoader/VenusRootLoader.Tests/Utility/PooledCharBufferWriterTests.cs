@@ -0,0 +1,67 @@
+using AwesomeAssertions;
+using System.Globalization;
+using VenusRootLoader.Extensions;
+using VenusRootLoader.Utility;
+
+namespace VenusRootLoader.Tests.Utility;
+
+public sealed class PooledCharBufferWriterTests
+{
+    [Theory]
+    [InlineData(0)]
+    [InlineData(7)]
+    [InlineData(-1)]
+    [InlineData(1234567)]
+    [InlineData(int.MaxValue)]
+    [InlineData(int.MinValue)]
+    public void WriteInvariant_WritesTheSameTextAsToString_WhenValueIsAnInteger(int value)
+    {
+        using PooledCharBufferWriter writer = new(1);
+
+        writer.WriteInvariant(value);
+
+        writer.ToString().Should().Be(value.ToString(CultureInfo.InvariantCulture));
+    }
+
+    [Fact]
+    public void GetSpan_KeepsTheWrittenChars_WhenTheBufferGrows()
+    {
+        string text = new('a', 10_000);
+        using PooledCharBufferWriter sut = new(1);
+
+        sut.Write("b");
+        sut.Write(text);
+
+        sut.ToString().Should().Be("b" + text);
+        sut.WrittenCount.Should().Be(text.Length + 1);
+    }
+
+    [Fact]
+    public void Clear_DiscardsTheWrittenChars_WhenCharsWereWritten()
+    {
+        using PooledCharBufferWriter sut = new(16);
+        sut.Write("abc");
+
+        sut.Clear();
+        sut.Write("d");
+
+        sut.ToString().Should().Be("d");
+    }
+
+    [Fact]
+    public void WriteInvariant_DoesNotAllocate_WhenBufferIsWarm()
+    {
+        using PooledCharBufferWriter writer = new(1);
+
+        long allocatedBytesPerCall = TestUtility.MeasureAllocatedBytesPerCall(
+            () =>
+            {
+                writer.Clear();
+                for (int i = 0; i < 750; i++)
+                    writer.WriteInvariant(i % 3 == 0).Write(',').WriteInvariant(i).Write(',');
+            },
+            1000);
+
+        allocatedBytesPerCall.Should().BeLessThan(16);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+using AwesomeAssertions;
+using VenusRootLoader.Utility;
+
+namespace VenusRootLoader.Tests.Utility;
+
+public sealed class SpanTokenizerTests
+{
+    [Theory]
+    [InlineData("", false)]
+    [InlineData("", true)]
+    [InlineData("a", false)]
+    [InlineData(",", false)]
+    [InlineData(",", true)]
+    [InlineData("a,b,c", false)]
+    [InlineData("a,,b,", false)]
+    [InlineData("a,,b,", true)]
+    [InlineData(",,a,,", true)]
+    public void TryReadNext_ReadsTheSameTokensAsStringSplit_WhenSeparatorIsAChar(
+        string source,
+        bool removeEmptyEntries)
+    {
+        StringSplitOptions options =
+            removeEmptyEntries ? StringSplitOptions.RemoveEmptyEntries : StringSplitOptions.None;
+        string[] expectedTokens = source.Split([','], options);
+
+        List<string> tokens = [];
+        SpanTokenizer sut = new(source.AsSpan(), ',', removeEmptyEntries);
+        int countRemaining = sut.CountRemaining();
+        while (sut.TryReadNext(out ReadOnlySpan<char> token))
+            tokens.Add(token.ToString());
+
+        tokens.Should().Equal(expectedTokens);
+        countRemaining.Should().Be(expectedTokens.Length);
+    }
+
+    [Theory]
+    [InlineData("", false)]
+    [InlineData("a|SPLIT|b", false)]
+    [InlineData("|SPLIT|a|SPLIT||SPLIT|", false)]
+    [InlineData("|SPLIT|a|SPLIT||SPLIT|", true)]
+    [InlineData("a|SPLIT", false)]
+    public void TryReadNext_ReadsTheSameTokensAsStringSplit_WhenSeparatorIsAString(
+        string source,
+        bool removeEmptyEntries)
+    {
+        StringSplitOptions options =
+            removeEmptyEntries ? StringSplitOptions.RemoveEmptyEntries : StringSplitOptions.None;
+        string[] expectedTokens = source.Split(["|SPLIT|"], options);
+
+        List<string> tokens = [];
+        SpanTokenizer sut = new(source.AsSpan(), "|SPLIT|", removeEmptyEntries);
+        while (sut.TryReadNext(out ReadOnlySpan<char> token))
+            tokens.Add(token.ToString());
+
+        tokens.Should().Equal(expectedTokens);
+    }
+
+    [Fact]
+    public void ReadNext_ThrowsInvalidDataException_WhenThereAreNoTokensLeft()
+    {
+        SpanTokenizer sut = new("a,b".AsSpan(), ',', false);
+        sut.Skip(2);
+
+        bool thrown = false;
+        try
+        {
+            sut.ReadNext();
+        }
+        catch (InvalidDataException)
+        {
+            thrown = true;
+        }
+
+        thrown.Should().BeTrue();
+    }
+
+    [Fact]
+    public void TryReadNext_DoesNotAllocate_WhenReadingEveryToken()
+    {
+        string flagsLine = string.Join(",", Enumerable.Range(0, 750).Select(i => i % 3 == 0 ? "True" : "False"));
+
+        long allocatedBytesPerCall = TestUtility.MeasureAllocatedBytesPerCall(() => ReadEveryToken(flagsLine), 1000);
+
+        allocatedBytesPerCall.Should().BeLessThan(16);
+    }
+
+    private static void ReadEveryToken(string line)
+    {
+        SpanTokenizer tokenizer = new(line.AsSpan(), ',', false);
+        while (tokenizer.TryReadNext(out ReadOnlySpan<char> token))
+            InvariantSpanParser.ParseBoolean(token);
+    }
+}
\ No newline at end of file
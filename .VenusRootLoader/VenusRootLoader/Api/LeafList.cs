@@ -0,0 +1,220 @@
+using System.Collections.ObjectModel;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
+
+namespace VenusRootLoader.Api;
+
+/// <summary>
+/// A list owned by a <see cref="Leaf"/>. It can be used like any other list, but every modification done to it is
+/// tracked so the game data derived from its leaf reflects it.
+/// </summary>
+/// <remarks>
+/// It has the same members as <see cref="List{T}"/> so code written against a <see cref="List{T}"/> compiles
+/// against it. It isn't a <see cref="List{T}"/> though so it can't be assigned to one.
+/// </remarks>
+/// <typeparam name="T">The type of the elements of the list.</typeparam>
+public sealed class LeafList<T> : Collection<T>
+{
+    private readonly Action _notifyModification;
+
+    private List<T> UnderlyingList => (List<T>)Items;
+
+    /// <summary>
+    /// Creates an empty list. Its modifications are tracked as modifications of every type of leaf since it isn't
+    /// known which leaf will own it.
+    /// </summary>
+    public LeafList() : this(LeafModifications.NotifyAll)
+    {
+    }
+
+    /// <summary>
+    /// Creates an empty list owned by a leaf.
+    /// </summary>
+    /// <param name="notifyModification">Signals a modification of the leaves of the owning leaf's type.</param>
+    internal LeafList(Action notifyModification) => _notifyModification = notifyModification;
+
+    /// <inheritdoc cref="List{T}.Capacity"/>
+    public int Capacity
+    {
+        get => UnderlyingList.Capacity;
+        set => UnderlyingList.Capacity = value;
+    }
+
+    /// <inheritdoc cref="List{T}.GetEnumerator"/>
+    /// <remarks>This hides the enumerator of <see cref="Collection{T}"/> so enumerating doesn't allocate.</remarks>
+    public new List<T>.Enumerator GetEnumerator() => UnderlyingList.GetEnumerator();
+
+    /// <inheritdoc cref="List{T}.AddRange"/>
+    public void AddRange(IEnumerable<T> collection)
+    {
+        UnderlyingList.AddRange(collection);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.InsertRange"/>
+    public void InsertRange(int index, IEnumerable<T> collection)
+    {
+        UnderlyingList.InsertRange(index, collection);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.RemoveRange"/>
+    public void RemoveRange(int index, int count)
+    {
+        UnderlyingList.RemoveRange(index, count);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.RemoveAll"/>
+    public int RemoveAll(Predicate<T> match)
+    {
+        int removed = UnderlyingList.RemoveAll(match);
+        if (removed > 0)
+            _notifyModification();
+        return removed;
+    }
+
+    /// <inheritdoc cref="List{T}.Reverse()"/>
+    public void Reverse()
+    {
+        UnderlyingList.Reverse();
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.Reverse(int, int)"/>
+    public void Reverse(int index, int count)
+    {
+        UnderlyingList.Reverse(index, count);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.Sort()"/>
+    public void Sort()
+    {
+        UnderlyingList.Sort();
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.Sort(IComparer{T})"/>
+    public void Sort(IComparer<T>? comparer)
+    {
+        UnderlyingList.Sort(comparer);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.Sort(Comparison{T})"/>
+    public void Sort(Comparison<T> comparison)
+    {
+        UnderlyingList.Sort(comparison);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.Sort(int, int, IComparer{T})"/>
+    public void Sort(int index, int count, IComparer<T>? comparer)
+    {
+        UnderlyingList.Sort(index, count, comparer);
+        _notifyModification();
+    }
+
+    /// <inheritdoc cref="List{T}.TrimExcess"/>
+    public void TrimExcess() => UnderlyingList.TrimExcess();
+
+    /// <inheritdoc cref="List{T}.AsReadOnly"/>
+    public ReadOnlyCollection<T> AsReadOnly() => UnderlyingList.AsReadOnly();
+
+    /// <inheritdoc cref="List{T}.BinarySearch(T)"/>
+    public int BinarySearch(T item) => UnderlyingList.BinarySearch(item);
+
+    /// <inheritdoc cref="List{T}.BinarySearch(T, IComparer{T})"/>
+    public int BinarySearch(T item, IComparer<T>? comparer) => UnderlyingList.BinarySearch(item, comparer);
+
+    /// <inheritdoc cref="List{T}.BinarySearch(int, int, T, IComparer{T})"/>
+    public int BinarySearch(int index, int count, T item, IComparer<T>? comparer) =>
+        UnderlyingList.BinarySearch(index, count, item, comparer);
+
+    /// <inheritdoc cref="List{T}.ConvertAll{TOutput}"/>
+    public List<TOutput> ConvertAll<TOutput>(Converter<T, TOutput> converter) => UnderlyingList.ConvertAll(converter);
+
+    /// <inheritdoc cref="List{T}.Exists"/>
+    public bool Exists(Predicate<T> match) => UnderlyingList.Exists(match);
+
+    /// <inheritdoc cref="List{T}.Find"/>
+    public T? Find(Predicate<T> match) => UnderlyingList.Find(match);
+
+    /// <inheritdoc cref="List{T}.FindAll"/>
+    public List<T> FindAll(Predicate<T> match) => UnderlyingList.FindAll(match);
+
+    /// <inheritdoc cref="List{T}.FindIndex(Predicate{T})"/>
+    public int FindIndex(Predicate<T> match) => UnderlyingList.FindIndex(match);
+
+    /// <inheritdoc cref="List{T}.FindIndex(int, Predicate{T})"/>
+    public int FindIndex(int startIndex, Predicate<T> match) => UnderlyingList.FindIndex(startIndex, match);
+
+    /// <inheritdoc cref="List{T}.FindIndex(int, int, Predicate{T})"/>
+    public int FindIndex(int startIndex, int count, Predicate<T> match) =>
+        UnderlyingList.FindIndex(startIndex, count, match);
+
+    /// <inheritdoc cref="List{T}.FindLast"/>
+    public T? FindLast(Predicate<T> match) => UnderlyingList.FindLast(match);
+
+    /// <inheritdoc cref="List{T}.FindLastIndex(Predicate{T})"/>
+    public int FindLastIndex(Predicate<T> match) => UnderlyingList.FindLastIndex(match);
+
+    /// <inheritdoc cref="List{T}.FindLastIndex(int, Predicate{T})"/>
+    public int FindLastIndex(int startIndex, Predicate<T> match) => UnderlyingList.FindLastIndex(startIndex, match);
+
+    /// <inheritdoc cref="List{T}.FindLastIndex(int, int, Predicate{T})"/>
+    public int FindLastIndex(int startIndex, int count, Predicate<T> match) =>
+        UnderlyingList.FindLastIndex(startIndex, count, match);
+
+    /// <inheritdoc cref="List{T}.ForEach"/>
+    public void ForEach(Action<T> action) => UnderlyingList.ForEach(action);
+
+    /// <inheritdoc cref="List{T}.GetRange"/>
+    public List<T> GetRange(int index, int count) => UnderlyingList.GetRange(index, count);
+
+    /// <inheritdoc cref="List{T}.IndexOf(T, int)"/>
+    public int IndexOf(T item, int index) => UnderlyingList.IndexOf(item, index);
+
+    /// <inheritdoc cref="List{T}.IndexOf(T, int, int)"/>
+    public int IndexOf(T item, int index, int count) => UnderlyingList.IndexOf(item, index, count);
+
+    /// <inheritdoc cref="List{T}.LastIndexOf(T)"/>
+    public int LastIndexOf(T item) => UnderlyingList.LastIndexOf(item);
+
+    /// <inheritdoc cref="List{T}.LastIndexOf(T, int)"/>
+    public int LastIndexOf(T item, int index) => UnderlyingList.LastIndexOf(item, index);
+
+    /// <inheritdoc cref="List{T}.LastIndexOf(T, int, int)"/>
+    public int LastIndexOf(T item, int index, int count) => UnderlyingList.LastIndexOf(item, index, count);
+
+    /// <inheritdoc cref="List{T}.ToArray"/>
+    public T[] ToArray() => UnderlyingList.ToArray();
+
+    /// <inheritdoc cref="List{T}.TrueForAll"/>
+    public bool TrueForAll(Predicate<T> match) => UnderlyingList.TrueForAll(match);
+
+    protected override void InsertItem(int index, T item)
+    {
+        base.InsertItem(index, item);
+        _notifyModification();
+    }
+
+    protected override void SetItem(int index, T item)
+    {
+        base.SetItem(index, item);
+        _notifyModification();
+    }
+
+    protected override void RemoveItem(int index)
+    {
+        base.RemoveItem(index);
+        _notifyModification();
+    }
+
+    protected override void ClearItems()
+    {
+        base.ClearItems();
+        _notifyModification();
+    }
+}
\ No newline at end of file
@@ -1,3 +1,5 @@
+using VenusRootLoader.LeavesInternals;
+
 namespace VenusRootLoader.Api.Leaves;
 
 internal sealed class ActionCommandHelpTextLeaf : Leaf
@@ -6,5 +8,5 @@ internal sealed class ActionCommandHelpTextLeaf : Leaf
     {
     }
 
-    internal LocalizedData<string> HelpText { get; } = new();
+    internal LocalizedData<string> HelpText { get; } = new(LeafModifications<ActionCommandHelpTextLeaf>.Notifier);
 }
\ No newline at end of file
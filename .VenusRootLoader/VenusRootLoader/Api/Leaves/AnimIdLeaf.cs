@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -10,38 +11,38 @@ public sealed class AnimIdLeaf : Leaf
 
     internal sealed class AnimIdResourcePreload
     {
-        internal string ResourcePath { get; set; } = "";
-        internal bool PreloadOnlyDuringBattles { get; set; }
-        internal bool IsSprite { get; set; }
+        internal string ResourcePath { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = "";
+        internal bool PreloadOnlyDuringBattles { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+        internal bool IsSprite { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
     }
 
-    public float ShadowSize { get; set; } = 1.0f;
-    public Vector3 StartingScale { get; set; } = Vector3.one;
-    public float BleepPitch { get; set; } = 1.0f;
-    public Branch<DialogueBleepLeaf> Bleep { get; set; } = null!;
-    public bool IsModelEntity { get; set; }
-    public Vector3 ModelScale { get; set; }
-    public Vector3 ModelOffset { get; set; }
-    public Vector3 FreezeSize { get; set; }
-    public Vector3 FreezeOffset { get; set; }
-    public Vector3 FreezeFlipOffset { get; set; }
-    internal List<AnimIdResourcePreload> PreloadResources { get; } = new();
-    public bool ShakeOnDrop { get; set; }
-    public bool HasDigAnimation { get; set; }
-    public bool HasJumpAnimationOverride { get; set; } = true;
-    public bool FallsWhenFrozen { get; set; } = true;
-    public bool HasShadow { get; set; } = true;
-    public EntityControl.WalkType WalkType { get; set; }
-    internal int UnusedBaseIdleAnimState { get; set; }
-    internal int UnusedBaseWalkAnimState { get; set; }
-    public float MinimumHeight { get; set; }
-    internal float UnusedStartingHeight { get; set; }
-    public float StartingBobSpeed { get; set; }
-    public float StartingBobFrequency { get; set; }
-    public bool HasIceAnimation { get; set; }
-    public bool HasFlyingAnimationOverride { get; set; }
-    public bool ForcesShadow { get; set; }
-    public bool Object { get; set; }
+    public float ShadowSize { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = 1.0f;
+    public Vector3 StartingScale { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = Vector3.one;
+    public float BleepPitch { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = 1.0f;
+    public Branch<DialogueBleepLeaf> Bleep { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = null!;
+    public bool IsModelEntity { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public Vector3 ModelScale { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public Vector3 ModelOffset { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public Vector3 FreezeSize { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public Vector3 FreezeOffset { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public Vector3 FreezeFlipOffset { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    internal LeafList<AnimIdResourcePreload> PreloadResources { get; } = new(LeafModifications<AnimIdLeaf>.Notifier);
+    public bool ShakeOnDrop { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public bool HasDigAnimation { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public bool HasJumpAnimationOverride { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = true;
+    public bool FallsWhenFrozen { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = true;
+    public bool HasShadow { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); } = true;
+    public EntityControl.WalkType WalkType { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    internal int UnusedBaseIdleAnimState { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    internal int UnusedBaseWalkAnimState { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public float MinimumHeight { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    internal float UnusedStartingHeight { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public float StartingBobSpeed { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public float StartingBobFrequency { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public bool HasIceAnimation { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public bool HasFlyingAnimationOverride { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public bool ForcesShadow { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
+    public bool Object { get; set => LeafModifications<AnimIdLeaf>.Set(ref field, value); }
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(Branch<DialogueBleepLeaf> bleep)
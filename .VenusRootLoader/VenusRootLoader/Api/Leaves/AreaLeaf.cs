@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -8,13 +9,13 @@ public sealed class AreaLeaf : Leaf
 {
     public sealed class AreaLanguageData
     {
-        public string Name { get; set; } = "";
-        public List<string> PaginatedDescription { get; } = new();
+        public string Name { get; set => LeafModifications<AreaLeaf>.Set(ref field, value); } = "";
+        public LeafList<string> PaginatedDescription { get; } = new(LeafModifications<AreaLeaf>.Notifier);
     }
 
     internal AreaLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId) { }
 
-    public Vector2 MapPosition { get; set; }
+    public Vector2 MapPosition { get; set => LeafModifications<AreaLeaf>.Set(ref field, value); }
 
-    public LocalizedData<AreaLanguageData> LocalizedData { get; } = new();
+    public LocalizedData<AreaLanguageData> LocalizedData { get; } = new(LeafModifications<AreaLeaf>.Notifier);
 }
\ No newline at end of file
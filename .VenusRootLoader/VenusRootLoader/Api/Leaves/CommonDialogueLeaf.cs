@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -10,5 +11,5 @@ public sealed class CommonDialogueLeaf : DialogueLeaf
 
     internal int InternalGameIndex => Math.Abs(GameId) - 1;
 
-    public LocalizedData<string> LocalizedText { get; } = new();
+    public LocalizedData<string> LocalizedText { get; } = new(LeafModifications<CommonDialogueLeaf>.Notifier);
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -7,5 +8,6 @@ public sealed class CrystalBerryLeaf : Leaf
 {
     internal CrystalBerryLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId) { }
 
-    public LocalizedData<string> LocalizedFortuneTellerHint { get; } = new();
+    public LocalizedData<string> LocalizedFortuneTellerHint { get; } =
+        new(LeafModifications<CrystalBerryLeaf>.Notifier);
 }
\ No newline at end of file
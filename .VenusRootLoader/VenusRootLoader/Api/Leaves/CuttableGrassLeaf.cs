@@ -1,5 +1,6 @@
 using UnityEngine;
 using VenusRootLoader.Api.Unity;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -11,9 +12,21 @@ public sealed class CuttableGrassLeaf : Leaf
     {
     }
 
-    public IAssetLoader<Sprite> GrassSpriteWhenUncut { get; set; } = null!;
-    public IAssetLoader<Sprite> BaseGrassSpriteWhenCut { get; set; } = null!;
-    public IAssetLoader<Sprite> GrassSpriteWhenCutFromBase { get; set; } = null!;
+    public IAssetLoader<Sprite> GrassSpriteWhenUncut
+    {
+        get;
+        set => LeafModifications<CuttableGrassLeaf>.Set(ref field, value);
+    } = null!;
+    public IAssetLoader<Sprite> BaseGrassSpriteWhenCut
+    {
+        get;
+        set => LeafModifications<CuttableGrassLeaf>.Set(ref field, value);
+    } = null!;
+    public IAssetLoader<Sprite> GrassSpriteWhenCutFromBase
+    {
+        get;
+        set => LeafModifications<CuttableGrassLeaf>.Set(ref field, value);
+    } = null!;
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(
@@ -1,5 +1,6 @@
 using UnityEngine;
 using VenusRootLoader.Api.Unity;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,7 +10,11 @@ public sealed class DialogueBleepLeaf : Leaf
 {
     internal DialogueBleepLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId) { }
 
-    public IAssetLoader<AudioClip> BleepSound { get; set; } = null!;
+    public IAssetLoader<AudioClip> BleepSound
+    {
+        get;
+        set => LeafModifications<DialogueBleepLeaf>.Set(ref field, value);
+    } = null!;
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<AudioClip> bleepSound)
@@ -10,20 +10,29 @@ public sealed class DiscoveryLeaf : Leaf, IHasEnemyPortraitSprite
 {
     public sealed class DiscoveryLanguageData
     {
-        public string Name { get; set; } = "";
-        public List<DiscoveryDescriptionPage> PaginatedDescription { get; init; } = new();
+        public string Name { get; set => LeafModifications<DiscoveryLeaf>.Set(ref field, value); } = "";
+        public LeafList<DiscoveryDescriptionPage> PaginatedDescription { get; init; } =
+            new(LeafModifications<DiscoveryLeaf>.Notifier);
     }
 
     public sealed class DiscoveryDescriptionPage
     {
-        public string Text { get; set; } = "<NO CONTENT>";
-        public Branch<FlagLeaf>? RequiredFlag { get; set; }
+        public string Text { get; set => LeafModifications<DiscoveryLeaf>.Set(ref field, value); } = "<NO CONTENT>";
+        public Branch<FlagLeaf>? RequiredFlag { get; set => LeafModifications<DiscoveryLeaf>.Set(ref field, value); }
     }
 
     internal DiscoveryLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId) { }
 
-    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex { get; set; }
-    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite { get; set; } = null!;
+    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex
+    {
+        get;
+        set => LeafModifications<DiscoveryLeaf>.Set(ref field, value);
+    }
+    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite
+    {
+        get;
+        set => LeafModifications<DiscoveryLeaf>.Set(ref field, value);
+    } = null!;
 
     public IAssetLoader<Sprite> PortraitSprite
     {
@@ -31,7 +40,7 @@ public sealed class DiscoveryLeaf : Leaf, IHasEnemyPortraitSprite
         set => ((IHasEnemyPortraitSprite)this).PortraitSprite = value;
     }
 
-    public LocalizedData<DiscoveryLanguageData> LocalizedData { get; } = new();
+    public LocalizedData<DiscoveryLanguageData> LocalizedData { get; } = new(LeafModifications<DiscoveryLeaf>.Notifier);
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<Sprite> portraitSprite)
@@ -36,19 +36,35 @@ public sealed class EnemyLeaf : Leaf, IHasEnemyPortraitSprite
 
     public sealed class EnemyLanguageData
     {
-        public string Name { get; set; } = "";
-        public List<string> PaginatedBiography { get; init; } = new();
-        public string BeeSpyDialogue { get; set; } = "beetattle";
-        public string BeetleSpyDialogue { get; set; } = "beetletattle";
-        public string MothSpyDialogue { get; set; } = "mothtattle";
+        public string Name { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = "";
+        public LeafList<string> PaginatedBiography { get; init; } = new(LeafModifications<EnemyLeaf>.Notifier);
+        public string BeeSpyDialogue { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = "beetattle";
+        public string BeetleSpyDialogue
+        {
+            get;
+            set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+        } = "beetletattle";
+        public string MothSpyDialogue
+        {
+            get;
+            set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+        } = "mothtattle";
     }
 
     internal EnemyLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId) { }
 
-    public LocalizedData<EnemyLanguageData> LocalizedData { get; } = new();
+    public LocalizedData<EnemyLanguageData> LocalizedData { get; } = new(LeafModifications<EnemyLeaf>.Notifier);
 
-    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex { get; set; }
-    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite { get; set; } = null!;
+    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    }
+    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    } = null!;
 
     public IAssetLoader<Sprite> PortraitSprite
     {
@@ -56,39 +72,51 @@ public sealed class EnemyLeaf : Leaf, IHasEnemyPortraitSprite
         set => ((IHasEnemyPortraitSprite)this).PortraitSprite = value;
     }
 
-    public bool CanBeSpied { get; internal set; } = true;
-
-    public Branch<AnimIdLeaf> EntityAnimId { get; set; } = null!;
-    public int BaseMaxHp { get; set; }
-    public int BaseDefense { get; set; }
-    public int BaseExpReward { get; set; }
-    public int BaseBerriesDropAmount { get; set; }
-    public Vector3 CursorOffset { get; set; } = Vector3.zero;
-    public int PoisonResistance { get; set; }
-    public int FreezeResistance { get; set; }
-    public int NumbResistance { get; set; }
-    public int SleepResistance { get; set; }
-    public float LogicalSize { get; set; }
-    public Vector3 EntityFreezeSize { get; set; } = Vector3.one;
-    public Vector3 EntityFreezeOffset { get; set; } = Vector3.zero;
-    public BattleControl.BattlePosition StartingBattlePosition { get; set; }
-    public float EntityHeight { get; set; }
-    public float EntityBobSpeed { get; set; }
-    public float EntityBobRange { get; set; }
-    public List<BattleControl.AttackProperty> Properties { get; } = new();
-    public float Weight { get; set; }
-
-    public Branch<EnemyLeaf>? BaseEnemyId { get; internal set; }
-
-    public Branch<BattleEventDialogueLeaf>? EventDialogueTriggeredOnDeath { get; set; }
-    public int ActorTurnAmountPerMainTurn { get; set; }
-    public bool CanBeTaunted { get; set; } = true;
-    public bool CanFall { get; set; } = true;
-    public bool HasFixedExpScaling { get; set; }
-    public bool IsAffectedByExhaustion { get; set; } = true;
-    public bool HasStatsHiddenFromHud { get; set; }
-
-    internal int InternalDeathType { get; set; }
+    public bool CanBeSpied { get; internal set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = true;
+
+    public Branch<AnimIdLeaf> EntityAnimId { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = null!;
+    public int BaseMaxHp { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int BaseDefense { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int BaseExpReward { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int BaseBerriesDropAmount { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public Vector3 CursorOffset { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = Vector3.zero;
+    public int PoisonResistance { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int FreezeResistance { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int NumbResistance { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int SleepResistance { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public float LogicalSize { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public Vector3 EntityFreezeSize { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = Vector3.one;
+    public Vector3 EntityFreezeOffset
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    } = Vector3.zero;
+    public BattleControl.BattlePosition StartingBattlePosition
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    }
+    public float EntityHeight { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public float EntityBobSpeed { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public float EntityBobRange { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public LeafList<BattleControl.AttackProperty> Properties { get; } = new(LeafModifications<EnemyLeaf>.Notifier);
+    public float Weight { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+
+    public Branch<EnemyLeaf>? BaseEnemyId { get; internal set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+
+    public Branch<BattleEventDialogueLeaf>? EventDialogueTriggeredOnDeath
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    }
+    public int ActorTurnAmountPerMainTurn { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public bool CanBeTaunted { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = true;
+    public bool CanFall { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = true;
+    public bool HasFixedExpScaling { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public bool IsAffectedByExhaustion { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = true;
+    public bool HasStatsHiddenFromHud { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+
+    internal int InternalDeathType { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
 
     public EnemyDeathType DeathType
     {
@@ -98,19 +126,28 @@ public sealed class EnemyLeaf : Leaf, IHasEnemyPortraitSprite
         set => InternalDeathType = (int)value;
     }
 
-    public List<Branch<EnemyLeaf>> EnemiesWhoTriggerHitActionWhenDamaged { get; } = new();
-    public int HardModeAttackIncrease { get; set; }
-    public int HardModeBaseMaxHpIncrease { get; set; }
-    public int HardModeBaseDefenseIncrease { get; set; }
-    public int DefenseIncreaseWhenDefending { get; set; }
-    public Vector3 ItemOffset { get; set; } = Vector3.zero;
-
-    public bool IsBaseStateBattleIdle { get; set; }
-    public Branch<BattleEventDialogueLeaf>? EventDialogueTriggeredOnFall { get; set; }
-    public AutoHitActionTrigger HitActionTrigger { get; set; }
-    public bool CanActWhileStunned { get; set; }
-    public float SizeWhenFrozen { get; set; }
-
-    public bool IsIncludedInRandomCaveOfTrialsPool { get; set; } = true;
-    public bool IsRareSpyData { get; set; }
+    public LeafList<Branch<EnemyLeaf>> EnemiesWhoTriggerHitActionWhenDamaged { get; } =
+        new(LeafModifications<EnemyLeaf>.Notifier);
+    public int HardModeAttackIncrease { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int HardModeBaseMaxHpIncrease { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int HardModeBaseDefenseIncrease { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public int DefenseIncreaseWhenDefending { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public Vector3 ItemOffset { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); } = Vector3.zero;
+
+    public bool IsBaseStateBattleIdle { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public Branch<BattleEventDialogueLeaf>? EventDialogueTriggeredOnFall
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    }
+    public AutoHitActionTrigger HitActionTrigger { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public bool CanActWhileStunned { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+    public float SizeWhenFrozen { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
+
+    public bool IsIncludedInRandomCaveOfTrialsPool
+    {
+        get;
+        set => LeafModifications<EnemyLeaf>.Set(ref field, value);
+    } = true;
+    public bool IsRareSpyData { get; set => LeafModifications<EnemyLeaf>.Set(ref field, value); }
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,5 +10,5 @@ public sealed class FishingTextLeaf : Leaf
     {
     }
 
-    public LocalizedData<string> LocalizedText { get; } = new();
+    public LocalizedData<string> LocalizedText { get; } = new(LeafModifications<FishingTextLeaf>.Notifier);
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 using UnityEngine;
 using VenusRootLoader.Api.Unity;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,29 +10,33 @@ public sealed class ItemLeaf : Leaf
 {
     public sealed class ItemUse
     {
-        public MainManager.ItemUsage Effect { get; set; }
-        public int Value { get; set; }
+        public MainManager.ItemUsage Effect { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); }
+        public int Value { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); }
     }
 
     public sealed class ItemLanguageData
     {
-        public string Name { get; set; } = "<NO NAME>";
-        public string UnusedDescription { get; set; } = "";
-        public string Description { get; set; } = "<NO DESCRIPTION>";
-        public string? Prepender { get; set; }
+        public string Name { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); } = "<NO NAME>";
+        public string UnusedDescription { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); } = "";
+        public string Description
+        {
+            get;
+            set => LeafModifications<ItemLeaf>.Set(ref field, value);
+        } = "<NO DESCRIPTION>";
+        public string? Prepender { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); }
     }
 
     internal ItemLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    public List<ItemUse> Effects { get; } = new();
-    public LocalizedData<ItemLanguageData> LocalizedData { get; } = new();
+    public LeafList<ItemUse> Effects { get; } = new(LeafModifications<ItemLeaf>.Notifier);
+    public LocalizedData<ItemLanguageData> LocalizedData { get; } = new(LeafModifications<ItemLeaf>.Notifier);
 
-    public IAssetLoader<Sprite> Sprite { get; set; } = null!;
+    public IAssetLoader<Sprite> Sprite { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); } = null!;
 
-    public int BuyingPrice { get; set; }
-    public BattleControl.AttackArea Target { get; set; }
+    public int BuyingPrice { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); }
+    public BattleControl.AttackArea Target { get; set => LeafModifications<ItemLeaf>.Set(ref field, value); }
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<Sprite> sprite)
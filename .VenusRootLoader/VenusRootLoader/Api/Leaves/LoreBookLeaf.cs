@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -8,17 +9,21 @@ public sealed class LoreBookLeaf : Leaf
 {
     public sealed class LoreBookLanguageData
     {
-        public string Title { get; set; } = "";
-        public string Content { get; set; } = "";
-        public string FortuneTellerHint { get; set; } = "";
+        public string Title { get; set => LeafModifications<LoreBookLeaf>.Set(ref field, value); } = "";
+        public string Content { get; set => LeafModifications<LoreBookLeaf>.Set(ref field, value); } = "";
+        public string FortuneTellerHint { get; set => LeafModifications<LoreBookLeaf>.Set(ref field, value); } = "";
     }
 
     internal LoreBookLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    public LocalizedData<LoreBookLanguageData> LocalizedData { get; } = new();
-    public Branch<FlagLeaf> LoreBookObtainedFlag { get; set; } = null!;
+    public LocalizedData<LoreBookLanguageData> LocalizedData { get; } = new(LeafModifications<LoreBookLeaf>.Notifier);
+    public Branch<FlagLeaf> LoreBookObtainedFlag
+    {
+        get;
+        set => LeafModifications<LoreBookLeaf>.Set(ref field, value);
+    } = null!;
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(Branch<FlagLeaf> loreBookObtainedFlag)
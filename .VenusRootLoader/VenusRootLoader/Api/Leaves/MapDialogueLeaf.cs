@@ -1,9 +1,15 @@
+using VenusRootLoader.LeavesInternals;
+
 namespace VenusRootLoader.Api.Leaves;
 
 public sealed class MapDialogueLeaf : DialogueLeaf
 {
     internal MapDialogueLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId) { }
     internal override Branch<MapLeaf> AssociatedMap => Map;
-    public Branch<MapLeaf> Map { get; internal set; } = null!;
-    public LocalizedData<string> LocalizedText { get; } = new();
+    public Branch<MapLeaf> Map
+    {
+        get;
+        internal set => LeafModifications<MapDialogueLeaf>.Set(ref field, value);
+    } = null!;
+    public LocalizedData<string> LocalizedText { get; } = new(LeafModifications<MapDialogueLeaf>.Notifier);
 }
\ No newline at end of file
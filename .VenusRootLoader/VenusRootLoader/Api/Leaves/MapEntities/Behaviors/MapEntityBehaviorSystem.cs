@@ -1,6 +1,7 @@
 using CommunityToolkit.Diagnostics;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves.MapEntities.Behaviors.Enums;
+using VenusRootLoader.LeavesInternals;
 
 namespace VenusRootLoader.Api.Leaves.MapEntities.Behaviors;
 
@@ -8,8 +9,16 @@ public sealed class MapEntityBehaviorSystem
 {
     private readonly MapEntityLeaf _mapEntityLeaf;
 
-    public MapEntityBehavior? OutOfBehaviorRangeBehavior { get; private set; }
-    public MapEntityBehavior? InBehaviorRangeBehavior { get; private set; }
+    public MapEntityBehavior? OutOfBehaviorRangeBehavior
+    {
+        get;
+        private set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
+    public MapEntityBehavior? InBehaviorRangeBehavior
+    {
+        get;
+        private set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
 
     internal MapEntityBehaviorSystem(MapEntityLeaf entityLeaf) { _mapEntityLeaf = entityLeaf; }
 
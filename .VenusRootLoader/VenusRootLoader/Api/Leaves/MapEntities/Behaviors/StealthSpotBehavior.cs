@@ -19,7 +19,7 @@ public sealed class StealthSpotBehavior : MapEntityBehavior
         set
         {
             MapEntityLeaf.InternalBattleEnemyIds[0].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -11,7 +11,7 @@ public sealed class StealthSpotWhileAsleepBehavior : MapEntityBehavior
         set
         {
             MapEntityLeaf.InternalBattleEnemyIds[0].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
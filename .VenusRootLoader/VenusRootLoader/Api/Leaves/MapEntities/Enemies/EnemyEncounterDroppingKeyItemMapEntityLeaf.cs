@@ -19,8 +19,8 @@ public sealed class EnemyEncounterDroppingKeyItemMapEntityLeaf : EnemyEncounterM
         get;
         set
         {
-            InternalVectorData[0].Value.x = value.Resolve().GameId;
-            field = value;
+            InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
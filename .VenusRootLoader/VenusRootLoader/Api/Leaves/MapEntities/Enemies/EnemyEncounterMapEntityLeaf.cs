@@ -28,7 +28,7 @@ public abstract class EnemyEncounterMapEntityLeaf : MapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
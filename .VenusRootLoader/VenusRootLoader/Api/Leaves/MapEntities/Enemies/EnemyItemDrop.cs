@@ -12,8 +12,8 @@ public sealed class EnemyItemDrop
         get;
         set
         {
-            Vector3Ref.Value.x = value?.Resolve().GameId ?? -1;
-            field = value;
+            Vector3Ref.Value = Vector3Ref.Value with { x = value?.Resolve().GameId ?? -1 };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -22,8 +22,8 @@ public sealed class EnemyItemDrop
         get;
         set
         {
-            Vector3Ref.Value.y = value?.Resolve().GameId ?? -1;
-            field = value;
+            Vector3Ref.Value = Vector3Ref.Value with { y = value?.Resolve().GameId ?? -1 };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 }
\ No newline at end of file
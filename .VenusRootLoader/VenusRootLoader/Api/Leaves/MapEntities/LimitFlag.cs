@@ -1,7 +1,13 @@
+using VenusRootLoader.LeavesInternals;
+
 namespace VenusRootLoader.Api.Leaves.MapEntities;
 
 public sealed class LimitFlag
 {
-    public required Branch<FlagLeaf> Flag { get; set; }
-    public bool FailsWholeExistConditionWhenFlagIsTrue { get; set; }
+    public required Branch<FlagLeaf> Flag { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    public bool FailsWholeExistConditionWhenFlagIsTrue
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
 }
\ No newline at end of file
@@ -7,7 +7,7 @@ namespace VenusRootLoader.Api.Leaves.MapEntities;
 public abstract class MapEntityLeaf : Leaf
 {
     private readonly string[] _modifiersNames = [.. Enum.GetNames(typeof(MapEntityModifiers)).Skip(1)];
-    internal MapEntityModifiers Modifiers { get; set; }
+    internal MapEntityModifiers Modifiers { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
 
     public string BaseGameObjectName
     {
@@ -22,16 +22,20 @@ public abstract class MapEntityLeaf : Leaf
                     $"{string.Join(", ", _modifiersNames)}.");
             }
 
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = $"Unnamed {nameof(MapEntityLeaf)}";
 
-    public Branch<MapLeaf> Map { get; internal set; } = null!;
+    public Branch<MapLeaf> Map { get; internal set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = null!;
 
     internal abstract NPCControl.NPCType Type { get; }
     internal abstract NPCControl.ObjectTypes ObjectType { get; }
 
-    protected internal NPCControl.Interaction OriginalInteraction { get; internal set; }
+    protected internal NPCControl.Interaction OriginalInteraction
+    {
+        get;
+        internal set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
     internal abstract NPCControl.Interaction Interaction { get; }
 
     internal MapEntityLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
@@ -137,8 +141,8 @@ public abstract class MapEntityLeaf : Leaf
     internal int[] OriginalRequires { get; } = new int[10];
     internal int[] OriginalLimits { get; } = new int[10];
 
-    public List<Branch<FlagLeaf>> RequiredFlags { get; } = new();
-    public List<LimitFlag> LimitedToFlags { get; } = new();
+    public LeafList<Branch<FlagLeaf>> RequiredFlags { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
+    public LeafList<LimitFlag> LimitedToFlags { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
 
     public virtual Vector3 EntityStartingPosition
     {
@@ -161,39 +165,59 @@ public abstract class MapEntityLeaf : Leaf
         set => InternalRegionalFlagId = value ?? -1;
     }
 
-    internal bool IsReturnToHeightOriginallyInt { get; set; }
-    internal bool InternalReturnToHeight { get; set; } = true;
-    internal int InternalInsideId { get; set; } = -1;
-    internal Color InternalTagColor { get; set; }
+    internal bool IsReturnToHeightOriginallyInt { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal bool InternalReturnToHeight { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = true;
+    internal int InternalInsideId { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1;
+    internal Color InternalTagColor { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
 
-    internal NPCControl.ActionBehaviors InternalOutOfRangeBehavior { get; set; }
-    internal float InternalOutOfRangeActionFrequency { get; set; } = 200f;
-    internal NPCControl.ActionBehaviors InternalInRangeBehavior { get; set; }
-    internal float InternalInRangeActionFrequency { get; set; } = 200f;
+    internal NPCControl.ActionBehaviors InternalOutOfRangeBehavior
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
+    internal float InternalOutOfRangeActionFrequency
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = 200f;
+    internal NPCControl.ActionBehaviors InternalInRangeBehavior
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
+    internal float InternalInRangeActionFrequency
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = 200f;
 
-    internal NPCControl.DeathType InternalDeathType { get; set; }
-    internal int InternalAnimIdOrItemId { get; set; } = -1;
-    internal bool InternalIsFlipped { get; set; }
-    internal Vector3 InternalStartingPosition { get; set; }
-    internal float InternalInitialHeight { get; set; }
-    internal float InternalBobRange { get; set; }
-    internal float InternalBobSpeed { get; set; }
+    internal NPCControl.DeathType InternalDeathType
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    }
+    internal int InternalAnimIdOrItemId { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1;
+    internal bool InternalIsFlipped { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal Vector3 InternalStartingPosition { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal float InternalInitialHeight { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal float InternalBobRange { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal float InternalBobSpeed { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
 
-    internal float InternalCcolHeight { get; set; } = 2f;
-    internal float InternalCcolRadius { get; set; } = 0.5f;
+    internal float InternalCcolHeight { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 2f;
+    internal float InternalCcolRadius { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 0.5f;
 
-    internal Vector3 InternalEulerAngles { get; set; }
-    internal float InternalRadius { get; set; }
-    internal float InternalTimer { get; set; } = -1f;
+    internal Vector3 InternalEulerAngles { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal float InternalRadius { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal float InternalTimer { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1f;
 
-    internal float InternalSpeed { get; set; } = 5f;
+    internal float InternalSpeed { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 5f;
 
-    internal float InternalSpeedMultiplier { get; set; } = 1f;
-    internal float InternalRadiusLimit { get; set; } = 6f;
-    internal float InternalWanderRadius { get; set; } = 3f;
-    internal float InternalTeleportRadius { get; set; } = 9f;
+    internal float InternalSpeedMultiplier { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 1f;
+    internal float InternalRadiusLimit { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 6f;
+    internal float InternalWanderRadius { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 3f;
+    internal float InternalTeleportRadius { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 9f;
 
-    internal float InternalFreezeTime { get; set; } = 600f;
+    internal float InternalFreezeTime { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = 600f;
 
     /*
      * TODO: These 2 fields don't work because CheckSpecialID will not honor them, but if they are specified meaning they
@@ -201,37 +225,58 @@ public abstract class MapEntityLeaf : Leaf
      * This can't work for modding so we have to retroactively change all existing ones to these values and then patch
      * the game to remove this quirk so they can actually function as it's supposed to
      */
-    internal Vector3 InternalFreezeSize { get; set; } = Vector3.one;
-    internal Vector3 InternalFreezeOffset { get; set; } = Vector3.zero;
+    internal Vector3 InternalFreezeSize
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = Vector3.one;
+    internal Vector3 InternalFreezeOffset
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = Vector3.zero;
 
-    internal int InternalActivationFlagId { get; set; } = -1;
-    internal int InternalRegionalFlagId { get; set; } = -1;
+    internal int InternalActivationFlagId { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1;
+    internal int InternalRegionalFlagId { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1;
 
-    internal int InternalSpyDialogueId { get; set; } = -1;
-    internal int InternalEventId { get; set; } = -1;
+    internal int InternalSpyDialogueId { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1;
+    internal int InternalEventId { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = -1;
 
-    internal bool InternalHaxBoxCol { get; set; }
-    internal bool InternalBoxColIsTrigger { get; set; }
-    internal Vector3 InternalBoxColSize { get; set; } = Vector3.one;
-    internal Vector3 InternalBoxColCenter { get; set; }
+    internal bool InternalHaxBoxCol { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal bool InternalBoxColIsTrigger { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    internal Vector3 InternalBoxColSize
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = Vector3.one;
+    internal Vector3 InternalBoxColCenter { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
 
     internal int[] OriginalData { get; } = new int[10];
-    internal List<Ref<int>> InternalData { get; } = new();
+    internal LeafList<Ref<int>> InternalData { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
 
     internal Vector3[] OriginalVectorData { get; } = new Vector3[10];
-    internal List<Ref<Vector3>> InternalVectorData { get; } = new();
-    internal Vector3[] InternalSecondaryVectorDataArray { get; set; } = [];
-    internal List<Ref<Vector3>> InternalSecondaryVectorData { get; } = new();
+    internal LeafList<Ref<Vector3>> InternalVectorData { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
+    internal Vector3[] InternalSecondaryVectorDataArray
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = [];
+    internal LeafList<Ref<Vector3>> InternalSecondaryVectorData { get; } =
+        new(LeafModifications<MapEntityLeaf>.Notifier);
 
     internal Vector3[] OriginalDialogues { get; } = new Vector3[20];
-    internal List<Ref<Vector3>> InternalDialogues { get; } = new();
+    internal LeafList<Ref<Vector3>> InternalDialogues { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
 
     internal int[] OriginalBattleEnemyIds { get; } = new int[4];
-    internal List<Ref<int>> InternalBattleEnemyIds { get; } = new();
+    internal LeafList<Ref<int>> InternalBattleEnemyIds { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
 
-    internal Vector3 InternalEmoticonOffset { get; set; } = Vector3.zero;
+    internal Vector3 InternalEmoticonOffset
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = Vector3.zero;
     internal Vector2[] OriginalEmoticonFlags { get; } = Enumerable.Repeat(new Vector2(-1, 0), 10).ToArray();
-    internal List<Ref<Vector2>> InternalEmoticonFlags { get; } = new();
+    internal LeafList<Ref<Vector2>> InternalEmoticonFlags { get; } = new(LeafModifications<MapEntityLeaf>.Notifier);
 
-    internal string UnusedOverflowData { get; set; } = "";
+    internal string UnusedOverflowData { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); } = "";
 }
\ No newline at end of file
@@ -27,7 +27,7 @@ public sealed class CaravanShelvedMedalNpcMapEntityLeaf : NpcMapEntityLeaf
             }
 
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -40,7 +40,7 @@ public sealed class CaravanShelvedMedalNpcMapEntityLeaf : NpcMapEntityLeaf
                 ThrowHelper.ThrowInvalidOperationException($"This map dialogue must be in the {Map.NamedId} map");
 
             InternalData[1].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
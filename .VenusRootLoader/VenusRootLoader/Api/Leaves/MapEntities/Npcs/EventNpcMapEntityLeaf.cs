@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -24,7 +25,7 @@ public sealed class EventNpcMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
         set
         {
             InternalEventId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
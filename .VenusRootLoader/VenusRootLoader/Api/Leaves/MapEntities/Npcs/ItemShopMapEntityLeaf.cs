@@ -24,15 +24,15 @@ public sealed class ItemShopMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
             if (value.Resolve().AssociatedMap is not null && value.Resolve().AssociatedMap != Map)
                 ThrowHelper.ThrowInvalidOperationException($"This map dialogue must be in the {Map.NamedId} map");
 
-            InternalDialogues[0].Value.y = value.Resolve().GameId;
-            field = value;
+            InternalDialogues[0].Value = InternalDialogues[0].Value with { y = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
     public float? ItemsBuyingPriceMultiplier
     {
         get => InternalDialogues[2].Value.y > 0.1f ? InternalDialogues[2].Value.y / 10f : null;
-        set => InternalDialogues[2].Value.y = value * 10f ?? 0f;
+        set => InternalDialogues[2].Value = InternalDialogues[2].Value with { y = value * 10f ?? 0f };
     }
 
     public Branch<DialogueLeaf> DialogueWhenInteractingWithShelvedItem
@@ -43,15 +43,15 @@ public sealed class ItemShopMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
             if (value.Resolve().AssociatedMap is not null && value.Resolve().AssociatedMap != Map)
                 ThrowHelper.ThrowInvalidOperationException($"This map dialogue must be in the {Map.NamedId} map");
 
-            InternalDialogues[6].Value.y = value.Resolve().GameId;
-            field = value;
+            InternalDialogues[6].Value = InternalDialogues[6].Value with { y = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
     public float? ShelvedItemsInteractionRadius
     {
         get => InternalDialogues[8].Value.x > 0.1f ? InternalDialogues[8].Value.x / 10f : null;
-        set => InternalDialogues[8].Value.x = value * 10f ?? 0f;
+        set => InternalDialogues[8].Value = InternalDialogues[8].Value with { x = value * 10f ?? 0f };
     }
 
     private readonly ListDoubleRefWrapper<ItemShopShelvedItemForSale, int, Vector3> _itemsForSale;
@@ -13,7 +13,7 @@ public sealed class ItemShopShelvedItemForSale
         get;
         set
         {
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
             RefItemGameId.Value = value.Resolve().GameId;
         }
     }
@@ -23,7 +23,7 @@ public sealed class ItemShopShelvedItemForSale
         get;
         set
         {
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
             RefPosition.Value = value;
         }
     }
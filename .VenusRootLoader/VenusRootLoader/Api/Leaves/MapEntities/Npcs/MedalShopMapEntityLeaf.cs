@@ -21,8 +21,8 @@ public sealed class MedalShopMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
         get;
         set
         {
-            InternalDialogues[9].Value.x = value.Resolve().GameId;
-            field = value;
+            InternalDialogues[9].Value = InternalDialogues[9].Value with { x = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -34,15 +34,15 @@ public sealed class MedalShopMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
             if (value.Resolve().AssociatedMap is not null && value.Resolve().AssociatedMap != Map)
                 ThrowHelper.ThrowInvalidOperationException($"This map dialogue must be in the {Map.NamedId} map");
 
-            InternalDialogues[0].Value.y = value.Resolve().GameId;
-            field = value;
+            InternalDialogues[0].Value = InternalDialogues[0].Value with { y = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
     public bool OnlyAcceptsCrystalBerries
     {
         get => Mathf.Approximately(InternalDialogues[1].Value.y, 1f);
-        set => InternalDialogues[1].Value.y = value ? 1f : 0f;
+        set => InternalDialogues[1].Value = InternalDialogues[1].Value with { y = value ? 1f : 0f };
     }
 
     public Branch<DialogueLeaf> DialogueWhenInteractingWithShelvedMedal
@@ -53,15 +53,15 @@ public sealed class MedalShopMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
             if (value.Resolve().AssociatedMap is not null && value.Resolve().AssociatedMap != Map)
                 ThrowHelper.ThrowInvalidOperationException($"This map dialogue must be in the {Map.NamedId} map");
 
-            InternalDialogues[6].Value.y = value.Resolve().GameId;
-            field = value;
+            InternalDialogues[6].Value = InternalDialogues[6].Value with { y = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
     public float? ShelvedMedalsInteractionRadius
     {
         get => InternalDialogues[8].Value.x > 0.1f ? InternalDialogues[8].Value.x / 10f : null;
-        set => InternalDialogues[8].Value.x = value * 10f ?? 0f;
+        set => InternalDialogues[8].Value = InternalDialogues[8].Value with { x = value * 10f ?? 0f };
     }
 
     private readonly ListRefWrapper<Vector3, Vector3> _shelvedMedalPositions;
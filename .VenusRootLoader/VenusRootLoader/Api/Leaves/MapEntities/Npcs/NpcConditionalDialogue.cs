@@ -12,8 +12,8 @@ public sealed class NpcConditionalDialogue
         get;
         set
         {
-            Vector3Ref.Value.x = value?.Resolve().GameId ?? -1;
-            field = value;
+            Vector3Ref.Value = Vector3Ref.Value with { x = value?.Resolve().GameId ?? -1 };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -22,8 +22,8 @@ public sealed class NpcConditionalDialogue
         get;
         set
         {
-            Vector3Ref.Value.y = value.Resolve().GameId;
-            field = value;
+            Vector3Ref.Value = Vector3Ref.Value with { y = value.Resolve().GameId };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -32,8 +32,8 @@ public sealed class NpcConditionalDialogue
         get;
         set
         {
-            Vector3Ref.Value.z = value;
-            field = value;
+            Vector3Ref.Value = Vector3Ref.Value with { z = value };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 }
\ No newline at end of file
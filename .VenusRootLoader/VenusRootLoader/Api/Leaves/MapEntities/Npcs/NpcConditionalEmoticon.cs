@@ -12,8 +12,8 @@ public sealed class NpcConditionalEmoticon
         get;
         set
         {
-            Vector2Ref.Value.x = value?.Resolve().GameId ?? -1;
-            field = value;
+            Vector2Ref.Value = Vector2Ref.Value with { x = value?.Resolve().GameId ?? -1 };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -22,8 +22,8 @@ public sealed class NpcConditionalEmoticon
         get;
         set
         {
-            Vector2Ref.Value.y = (int)value;
-            field = value;
+            Vector2Ref.Value = Vector2Ref.Value with { y = (int)value };
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 }
\ No newline at end of file
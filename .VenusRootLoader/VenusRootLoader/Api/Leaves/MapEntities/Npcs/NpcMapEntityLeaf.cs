@@ -24,7 +24,7 @@ public abstract class NpcMapEntityLeaf : MapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -46,7 +46,7 @@ public abstract class NpcMapEntityLeaf : MapEntityLeaf
     public NpcEmoticon FallbackEmoticon
     {
         get => (NpcEmoticon)(int)InternalEmoticonFlags[0].Value.y;
-        set => InternalEmoticonFlags[0].Value.y = (int)value;
+        set => InternalEmoticonFlags[0].Value = InternalEmoticonFlags[0].Value with { y = (int)value };
     }
 
     private readonly ListRefWrapper<NpcConditionalEmoticon, Vector2> _conditionalEmoticons;
@@ -20,7 +20,7 @@ public abstract class NpcWithSpyDialogueMapEntityLeaf : NpcMapEntityLeaf
         set
         {
             InternalSpyDialogueId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
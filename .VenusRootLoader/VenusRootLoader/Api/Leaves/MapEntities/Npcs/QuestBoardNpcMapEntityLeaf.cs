@@ -27,7 +27,7 @@ public sealed class QuestBoardNpcMapEntityLeaf : NpcMapEntityLeaf
             }
 
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -40,7 +40,7 @@ public sealed class QuestBoardNpcMapEntityLeaf : NpcMapEntityLeaf
                 ThrowHelper.ThrowInvalidOperationException($"This map dialogue must be in the {Map.NamedId} map");
 
             InternalData[1].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -50,7 +50,7 @@ public sealed class QuestBoardNpcMapEntityLeaf : NpcMapEntityLeaf
         set
         {
             InternalData[2].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -69,13 +69,13 @@ public sealed class QuestBoardNpcMapEntityLeaf : NpcMapEntityLeaf
     public float CameraSpeedBeforeShowingQuests
     {
         get => InternalVectorData[2].Value.x;
-        set => InternalVectorData[2].Value.x = value;
+        set => InternalVectorData[2].Value = InternalVectorData[2].Value with { x = value };
     }
 
     public float CameraMovementTimeInSecondsBeforeShowingQuests
     {
         get => InternalVectorData[2].Value.y;
-        set => InternalVectorData[2].Value.y = value;
+        set => InternalVectorData[2].Value = InternalVectorData[2].Value with { y = value };
     }
 
     public NpcHornInteraction HornInteraction
@@ -20,7 +20,7 @@ public sealed class TalkingNpcMapEntityLeaf : NpcWithSpyDialogueMapEntityLeaf
     private readonly ListRefWrapper<NpcConditionalDialogue, Vector3> _conditionalDialogues;
     public IList<NpcConditionalDialogue> ConditionalDialogues => _conditionalDialogues;
 
-    public bool InteractIconIsQuestionMark { get; set; }
+    public bool InteractIconIsQuestionMark { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
 
     [MapEntityInitializeFromNew]
     internal void InitializeFromNew(
@@ -24,7 +24,7 @@ public abstract class ActivatorZoneMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
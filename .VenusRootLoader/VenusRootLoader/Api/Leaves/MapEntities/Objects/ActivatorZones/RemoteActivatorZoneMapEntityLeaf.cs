@@ -1,6 +1,7 @@
 using CommunityToolkit.Diagnostics;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves.MapEntities.Objects.ActivatorZones.Enums;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves.MapEntities.Objects.ActivatorZones;
@@ -32,7 +33,7 @@ public sealed class RemoteActivatorZoneMapEntityLeaf : ActivatorZoneMapEntityLea
             }
 
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
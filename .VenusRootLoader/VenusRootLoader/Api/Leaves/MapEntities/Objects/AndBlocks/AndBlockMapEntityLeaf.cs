@@ -18,7 +18,7 @@ public abstract class AndBlockMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -31,7 +31,7 @@ public abstract class AndBlockMapEntityLeaf : ObjectMapEntityLeaf
     public float LocalPositionLerpFactorWhenActivated
     {
         get => InternalVectorData[1].Value.x;
-        set => InternalVectorData[1].Value.x = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { x = value };
     }
 
     public Vector3? EntityStartScaleOverride
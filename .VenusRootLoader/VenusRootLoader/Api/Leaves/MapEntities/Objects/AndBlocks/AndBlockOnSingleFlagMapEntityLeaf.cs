@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -18,7 +19,7 @@ public sealed class AndBlockOnSingleFlagMapEntityLeaf : AndBlockMapEntityLeaf
         set
         {
             InternalActivationFlagId = value.EffectiveValue;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
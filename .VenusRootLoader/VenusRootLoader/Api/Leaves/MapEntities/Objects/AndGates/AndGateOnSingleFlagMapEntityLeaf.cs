@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -17,7 +18,7 @@ public sealed class AndGateOnSingleFlagMapEntityLeaf : AndGateMapEntityLeaf
         set
         {
             InternalActivationFlagId = value.EffectiveValue;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
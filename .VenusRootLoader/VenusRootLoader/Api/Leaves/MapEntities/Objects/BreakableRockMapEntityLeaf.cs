@@ -1,5 +1,6 @@
 using UnityEngine;
 using VenusRootLoader.Api.Leaves.MapEntities.Objects.Enums;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -26,7 +27,7 @@ public sealed class BreakableRockMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -61,12 +61,12 @@ public sealed class CameraChangeZoneMapEntityLeaf : ObjectMapEntityLeaf
             if (value is null)
             {
                 InternalData[2].Value = 0;
-                InternalVectorData[3].Value.x = 0f;
+                InternalVectorData[3].Value = InternalVectorData[3].Value with { x = 0f };
                 return;
             }
 
             InternalData[2].Value = 1;
-            InternalVectorData[3].Value.x = value.Value;
+            InternalVectorData[3].Value = InternalVectorData[3].Value with { x = value.Value };
         }
     }
 
@@ -129,12 +129,12 @@ public sealed class CameraChangeZoneMapEntityLeaf : ObjectMapEntityLeaf
             if (value is null)
             {
                 InternalData[7].Value = 0;
-                InternalVectorData[3].Value.y = 0f;
+                InternalVectorData[3].Value = InternalVectorData[3].Value with { y = 0f };
                 return;
             }
 
             InternalData[7].Value = 1;
-            InternalVectorData[3].Value.y = value.Value;
+            InternalVectorData[3].Value = InternalVectorData[3].Value with { y = value.Value };
         }
     }
 
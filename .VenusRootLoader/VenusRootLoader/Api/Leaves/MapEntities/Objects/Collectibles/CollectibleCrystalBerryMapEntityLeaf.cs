@@ -20,7 +20,7 @@ public sealed class CollectibleCrystalBerryMapEntityLeaf : CollectibleMapEntityL
         set
         {
             InternalData[3].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
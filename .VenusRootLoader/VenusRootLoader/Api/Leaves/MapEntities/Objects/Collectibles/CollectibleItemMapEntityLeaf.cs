@@ -20,7 +20,7 @@ public sealed class CollectibleItemMapEntityLeaf : CollectibleMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -36,7 +36,7 @@ public sealed class CollectibleItemMapEntityLeaf : CollectibleMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
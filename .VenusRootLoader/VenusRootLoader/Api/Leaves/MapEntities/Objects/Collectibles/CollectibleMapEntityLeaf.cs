@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 
 namespace VenusRootLoader.Api.Leaves.MapEntities.Objects.Collectibles;
@@ -17,7 +18,7 @@ public abstract class CollectibleMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[1].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
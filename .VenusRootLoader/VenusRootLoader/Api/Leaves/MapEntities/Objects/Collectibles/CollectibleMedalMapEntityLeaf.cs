@@ -20,7 +20,7 @@ public sealed class CollectibleMedalMapEntityLeaf : CollectibleMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -30,7 +30,7 @@ public sealed class CollectibleMedalMapEntityLeaf : CollectibleMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
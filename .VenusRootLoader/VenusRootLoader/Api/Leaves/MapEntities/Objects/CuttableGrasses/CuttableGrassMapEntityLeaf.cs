@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 
 namespace VenusRootLoader.Api.Leaves.MapEntities.Objects.CuttableGrasses;
 
@@ -22,7 +23,7 @@ public abstract class CuttableGrassMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
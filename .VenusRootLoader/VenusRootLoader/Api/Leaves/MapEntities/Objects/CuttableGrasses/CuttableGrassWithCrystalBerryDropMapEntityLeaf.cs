@@ -20,7 +20,7 @@ public sealed class CuttableGrassWithCrystalBerryDropMapEntityLeaf : CuttableGra
         set
         {
             InternalData[1].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
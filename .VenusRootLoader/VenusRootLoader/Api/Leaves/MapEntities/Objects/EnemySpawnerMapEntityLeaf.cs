@@ -1,6 +1,7 @@
 using CommunityToolkit.Diagnostics;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves.MapEntities.Enemies;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves.MapEntities.Objects;
@@ -23,7 +24,7 @@ public sealed class EnemySpawnerMapEntityLeaf : ObjectMapEntityLeaf
                 ThrowHelper.ThrowInvalidOperationException($"This map enemy must be in the {Map.NamedId} map");
 
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -18,7 +18,7 @@ public sealed class EventTriggerZoneMapEntityLeaf : EventTriggerMapEntityLeaf
         set
         {
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -33,7 +33,7 @@ public sealed class EventTriggerZoneMapEntityLeaf : EventTriggerMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -20,7 +21,7 @@ public sealed class FixedAnimstateMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -21,7 +21,7 @@ public sealed class FlytrapPlatformMapEntityLeaf : ObjectMapEntityLeaf
     public float DelayFramesBeforeRespawnWhenFlytrapCloses
     {
         get => InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value };
     }
 
     public Vector3 PlatformPosition
@@ -65,19 +65,19 @@ public sealed class FreezableWaterDropletMapEntityLeaf : ObjectMapEntityLeaf
     public float IceCubeLaunchXZVelocity
     {
         get => InternalVectorData[1].Value.x;
-        set => InternalVectorData[1].Value.x = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { x = value };
     }
 
     public float IceCubeLaunchYVelocity
     {
         get => InternalVectorData[1].Value.y;
-        set => InternalVectorData[1].Value.y = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { y = value };
     }
 
     public float? WaterSplashSoundVolumeFraction
     {
         get => InternalVectorData[1].Value.z != 0f ? InternalVectorData[1].Value.z : null;
-        set => InternalVectorData[1].Value.z = value ?? 0f;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { z = value ?? 0f };
     }
 
     [MapEntityInitializeFromNew]
@@ -21,7 +21,7 @@ public sealed class GeyserMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[1].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -44,19 +44,19 @@ public sealed class GeyserMapEntityLeaf : ObjectMapEntityLeaf
     public float OscillationFrequencyInHertz
     {
         get => InternalVectorData[0].Value.x / 6f;
-        set => InternalVectorData[0].Value.x = value * 6f;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value * 6f };
     }
 
     public float OscillationMagnitude
     {
         get => InternalVectorData[0].Value.y;
-        set => InternalVectorData[0].Value.y = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { y = value };
     }
 
     public float FreezeTimeInFramesWhenFrozen
     {
         get => InternalVectorData[0].Value.z;
-        set => InternalVectorData[0].Value.z = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { z = value };
     }
 
     [MapEntityInitializeFromNew]
@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -20,7 +21,7 @@ public sealed class IceRadiusSwitchMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -30,7 +31,7 @@ public sealed class IceRadiusSwitchMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[1].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -49,13 +50,13 @@ public sealed class IceRadiusSwitchMapEntityLeaf : ObjectMapEntityLeaf
     public float RadiusRangeChangeRateWhenToggled
     {
         get => InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value };
     }
 
     public float RadiusRange
     {
         get => InternalVectorData[0].Value.y;
-        set => InternalVectorData[0].Value.y = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { y = value };
     }
 
     public Vector3 LocalPositionFromMapEntityParent
@@ -73,7 +74,7 @@ public sealed class IceRadiusSwitchMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
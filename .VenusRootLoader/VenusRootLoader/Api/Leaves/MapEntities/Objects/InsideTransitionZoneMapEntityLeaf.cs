@@ -22,7 +22,7 @@ public sealed class InsideTransitionZoneMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[1].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -71,7 +71,7 @@ public sealed class InsideTransitionZoneMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
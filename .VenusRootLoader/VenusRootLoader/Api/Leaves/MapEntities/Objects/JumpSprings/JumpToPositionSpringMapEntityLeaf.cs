@@ -1,5 +1,6 @@
 using CommunityToolkit.Diagnostics;
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves.MapEntities.Objects.JumpSprings;
@@ -24,7 +25,7 @@ public sealed class JumpToPositionSpringMapEntityLeaf : JumpSpringMapEntityLeaf
             }
 
             InternalData[2].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -37,13 +38,13 @@ public sealed class JumpToPositionSpringMapEntityLeaf : JumpSpringMapEntityLeaf
     public float JumpHeightWhenUsingSpring
     {
         get => InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value };
     }
 
     public float JumpDurationDivisorWhenUsingSpring
     {
         get => Mathf.Clamp(InternalVectorData[2].Value.x, 1f, 99f);
-        set => InternalVectorData[2].Value.x = Mathf.Clamp(value, 1f, 99f);
+        set => InternalVectorData[2].Value = InternalVectorData[2].Value with { x = Mathf.Clamp(value, 1f, 99f) };
     }
 
     [MapEntityInitializeFromNew]
@@ -13,7 +13,7 @@ public sealed class JumpUpSpringMapEntityLeaf : JumpSpringMapEntityLeaf
     public float? JumpHeightOverrideWhenUsingSpring
     {
         get => InternalVectorData[0].Value.x <= 1.0f ? null : InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value ?? 0f;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value ?? 0f };
     }
 
     [MapEntityInitializeFromNew]
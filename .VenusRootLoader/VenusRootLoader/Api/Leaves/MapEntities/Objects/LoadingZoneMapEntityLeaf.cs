@@ -14,7 +14,11 @@ public sealed class LoadingZoneMapEntityLeaf : ObjectMapEntityLeaf
 
     internal override NPCControl.ObjectTypes ObjectType => NPCControl.ObjectTypes.DoorOtherMap;
 
-    public Branch<MapLeaf> DestinationMap { get; set; } = null!;
+    public Branch<MapLeaf> DestinationMap
+    {
+        get;
+        set => LeafModifications<MapEntityLeaf>.Set(ref field, value);
+    } = null!;
 
     public Vector3? CameraPositionOffsetFromTargetAfterLoadOverride
     {
@@ -116,7 +120,7 @@ public sealed class LoadingZoneMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -21,7 +21,7 @@ public sealed class MapMainMeshChildVerticalPositionSwitchMapEntityLeaf : Object
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -36,19 +36,19 @@ public sealed class MapMainMeshChildVerticalPositionSwitchMapEntityLeaf : Object
     public float FramesDurationForFullMovement
     {
         get => InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value };
     }
 
     public float VerticalMovementUpperBound
     {
         get => InternalVectorData[0].Value.y;
-        set => InternalVectorData[0].Value.y = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { y = value };
     }
 
     public float VerticalMovementLowerBound
     {
         get => InternalVectorData[0].Value.z;
-        set => InternalVectorData[0].Value.z = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { z = value };
     }
 
     public Vector3 TriggerBoxColliderSize { get => InternalBoxColSize; set => InternalBoxColSize = value; }
@@ -60,7 +60,7 @@ public sealed class MapMainMeshChildVerticalPositionSwitchMapEntityLeaf : Object
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
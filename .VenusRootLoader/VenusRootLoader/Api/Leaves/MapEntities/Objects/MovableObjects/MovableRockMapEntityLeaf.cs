@@ -14,13 +14,13 @@ public sealed class MovableRockMapEntityLeaf : MovableObjectMapEntityLeaf
     public float LaunchYVelocity
     {
         get => InternalVectorData[0].Value.y;
-        set => InternalVectorData[0].Value.y = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { y = value };
     }
 
     public float LaunchXZVelocityMultiplier
     {
         get => InternalVectorData[0].Value.z;
-        set => InternalVectorData[0].Value.z = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { z = value };
     }
 
     [MapEntityInitializeFromNew]
@@ -13,7 +13,7 @@ public sealed class SlidingIcePillarMapEntityLeaf : MovableObjectMapEntityLeaf
     public float SlidingVelocityMultiplier
     {
         get => InternalVectorData[0].Value.z;
-        set => InternalVectorData[0].Value.z = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { z = value };
     }
 
     public Vector3? IcePillarScaleOverride
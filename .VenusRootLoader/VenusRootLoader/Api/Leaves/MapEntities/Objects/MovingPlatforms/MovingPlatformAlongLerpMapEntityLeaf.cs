@@ -30,7 +30,7 @@ public sealed class MovingPlatformAlongLerpMapEntityLeaf : MovingPlatformMapEnti
     public bool StartMovementFromActivePosition
     {
         get => (int)InternalDialogues[0].Value.x == 1;
-        set => InternalDialogues[0].Value.x = value ? 1f : 0f;
+        set => InternalDialogues[0].Value = InternalDialogues[0].Value with { x = value ? 1f : 0f };
     }
 
     [MapEntityInitializeFromNew]
@@ -22,14 +22,14 @@ public sealed class MovingPlatformAlongPathMapEntityLeaf : MovingPlatformMapEnti
         set
         {
             Guard.IsBetweenOrEqualTo(value, 0, InternalVectorData.Count - 1, nameof(StartMovementFromNodeIndex));
-            InternalDialogues[0].Value.x = value;
+            InternalDialogues[0].Value = InternalDialogues[0].Value with { x = value };
         }
     }
 
     public float FramesDelayBeforeReversingWhenGoingInactiveAtNode
     {
         get => InternalDialogues[1].Value.y;
-        set => InternalDialogues[1].Value.y = value;
+        set => InternalDialogues[1].Value = InternalDialogues[1].Value with { y = value };
     }
 
     [MapEntityInitializeFromNew]
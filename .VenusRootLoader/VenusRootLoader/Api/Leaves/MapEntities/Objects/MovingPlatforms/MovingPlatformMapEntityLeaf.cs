@@ -22,26 +22,27 @@ public abstract class MovingPlatformMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
     public float MovementSpeedMultiplier
     {
         get => InternalDialogues[0].Value.y;
-        set => InternalDialogues[0].Value.y = value;
+        set => InternalDialogues[0].Value = InternalDialogues[0].Value with { y = value };
     }
 
     public float? ModelScaleOverride
     {
         get => InternalDialogues[2].Value.x <= 0.1f ? null : InternalDialogues[2].Value.x / 10f;
-        set => InternalDialogues[2].Value.x = value is > 0.1f ? value.Value * 10f : 0f;
+        set => InternalDialogues[2].Value =
+            InternalDialogues[2].Value with { x = value is > 0.1f ? value.Value * 10f : 0f };
     }
 
     public float? FramesBeforeShockIfElectroPlatformOverride
     {
         get => InternalDialogues[2].Value.y == 0f ? null : InternalDialogues[2].Value.y;
-        set => InternalDialogues[2].Value.y = value ?? 0f;
+        set => InternalDialogues[2].Value = InternalDialogues[2].Value with { y = value ?? 0f };
     }
 
     private readonly ListRefWrapper<Branch<ObjectMapEntityLeaf>, int> _requiredEntityActivationsToMove;
@@ -1,4 +1,5 @@
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -25,26 +26,26 @@ public sealed class MusicChangeRadiusMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[2].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
     public float RangeRadius
     {
         get => InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value };
     }
 
     public float MusicFadeRate
     {
         get => InternalVectorData[0].Value.y;
-        set => InternalVectorData[0].Value.y = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { y = value };
     }
 
     public float MusicMaxVolumeMultiplier
     {
         get => InternalVectorData[0].Value.z;
-        set => InternalVectorData[0].Value.z = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { z = value };
     }
 
     [MapEntityInitializeFromNew]
@@ -1,8 +1,10 @@
+using VenusRootLoader.LeavesInternals;
+
 namespace VenusRootLoader.Api.Leaves.MapEntities.Objects;
 
 public sealed class NegatableFlag
 {
-    public required Branch<FlagLeaf> Flag { get; set; }
-    public required bool IsValueNegated { get; set; }
+    public required Branch<FlagLeaf> Flag { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
+    public required bool IsValueNegated { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
     internal int EffectiveValue => Flag.Resolve().GameId * (IsValueNegated ? -1 : 1);
 }
\ No newline at end of file
@@ -11,7 +11,7 @@ public sealed class NegatableMapEntityActivation
         get;
         set
         {
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
             IntRef.Value = EffectiveValue;
         }
     }
@@ -21,7 +21,7 @@ public sealed class NegatableMapEntityActivation
         get;
         set
         {
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
             if (MapEntity.Resolve() is not null)
                 IntRef.Value = EffectiveValue;
         }
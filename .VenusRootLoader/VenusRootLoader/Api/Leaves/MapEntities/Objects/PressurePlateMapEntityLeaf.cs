@@ -52,7 +52,7 @@ public sealed class PressurePlateMapEntityLeaf : ObjectMapEntityLeaf
                     break;
             }
 
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -74,7 +74,7 @@ public sealed class PressurePlateMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[2].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -84,7 +84,7 @@ public sealed class PressurePlateMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalActivationFlagId = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
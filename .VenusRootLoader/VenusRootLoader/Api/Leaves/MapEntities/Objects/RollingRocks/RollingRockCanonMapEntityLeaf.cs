@@ -1,5 +1,6 @@
 using CommunityToolkit.Diagnostics;
 using UnityEngine;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -33,7 +34,7 @@ public sealed class RollingRockCanonMapEntityLeaf : RollingRockMapEntityLeaf
             }
 
             InternalData[3].Value = value?.EffectiveValue ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -43,7 +44,7 @@ public sealed class RollingRockCanonMapEntityLeaf : RollingRockMapEntityLeaf
         set
         {
             Guard.IsGreaterThan(value, 0f);
-            InternalVectorData[1].Value.z = value;
+            InternalVectorData[1].Value = InternalVectorData[1].Value with { z = value };
         }
     }
 
@@ -20,13 +20,14 @@ public abstract class RollingRockMapEntityLeaf : ObjectMapEntityLeaf
     public float MinimumYPositionBeforeRespawn
     {
         get => InternalVectorData[1].Value.x;
-        set => InternalVectorData[1].Value.x = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { x = value };
     }
 
     public float? RockRadiusOverride
     {
         get => InternalVectorData[1].Value.y < 0.1 ? null : InternalVectorData[1].Value.y;
-        set => InternalVectorData[1].Value.y = value is null or < 0.1f ? 0f : value.Value;
+        set => InternalVectorData[1].Value =
+            InternalVectorData[1].Value with { y = value is null or < 0.1f ? 0f : value.Value };
     }
 
     public Vector3 RollingRotationAngles
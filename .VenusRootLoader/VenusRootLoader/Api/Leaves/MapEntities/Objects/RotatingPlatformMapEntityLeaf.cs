@@ -30,7 +30,7 @@ public sealed class RotatingPlatformMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalAnimIdOrItemId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -43,25 +43,26 @@ public sealed class RotatingPlatformMapEntityLeaf : ObjectMapEntityLeaf
     public float MovementSpeedMultiplier
     {
         get => InternalDialogues[0].Value.y;
-        set => InternalDialogues[0].Value.y = value;
+        set => InternalDialogues[0].Value = InternalDialogues[0].Value with { y = value };
     }
 
     public float FramesDelayBeforeReversingWhenGoingInactiveAtNode
     {
         get => InternalDialogues[1].Value.y;
-        set => InternalDialogues[1].Value.y = value;
+        set => InternalDialogues[1].Value = InternalDialogues[1].Value with { y = value };
     }
 
     public float? ModelScale
     {
         get => InternalDialogues[2].Value.x <= 0.1f ? null : InternalDialogues[2].Value.x / 10f;
-        set => InternalDialogues[2].Value.x = value is > 0.1f ? value.Value * 10f : 0f;
+        set => InternalDialogues[2].Value =
+            InternalDialogues[2].Value with { x = value is > 0.1f ? value.Value * 10f : 0f };
     }
 
     public float? FramesBeforeShockIfElectroPlatformOverride
     {
         get => InternalDialogues[2].Value.y == 0f ? null : InternalDialogues[2].Value.y;
-        set => InternalDialogues[2].Value.y = value ?? 0f;
+        set => InternalDialogues[2].Value = InternalDialogues[2].Value with { y = value ?? 0f };
     }
 
     [MapEntityInitializeFromNew]
@@ -15,19 +15,19 @@ public sealed class SpinningCrankMapEntityLeaf : ObjectMapEntityLeaf
     public float RateOfIncreaseWhenSpinning
     {
         get => InternalVectorData[0].Value.x;
-        set => InternalVectorData[0].Value.x = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { x = value };
     }
 
     public float RateOfDecreaseWhenNotSpinning
     {
         get => InternalVectorData[0].Value.y;
-        set => InternalVectorData[0].Value.y = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { y = value };
     }
 
     public float MaximumSpinValue
     {
         get => InternalVectorData[0].Value.z;
-        set => InternalVectorData[0].Value.z = value;
+        set => InternalVectorData[0].Value = InternalVectorData[0].Value with { z = value };
     }
 
     public Vector3 SpinningRotationAngles
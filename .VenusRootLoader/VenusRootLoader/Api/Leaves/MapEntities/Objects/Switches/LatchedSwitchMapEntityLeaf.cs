@@ -19,7 +19,7 @@ public sealed class LatchedSwitchMapEntityLeaf : SwitchMapEntityLeaf
         set
         {
             InternalActivationFlagId = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
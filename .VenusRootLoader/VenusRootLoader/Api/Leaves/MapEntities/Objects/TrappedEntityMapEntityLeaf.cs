@@ -23,7 +23,7 @@ public sealed class TrappedEntityMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[0].Value = value.Resolve().GameId;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     } = null!;
 
@@ -33,7 +33,7 @@ public sealed class TrappedEntityMapEntityLeaf : ObjectMapEntityLeaf
         set
         {
             InternalData[1].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
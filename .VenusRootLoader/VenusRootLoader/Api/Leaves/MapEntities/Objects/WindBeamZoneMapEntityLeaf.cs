@@ -27,7 +27,7 @@ public sealed class WindBeamZoneMapEntityLeaf : ObjectMapEntityLeaf
             }
 
             InternalData[0].Value = value?.Resolve().GameId ?? -1;
-            field = value;
+            LeafModifications<MapEntityLeaf>.Set(ref field, value);
         }
     }
 
@@ -40,31 +40,33 @@ public sealed class WindBeamZoneMapEntityLeaf : ObjectMapEntityLeaf
     public float WindPushForceUnitsPerSecond
     {
         get => InternalVectorData[1].Value.x;
-        set => InternalVectorData[1].Value.x = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { x = value };
     }
 
     public float TriggerColliderWidth
     {
         get => InternalVectorData[1].Value.y;
-        set => InternalVectorData[1].Value.y = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { y = value };
     }
 
     public float TriggerColliderHeight
     {
         get => InternalVectorData[1].Value.z;
-        set => InternalVectorData[1].Value.z = value;
+        set => InternalVectorData[1].Value = InternalVectorData[1].Value with { z = value };
     }
 
     public float? WindParticlesStartLifetimeOverride
     {
         get => InternalVectorData[2].Value.x < 0.1f ? null : InternalVectorData[2].Value.x;
-        set => InternalVectorData[2].Value.x = value is null or < 0.1f ? 0f : value.Value;
+        set => InternalVectorData[2].Value =
+            InternalVectorData[2].Value with { x = value is null or < 0.1f ? 0f : value.Value };
     }
 
     public float? WindParticlesStartSpeedOverride
     {
         get => InternalVectorData[2].Value.y < 0.1f ? null : InternalVectorData[2].Value.y;
-        set => InternalVectorData[2].Value.y = value is null or < 0.1f ? 0f : value.Value;
+        set => InternalVectorData[2].Value =
+            InternalVectorData[2].Value with { y = value is null or < 0.1f ? 0f : value.Value };
     }
 
     [MapEntityInitializeFromNew]
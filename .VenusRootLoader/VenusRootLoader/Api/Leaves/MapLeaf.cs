@@ -2,6 +2,7 @@ using CommunityToolkit.Diagnostics;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves.MapEntities;
 using VenusRootLoader.Api.Unity;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 using VenusRootLoader.SourceGenerators;
 
@@ -18,39 +19,55 @@ public sealed class MapLeaf : Leaf
     {
     }
 
-    public Branch<AreaLeaf> Area { get; set; } = null!;
+    public Branch<AreaLeaf> Area { get; set => LeafModifications<MapLeaf>.Set(ref field, value); } = null!;
 
     public Vector3? DefaultCameraPositionOffsetFromTargetOverride
     {
         get => field?.magnitude <= 0.2 ? null : field;
-        set => field = value is null || value.Value.magnitude <= 0.2f ? null : value;
+        set => LeafModifications<MapLeaf>.Set(ref field, value is null || value.Value.magnitude <= 0.2f ? null : value);
     }
 
     public Vector3? DefaultCameraAnglesOffsetFromTargetOverride
     {
         get => field?.magnitude <= 0.2 ? null : field;
-        set => field = value is null || value.Value.magnitude <= 0.2f ? null : value;
+        set => LeafModifications<MapLeaf>.Set(ref field, value is null || value.Value.magnitude <= 0.2f ? null : value);
     }
 
-    public Vector3 DefaultCameraLowerBounds { get; set; } = new(-999.0f, -999.0f, -999.0f);
-    public Vector3 DefaultCameraUpperBounds { get; set; } = new(999.0f, 999.0f, 999.0f);
-    public MapCameraMoveAroundCircleConfiguration? CameraMoveAroundCircleConfiguration { get; set; }
+    public Vector3 DefaultCameraLowerBounds
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = new(-999.0f, -999.0f, -999.0f);
+    public Vector3 DefaultCameraUpperBounds
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = new(999.0f, 999.0f, 999.0f);
+    public MapCameraMoveAroundCircleConfiguration? CameraMoveAroundCircleConfiguration
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
 
-    public float InitialFogEndDistance { get; set; } = 300f;
-    public Color InitialFogColor { get; set; } = Color.white;
-    public bool HasSunRaysTopRightScreenEffect { get; set; }
+    public float InitialFogEndDistance { get; set => LeafModifications<MapLeaf>.Set(ref field, value); } = 300f;
+    public Color InitialFogColor { get; set => LeafModifications<MapLeaf>.Set(ref field, value); } = Color.white;
+    public bool HasSunRaysTopRightScreenEffect { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
-    public Material? SkyboxMaterial { get; set; }
-    public Color InitialAmbientLightColor { get; set; } = Color.gray;
-    public float WindIntensity { get; set; } = 0.2f;
-    public bool ForceAllFadersToFadeInsteadOfCulling { get; set; }
-    public Color AllFadersFadingTint { get; set; } = Color.white;
+    public Material? SkyboxMaterial { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public Color InitialAmbientLightColor
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = Color.gray;
+    public float WindIntensity { get; set => LeafModifications<MapLeaf>.Set(ref field, value); } = 0.2f;
+    public bool ForceAllFadersToFadeInsteadOfCulling { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public Color AllFadersFadingTint { get; set => LeafModifications<MapLeaf>.Set(ref field, value); } = Color.white;
 
     // TODO: Add BattleMapLeaf
-    public MainManager.BattleMaps DefaultBattleMap { get; set; }
+    public MainManager.BattleMaps DefaultBattleMap { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
     // TODO: Consider adding BattleTransitionLeaf
-    public MapControl.BattleLeafType BattleTransition { get; set; }
+    public MapControl.BattleLeafType BattleTransition { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
     public float ExpMultiplier
     {
@@ -58,27 +75,49 @@ public sealed class MapLeaf : Leaf
         set
         {
             Guard.IsGreaterThanOrEqualTo(value, 0.0f, nameof(ExpMultiplier));
-            field = value;
+            LeafModifications<MapLeaf>.Set(ref field, value);
         }
     } = 1.0f;
 
-    public Color DefaultBattleTransitionLeavesColor { get; set; } = Color.green;
-    public bool DisableMusicChangeWhenEnteringBattle { get; set; }
+    public Color DefaultBattleTransitionLeavesColor
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = Color.green;
+    public bool DisableMusicChangeWhenEnteringBattle { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
-    private ReadOnlyListWithCreate<MapMusic> InternalMusicsAvailable { get; } = new();
+    private ReadOnlyListWithCreate<MapMusic> InternalMusicsAvailable { get; } =
+        new(LeafModifications<MapLeaf>.Notifier);
     public IReadOnlyList<MapMusic> MusicsAvailable => InternalMusicsAvailable;
-    public bool KeepsExistingMusicPlayingOnLoad { get; set; }
-    public List<MapMusicSelectionCondition> MusicSelectionConditions { get; } = new();
+    public bool KeepsExistingMusicPlayingOnLoad { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public LeafList<MapMusicSelectionCondition> MusicSelectionConditions { get; } =
+        new(LeafModifications<MapLeaf>.Notifier);
 
-    public List<MapInside> Insides { get; } = new();
-    public bool ForceRestoreCameraWhenExitingAnyInsideTransitionZone { get; set; }
-    public bool DisablesInsideWhenCurrentInsideIsDifferent { get; set; }
-    public bool SetCameraTargetToCurrentInsideWhileInside { get; set; }
-    public float FadingSpeedWhenEnteringOrExitingAnInside { get; set; } = 0.2f;
+    public LeafList<MapInside> Insides { get; } = new(LeafModifications<MapLeaf>.Notifier);
+    public bool ForceRestoreCameraWhenExitingAnyInsideTransitionZone
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
+    public bool DisablesInsideWhenCurrentInsideIsDifferent
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
+    public bool SetCameraTargetToCurrentInsideWhileInside
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
+    public float FadingSpeedWhenEnteringOrExitingAnInside
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = 0.2f;
 
-    public Branch<DialogueLeaf> SpyDialogue { get; set; } = null!;
+    public Branch<DialogueLeaf> SpyDialogue { get; set => LeafModifications<MapLeaf>.Set(ref field, value); } = null!;
 
-    public List<Branch<AnimIdLeaf>> FollowerAnimIdsAllowed { get; } = new();
+    public LeafList<Branch<AnimIdLeaf>> FollowerAnimIdsAllowed { get; } = new(LeafModifications<MapLeaf>.Notifier);
 
     public float MaximumYFollowerDistanceBeforeTeleport
     {
@@ -86,29 +125,55 @@ public sealed class MapLeaf : Leaf
         set
         {
             Guard.IsGreaterThanOrEqualTo(value, 0.0f, nameof(ExpMultiplier));
-            field = value;
+            LeafModifications<MapLeaf>.Set(ref field, value);
         }
     } = 20.0f;
 
     // TODO: Consider patching the game to address the mess of the closemove field so it can be exposed
 
-    public float AllEntitiesYPositionLowerBoundLimitBeforeRespawn { get; set; } = -50f;
-    public bool IsFrozenMap { get; set; }
+    public float AllEntitiesYPositionLowerBoundLimitBeforeRespawn
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = -50f;
+    public bool IsFrozenMap { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
-    public bool MapEntitiesHaveRestrictedActiveRange { get; set; }
-    public bool MapEntitiesAndEmoticonsAreActiveWhenOutOfRange { get; set; }
+    public bool MapEntitiesHaveRestrictedActiveRange { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public bool MapEntitiesAndEmoticonsAreActiveWhenOutOfRange
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
 
-    public string? MainMapTransformOverridePrefabPath { get; set; }
-    public List<Branch<DiscoveryLeaf>> DetectableDiscoveriesByDetectorMedal { get; } = new();
-    public Branch<MapLeaf>? MapWhoProvidesEntitiesAndDialogues { get; set; }
-    public bool DisallowAntCompassUsage { get; set; }
-    public List<MapAutoEvent> AutomaticallyTriggeredEventsAfterLoad { get; } = new();
-    public List<string> EventsGameObjectPrefabPaths { get; } = new();
+    public string? MainMapTransformOverridePrefabPath { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public LeafList<Branch<DiscoveryLeaf>> DetectableDiscoveriesByDetectorMedal { get; } =
+        new(LeafModifications<MapLeaf>.Notifier);
+    public Branch<MapLeaf>? MapWhoProvidesEntitiesAndDialogues
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
+    public bool DisallowAntCompassUsage { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public LeafList<MapAutoEvent> AutomaticallyTriggeredEventsAfterLoad { get; } =
+        new(LeafModifications<MapLeaf>.Notifier);
+    public LeafList<string> EventsGameObjectPrefabPaths { get; } = new(LeafModifications<MapLeaf>.Notifier);
 
-    public IAssetLoader<GameObject> PrefabLoader { get; set; } = null!;
+    public IAssetLoader<GameObject> PrefabLoader
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = null!;
 
-    internal ILeavesRegistry<MapEntityLeaf> EntitiesRegistry { get; set; } = null!;
-    internal ILeavesRegistry<MapDialogueLeaf> DialoguesRegistry { get; set; } = null!;
+    internal ILeavesRegistry<MapEntityLeaf> EntitiesRegistry
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = null!;
+    internal ILeavesRegistry<MapDialogueLeaf> DialoguesRegistry
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    } = null!;
 
     public MapMusic AddMusicToMap(Branch<MusicLeaf>? music) =>
         InternalMusicsAvailable.CreateNew(id => new MapMusic(id)
@@ -120,13 +185,13 @@ public sealed class MapLeaf : Leaf
 
 public sealed class MapCameraMoveAroundCircleConfiguration
 {
-    public Vector3 InitialCircleCenter { get; set; }
-    public bool CameraFollowsTargetInYAxis { get; set; }
+    public Vector3 InitialCircleCenter { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
+    public bool CameraFollowsTargetInYAxis { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
     public float? CameraMaxRadiusFromCenterPointAllowed
     {
         get => field is null or <= 0 ? null : field;
-        set => field = value is null or <= 0 ? null : value;
+        set => LeafModifications<MapLeaf>.Set(ref field, value is null or <= 0 ? null : value);
     }
 }
 
@@ -134,13 +199,13 @@ public sealed class MapMusic
 {
     public int MusicIdInMap { get; }
     public required Branch<MapLeaf> Map { get; init; }
-    public required Branch<MusicLeaf>? Music { get; set; }
+    public required Branch<MusicLeaf>? Music { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
     internal MapMusic(int musicIdInMap) => MusicIdInMap = musicIdInMap;
 }
 
 public sealed class MapMusicSelectionCondition
 {
-    public required Branch<FlagLeaf>? RequiredFlag { get; set; }
+    public required Branch<FlagLeaf>? RequiredFlag { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
     public required MapMusic MapMusic
     {
@@ -149,21 +214,33 @@ public sealed class MapMusicSelectionCondition
         {
             if (field is not null)
                 Guard.IsEqualTo(value.Map, field.Map);
-            field = value;
+            LeafModifications<MapLeaf>.Set(ref field, value);
         }
     }
 }
 
 public sealed class MapInside
 {
-    public required string GameObjectPathInPrefab { get; set; }
+    public required string GameObjectPathInPrefab { get; set => LeafModifications<MapLeaf>.Set(ref field, value); }
 
     // TODO: Consider adding InsideTransitionLeaf
-    public MapControl.InsideType TransitionWhenEnteringOrExiting { get; set; }
+    public MapControl.InsideType TransitionWhenEnteringOrExiting
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
 }
 
 public sealed class MapAutoEvent
 {
-    public required Branch<FlagLeaf> AlreadyTriggeredFlag { get; set; }
-    public required Branch<EventLeaf> EventToTriggerWhenFlagIsFalse { get; set; }
+    public required Branch<FlagLeaf> AlreadyTriggeredFlag
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
+    public required Branch<EventLeaf> EventToTriggerWhenFlagIsFalse
+    {
+        get;
+        set => LeafModifications<MapLeaf>.Set(ref field, value);
+    }
 }
\ No newline at end of file
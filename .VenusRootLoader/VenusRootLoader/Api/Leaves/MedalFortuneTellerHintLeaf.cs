@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,8 +10,13 @@ public sealed class MedalFortuneTellerHintLeaf : Leaf
     {
     }
 
-    public Branch<FlagLeaf> MedalObtainedFlag { get; set; } = null!;
-    public LocalizedData<string> LocalizedHintText { get; } = new();
+    public Branch<FlagLeaf> MedalObtainedFlag
+    {
+        get;
+        set => LeafModifications<MedalFortuneTellerHintLeaf>.Set(ref field, value);
+    } = null!;
+    public LocalizedData<string> LocalizedHintText { get; } =
+        new(LeafModifications<MedalFortuneTellerHintLeaf>.Notifier);
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(Branch<FlagLeaf> medalObtainedFlag)
@@ -1,5 +1,6 @@
 using UnityEngine;
 using VenusRootLoader.Api.Unity;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,31 +10,35 @@ public sealed class MedalLeaf : Leaf
 {
     public sealed class MedalEffect
     {
-        public MainManager.BadgeEffects Effect { get; set; }
-        public int Value { get; set; }
+        public MainManager.BadgeEffects Effect { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); }
+        public int Value { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); }
     }
 
     public sealed class MedalLanguageData
     {
-        public string Name { get; set; } = "<NO NAME>";
-        public string Description { get; set; } = "<NO DESCRIPTION>";
-        public string Prepender { get; set; } = "<NO PREPENDER>";
+        public string Name { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); } = "<NO NAME>";
+        public string Description
+        {
+            get;
+            set => LeafModifications<MedalLeaf>.Set(ref field, value);
+        } = "<NO DESCRIPTION>";
+        public string Prepender { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); } = "<NO PREPENDER>";
     }
 
     internal MedalLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    internal int Items1SpriteIndex { get; set; } = -1;
+    internal int Items1SpriteIndex { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); } = -1;
 
-    public int MpCost { get; set; }
-    public bool IsPartyEquip { get; set; }
-    public List<MedalEffect> Effects { get; } = new();
-    public int BuyingPriceRegularBerries { get; set; }
-    public int BuyingPriceCrystalBerries { get; set; }
-    public LocalizedData<MedalLanguageData> LocalizedData { get; } = new();
+    public int MpCost { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); }
+    public bool IsPartyEquip { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); }
+    public LeafList<MedalEffect> Effects { get; } = new(LeafModifications<MedalLeaf>.Notifier);
+    public int BuyingPriceRegularBerries { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); }
+    public int BuyingPriceCrystalBerries { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); }
+    public LocalizedData<MedalLanguageData> LocalizedData { get; } = new(LeafModifications<MedalLeaf>.Notifier);
 
-    public IAssetLoader<Sprite> Sprite { get; set; } = null!;
+    public IAssetLoader<Sprite> Sprite { get; set => LeafModifications<MedalLeaf>.Set(ref field, value); } = null!;
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<Sprite> sprite)
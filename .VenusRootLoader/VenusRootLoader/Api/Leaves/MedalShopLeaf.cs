@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,8 +10,12 @@ public sealed class MedalShopLeaf : Leaf
     {
     }
 
-    public Branch<FlagLeaf> BoughtAllStockFlag { get; set; } = null!;
-    public List<Branch<MedalLeaf>> StartingMedalsStock { get; } = new();
+    public Branch<FlagLeaf> BoughtAllStockFlag
+    {
+        get;
+        set => LeafModifications<MedalShopLeaf>.Set(ref field, value);
+    } = null!;
+    public LeafList<Branch<MedalLeaf>> StartingMedalsStock { get; } = new(LeafModifications<MedalShopLeaf>.Notifier);
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(
@@ -1,5 +1,6 @@
 using UnityEngine;
 using VenusRootLoader.Api.Unity;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -11,11 +12,11 @@ public sealed class MusicLeaf : Leaf
     {
     }
 
-    public IAssetLoader<AudioClip> Music { get; set; } = null!;
-    public float? LoopEndTimestampInSeconds { get; set; }
-    public float? LoopStartTimestampInSeconds { get; set; }
-    public bool CanBePurchasedFromSamira { get; set; } = true;
-    public LocalizedData<string> SamiraDisplayTitle { get; } = new();
+    public IAssetLoader<AudioClip> Music { get; set => LeafModifications<MusicLeaf>.Set(ref field, value); } = null!;
+    public float? LoopEndTimestampInSeconds { get; set => LeafModifications<MusicLeaf>.Set(ref field, value); }
+    public float? LoopStartTimestampInSeconds { get; set => LeafModifications<MusicLeaf>.Set(ref field, value); }
+    public bool CanBePurchasedFromSamira { get; set => LeafModifications<MusicLeaf>.Set(ref field, value); } = true;
+    public LocalizedData<string> SamiraDisplayTitle { get; } = new(LeafModifications<MusicLeaf>.Notifier);
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<AudioClip> music)
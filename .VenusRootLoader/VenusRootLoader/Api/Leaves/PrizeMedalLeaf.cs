@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,12 +10,12 @@ public sealed class PrizeMedalLeaf : Leaf
     {
     }
 
-    public Branch<MedalLeaf> Medal { get; set; } = null!;
+    public Branch<MedalLeaf> Medal { get; set => LeafModifications<PrizeMedalLeaf>.Set(ref field, value); } = null!;
 
-    public Branch<FlagvarLeaf> Flagvar { get; set; } = null!;
+    public Branch<FlagvarLeaf> Flagvar { get; set => LeafModifications<PrizeMedalLeaf>.Set(ref field, value); } = null!;
 
     // TODO: Figure out special cases such as "Explorer Duo"
-    public int DisplayedEnemyGameId { get; set; }
+    public int DisplayedEnemyGameId { get; set => LeafModifications<PrizeMedalLeaf>.Set(ref field, value); }
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(Branch<MedalLeaf> medal, Branch<FlagvarLeaf> flagvar)
@@ -10,23 +10,32 @@ public sealed class QuestLeaf : Leaf, IHasEnemyPortraitSprite
 {
     public sealed class QuestLanguageData
     {
-        public string Name { get; set; } = "";
-        public List<QuestDescriptionPage> PaginatedDescription { get; } = new();
-        public string Sender { get; set; } = "";
+        public string Name { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); } = "";
+        public LeafList<QuestDescriptionPage> PaginatedDescription { get; } =
+            new(LeafModifications<QuestLeaf>.Notifier);
+        public string Sender { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); } = "";
     }
 
     public sealed class QuestDescriptionPage
     {
-        public string Text { get; set; } = "<NO CONTENT>";
-        public Branch<FlagLeaf>? RequiredFlag { get; set; }
+        public string Text { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); } = "<NO CONTENT>";
+        public Branch<FlagLeaf>? RequiredFlag { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); }
     }
 
     internal QuestLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex { get; set; }
-    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite { get; set; } = null!;
+    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex
+    {
+        get;
+        set => LeafModifications<QuestLeaf>.Set(ref field, value);
+    }
+    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite
+    {
+        get;
+        set => LeafModifications<QuestLeaf>.Set(ref field, value);
+    } = null!;
 
     public IAssetLoader<Sprite> PortraitSprite
     {
@@ -34,12 +43,12 @@ public sealed class QuestLeaf : Leaf, IHasEnemyPortraitSprite
         set => ((IHasEnemyPortraitSprite)this).PortraitSprite = value;
     }
 
-    public LocalizedData<QuestLanguageData> LocalizedData { get; } = new();
-    public Branch<FlagLeaf>? TakenFlag { get; set; }
-    public int Difficulty { get; set; }
-    public List<Branch<FlagLeaf>> RequiredFlags { get; } = new();
-    public List<Branch<AreaLeaf>> RequiredSeenAreas { get; } = new();
-    public bool CanOnlyBeTakenAtUndergroundBar { get; set; }
+    public LocalizedData<QuestLanguageData> LocalizedData { get; } = new(LeafModifications<QuestLeaf>.Notifier);
+    public Branch<FlagLeaf>? TakenFlag { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); }
+    public int Difficulty { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); }
+    public LeafList<Branch<FlagLeaf>> RequiredFlags { get; } = new(LeafModifications<QuestLeaf>.Notifier);
+    public LeafList<Branch<AreaLeaf>> RequiredSeenAreas { get; } = new(LeafModifications<QuestLeaf>.Notifier);
+    public bool CanOnlyBeTakenAtUndergroundBar { get; set => LeafModifications<QuestLeaf>.Set(ref field, value); }
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<Sprite> portraitSprite)
@@ -1,3 +1,5 @@
+using VenusRootLoader.LeavesInternals;
+
 namespace VenusRootLoader.Api.Leaves;
 
 // We need to make this API easier instead of having 3 parameter values
@@ -15,9 +17,9 @@ internal sealed class RankBonusLeaf : Leaf
     {
     }
 
-    internal int RankNeeded { get; set; }
-    internal RankBonusType BonusType { get; set; }
-    internal int FirstParameter { get; set; }
-    internal int SecondParameter { get; set; }
-    internal int ThirdParameter { get; set; }
+    internal int RankNeeded { get; set => LeafModifications<RankBonusLeaf>.Set(ref field, value); }
+    internal RankBonusType BonusType { get; set => LeafModifications<RankBonusLeaf>.Set(ref field, value); }
+    internal int FirstParameter { get; set => LeafModifications<RankBonusLeaf>.Set(ref field, value); }
+    internal int SecondParameter { get; set => LeafModifications<RankBonusLeaf>.Set(ref field, value); }
+    internal int ThirdParameter { get; set => LeafModifications<RankBonusLeaf>.Set(ref field, value); }
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,9 +10,9 @@ public sealed class RecipeLeaf : Leaf
     {
     }
 
-    public Branch<ItemLeaf>? FirstItem { get; set; }
-    public Branch<ItemLeaf>? SecondItem { get; set; }
-    public Branch<ItemLeaf> ResultItem { get; set; } = null!;
+    public Branch<ItemLeaf>? FirstItem { get; set => LeafModifications<RecipeLeaf>.Set(ref field, value); }
+    public Branch<ItemLeaf>? SecondItem { get; set => LeafModifications<RecipeLeaf>.Set(ref field, value); }
+    public Branch<ItemLeaf> ResultItem { get; set => LeafModifications<RecipeLeaf>.Set(ref field, value); } = null!;
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(
@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,9 +10,21 @@ public sealed class RecipeLibraryEntryLeaf : Leaf
     {
     }
 
-    internal bool OriginalEndsWithAtSymbol { get; set; }
-    internal bool OriginalItemsHaveInvertedOrder { get; set; }
-    public Branch<RecipeLeaf> Recipe { get; set; } = null!;
+    internal bool OriginalEndsWithAtSymbol
+    {
+        get;
+        set => LeafModifications<RecipeLibraryEntryLeaf>.Set(ref field, value);
+    }
+    internal bool OriginalItemsHaveInvertedOrder
+    {
+        get;
+        set => LeafModifications<RecipeLibraryEntryLeaf>.Set(ref field, value);
+    }
+    public Branch<RecipeLeaf> Recipe
+    {
+        get;
+        set => LeafModifications<RecipeLibraryEntryLeaf>.Set(ref field, value);
+    } = null!;
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(Branch<RecipeLeaf> recipe)
@@ -10,16 +10,24 @@ public sealed class RecordLeaf : Leaf, IHasEnemyPortraitSprite
 {
     public sealed class RecordLanguageData
     {
-        public string Name { get; set; } = "";
-        public string Description { get; set; } = "";
+        public string Name { get; set => LeafModifications<RecordLeaf>.Set(ref field, value); } = "";
+        public string Description { get; set => LeafModifications<RecordLeaf>.Set(ref field, value); } = "";
     }
 
     internal RecordLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex { get; set; }
-    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite { get; set; } = null!;
+    int? IHasEnemyPortraitSprite.EnemyPortraitsSpriteIndex
+    {
+        get;
+        set => LeafModifications<RecordLeaf>.Set(ref field, value);
+    }
+    IAssetLoader<Sprite> IHasEnemyPortraitSprite.PortraitSprite
+    {
+        get;
+        set => LeafModifications<RecordLeaf>.Set(ref field, value);
+    } = null!;
 
     public IAssetLoader<Sprite> PortraitSprite
     {
@@ -27,7 +35,7 @@ public sealed class RecordLeaf : Leaf, IHasEnemyPortraitSprite
         set => ((IHasEnemyPortraitSprite)this).PortraitSprite = value;
     }
 
-    public LocalizedData<RecordLanguageData> LocalizedData { get; } = new();
+    public LocalizedData<RecordLanguageData> LocalizedData { get; } = new(LeafModifications<RecordLeaf>.Notifier);
 
     [LeafInitializeFromNew]
     internal void InitializeFromNew(IAssetLoader<Sprite> portraitSprite)
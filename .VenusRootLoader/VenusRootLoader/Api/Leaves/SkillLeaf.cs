@@ -1,3 +1,5 @@
+using VenusRootLoader.LeavesInternals;
+
 namespace VenusRootLoader.Api.Leaves;
 
 // TODO: Need to patch RefreshSkills which requires additional conditions support and linking with RankBonus leaves
@@ -48,20 +50,24 @@ internal sealed class SkillLeaf : Leaf
 
     internal sealed class SkillLanguageData
     {
-        internal string Name { get; set; } = "";
-        internal string Description { get; set; } = "";
+        internal string Name { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); } = "";
+        internal string Description { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); } = "";
     }
 
     internal SkillLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    internal BoolCasing OriginalBoolCasing { get; set; }
+    internal BoolCasing OriginalBoolCasing { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); }
 
-    internal LocalizedData<SkillLanguageData> LocalizedData { get; } = new();
-    internal SkillCostResource CostResource { get; set; }
-    internal int Cost { get; set; }
-    internal SkillTarget Target { get; set; }
-    internal SkillUsability UsableBy { get; set; }
-    internal Branch<ActionCommandHelpTextLeaf>? ActionCommandHelpText { get; set; }
+    internal LocalizedData<SkillLanguageData> LocalizedData { get; } = new(LeafModifications<SkillLeaf>.Notifier);
+    internal SkillCostResource CostResource { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); }
+    internal int Cost { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); }
+    internal SkillTarget Target { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); }
+    internal SkillUsability UsableBy { get; set => LeafModifications<SkillLeaf>.Set(ref field, value); }
+    internal Branch<ActionCommandHelpTextLeaf>? ActionCommandHelpText
+    {
+        get;
+        set => LeafModifications<SkillLeaf>.Set(ref field, value);
+    }
 }
\ No newline at end of file
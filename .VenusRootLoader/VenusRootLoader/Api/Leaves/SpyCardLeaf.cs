@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -9,32 +10,36 @@ public sealed class SpyCardLeaf : Leaf
 {
     public sealed class SpyCardEffect
     {
-        public CardGame.Effects Effect { get; set; }
-        public int FirstValue { get; set; }
-        public int SecondValue { get; set; }
+        public CardGame.Effects Effect { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); }
+        public int FirstValue { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); }
+        public int SecondValue { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); }
     }
 
     public sealed class SpyCardLanguageData
     {
-        public string Description { get; set; } = "";
-        public float HorizontalNameSize { get; set; } = 1;
+        public string Description { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); } = "";
+        public float HorizontalNameSize { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); } = 1;
     }
 
     internal SpyCardLeaf(int gameId, string creatorId, string namedId) : base(gameId, creatorId, namedId)
     {
     }
 
-    public LocalizedData<SpyCardLanguageData> LocalizedData { get; } = new();
+    public LocalizedData<SpyCardLanguageData> LocalizedData { get; } = new(LeafModifications<SpyCardLeaf>.Notifier);
 
-    public int TpCost { get; set; }
-    public int Attack { get; set; }
-    public Branch<EnemyLeaf> Enemy { get; set; } = null!;
-    internal float UnusedHorizontalNameSize { get; set; } = 1.0f;
-    public CardGame.Type Type { get; set; }
-    public List<SpyCardEffect> Effects { get; } = new();
+    public int TpCost { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); }
+    public int Attack { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); }
+    public Branch<EnemyLeaf> Enemy { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); } = null!;
+    internal float UnusedHorizontalNameSize
+    {
+        get;
+        set => LeafModifications<SpyCardLeaf>.Set(ref field, value);
+    } = 1.0f;
+    public CardGame.Type Type { get; set => LeafModifications<SpyCardLeaf>.Set(ref field, value); }
+    public LeafList<SpyCardEffect> Effects { get; } = new(LeafModifications<SpyCardLeaf>.Notifier);
 
     // TODO: Consider making this a leaf
-    public List<CardGame.Tribe> Tribes { get; } = new();
+    public LeafList<CardGame.Tribe> Tribes { get; } = new(LeafModifications<SpyCardLeaf>.Notifier);
 
     internal void InitializeFromNew(
         Branch<EnemyLeaf> enemy,
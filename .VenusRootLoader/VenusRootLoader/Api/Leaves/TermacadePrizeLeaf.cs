@@ -1,3 +1,4 @@
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.SourceGenerators;
 
 namespace VenusRootLoader.Api.Leaves;
@@ -16,10 +17,14 @@ public sealed class TermacadePrizeLeaf : Leaf
     {
     }
 
-    public TermacadePrizeType PrizeType { get; set; }
+    public TermacadePrizeType PrizeType { get; set => LeafModifications<TermacadePrizeLeaf>.Set(ref field, value); }
 
     // TODO: Improve the typing on this
-    public int ItemOrMedalGameId { get; set; }
-    public int GameTokenCost { get; set; }
-    public Branch<FlagLeaf>? AlreadyBoughtFlag { get; set; }
+    public int ItemOrMedalGameId { get; set => LeafModifications<TermacadePrizeLeaf>.Set(ref field, value); }
+    public int GameTokenCost { get; set => LeafModifications<TermacadePrizeLeaf>.Set(ref field, value); }
+    public Branch<FlagLeaf>? AlreadyBoughtFlag
+    {
+        get;
+        set => LeafModifications<TermacadePrizeLeaf>.Set(ref field, value);
+    }
 }
\ No newline at end of file
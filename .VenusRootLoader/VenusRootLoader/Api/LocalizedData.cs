@@ -1,12 +1,30 @@
 using System.Collections;
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 
 namespace VenusRootLoader.Api;
 
 public sealed class LocalizedData<T> : IReadOnlyDictionary<Branch<LanguageLeaf>, T>
 {
+    private readonly Action _notifyModification;
+
     private Dictionary<Branch<LanguageLeaf>, T> UnderlyingDictionary { get; } = new();
+
+    /// <summary>
+    /// Creates an empty instance. Its modifications are tracked as modifications of every type of leaf since it isn't
+    /// known which leaf will own it.
+    /// </summary>
+    public LocalizedData() : this(LeafModifications.NotifyAll)
+    {
+    }
+
+    /// <summary>
+    /// Creates an empty instance owned by a leaf.
+    /// </summary>
+    /// <param name="notifyModification">Signals a modification of the leaves of the owning leaf's type.</param>
+    internal LocalizedData(Action notifyModification) => _notifyModification = notifyModification;
+
     public IEnumerator<KeyValuePair<Branch<LanguageLeaf>, T>> GetEnumerator() => UnderlyingDictionary.GetEnumerator();
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
     public int Count => UnderlyingDictionary.Count;
@@ -29,7 +47,11 @@ public sealed class LocalizedData<T> : IReadOnlyDictionary<Branch<LanguageLeaf>,
             Branch<LanguageLeaf> firstLanguage = RegistryResolver.Resolve<LanguageLeaf>().GetByGameId(minGameId);
             return this[firstLanguage];
         }
-        set => UnderlyingDictionary[language] = value;
+        set
+        {
+            UnderlyingDictionary[language] = value;
+            _notifyModification();
+        }
     }
 
     public IEnumerable<Branch<LanguageLeaf>> Keys => UnderlyingDictionary.Keys;
@@ -4,8 +4,12 @@ namespace VenusRootLoader.Api;
 
 internal sealed class ReadOnlyListWithCreate<T> : IReadOnlyList<T>
 {
+    private readonly Action _notifyModification;
+
     private List<T> UnderlyingList { get; } = new();
 
+    internal ReadOnlyListWithCreate(Action notifyModification) => _notifyModification = notifyModification;
+
     public int Count => UnderlyingList.Count;
     public T this[int index] => UnderlyingList[index];
     public IEnumerator<T> GetEnumerator() => UnderlyingList.GetEnumerator();
@@ -15,6 +19,7 @@ internal sealed class ReadOnlyListWithCreate<T> : IReadOnlyList<T>
     {
         T item = createNew(Count);
         UnderlyingList.Add(item);
+        _notifyModification();
         return item;
     }
 }
\ No newline at end of file
@@ -49,4 +49,17 @@ public static class AssetLoader
     {
         return new AudioClipLoaderFromFile(filePath, true, audioFileFormat);
     }
+
+    public static Task<IAssetLoader<AudioClip>> AudioClipFromFileAsync(string filePath)
+    {
+        return CustomAudioClipProvider.GetAudioClipLoaderFromFileAsync(filePath, AudioFileFormat.AutoDetect, false);
+    }
+
+    public static Task<IAssetLoader<AudioClip>> AudioClipFromFileAsync(
+        string filePath,
+        AudioFileFormat audioFileFormat,
+        bool useDecodedAudioCache)
+    {
+        return CustomAudioClipProvider.GetAudioClipLoaderFromFileAsync(filePath, audioFileFormat, useDecodedAudioCache);
+    }
 }
\ No newline at end of file
@@ -8,8 +8,7 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class ActionCommandHelpTextsCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _actionCommandHelpTextsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedActionCommandHelpTextsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _actionCommandHelpTextsLanguageData;
 
     private readonly ILogger<ActionCommandHelpTextsCollector> _logger;
     private readonly ILeavesRegistry<ActionCommandHelpTextLeaf> _actionCommandHelpTextsRegistry;
@@ -18,6 +17,7 @@ internal sealed class ActionCommandHelpTextsCollector : IBaseGameCollector
         _actionCommandHelpTextLocalizedTextAssetParser;
 
     public ActionCommandHelpTextsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<ActionCommandHelpTextsCollector> logger,
         ILocalizedTextAssetParser<ActionCommandHelpTextLeaf> actionCommandHelpTextLocalizedTextAssetParser,
         ILeavesRegistry<ActionCommandHelpTextLeaf> actionCommandHelpTextsRegistry)
@@ -25,15 +25,28 @@ internal sealed class ActionCommandHelpTextsCollector : IBaseGameCollector
         _logger = logger;
         _actionCommandHelpTextLocalizedTextAssetParser = actionCommandHelpTextLocalizedTextAssetParser;
         _actionCommandHelpTextsRegistry = actionCommandHelpTextsRegistry;
+
+        _actionCommandHelpTextsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedActionCommandHelpTextsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        int actionCommandHelpTextsAmount = _actionCommandHelpTextsLanguageData.Values.First().Length;
+        for (int i = 0; i < actionCommandHelpTextsAmount; i++)
+            _actionCommandHelpTextsRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _actionCommandHelpTextsRegistry, actionCommandHelpTextsAmount);
+    }
+
+    public void ParseBaseGameData()
     {
         int actionCommandHelpTextsAmount = _actionCommandHelpTextsLanguageData.Values.First().Length;
         for (int i = 0; i < actionCommandHelpTextsAmount; i++)
         {
-            ActionCommandHelpTextLeaf actionCommandHelpTextLeaf =
-                _actionCommandHelpTextsRegistry.RegisterExisting(i, i.ToString());
+            ActionCommandHelpTextLeaf actionCommandHelpTextLeaf = _actionCommandHelpTextsRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _actionCommandHelpTextLocalizedTextAssetParser.FromTextAssetSerializedString(
@@ -43,7 +56,5 @@ internal sealed class ActionCommandHelpTextsCollector : IBaseGameCollector
                     actionCommandHelpTextLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _actionCommandHelpTextsRegistry, actionCommandHelpTextsAmount);
     }
 }
\ No newline at end of file
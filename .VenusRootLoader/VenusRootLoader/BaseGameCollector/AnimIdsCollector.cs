@@ -8,7 +8,7 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class AnimIdsCollector : IBaseGameCollector
 {
-    private readonly string[] _animIdsData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataAnimIdsPath);
+    private readonly TextAssetLines _animIdsData;
 
     private readonly string[] _animIdNamedIds = Enum.GetNames(typeof(MainManager.AnimIDs)).ToArray();
 
@@ -17,6 +17,7 @@ internal sealed class AnimIdsCollector : IBaseGameCollector
     private readonly ITextAssetParser<AnimIdLeaf> _animIdTextAssetParser;
 
     public AnimIdsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<AnimIdsCollector> logger,
         ILeavesRegistry<AnimIdLeaf> animIdsRegistry,
         ITextAssetParser<AnimIdLeaf> animIdTextAssetParser)
@@ -24,19 +25,28 @@ internal sealed class AnimIdsCollector : IBaseGameCollector
         _logger = logger;
         _animIdsRegistry = animIdsRegistry;
         _animIdTextAssetParser = animIdTextAssetParser;
+
+        _animIdsData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataAnimIdsPath);
+    }
+
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(DialogueBleepCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        for (int i = 0; i < _animIdNamedIds.Length; i++)
+            _animIdsRegistry.RegisterExisting(i, _animIdNamedIds[i]);
+
+        RootCollector.LogCollectedAmount(_logger, _animIdsRegistry, _animIdNamedIds.Length);
     }
 
-    public void CollectBaseGameData()
+    public void ParseBaseGameData()
     {
         for (int i = 0; i < _animIdNamedIds.Length; i++)
         {
-            AnimIdLeaf animIdLeaf = _animIdsRegistry.RegisterExisting(i, _animIdNamedIds[i]);
             _animIdTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataAnimIdsPath,
                 _animIdsData[i],
-                animIdLeaf);
+                _animIdsRegistry.GetByGameId(i));
         }
-
-        RootCollector.LogCollectedAmount(_logger, _animIdsRegistry, _animIdNamedIds.Length);
     }
 }
\ No newline at end of file
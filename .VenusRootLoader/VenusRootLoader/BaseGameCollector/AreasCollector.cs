@@ -13,11 +13,8 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class AreasCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _areaNamesData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedAreaNamesPathSuffix);
-
-    private readonly Dictionary<int, string[]> _areaDescriptionsData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedAreaDescriptionsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _areaNamesData;
+    private readonly Dictionary<int, TextAssetLines> _areaDescriptionsData;
 
     private readonly string[] _areasNamedIds = Enum.GetNames(typeof(MainManager.Areas)).ToArray();
 
@@ -26,6 +23,7 @@ internal sealed class AreasCollector : IBaseGameCollector
     private readonly ILocalizedTextAssetParser<AreaLeaf> _areaLocalizedTextAssetParser;
 
     public AreasCollector(
+        IBaseGameResources baseGameResources,
         ILogger<AreasCollector> logger,
         ILocalizedTextAssetParser<AreaLeaf> areaLocalizedTextAssetParser,
         ILeavesRegistry<AreaLeaf> areasRegistry)
@@ -33,14 +31,31 @@ internal sealed class AreasCollector : IBaseGameCollector
         _logger = logger;
         _areaLocalizedTextAssetParser = areaLocalizedTextAssetParser;
         _areasRegistry = areasRegistry;
+
+        _areaNamesData = baseGameResources.ReadLocalizedTextAssetLines(ResourcesPaths.DataLocalizedAreaNamesPathSuffix);
+        _areaDescriptionsData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedAreaDescriptionsPathSuffix);
+    }
+
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        int areasAmount = _areaNamesData.Values.First().Length;
+        for (int i = 0; i < areasAmount; i++)
+            _areasRegistry.RegisterExisting(i, _areasNamedIds[i]);
+
+        CollectMapPositions();
+
+        RootCollector.LogCollectedAmount(_logger, _areasRegistry, areasAmount);
     }
 
-    public void CollectBaseGameData()
+    public void ParseBaseGameData()
     {
         int areasAmount = _areaNamesData.Values.First().Length;
         for (int i = 0; i < areasAmount; i++)
         {
-            AreaLeaf areaLeaf = _areasRegistry.RegisterExisting(i, _areasNamedIds[i]);
+            AreaLeaf areaLeaf = _areasRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _areaLocalizedTextAssetParser.FromTextAssetSerializedString(
@@ -55,10 +70,6 @@ internal sealed class AreasCollector : IBaseGameCollector
                     areaLeaf);
             }
         }
-
-        CollectMapPositions();
-
-        RootCollector.LogCollectedAmount(_logger, _areasRegistry, areasAmount);
     }
 
     // In order to collect the map positions on the PauseMenu, we need to seek them in PauseMenu.MapSetup.
@@ -0,0 +1,149 @@
+using UnityEngine;
+using VenusRootLoader.Utility;
+using Object = UnityEngine.Object;
+
+namespace VenusRootLoader.BaseGameCollector;
+
+/// <summary>
+/// The service the collectors read the game's data with. The data is given from the <see cref="BaseGameSnapshot"/>
+/// when the game didn't change since it was saved and is loaded from the game otherwise which means a warm boot
+/// doesn't load any asset from the game's bundle to collect the base game data. This must only be used from the
+/// collectors' constructors since it calls Unity's APIs when the snapshot doesn't have what is asked.
+/// </summary>
+internal interface IBaseGameResources
+{
+    /// <summary>
+    /// Reads the text of a TextAsset.
+    /// </summary>
+    /// <param name="resourcesPath">The full Resources path of the TextAsset.</param>
+    /// <returns>The text of the TextAsset.</returns>
+    string ReadTextAsset(string resourcesPath);
+
+    /// <summary>
+    /// Reads the lines of a TextAsset from the game's data directory without the line endings at its start and end.
+    /// </summary>
+    /// <param name="resourcesPathSuffix">The Resources path of the TextAsset relative to the data directory.</param>
+    /// <returns>The lines of the TextAsset.</returns>
+    TextAssetLines ReadTextAssetLines(string resourcesPathSuffix);
+
+    /// <summary>
+    /// Reads the text of a TextAsset from the game's data directory without the line endings at its start and end.
+    /// </summary>
+    /// <param name="resourcesPathSuffix">The Resources path of the TextAsset relative to the data directory.</param>
+    /// <returns>The text of the TextAsset.</returns>
+    string ReadWholeTextAsset(string resourcesPathSuffix);
+
+    /// <summary>
+    /// Reads the lines of a localized TextAsset in every language without the line endings at their start and end.
+    /// </summary>
+    /// <param name="resourcesPathSuffix">The Resources path of the TextAsset relative to a language's dialogues
+    /// directory.</param>
+    /// <returns>The lines of the TextAsset indexed by the language's game id.</returns>
+    Dictionary<int, TextAssetLines> ReadLocalizedTextAssetLines(string resourcesPathSuffix);
+
+    /// <summary>
+    /// Reads the names of every asset of a type in a Resources directory in the order they are loaded by Unity.
+    /// </summary>
+    /// <param name="resourcesPath">The Resources path of the directory.</param>
+    /// <typeparam name="T">The type of the assets.</typeparam>
+    /// <returns>The names of the assets.</returns>
+    string[] ReadAssetsNames<T>(string resourcesPath)
+        where T : Object;
+
+    /// <summary>
+    /// Gets the <see cref="MapsAssetsData"/> from the snapshot or collects it if the snapshot doesn't have it.
+    /// </summary>
+    /// <param name="collectMapsAssetsData">The function reading the data from the game's bundle.</param>
+    /// <returns>The data.</returns>
+    MapsAssetsData GetOrCollectMapsAssetsData(Func<MapsAssetsData> collectMapsAssetsData);
+
+    /// <summary>
+    /// Saves the snapshot if anything had to be read from the game. This is meant to be called once every collector
+    /// got constructed.
+    /// </summary>
+    void SaveSnapshotIfChanged();
+}
+
+/// <inheritdoc/>
+internal sealed class BaseGameResources : IBaseGameResources
+{
+    private readonly IBaseGameSnapshotCache _baseGameSnapshotCache;
+    private readonly BaseGameSnapshot _snapshot;
+
+    private bool _snapshotChanged;
+
+    public BaseGameResources(IBaseGameSnapshotCache baseGameSnapshotCache)
+    {
+        _baseGameSnapshotCache = baseGameSnapshotCache;
+        if (_baseGameSnapshotCache.TryLoad(out BaseGameSnapshot? snapshot))
+        {
+            _snapshot = snapshot;
+        }
+        else
+        {
+            _snapshot = new();
+            _snapshotChanged = true;
+        }
+    }
+
+    public string ReadTextAsset(string resourcesPath)
+    {
+        if (_snapshot.TextAssetsTexts.TryGetValue(resourcesPath, out string text))
+            return text;
+
+        text = Resources.Load<TextAsset>(resourcesPath).text;
+        _snapshot.TextAssetsTexts[resourcesPath] = text;
+        _snapshotChanged = true;
+        return text;
+    }
+
+    public TextAssetLines ReadTextAssetLines(string resourcesPathSuffix) =>
+        new(ReadTextAsset($"{ResourcesPaths.RootDataPathPrefix}{resourcesPathSuffix}"), trimLineEndings: true);
+
+    public string ReadWholeTextAsset(string resourcesPathSuffix) =>
+        ReadTextAsset($"{ResourcesPaths.RootDataPathPrefix}{resourcesPathSuffix}").Trim('\n');
+
+    public Dictionary<int, TextAssetLines> ReadLocalizedTextAssetLines(string resourcesPathSuffix)
+    {
+        Dictionary<int, TextAssetLines> localizedLines = new();
+        for (int i = 0; i < RootCollector.LanguageDisplayNames.Length; i++)
+        {
+            string text = ReadTextAsset($"{ResourcesPaths.DataSlashDialogues}{i}/{resourcesPathSuffix}");
+            localizedLines.Add(i, new(text, trimLineEndings: true));
+        }
+
+        return localizedLines;
+    }
+
+    public string[] ReadAssetsNames<T>(string resourcesPath)
+        where T : Object
+    {
+        string key = $"{typeof(T).Name}:{resourcesPath}";
+        if (_snapshot.AssetsNames.TryGetValue(key, out string[] names))
+            return names;
+
+        names = Resources.LoadAll<T>(resourcesPath).Select(a => a.name).ToArray();
+        _snapshot.AssetsNames[key] = names;
+        _snapshotChanged = true;
+        return names;
+    }
+
+    public MapsAssetsData GetOrCollectMapsAssetsData(Func<MapsAssetsData> collectMapsAssetsData)
+    {
+        if (_snapshot.MapsAssetsData is not null)
+            return _snapshot.MapsAssetsData;
+
+        _snapshot.MapsAssetsData = collectMapsAssetsData();
+        _snapshotChanged = true;
+        return _snapshot.MapsAssetsData;
+    }
+
+    public void SaveSnapshotIfChanged()
+    {
+        if (!_snapshotChanged)
+            return;
+
+        _baseGameSnapshotCache.Save(_snapshot);
+        _snapshotChanged = false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+namespace VenusRootLoader.BaseGameCollector;
+
+/// <summary>
+/// Everything the collectors read from the game's bundle. It is persisted by <see cref="IBaseGameSnapshotCache"/> so
+/// <see cref="IBaseGameResources"/> can give it to the collectors without loading anything from the bundle when the
+/// game didn't change since the last boot.
+/// </summary>
+internal sealed class BaseGameSnapshot
+{
+    /// <summary>
+    /// The data read from the bundle with AssetsTools, null if it wasn't collected yet.
+    /// </summary>
+    internal MapsAssetsData? MapsAssetsData { get; set; }
+
+    /// <summary>
+    /// The text of every TextAsset read by the collectors indexed by their Resources path.
+    /// </summary>
+    internal Dictionary<string, string> TextAssetsTexts { get; } = new();
+
+    /// <summary>
+    /// The names of the assets of every Resources directory listed by the collectors indexed by the type of the
+    /// assets followed by a colon and the path of the directory.
+    /// </summary>
+    internal Dictionary<string, string[]> AssetsNames { get; } = new();
+}
\ No newline at end of file
@@ -0,0 +1,454 @@
+using Microsoft.Extensions.Logging;
+using System.Diagnostics.CodeAnalysis;
+using System.IO.Abstractions;
+using System.Security.Cryptography;
+using System.Text;
+using UnityEngine;
+using VenusRootLoader.Api;
+
+namespace VenusRootLoader.BaseGameCollector;
+
+/// <summary>
+/// A persistent cache of the <see cref="BaseGameSnapshot"/>. The snapshot is stored next to the loader and is stamped
+/// with the size, last write time and SHA256 hash of the game's bundle and Assembly-CSharp. It is only reused if these
+/// files didn't change since it was saved which means the snapshot is always equivalent to what a fresh collection
+/// would produce.
+/// </summary>
+internal interface IBaseGameSnapshotCache
+{
+    /// <summary>
+    /// Attempts to load the <see cref="BaseGameSnapshot"/> if it exists and is still valid.
+    /// </summary>
+    /// <param name="snapshot">When this method returns, the loaded snapshot if it was valid; otherwise, null.</param>
+    /// <returns>True if the snapshot was valid and got loaded, false otherwise.</returns>
+    bool TryLoad([NotNullWhen(true)] out BaseGameSnapshot? snapshot);
+
+    /// <summary>
+    /// Saves the <see cref="BaseGameSnapshot"/> stamped with the current state of the game's files. Failing to save
+    /// is not fatal since the data will simply be read from the game again on the next boot.
+    /// </summary>
+    /// <param name="snapshot">The snapshot to save.</param>
+    void Save(BaseGameSnapshot snapshot);
+}
+
+/// <inheritdoc/>
+internal sealed class BaseGameSnapshotCache : IBaseGameSnapshotCache
+{
+    private readonly struct SourceFileStamp
+    {
+        internal readonly long Size;
+        internal readonly long LastWriteTimeUtcTicks;
+        internal readonly byte[] Hash;
+
+        internal SourceFileStamp(long size, long lastWriteTimeUtcTicks, byte[] hash)
+        {
+            Size = size;
+            LastWriteTimeUtcTicks = lastWriteTimeUtcTicks;
+            Hash = hash;
+        }
+    }
+
+    internal const string SnapshotFileName = "BaseGameSnapshot.bin";
+
+    // "VRLS" in little endian
+    private const int SnapshotMagic = 0x534C5256;
+
+    // This must be incremented whenever the layout of the snapshot or what gets extracted from the game changes
+    private const int SnapshotFormatVersion = 2;
+
+    private readonly string _snapshotPath;
+    private readonly string[] _sourceFilesPaths;
+
+    private readonly IFileSystem _fileSystem;
+    private readonly ILogger<BaseGameSnapshotCache> _logger;
+
+    public BaseGameSnapshotCache(
+        IFileSystem fileSystem,
+        ILogger<BaseGameSnapshotCache> logger,
+        GameExecutionContext gameExecutionContext,
+        BudLoaderContext budLoaderContext)
+    {
+        _fileSystem = fileSystem;
+        _logger = logger;
+        _snapshotPath = _fileSystem.Path.Combine(budLoaderContext.LoaderPath, SnapshotFileName);
+        _sourceFilesPaths =
+        [
+            _fileSystem.Path.Combine(gameExecutionContext.DataDir, "data.unity3d"),
+            _fileSystem.Path.Combine(gameExecutionContext.DataDir, "Managed", "Assembly-CSharp.dll")
+        ];
+    }
+
+    public bool TryLoad([NotNullWhen(true)] out BaseGameSnapshot? snapshot)
+    {
+        snapshot = null;
+        if (!_fileSystem.File.Exists(_snapshotPath))
+        {
+            _logger.LogInformation("No base game snapshot found, the base game data will be collected from the game");
+            return false;
+        }
+
+        bool onlyLastWriteTimesChanged = false;
+        try
+        {
+            using Stream stream = _fileSystem.File.OpenRead(_snapshotPath);
+            using BinaryReader reader = new(stream, Encoding.UTF8);
+            if (reader.ReadInt32() != SnapshotMagic || reader.ReadInt32() != SnapshotFormatVersion)
+            {
+                _logger.LogInformation("The base game snapshot is from a different version and will be regenerated");
+                return false;
+            }
+
+            foreach (string sourceFilePath in _sourceFilesPaths)
+            {
+                SourceFileStamp storedStamp = ReadSourceFileStamp(reader);
+                IFileInfo sourceFileInfo = _fileSystem.FileInfo.New(sourceFilePath);
+                if (storedStamp.Size != sourceFileInfo.Length)
+                {
+                    _logger.LogInformation(
+                        "{path} changed since the base game snapshot was saved, it will be regenerated",
+                        sourceFilePath);
+                    return false;
+                }
+
+                if (storedStamp.LastWriteTimeUtcTicks == sourceFileInfo.LastWriteTimeUtc.Ticks)
+                    continue;
+
+                // The file may have been touched without its content changing such as when the game is reinstalled
+                // or verified so we only consider the snapshot invalid if the content is actually different.
+                if (!storedStamp.Hash.SequenceEqual(ComputeFileHash(sourceFilePath)))
+                {
+                    _logger.LogInformation(
+                        "{path} changed since the base game snapshot was saved, it will be regenerated",
+                        sourceFilePath);
+                    return false;
+                }
+
+                onlyLastWriteTimesChanged = true;
+            }
+
+            snapshot = ReadSnapshot(reader);
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(
+                e,
+                "Unable to read the base game snapshot at {path}, it will be regenerated",
+                _snapshotPath);
+            snapshot = null;
+            return false;
+        }
+
+        _logger.LogInformation("Loaded the base game snapshot from {path}", _snapshotPath);
+
+        // This avoids hashing the game's files again on the next boot
+        if (onlyLastWriteTimesChanged)
+            Save(snapshot);
+        return true;
+    }
+
+    public void Save(BaseGameSnapshot snapshot)
+    {
+        // We write to a temporary file first so a crash while saving can't leave a truncated snapshot behind
+        string temporarySnapshotPath = _snapshotPath + ".tmp";
+        try
+        {
+            using (Stream stream = _fileSystem.File.Create(temporarySnapshotPath))
+            using (BinaryWriter writer = new(stream, Encoding.UTF8))
+            {
+                writer.Write(SnapshotMagic);
+                writer.Write(SnapshotFormatVersion);
+                foreach (string sourceFilePath in _sourceFilesPaths)
+                {
+                    IFileInfo sourceFileInfo = _fileSystem.FileInfo.New(sourceFilePath);
+                    WriteSourceFileStamp(
+                        writer,
+                        new(
+                            sourceFileInfo.Length,
+                            sourceFileInfo.LastWriteTimeUtc.Ticks,
+                            ComputeFileHash(sourceFilePath)));
+                }
+
+                WriteSnapshot(writer, snapshot);
+            }
+
+            if (_fileSystem.File.Exists(_snapshotPath))
+                _fileSystem.File.Delete(_snapshotPath);
+            _fileSystem.File.Move(temporarySnapshotPath, _snapshotPath);
+            _logger.LogInformation("Saved the base game snapshot to {path}", _snapshotPath);
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(e, "Unable to save the base game snapshot to {path}", _snapshotPath);
+        }
+    }
+
+    private byte[] ComputeFileHash(string path)
+    {
+        using Stream stream = _fileSystem.File.OpenRead(path);
+        using SHA256 sha256 = SHA256.Create();
+        return sha256.ComputeHash(stream);
+    }
+
+    private static SourceFileStamp ReadSourceFileStamp(BinaryReader reader)
+    {
+        long size = reader.ReadInt64();
+        long lastWriteTimeUtcTicks = reader.ReadInt64();
+        byte[] hash = reader.ReadBytes(reader.ReadInt32());
+        return new(size, lastWriteTimeUtcTicks, hash);
+    }
+
+    private static void WriteSourceFileStamp(BinaryWriter writer, SourceFileStamp stamp)
+    {
+        writer.Write(stamp.Size);
+        writer.Write(stamp.LastWriteTimeUtcTicks);
+        writer.Write(stamp.Hash.Length);
+        writer.Write(stamp.Hash);
+    }
+
+    private static BaseGameSnapshot ReadSnapshot(BinaryReader reader)
+    {
+        BaseGameSnapshot snapshot = new()
+        {
+            MapsAssetsData = reader.ReadBoolean() ? ReadMapsAssetsData(reader) : null
+        };
+
+        int textAssetsCount = reader.ReadInt32();
+        for (int i = 0; i < textAssetsCount; i++)
+        {
+            string resourcesPath = reader.ReadString();
+            snapshot.TextAssetsTexts[resourcesPath] = reader.ReadString();
+        }
+
+        int assetsNamesCount = reader.ReadInt32();
+        for (int i = 0; i < assetsNamesCount; i++)
+        {
+            string key = reader.ReadString();
+            string[] names = new string[reader.ReadInt32()];
+            for (int j = 0; j < names.Length; j++)
+                names[j] = reader.ReadString();
+            snapshot.AssetsNames[key] = names;
+        }
+
+        return snapshot;
+    }
+
+    private static void WriteSnapshot(BinaryWriter writer, BaseGameSnapshot snapshot)
+    {
+        writer.Write(snapshot.MapsAssetsData is not null);
+        if (snapshot.MapsAssetsData is not null)
+            WriteMapsAssetsData(writer, snapshot.MapsAssetsData);
+
+        writer.Write(snapshot.TextAssetsTexts.Count);
+        foreach (KeyValuePair<string, string> textAsset in snapshot.TextAssetsTexts)
+        {
+            writer.Write(textAsset.Key);
+            writer.Write(textAsset.Value);
+        }
+
+        writer.Write(snapshot.AssetsNames.Count);
+        foreach (KeyValuePair<string, string[]> assetsNames in snapshot.AssetsNames)
+        {
+            writer.Write(assetsNames.Key);
+            writer.Write(assetsNames.Value.Length);
+            foreach (string name in assetsNames.Value)
+                writer.Write(name);
+        }
+    }
+
+    private static MapsAssetsData ReadMapsAssetsData(BinaryReader reader)
+    {
+        int mapControlsCount = reader.ReadInt32();
+        Dictionary<int, MapControlData> mapControlsByGameIds = new(mapControlsCount);
+        for (int i = 0; i < mapControlsCount; i++)
+        {
+            int mapGameId = reader.ReadInt32();
+            mapControlsByGameIds[mapGameId] = ReadMapControlData(reader);
+        }
+
+        int mapGameIdsWithHoleHazardsCount = reader.ReadInt32();
+        HashSet<int> mapGameIdsWithHoleHazards = new();
+        for (int i = 0; i < mapGameIdsWithHoleHazardsCount; i++)
+            mapGameIdsWithHoleHazards.Add(reader.ReadInt32());
+
+        return new()
+        {
+            MapControlsByGameIds = mapControlsByGameIds,
+            MapGameIdsWithHoleHazards = mapGameIdsWithHoleHazards
+        };
+    }
+
+    private static void WriteMapsAssetsData(BinaryWriter writer, MapsAssetsData mapsAssetsData)
+    {
+        writer.Write(mapsAssetsData.MapControlsByGameIds.Count);
+        foreach (KeyValuePair<int, MapControlData> mapControl in mapsAssetsData.MapControlsByGameIds)
+        {
+            writer.Write(mapControl.Key);
+            WriteMapControlData(writer, mapControl.Value);
+        }
+
+        writer.Write(mapsAssetsData.MapGameIdsWithHoleHazards.Count);
+        foreach (int mapGameId in mapsAssetsData.MapGameIdsWithHoleHazards)
+            writer.Write(mapGameId);
+    }
+
+    private static MapControlData ReadMapControlData(BinaryReader reader)
+    {
+        MapControlData mapControlData = new()
+        {
+            AreaId = reader.ReadInt32(),
+            CamOffset = ReadVector3(reader),
+            CamAngle = ReadVector3(reader),
+            CamLimitNeg = ReadVector3(reader),
+            CamLimitPos = ReadVector3(reader),
+            RotateCam = reader.ReadBoolean(),
+            CentralPoint = ReadVector3(reader),
+            TieYToPlayer = reader.ReadBoolean(),
+            TetherDistance = reader.ReadSingle(),
+            FogEnd = reader.ReadSingle(),
+            FogColor = ReadColor(reader),
+            ScreenEffect = reader.ReadInt32(),
+            SkyboxMaterialName = ReadNullableString(reader),
+            GlobalLight = ReadColor(reader),
+            WindIntensity = reader.ReadSingle(),
+            FaderChange = reader.ReadBoolean(),
+            SkyColor = ReadColor(reader),
+            BattleMap = reader.ReadInt32(),
+            BattleLeafType = reader.ReadInt32(),
+            ExpMulti = reader.ReadSingle(),
+            BattleLeafColor = ReadColor(reader),
+            NoBattleMusic = reader.ReadBoolean(),
+            KeepMusic = reader.ReadBoolean(),
+            TieInsideDoorEntities = reader.ReadBoolean(),
+            HideInsides = reader.ReadBoolean(),
+            SetInsideCenter = reader.ReadBoolean(),
+            FadingSpeed = reader.ReadSingle(),
+            TattleId = reader.ReadInt32(),
+            FollowerYLimit = reader.ReadSingle(),
+            YLimit = reader.ReadSingle(),
+            IceMap = reader.ReadBoolean(),
+            LimitBehavior = reader.ReadBoolean(),
+            KeepObjectsActive = reader.ReadBoolean(),
+            MainMeshTransformPath = ReadNullableString(reader),
+            ReadDataFromOtherMap = reader.ReadInt32(),
+            CantCompass = reader.ReadBoolean()
+        };
+
+        ReadList(reader, mapControlData.MusicNames, ReadNullableString);
+        ReadList(reader, mapControlData.MusicFlags, r => new Vector2Int(r.ReadInt32(), r.ReadInt32()));
+        ReadList(reader, mapControlData.InsidesTransformPaths, r => r.ReadString());
+        ReadList(reader, mapControlData.InsideTypes, r => r.ReadInt32());
+        ReadList(reader, mapControlData.CanFollowIds, r => r.ReadInt32());
+        ReadList(reader, mapControlData.DiscoveryIds, r => r.ReadInt32());
+        ReadList(reader, mapControlData.AutoEvents, r => new Vector2(r.ReadSingle(), r.ReadSingle()));
+        ReadList(reader, mapControlData.EventPointersTransformPaths, r => r.ReadString());
+        return mapControlData;
+    }
+
+    private static void WriteMapControlData(BinaryWriter writer, MapControlData mapControlData)
+    {
+        writer.Write(mapControlData.AreaId);
+        WriteVector3(writer, mapControlData.CamOffset);
+        WriteVector3(writer, mapControlData.CamAngle);
+        WriteVector3(writer, mapControlData.CamLimitNeg);
+        WriteVector3(writer, mapControlData.CamLimitPos);
+        writer.Write(mapControlData.RotateCam);
+        WriteVector3(writer, mapControlData.CentralPoint);
+        writer.Write(mapControlData.TieYToPlayer);
+        writer.Write(mapControlData.TetherDistance);
+        writer.Write(mapControlData.FogEnd);
+        WriteColor(writer, mapControlData.FogColor);
+        writer.Write(mapControlData.ScreenEffect);
+        WriteNullableString(writer, mapControlData.SkyboxMaterialName);
+        WriteColor(writer, mapControlData.GlobalLight);
+        writer.Write(mapControlData.WindIntensity);
+        writer.Write(mapControlData.FaderChange);
+        WriteColor(writer, mapControlData.SkyColor);
+        writer.Write(mapControlData.BattleMap);
+        writer.Write(mapControlData.BattleLeafType);
+        writer.Write(mapControlData.ExpMulti);
+        WriteColor(writer, mapControlData.BattleLeafColor);
+        writer.Write(mapControlData.NoBattleMusic);
+        writer.Write(mapControlData.KeepMusic);
+        writer.Write(mapControlData.TieInsideDoorEntities);
+        writer.Write(mapControlData.HideInsides);
+        writer.Write(mapControlData.SetInsideCenter);
+        writer.Write(mapControlData.FadingSpeed);
+        writer.Write(mapControlData.TattleId);
+        writer.Write(mapControlData.FollowerYLimit);
+        writer.Write(mapControlData.YLimit);
+        writer.Write(mapControlData.IceMap);
+        writer.Write(mapControlData.LimitBehavior);
+        writer.Write(mapControlData.KeepObjectsActive);
+        WriteNullableString(writer, mapControlData.MainMeshTransformPath);
+        writer.Write(mapControlData.ReadDataFromOtherMap);
+        writer.Write(mapControlData.CantCompass);
+
+        WriteList(writer, mapControlData.MusicNames, WriteNullableString);
+        WriteList(
+            writer,
+            mapControlData.MusicFlags,
+            (w, v) =>
+            {
+                w.Write(v.x);
+                w.Write(v.y);
+            });
+        WriteList(writer, mapControlData.InsidesTransformPaths, (w, v) => w.Write(v));
+        WriteList(writer, mapControlData.InsideTypes, (w, v) => w.Write(v));
+        WriteList(writer, mapControlData.CanFollowIds, (w, v) => w.Write(v));
+        WriteList(writer, mapControlData.DiscoveryIds, (w, v) => w.Write(v));
+        WriteList(
+            writer,
+            mapControlData.AutoEvents,
+            (w, v) =>
+            {
+                w.Write(v.x);
+                w.Write(v.y);
+            });
+        WriteList(writer, mapControlData.EventPointersTransformPaths, (w, v) => w.Write(v));
+    }
+
+    private static void ReadList<T>(BinaryReader reader, List<T> list, Func<BinaryReader, T> readElement)
+    {
+        int count = reader.ReadInt32();
+        list.Capacity = count;
+        for (int i = 0; i < count; i++)
+            list.Add(readElement(reader));
+    }
+
+    private static void WriteList<T>(BinaryWriter writer, List<T> list, Action<BinaryWriter, T> writeElement)
+    {
+        writer.Write(list.Count);
+        foreach (T element in list)
+            writeElement(writer, element);
+    }
+
+    private static string? ReadNullableString(BinaryReader reader) => reader.ReadBoolean() ? reader.ReadString() : null;
+
+    private static void WriteNullableString(BinaryWriter writer, string? value)
+    {
+        writer.Write(value is not null);
+        if (value is not null)
+            writer.Write(value);
+    }
+
+    private static Vector3 ReadVector3(BinaryReader reader) =>
+        new(reader.ReadSingle(), reader.ReadSingle(), reader.ReadSingle());
+
+    private static void WriteVector3(BinaryWriter writer, Vector3 value)
+    {
+        writer.Write(value.x);
+        writer.Write(value.y);
+        writer.Write(value.z);
+    }
+
+    private static Color ReadColor(BinaryReader reader) =>
+        new(reader.ReadSingle(), reader.ReadSingle(), reader.ReadSingle(), reader.ReadSingle());
+
+    private static void WriteColor(BinaryWriter writer, Color value)
+    {
+        writer.Write(value.r);
+        writer.Write(value.g);
+        writer.Write(value.b);
+        writer.Write(value.a);
+    }
+}
\ No newline at end of file
@@ -23,7 +23,9 @@ internal sealed class BattleEventDialoguesCollector : IBaseGameCollector
         _battleEventDialoguesRegistry = battleEventDialoguesRegistry;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         Type eventDialogueEnumeratorType =
             typeof(BattleControl).InnerTypes().Single(x => x.Name.Contains("<EventDialogue>"));
@@ -45,4 +47,8 @@ internal sealed class BattleEventDialoguesCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _battleEventDialoguesRegistry, eventDialoguesAmount);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
@@ -8,14 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class CommonDialoguesCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _commonDialoguesLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedCommonDialoguesPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _commonDialoguesLanguageData;
 
     private readonly ILogger<CommonDialoguesCollector> _logger;
     private readonly ILeavesRegistry<CommonDialogueLeaf> _commonDialoguesRegistry;
     private readonly ILocalizedTextAssetParser<CommonDialogueLeaf> _commonDialogueLanguageDataSerializer;
 
     public CommonDialoguesCollector(
+        IBaseGameResources baseGameResources,
         ILogger<CommonDialoguesCollector> logger,
         ILocalizedTextAssetParser<CommonDialogueLeaf> commonDialogueLanguageDataSerializer,
         ILeavesRegistry<CommonDialogueLeaf> commonDialoguesRegistry)
@@ -23,9 +23,14 @@ internal sealed class CommonDialoguesCollector : IBaseGameCollector
         _logger = logger;
         _commonDialogueLanguageDataSerializer = commonDialogueLanguageDataSerializer;
         _commonDialoguesRegistry = commonDialoguesRegistry;
+
+        _commonDialoguesLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedCommonDialoguesPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
     {
         int commonDialoguesAmount = _commonDialoguesLanguageData.Values.First().Length;
         for (int i = 0; i < commonDialoguesAmount; i++)
@@ -34,8 +39,18 @@ internal sealed class CommonDialoguesCollector : IBaseGameCollector
             // encoded form for convenience. That form starts at -1 and goes in descending order which is why we need to
             // encode the game id for registration.
             int gameId = -i - 1;
-            CommonDialogueLeaf commonDialogueLeaf =
-                _commonDialoguesRegistry.RegisterExisting(gameId, gameId.ToString());
+            _commonDialoguesRegistry.RegisterExisting(gameId, gameId.ToString());
+        }
+
+        RootCollector.LogCollectedAmount(_logger, _commonDialoguesRegistry, commonDialoguesAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        int commonDialoguesAmount = _commonDialoguesLanguageData.Values.First().Length;
+        for (int i = 0; i < commonDialoguesAmount; i++)
+        {
+            CommonDialogueLeaf commonDialogueLeaf = _commonDialoguesRegistry.GetByGameId(-i - 1);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _commonDialogueLanguageDataSerializer.FromTextAssetSerializedString(
@@ -45,7 +60,5 @@ internal sealed class CommonDialoguesCollector : IBaseGameCollector
                     commonDialogueLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _commonDialoguesRegistry, commonDialoguesAmount);
     }
 }
\ No newline at end of file
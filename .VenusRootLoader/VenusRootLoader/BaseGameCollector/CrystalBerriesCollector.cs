@@ -12,15 +12,16 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class CrystalBerriesCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _fortuneTeller0LanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(
-            ResourcesPaths.DataLocalizedCrystalBerryFortuneTellerHintsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _fortuneTeller0LanguageData;
 
     private readonly ILogger<CrystalBerriesCollector> _logger;
     private readonly ILeavesRegistry<CrystalBerryLeaf> _crystalBerriesRegistry;
     private readonly ILocalizedTextAssetParser<CrystalBerryLeaf> _crystalBerryLanguageDataSerializer;
 
+    private int _crystalBerriesAmount;
+
     public CrystalBerriesCollector(
+        IBaseGameResources baseGameResources,
         ILogger<CrystalBerriesCollector> logger,
         ILocalizedTextAssetParser<CrystalBerryLeaf> crystalBerryLanguageDataSerializer,
         ILeavesRegistry<CrystalBerryLeaf> crystalBerriesRegistry)
@@ -28,14 +29,27 @@ internal sealed class CrystalBerriesCollector : IBaseGameCollector
         _logger = logger;
         _crystalBerryLanguageDataSerializer = crystalBerryLanguageDataSerializer;
         _crystalBerriesRegistry = crystalBerriesRegistry;
+
+        _fortuneTeller0LanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedCrystalBerryFortuneTellerHintsPathSuffix);
+    }
+
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        _crystalBerriesAmount = CollectCrystalBerriesAmount();
+        for (int i = 0; i < _crystalBerriesAmount; i++)
+            _crystalBerriesRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _crystalBerriesRegistry, _crystalBerriesAmount);
     }
 
-    public void CollectBaseGameData()
+    public void ParseBaseGameData()
     {
-        int crystalBerriesAmount = CollectCrystalBerriesAmount();
-        for (int i = 0; i < crystalBerriesAmount; i++)
+        for (int i = 0; i < _crystalBerriesAmount; i++)
         {
-            CrystalBerryLeaf crystalBerryLeaf = _crystalBerriesRegistry.RegisterExisting(i, i.ToString());
+            CrystalBerryLeaf crystalBerryLeaf = _crystalBerriesRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _crystalBerryLanguageDataSerializer.FromTextAssetSerializedString(
@@ -45,8 +59,6 @@ internal sealed class CrystalBerriesCollector : IBaseGameCollector
                     crystalBerryLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _crystalBerriesRegistry, crystalBerriesAmount);
     }
 
     // The amount of crystal berries isn't straight forward to figure out because it's not declared in a dedicated way.
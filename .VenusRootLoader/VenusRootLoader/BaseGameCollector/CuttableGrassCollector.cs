@@ -12,18 +12,25 @@ internal sealed class CuttableGrassCollector : IBaseGameCollector
     private const string SpritesObjectsGrassResourcesPath =
         $"{ResourcesPaths.RootSpritesPathPrefix}{ResourcesPaths.SpritesObjectsGrassPath}";
 
-    private readonly int _amountCuttableGrass = Resources.LoadAll<Sprite>(SpritesObjectsGrassResourcesPath).Length / 3;
+    private readonly int _amountCuttableGrass;
 
     private readonly ILogger<CuttableGrassLeaf> _logger;
     private readonly ILeavesRegistry<CuttableGrassLeaf> _leavesRegistry;
 
-    public CuttableGrassCollector(ILogger<CuttableGrassLeaf> logger, ILeavesRegistry<CuttableGrassLeaf> leavesRegistry)
+    public CuttableGrassCollector(
+        IBaseGameResources baseGameResources,
+        ILogger<CuttableGrassLeaf> logger,
+        ILeavesRegistry<CuttableGrassLeaf> leavesRegistry)
     {
         _logger = logger;
         _leavesRegistry = leavesRegistry;
+
+        _amountCuttableGrass = baseGameResources.ReadAssetsNames<Sprite>(SpritesObjectsGrassResourcesPath).Length / 3;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         for (int i = 0; i < _amountCuttableGrass; i++)
         {
@@ -38,4 +45,8 @@ internal sealed class CuttableGrassCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _leavesRegistry, _amountCuttableGrass);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
@@ -12,22 +12,25 @@ internal sealed class DialogueBleepCollector : IBaseGameCollector
     private const string AudioSoundsDialogueResourcesPath =
         $"{ResourcesPaths.RootAudioPathPrefix}{ResourcesPaths.AudioSoundsDialogueDirectory}";
 
-    private readonly string[] _dialogueBleepsName = Resources.LoadAll<AudioClip>(AudioSoundsDialogueResourcesPath)
-        .Select(a => a.name)
-        .ToArray();
+    private readonly string[] _dialogueBleepsName;
 
     private readonly ILogger<DialogueBleepCollector> _logger;
     private readonly ILeavesRegistry<DialogueBleepLeaf> _dialogueBleepsRegistry;
 
     public DialogueBleepCollector(
+        IBaseGameResources baseGameResources,
         ILogger<DialogueBleepCollector> logger,
         ILeavesRegistry<DialogueBleepLeaf> dialogueBleepsRegistry)
     {
         _logger = logger;
         _dialogueBleepsRegistry = dialogueBleepsRegistry;
+
+        _dialogueBleepsName = baseGameResources.ReadAssetsNames<AudioClip>(AudioSoundsDialogueResourcesPath);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         // We need to strip out clips like Dialogue3old which aren't considered bleeps that can be addressed as such.
         // They are effectively unused in base game.
@@ -45,4 +48,8 @@ internal sealed class DialogueBleepCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _dialogueBleepsRegistry, dialogueBleeps.Count);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
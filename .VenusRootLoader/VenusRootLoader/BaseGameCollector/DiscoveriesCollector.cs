@@ -11,11 +11,8 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class DiscoveriesCollector : IBaseGameCollector
 {
-    private readonly string _discoveriesOrderingData =
-        RootCollector.ReadWholeTextAsset(ResourcesPaths.DataDiscoveriesOrderingPath);
-
-    private readonly Dictionary<int, string[]> _discoveriesLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedDiscoveriesPathSuffix);
+    private readonly string _discoveriesOrderingData;
+    private readonly Dictionary<int, TextAssetLines> _discoveriesLanguageData;
 
     private readonly ILogger<DiscoveriesCollector> _logger;
     private readonly IOrderedLeavesRegistry<DiscoveryLeaf> _orderedRegistry;
@@ -23,7 +20,10 @@ internal sealed class DiscoveriesCollector : IBaseGameCollector
     private readonly IOrderingTextAssetParser<DiscoveryLeaf> _discoveriesOrderingDataSerializer;
     private readonly ILocalizedTextAssetParser<DiscoveryLeaf> _discoveriesLanguageDataSerializer;
 
+    private int _discoveriesAmount;
+
     public DiscoveriesCollector(
+        IBaseGameResources baseGameResources,
         IOrderedLeavesRegistry<DiscoveryLeaf> orderedRegistry,
         ILogger<DiscoveriesCollector> logger,
         ILeavesRegistry<LanguageLeaf> languageRegistry,
@@ -35,16 +35,31 @@ internal sealed class DiscoveriesCollector : IBaseGameCollector
         _languageRegistry = languageRegistry;
         _discoveriesOrderingDataSerializer = discoveriesOrderingDataSerializer;
         _discoveriesLanguageDataSerializer = discoveriesLanguageDataSerializer;
+
+        _discoveriesOrderingData = baseGameResources.ReadWholeTextAsset(ResourcesPaths.DataDiscoveriesOrderingPath);
+        _discoveriesLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedDiscoveriesPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+        [typeof(LanguagesCollector), typeof(GlobalFlagsCollector)];
+
+    public void RegisterBaseGameData()
     {
-        int discoveriesAmount = _discoveriesOrderingData
+        _discoveriesAmount = _discoveriesOrderingData
             .Split('\n')
             .Length;
-        for (int i = 0; i < discoveriesAmount; i++)
+        for (int i = 0; i < _discoveriesAmount; i++)
+            _orderedRegistry.RegisterExistingWithOrdering(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, _discoveriesAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _discoveriesAmount; i++)
         {
-            DiscoveryLeaf discoveryLeaf = _orderedRegistry.RegisterExistingWithOrdering(i, i.ToString());
+            DiscoveryLeaf discoveryLeaf = _orderedRegistry.Registry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 discoveryLeaf.LocalizedData[_languageRegistry.GetByGameId(j)] = new();
@@ -64,7 +79,5 @@ internal sealed class DiscoveriesCollector : IBaseGameCollector
                 ResourcesPaths.SpritesItemsEnemyPortraitsResourcesPath,
                 hasEnemyPortraitSprite.EnemyPortraitsSpriteIndex!.Value);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, discoveriesAmount);
     }
 }
\ No newline at end of file
@@ -16,13 +16,9 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class EnemiesCollector : IBaseGameCollector
 {
-    private readonly string[] _enemiesData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataEnemiesPath);
-
-    private readonly string _enemiesOrderingData =
-        RootCollector.ReadWholeTextAsset(ResourcesPaths.DataBestiaryEntriesOrderingPath);
-
-    private readonly Dictionary<int, string[]> _enemiesLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedBestiaryEntriesPathSuffix);
+    private readonly TextAssetLines _enemiesData;
+    private readonly string _enemiesOrderingData;
+    private readonly Dictionary<int, TextAssetLines> _enemiesLanguageData;
 
     private readonly string[] _enemyNamedIds = Enum.GetNames(typeof(MainManager.Enemies)).ToArray();
 
@@ -35,6 +31,7 @@ internal sealed class EnemiesCollector : IBaseGameCollector
     private readonly ILocalizedTextAssetParser<EnemyLeaf> _enemyLocalizedTextAssetParser;
 
     public EnemiesCollector(
+        IBaseGameResources baseGameResources,
         ILogger<EnemiesCollector> logger,
         IAssemblyCSharpDataCollector assemblyCSharpDataCollector,
         ITextAssetParser<EnemyLeaf> enemyTextAssetParser,
@@ -50,9 +47,21 @@ internal sealed class EnemiesCollector : IBaseGameCollector
         _enemyOrderingTextAssetParser = enemyOrderingTextAssetParser;
         _enemyLocalizedTextAssetParser = enemyLocalizedTextAssetParser;
         _languageRegistry = languageRegistry;
+
+        _enemiesData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataEnemiesPath);
+        _enemiesOrderingData = baseGameResources.ReadWholeTextAsset(ResourcesPaths.DataBestiaryEntriesOrderingPath);
+        _enemiesLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedBestiaryEntriesPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+    [
+        typeof(LanguagesCollector),
+        typeof(AnimIdsCollector),
+        typeof(BattleEventDialoguesCollector)
+    ];
+
+    public void RegisterBaseGameData()
     {
         _enemyOrderingTextAssetParser.FromTextAssetString(_enemiesOrderingData, _orderedRegistry);
 
@@ -129,6 +138,20 @@ internal sealed class EnemiesCollector : IBaseGameCollector
             .Where(e => e >= 0)
             .ToHashSet();
 
+        for (int i = 0; i < _enemyNamedIds.Length; i++)
+        {
+            EnemyLeaf enemyLeaf = _orderedRegistry.Registry.GetByGameId(i);
+            if (excludedEnemyGameIdsFromRandomCot.Contains(i))
+                enemyLeaf.IsIncludedInRandomCaveOfTrialsPool = false;
+            if (gameIdsWithRareSpyData.Contains(i))
+                enemyLeaf.IsRareSpyData = true;
+        }
+
+        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, _enemyNamedIds.Length);
+    }
+
+    public void ParseBaseGameData()
+    {
         for (int i = 0; i < _enemyNamedIds.Length; i++)
         {
             EnemyLeaf enemyLeaf = _orderedRegistry.Registry.GetByGameId(i);
@@ -145,11 +168,6 @@ internal sealed class EnemiesCollector : IBaseGameCollector
                     _enemiesLanguageData[j][i],
                     enemyLeaf);
             }
-
-            if (excludedEnemyGameIdsFromRandomCot.Contains(i))
-                enemyLeaf.IsIncludedInRandomCaveOfTrialsPool = false;
-            if (gameIdsWithRareSpyData.Contains(i))
-                enemyLeaf.IsRareSpyData = true;
         }
 
         foreach (EnemyLeaf leaf in _orderedRegistry.Registry)
@@ -165,7 +183,5 @@ internal sealed class EnemiesCollector : IBaseGameCollector
                 ResourcesPaths.SpritesItemsEnemyPortraitsResourcesPath,
                 hasEnemyPortraitSprite.EnemyPortraitsSpriteIndex!.Value);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, _enemyNamedIds.Length);
     }
 }
\ No newline at end of file
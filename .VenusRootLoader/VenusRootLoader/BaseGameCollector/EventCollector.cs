@@ -20,7 +20,9 @@ internal sealed class EventCollector : IBaseGameCollector
         _logger = logger;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         IList<int> eventIds = _assemblyCSharpDataCollector.GetEventControlEventsIds();
         foreach (int eventId in eventIds)
@@ -28,4 +30,8 @@ internal sealed class EventCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _eventsRegistry, eventIds.Count);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
@@ -8,14 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class FishingTextsCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _fishingTextsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedFishingTextsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _fishingTextsLanguageData;
 
     private readonly ILogger<FishingTextsCollector> _logger;
     private readonly ILeavesRegistry<FishingTextLeaf> _fishingTextsRegistry;
     private readonly ILocalizedTextAssetParser<FishingTextLeaf> _fishingTextLocalizedTextAssetParser;
 
     public FishingTextsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<FishingTextsCollector> logger,
         ILocalizedTextAssetParser<FishingTextLeaf> fishingTextLocalizedTextAssetParser,
         ILeavesRegistry<FishingTextLeaf> fishingTextsRegistry)
@@ -23,14 +23,28 @@ internal sealed class FishingTextsCollector : IBaseGameCollector
         _logger = logger;
         _fishingTextLocalizedTextAssetParser = fishingTextLocalizedTextAssetParser;
         _fishingTextsRegistry = fishingTextsRegistry;
+
+        _fishingTextsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedFishingTextsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        int fishingTextsAmount = _fishingTextsLanguageData.Values.First().Length;
+        for (int i = 0; i < fishingTextsAmount; i++)
+            _fishingTextsRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _fishingTextsRegistry, fishingTextsAmount);
+    }
+
+    public void ParseBaseGameData()
     {
         int fishingTextsAmount = _fishingTextsLanguageData.Values.First().Length;
         for (int i = 0; i < fishingTextsAmount; i++)
         {
-            FishingTextLeaf fishingTextLeaf = _fishingTextsRegistry.RegisterExisting(i, i.ToString());
+            FishingTextLeaf fishingTextLeaf = _fishingTextsRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _fishingTextLocalizedTextAssetParser.FromTextAssetSerializedString(
@@ -40,7 +54,5 @@ internal sealed class FishingTextsCollector : IBaseGameCollector
                     fishingTextLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _fishingTextsRegistry, fishingTextsAmount);
     }
 }
\ No newline at end of file
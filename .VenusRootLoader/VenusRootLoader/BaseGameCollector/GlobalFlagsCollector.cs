@@ -27,7 +27,9 @@ internal sealed class GlobalFlagsCollector : IBaseGameCollector
         _flagstringsRegistry = flagstringsRegistry;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         int flagsAmount = 0;
         int flagvarsAmount = 0;
@@ -65,4 +67,8 @@ internal sealed class GlobalFlagsCollector : IBaseGameCollector
             _flagstringsRegistry.RegisterExisting(i, i.ToString());
         RootCollector.LogCollectedAmount(_logger, _flagstringsRegistry, flagstringsAmount);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
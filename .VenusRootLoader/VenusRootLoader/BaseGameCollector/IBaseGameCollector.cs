@@ -1,15 +1,41 @@
 using VenusRootLoader.Api;
+using VenusRootLoader.Api.Leaves;
 
 namespace VenusRootLoader.BaseGameCollector;
 
 /// <summary>
 /// A service that collects base game data such that the state of <see cref="VenusRootLoader"/> reflects the base game
-/// before any <see cref="Bud"/> gets loaded.
+/// before any <see cref="Bud"/> gets loaded. The collection happens in phases:
+/// <list type="number">
+/// <item>The raw data is read from the game's resources when the collector is constructed which happens on the main
+/// thread because Unity's APIs can only be called from there.</item>
+/// <item><see cref="RegisterBaseGameData"/> is called on the main thread for every collectors in their registration
+/// order so the <see cref="Leaf.GameId"/> of every leaf is deterministic.</item>
+/// <item><see cref="ParseBaseGameData"/> is called from the thread pool once the parsing of every collector in
+/// <see cref="ParsingDependencies"/> completed which means collectors without dependencies between them are parsed in
+/// parallel.</item>
+/// </list>
 /// </summary>
 internal interface IBaseGameCollector
 {
     /// <summary>
-    /// Collects data from the base game.
+    /// The types of the collectors whose leaves are read or modified by <see cref="ParseBaseGameData"/>. Their parsing
+    /// is guaranteed to be completed before this collector's parsing starts and they must be registered before this
+    /// collector. This must be a constant expression bodied property so it can be verified without constructing the
+    /// collector.
     /// </summary>
-    void CollectBaseGameData();
+    IReadOnlyCollection<Type> ParsingDependencies { get; }
+
+    /// <summary>
+    /// Registers the base game leaves from the data read on construction. This is called on the main thread and it is
+    /// the only phase allowed to register leaves to a registry shared with other collectors or to call Unity's APIs.
+    /// </summary>
+    void RegisterBaseGameData();
+
+    /// <summary>
+    /// Parses the data read on construction into the leaves registered by <see cref="RegisterBaseGameData"/>. This is
+    /// called from the thread pool so it must not call Unity's APIs and it must only modify leaves owned by this
+    /// collector or by one of its <see cref="ParsingDependencies"/>.
+    /// </summary>
+    void ParseBaseGameData();
 }
\ No newline at end of file
@@ -14,16 +14,16 @@ internal sealed class ItemsCollector : IBaseGameCollector
     // index that separates these 2 regions so we need to hardcode this too.
     private const int ItemsSpritesAmountInItems0 = 176;
 
+    private const string MissingBigBerryLanguageLine = "RESERVED@Desc@Desc@a";
+
     private const string SpritesItemsItems0ResourcesPath =
         $"{ResourcesPaths.RootSpritesPathPrefix}{ResourcesPaths.SpritesItems0Path}";
 
     private const string SpritesItemsItems1ResourcesPath =
         $"{ResourcesPaths.RootSpritesPathPrefix}{ResourcesPaths.SpritesItems1Path}";
 
-    private readonly string[] _itemsData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataItemsPath);
-
-    private readonly Dictionary<int, string[]> _itemsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedItemsPathSuffix);
+    private readonly TextAssetLines _itemsData;
+    private readonly Dictionary<int, TextAssetLines> _itemsLanguageData;
 
     private readonly string[] _itemNamedIds = Enum.GetNames(typeof(MainManager.Items))
         .TakeWhile(v => v != nameof(MainManager.Items.None))
@@ -36,6 +36,7 @@ internal sealed class ItemsCollector : IBaseGameCollector
     private readonly ILeavesRegistry<LanguageLeaf> _languageRegistry;
 
     public ItemsCollector(
+        IBaseGameResources baseGameResources,
         ILeavesRegistry<ItemLeaf> leavesRegistry,
         ILogger<ItemsCollector> logger,
         ITextAssetParser<ItemLeaf> itemDataSerializer,
@@ -48,40 +49,46 @@ internal sealed class ItemsCollector : IBaseGameCollector
         _itemLanguageDataSerializer = itemLanguageDataSerializer;
         _languageRegistry = languageRegistry;
 
-        // Workaround a game bug where not all languages has the last line about BigBerry
-        for (int i = 0; i < _itemsLanguageData.Count; i++)
-        {
-            string[] itemLanguageData = _itemsLanguageData[i];
-            if (itemLanguageData.Length != _itemNamedIds.Length)
-                itemLanguageData = itemLanguageData.Append("RESERVED@Desc@Desc@a").ToArray();
-            _itemsLanguageData[i] = itemLanguageData;
-        }
+        _itemsData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataItemsPath);
+        _itemsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(ResourcesPaths.DataLocalizedItemsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
     {
         for (int i = 0; i < _itemNamedIds.Length; i++)
         {
             string itemNamedId = _itemNamedIds[i];
             ItemLeaf itemLeaf = _leavesRegistry.RegisterExisting(i, itemNamedId);
+            itemLeaf.Sprite = i < ItemsSpritesAmountInItems0
+                ? new AssetLoaderFromResources<Sprite>(SpritesItemsItems0ResourcesPath, i)
+                : new AssetLoaderFromResources<Sprite>(SpritesItemsItems1ResourcesPath, i - ItemsSpritesAmountInItems0);
+        }
+
+        RootCollector.LogCollectedAmount(_logger, _leavesRegistry, _itemNamedIds.Length);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _itemNamedIds.Length; i++)
+        {
+            ItemLeaf itemLeaf = _leavesRegistry.GetByGameId(i);
             _itemDataSerializer.FromTextAssetSerializedString(
                 ResourcesPaths.DataItemsPath,
                 _itemsData[i],
                 itemLeaf);
-            itemLeaf.Sprite = i < ItemsSpritesAmountInItems0
-                ? new AssetLoaderFromResources<Sprite>(SpritesItemsItems0ResourcesPath, i)
-                : new AssetLoaderFromResources<Sprite>(SpritesItemsItems1ResourcesPath, i - ItemsSpritesAmountInItems0);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
+                // Workaround a game bug where not all languages has the last line about BigBerry
+                TextAssetLines itemLanguageData = _itemsLanguageData[j];
                 itemLeaf.LocalizedData[_languageRegistry.GetByGameId(j)] = new();
                 _itemLanguageDataSerializer.FromTextAssetSerializedString(
                     ResourcesPaths.DataLocalizedItemsPathSuffix,
                     j,
-                    _itemsLanguageData[j][i],
+                    i < itemLanguageData.Length ? itemLanguageData[i] : MissingBigBerryLanguageLine,
                     itemLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _leavesRegistry, _itemNamedIds.Length);
     }
 }
\ No newline at end of file
@@ -28,7 +28,9 @@ internal sealed class LanguagesCollector : IBaseGameCollector
         _leavesRegistry = leavesRegistry;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         for (int i = 0; i < LanguagesDisplayNames.Count; i++)
         {
@@ -39,4 +41,8 @@ internal sealed class LanguagesCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _leavesRegistry, LanguagesDisplayNames.Count);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
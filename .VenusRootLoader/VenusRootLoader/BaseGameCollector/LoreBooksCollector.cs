@@ -15,12 +15,8 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class LoreBooksCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _fortuneTellerHintsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(
-            ResourcesPaths.DataLocalizedLoreBookFortuneTellerHintsPathSuffix);
-
-    private readonly Dictionary<int, string[]> _loreTextsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedLoreBooksPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _fortuneTellerHintsLanguageData;
+    private readonly Dictionary<int, TextAssetLines> _loreTextsLanguageData;
 
     private readonly ILogger<LoreBooksCollector> _logger;
     private readonly IAssemblyCSharpDataCollector _assemblyCSharpDataCollector;
@@ -30,6 +26,7 @@ internal sealed class LoreBooksCollector : IBaseGameCollector
     private readonly ILeavesRegistry<FlagLeaf> _flagsRegistry;
 
     public LoreBooksCollector(
+        IBaseGameResources baseGameResources,
         ILogger<LoreBooksCollector> logger,
         IAssemblyCSharpDataCollector assemblyCSharpDataCollector,
         ILocalizedTextAssetParser<LoreBookLeaf> loreBookLocalizedTextAssetParser,
@@ -43,9 +40,16 @@ internal sealed class LoreBooksCollector : IBaseGameCollector
         _loreBooksRegistry = loreBooksRegistry;
         _flagsRegistry = flagsRegistry;
         _languageRegistry = languageRegistry;
+
+        _fortuneTellerHintsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedLoreBookFortuneTellerHintsPathSuffix);
+        _loreTextsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedLoreBooksPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
     {
         int[] flags = CollectLoreBooksObtainedFlagGameIds();
 
@@ -54,6 +58,17 @@ internal sealed class LoreBooksCollector : IBaseGameCollector
         {
             LoreBookLeaf loreBookLeaf = _loreBooksRegistry.RegisterExisting(i, i.ToString());
             loreBookLeaf.LoreBookObtainedFlag = new(_flagsRegistry.GetByGameId(flags[i]));
+        }
+
+        RootCollector.LogCollectedAmount(_logger, _loreBooksRegistry, loreBooksAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        int loreBooksAmount = _loreTextsLanguageData.Values.First().Length;
+        for (int i = 0; i < loreBooksAmount; i++)
+        {
+            LoreBookLeaf loreBookLeaf = _loreBooksRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 loreBookLeaf.LocalizedData[_languageRegistry.GetByGameId(j)] = new();
@@ -69,8 +84,6 @@ internal sealed class LoreBooksCollector : IBaseGameCollector
                     loreBookLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _loreBooksRegistry, loreBooksAmount);
     }
 
     // The flags are hardcoded in an array in event 71 (Fortune Teller event).
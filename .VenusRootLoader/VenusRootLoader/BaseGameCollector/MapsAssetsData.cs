@@ -0,0 +1,83 @@
+using UnityEngine;
+
+namespace VenusRootLoader.BaseGameCollector;
+
+/// <summary>
+/// The data about the base game's maps that can only be obtained by reading the game's bundle with AssetsTools.
+/// Reading the bundle is expensive so this data is part of the <see cref="BaseGameSnapshot"/> which allows to skip it
+/// entirely when the game didn't change since the last boot.
+/// </summary>
+internal sealed class MapsAssetsData
+{
+    /// <summary>
+    /// The serialized fields of each map's <see cref="MapControl"/> indexed by the map's game id.
+    /// </summary>
+    internal required Dictionary<int, MapControlData> MapControlsByGameIds { get; init; }
+
+    /// <summary>
+    /// The game id of every map containing at least one <see cref="Hazards"/> of type <see cref="Hazards.Type.Hole"/>.
+    /// </summary>
+    internal required HashSet<int> MapGameIdsWithHoleHazards { get; init; }
+}
+
+/// <summary>
+/// The serialized fields of a map's <see cref="MapControl"/> with every object reference already resolved to what
+/// the <see cref="MapsCollector"/> needs from them (an asset name or a transform path in the map's prefab).
+/// </summary>
+internal sealed class MapControlData
+{
+    internal int AreaId { get; set; }
+    internal Vector3 CamOffset { get; set; }
+    internal Vector3 CamAngle { get; set; }
+    internal Vector3 CamLimitNeg { get; set; }
+    internal Vector3 CamLimitPos { get; set; }
+    internal bool RotateCam { get; set; }
+    internal Vector3 CentralPoint { get; set; }
+    internal bool TieYToPlayer { get; set; }
+    internal float TetherDistance { get; set; }
+    internal float FogEnd { get; set; }
+    internal Color FogColor { get; set; }
+    internal int ScreenEffect { get; set; }
+    internal string? SkyboxMaterialName { get; set; }
+    internal Color GlobalLight { get; set; }
+    internal float WindIntensity { get; set; }
+    internal bool FaderChange { get; set; }
+    internal Color SkyColor { get; set; }
+    internal int BattleMap { get; set; }
+    internal int BattleLeafType { get; set; }
+    internal float ExpMulti { get; set; }
+    internal Color BattleLeafColor { get; set; }
+    internal bool NoBattleMusic { get; set; }
+
+    /// <summary>
+    /// The name of each music's AudioClip in order where null means the reference was empty.
+    /// </summary>
+    internal List<string?> MusicNames { get; } = new();
+
+    internal bool KeepMusic { get; set; }
+    internal List<Vector2Int> MusicFlags { get; } = new();
+    internal List<string> InsidesTransformPaths { get; } = new();
+    internal List<int> InsideTypes { get; } = new();
+    internal bool TieInsideDoorEntities { get; set; }
+    internal bool HideInsides { get; set; }
+    internal bool SetInsideCenter { get; set; }
+    internal float FadingSpeed { get; set; }
+    internal int TattleId { get; set; }
+    internal List<int> CanFollowIds { get; } = new();
+    internal float FollowerYLimit { get; set; }
+    internal float YLimit { get; set; }
+    internal bool IceMap { get; set; }
+    internal bool LimitBehavior { get; set; }
+    internal bool KeepObjectsActive { get; set; }
+
+    /// <summary>
+    /// The path of the main mesh's transform in the map's prefab or null if the map has no main mesh.
+    /// </summary>
+    internal string? MainMeshTransformPath { get; set; }
+
+    internal List<int> DiscoveryIds { get; } = new();
+    internal int ReadDataFromOtherMap { get; set; }
+    internal bool CantCompass { get; set; }
+    internal List<Vector2> AutoEvents { get; } = new();
+    internal List<string> EventPointersTransformPaths { get; } = new();
+}
\ No newline at end of file
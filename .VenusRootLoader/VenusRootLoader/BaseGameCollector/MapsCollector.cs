@@ -21,21 +21,13 @@ internal sealed class MapsCollector : IBaseGameCollector
 {
     private readonly string[] _mapNamedIds = Enum.GetNames(typeof(MainManager.Maps)).ToArray();
 
-    private readonly Dictionary<int, (string[] Names, string[] Data)> _mapsEntityData;
+    private readonly Dictionary<int, (TextAssetLines Names, TextAssetLines Data)> _mapsEntityData;
 
-    private readonly string[] _testRoomTextData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataTestRoomMapDialoguesPath);
+    private readonly TextAssetLines _testRoomTextData;
 
-    private readonly Dictionary<string, Dictionary<int, string[]>> _mapsDialogues = new();
+    private readonly Dictionary<string, Dictionary<int, TextAssetLines>> _mapsDialogues = new();
 
-    private readonly AssetsManager _assetsManager = new();
-    private readonly AssetsFileInstance _resourcesFileInstance;
-    private readonly Dictionary<int, AssetTypeValueField> _mapControlBaseFieldsByGameIds;
-    private readonly HashSet<int> _mapGameIdsWithHoleHazards;
-    private readonly string _assemblyCSharpFileName;
-    private readonly string _gameBundlePath;
-    private readonly string _gameManagedDirectoryPath;
-    private readonly string _classDataTpkPath;
+    private readonly MapsAssetsData _mapsAssetsData;
 
     private readonly GameExecutionContext _gameExecutionContext;
     private readonly BudLoaderContext _budLoaderContext;
@@ -59,6 +51,7 @@ internal sealed class MapsCollector : IBaseGameCollector
         IFileSystem fileSystem,
         ILogger<MapsCollector> logger,
         ILoggerFactory loggerFactory,
+        IBaseGameResources baseGameResources,
         ILeavesRegistry<MapLeaf> mapsRegistry,
         ILeavesRegistry<LanguageLeaf> languageRegistry,
         ILeavesRegistry<AreaLeaf> areasRegistry,
@@ -91,12 +84,10 @@ internal sealed class MapsCollector : IBaseGameCollector
             _mapsDialogues[mapName] = new();
             for (int i = 0; i < RootCollector.LanguageDisplayNames.Length; i++)
             {
-                string[] itemLanguageData = Resources
-                    .Load<TextAsset>(
-                        $"{ResourcesPaths.DataSlashDialogues}{i}/{ResourcesPaths.DataDialoguesLocalizedMapsDirectory}/{mapName}")
-                    .text
-                    .Split(StringUtils.NewlineSplitDelimiter);
-                _mapsDialogues[mapName].Add(i, itemLanguageData);
+                string itemLanguageText = baseGameResources.ReadTextAsset(
+                    $"{ResourcesPaths.DataSlashDialogues}{i}/" +
+                    $"{ResourcesPaths.DataDialoguesLocalizedMapsDirectory}/{mapName}");
+                _mapsDialogues[mapName].Add(i, new(itemLanguageText, trimLineEndings: false));
             }
         }
 
@@ -104,40 +95,70 @@ internal sealed class MapsCollector : IBaseGameCollector
             .ToDictionary(
                 x => x,
                 x => (
-                    RootCollector.ReadTextAssetLines($"{ResourcesPaths.DataMapEntitiesDirectory}/Names/{x}Names"),
-                    RootCollector.ReadTextAssetLines($"{ResourcesPaths.DataMapEntitiesDirectory}/{x}")));
-
-        _assemblyCSharpFileName = _fileSystem.Path.GetFileName(typeof(MapControl).Assembly.Location);
-        _gameBundlePath = _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "data.unity3d");
-        _gameManagedDirectoryPath = _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "Managed");
-        _classDataTpkPath = _fileSystem.Path.Combine(_budLoaderContext.LoaderPath, "classdata.tpk");
-
-        _assetsManager.UseQuickLookup = true;
-        _assetsManager.UseTemplateFieldCache = true;
-        _assetsManager.UseMonoTemplateFieldCache = true;
-        _assetsManager.UseRefTypeManagerCache = true;
-        _assetsManager.LoadClassPackage(_classDataTpkPath);
-        BundleFileInstance bundleInstance = _assetsManager.LoadBundleFile(_gameBundlePath);
-        _resourcesFileInstance = _assetsManager.LoadAssetsFileFromBundle(bundleInstance, "resources.assets");
+                    baseGameResources.ReadTextAssetLines($"{ResourcesPaths.DataMapEntitiesDirectory}/Names/{x}Names"),
+                    baseGameResources.ReadTextAssetLines($"{ResourcesPaths.DataMapEntitiesDirectory}/{x}")));
+        _testRoomTextData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataTestRoomMapDialoguesPath);
+
+        _mapsAssetsData = baseGameResources.GetOrCollectMapsAssetsData(CollectMapsAssetsDataFromGameBundle);
+    }
+
+    private MapsAssetsData CollectMapsAssetsDataFromGameBundle()
+    {
+        string assemblyCSharpFileName = _fileSystem.Path.GetFileName(typeof(MapControl).Assembly.Location);
+        string gameBundlePath = _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "data.unity3d");
+        string gameManagedDirectoryPath = _fileSystem.Path.Combine(_gameExecutionContext.DataDir, "Managed");
+        string classDataTpkPath = _fileSystem.Path.Combine(_budLoaderContext.LoaderPath, "classdata.tpk");
+
+        AssetsManager assetsManager = new();
+        assetsManager.UseQuickLookup = true;
+        assetsManager.UseTemplateFieldCache = true;
+        assetsManager.UseMonoTemplateFieldCache = true;
+        assetsManager.UseRefTypeManagerCache = true;
+        assetsManager.LoadClassPackage(classDataTpkPath);
+        BundleFileInstance bundleInstance = assetsManager.LoadBundleFile(gameBundlePath);
+        AssetsFileInstance resourcesFileInstance =
+            assetsManager.LoadAssetsFileFromBundle(bundleInstance, "resources.assets");
 
         AssetsFileInstance globalManagersFileInstance =
-            _assetsManager.LoadAssetsFileFromBundle(bundleInstance, "globalgamemanagers");
+            assetsManager.LoadAssetsFileFromBundle(bundleInstance, "globalgamemanagers");
         AssetsFile globalManagersFile = globalManagersFileInstance.file;
-        _assetsManager.LoadClassDatabaseFromPackage(globalManagersFile.Metadata.UnityVersion);
-        _assetsManager.MonoTempGenerator = new MonoCecilTempGenerator(_gameManagedDirectoryPath);
+        assetsManager.LoadClassDatabaseFromPackage(globalManagersFile.Metadata.UnityVersion);
+        assetsManager.MonoTempGenerator = new MonoCecilTempGenerator(gameManagedDirectoryPath);
 
-        _mapControlBaseFieldsByGameIds = CollectMapControlBaseFields();
-        _mapGameIdsWithHoleHazards = CollectMapGameIdWithHoldHazards();
+        Dictionary<int, AssetTypeValueField> mapControlBaseFieldsByGameIds =
+            CollectMapControlBaseFields(assetsManager, resourcesFileInstance, assemblyCSharpFileName);
+        HashSet<int> mapGameIdsWithHoleHazards =
+            CollectMapGameIdWithHoldHazards(assetsManager, resourcesFileInstance, assemblyCSharpFileName);
+
+        Dictionary<int, MapControlData> mapControlsByGameIds = new();
+        foreach (KeyValuePair<int, AssetTypeValueField> mapControlBaseField in mapControlBaseFieldsByGameIds)
+        {
+            mapControlsByGameIds[mapControlBaseField.Key] = ExtractMapControlData(
+                mapControlBaseField.Value,
+                assetsManager,
+                resourcesFileInstance,
+                mapControlBaseField.Key);
+        }
+
+        assetsManager.UnloadAll(true);
+        return new()
+        {
+            MapControlsByGameIds = mapControlsByGameIds,
+            MapGameIdsWithHoleHazards = mapGameIdsWithHoleHazards
+        };
     }
 
-    private Dictionary<int, AssetTypeValueField> CollectMapControlBaseFields()
+    private static Dictionary<int, AssetTypeValueField> CollectMapControlBaseFields(
+        AssetsManager assetsManager,
+        AssetsFileInstance resourcesFileInstance,
+        string assemblyCSharpFileName)
     {
         Dictionary<int, AssetTypeValueField> mapControlBaseFieldsByGameId = new();
-        AssetsFile resourcesFile = _resourcesFileInstance.file;
+        AssetsFile resourcesFile = resourcesFileInstance.file;
         Dictionary<int, AssetTypeReference> scriptInfos =
-            AssetHelper.GetAssetsFileScriptInfos(_assetsManager, _resourcesFileInstance);
+            AssetHelper.GetAssetsFileScriptInfos(assetsManager, resourcesFileInstance);
         int mapControlScriptIndex = scriptInfos
-            .Single(x => x.Value.AsmName == _assemblyCSharpFileName
+            .Single(x => x.Value.AsmName == assemblyCSharpFileName
                          && x.Value.Namespace == ""
                          && x.Value.ClassName == nameof(MapControl))
             .Key;
@@ -148,15 +169,15 @@ internal sealed class MapsCollector : IBaseGameCollector
                 continue;
 
             AssetTypeValueField mapControlBaseField =
-                _assetsManager.GetBaseField(_resourcesFileInstance, assetFileInfo);
+                assetsManager.GetBaseField(resourcesFileInstance, assetFileInfo);
             int mapGameId = mapControlBaseField[nameof(MapControl.mapid)].AsInt;
 
             if (mapControlBaseFieldsByGameId.ContainsKey(mapGameId))
             {
                 if (!TryGetBaseFieldFromReference(
                         mapControlBaseField["m_GameObject"],
-                        _resourcesFileInstance,
-                        _assetsManager,
+                        resourcesFileInstance,
+                        assetsManager,
                         out AssetTypeValueField? gameObjectBaseField))
                 {
                     continue;
@@ -178,14 +199,17 @@ internal sealed class MapsCollector : IBaseGameCollector
     // is of type Hole. Since the value would be overriden in base game, we want to instead override the value in advance
     // from the leaf to reflect the reality, but then remove the logic in a patcher so leaves are free to change it without
     // the game overriding it.
-    private HashSet<int> CollectMapGameIdWithHoldHazards()
+    private static HashSet<int> CollectMapGameIdWithHoldHazards(
+        AssetsManager assetsManager,
+        AssetsFileInstance resourcesFileInstance,
+        string assemblyCSharpFileName)
     {
         HashSet<int> mapGameIdsWithHoldHazards = new();
-        AssetsFile resourcesFile = _resourcesFileInstance.file;
+        AssetsFile resourcesFile = resourcesFileInstance.file;
         Dictionary<int, AssetTypeReference> scriptInfos =
-            AssetHelper.GetAssetsFileScriptInfos(_assetsManager, _resourcesFileInstance);
+            AssetHelper.GetAssetsFileScriptInfos(assetsManager, resourcesFileInstance);
         int mapControlScriptIndex = scriptInfos
-            .Single(x => x.Value.AsmName == _assemblyCSharpFileName
+            .Single(x => x.Value.AsmName == assemblyCSharpFileName
                          && x.Value.Namespace == ""
                          && x.Value.ClassName == nameof(Hazards))
             .Key;
@@ -196,15 +220,15 @@ internal sealed class MapsCollector : IBaseGameCollector
                 continue;
 
             AssetTypeValueField hazardsBaseField =
-                _assetsManager.GetBaseField(_resourcesFileInstance, assetFileInfo);
+                assetsManager.GetBaseField(resourcesFileInstance, assetFileInfo);
             int hazardsType = hazardsBaseField[nameof(Hazards.type)].AsInt;
             if (hazardsType != (int)Hazards.Type.Hole)
                 continue;
 
             if (!TryGetBaseFieldFromReference(
                     hazardsBaseField["m_GameObject"],
-                    _resourcesFileInstance,
-                    _assetsManager,
+                    resourcesFileInstance,
+                    assetsManager,
                     out AssetTypeValueField? hazardsGameObjectValueField))
             {
                 ThrowHelper.ThrowInvalidDataException("Can't find the GameObject of an Hazards");
@@ -213,8 +237,8 @@ internal sealed class MapsCollector : IBaseGameCollector
             AssetTypeValueField transformPair = hazardsGameObjectValueField["m_Component"][nameof(Array)][0];
             if (!TryGetBaseFieldFromReference(
                     transformPair["component"],
-                    _resourcesFileInstance,
-                    _assetsManager,
+                    resourcesFileInstance,
+                    assetsManager,
                     out AssetTypeValueField? transform))
             {
                 ThrowHelper.ThrowInvalidDataException("Can't find the Transform of an Hazards");
@@ -225,8 +249,8 @@ internal sealed class MapsCollector : IBaseGameCollector
             {
                 if (!TryGetBaseFieldFromReference(
                         transform["m_GameObject"],
-                        _resourcesFileInstance,
-                        _assetsManager,
+                        resourcesFileInstance,
+                        assetsManager,
                         out gameObject))
                 {
                     ThrowHelper.ThrowInvalidDataException("Can't find the GameObject of a Transform");
@@ -234,8 +258,8 @@ internal sealed class MapsCollector : IBaseGameCollector
 
                 TryGetBaseFieldFromReference(
                     transform["m_Father"],
-                    _resourcesFileInstance,
-                    _assetsManager,
+                    resourcesFileInstance,
+                    assetsManager,
                     out transform);
             }
 
@@ -246,11 +270,27 @@ internal sealed class MapsCollector : IBaseGameCollector
         return mapGameIdsWithHoldHazards;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+    [
+        typeof(LanguagesCollector),
+        typeof(EventCollector),
+        typeof(AnimIdsCollector),
+        typeof(ItemsCollector),
+        typeof(EnemiesCollector),
+        typeof(AreasCollector),
+        typeof(MedalsCollector),
+        typeof(GlobalFlagsCollector),
+        typeof(CrystalBerriesCollector),
+        typeof(CommonDialoguesCollector),
+        typeof(DiscoveriesCollector),
+        typeof(MusicsCollector),
+        typeof(MedalShopsCollector)
+    ];
+
+    public void RegisterBaseGameData()
     {
         for (int i = 0; i < _mapNamedIds.Length; i++)
         {
-            (string[] Names, string[] Data) mapEntityData = _mapsEntityData[i];
             MapLeaf mapLeaf = _mapsRegistry.RegisterExisting(i, _mapNamedIds[i]);
             mapLeaf.PrefabLoader = new AssetLoaderFromResources<GameObject>($"prefabs/maps/{mapLeaf.NamedId}");
             mapLeaf.EntitiesRegistry = new AutoSequentialIdBasedRegistry<MapEntityLeaf>(
@@ -260,6 +300,31 @@ internal sealed class MapsCollector : IBaseGameCollector
                 _loggerFactory.CreateLogger($"Maps.{mapLeaf.NamedId}_{nameof(MapLeaf.DialoguesRegistry)}"),
                 IdSequenceDirection.Increment);
 
+            int dialoguesAmount = i == 0
+                ? _testRoomTextData.Length
+                : _mapsDialogues[mapLeaf.NamedId].Values.Max(x => x.Length);
+            for (int j = 0; j < dialoguesAmount; j++)
+            {
+                MapDialogueLeaf mapDialogueLeaf =
+                    mapLeaf.DialoguesRegistry.RegisterExisting(j, j.ToString());
+                mapDialogueLeaf.Map = mapLeaf;
+            }
+        }
+
+        // Needs to be done here since we need all MapLeaf to be registered. It also loads the skybox materials from the
+        // resources which can only be done on the main thread.
+        foreach (MapLeaf mapLeaf in _mapsRegistry)
+            FillMapControlDataIntoMapLeaf(_mapsAssetsData.MapControlsByGameIds[mapLeaf.GameId], mapLeaf);
+
+        RootCollector.LogCollectedAmount(_logger, _mapsRegistry, _mapNamedIds.Length);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _mapNamedIds.Length; i++)
+        {
+            (TextAssetLines Names, TextAssetLines Data) mapEntityData = _mapsEntityData[i];
+            MapLeaf mapLeaf = _mapsRegistry.GetByGameId(i);
             for (int j = 0; j < mapEntityData.Data.Length; j++)
             {
                 string mapEntityText = mapEntityData.Data[j];
@@ -275,22 +340,13 @@ internal sealed class MapsCollector : IBaseGameCollector
             {
                 for (int j = 0; j < _testRoomTextData.Length; j++)
                 {
-                    MapDialogueLeaf mapDialogueLeaf =
-                        mapLeaf.DialoguesRegistry.RegisterExisting(j, j.ToString());
-                    mapDialogueLeaf.Map = mapLeaf;
+                    MapDialogueLeaf mapDialogueLeaf = mapLeaf.DialoguesRegistry.GetByGameId(j);
                     mapDialogueLeaf.LocalizedText[_languageRegistry.GetByGameId(0)] = _testRoomTextData[j];
                 }
 
                 continue;
             }
 
-            for (int j = 0; j < _mapsDialogues[mapLeaf.NamedId].Values.Max(x => x.Length); j++)
-            {
-                MapDialogueLeaf mapDialogueLeaf =
-                    mapLeaf.DialoguesRegistry.RegisterExisting(j, j.ToString());
-                mapDialogueLeaf.Map = mapLeaf;
-            }
-
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 for (int k = 0; k < _mapsDialogues[mapLeaf.NamedId][j].Length; k++)
@@ -319,17 +375,7 @@ internal sealed class MapsCollector : IBaseGameCollector
 
                 mapEntity.InitializeFromExisting();
             }
-
-            // Needs to be done here since we need all MapLeaf to be registered
-            FillMapControlDataIntoMapLeaf(
-                _mapControlBaseFieldsByGameIds[mapLeaf.GameId],
-                _assetsManager,
-                _resourcesFileInstance,
-                mapLeaf);
         }
-
-        _assetsManager.UnloadAll(true);
-        RootCollector.LogCollectedAmount(_logger, _mapsRegistry, _mapNamedIds.Length);
     }
 
     private static bool TryGetBaseFieldFromReference(
@@ -353,111 +399,78 @@ internal sealed class MapsCollector : IBaseGameCollector
         return true;
     }
 
-    private void FillMapControlDataIntoMapLeaf(
+    private static MapControlData ExtractMapControlData(
         AssetTypeValueField mapControlBaseField,
         AssetsManager manager,
         AssetsFileInstance resourcesFileInstance,
-        MapLeaf mapLeaf)
+        int mapGameId)
     {
-        int areaGameId = mapControlBaseField[nameof(MapControl.areaid)].AsInt;
-
-        mapLeaf.Area = _areasRegistry.GetByGameId(areaGameId);
-
-        mapLeaf.DefaultCameraPositionOffsetFromTargetOverride =
-            ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camoffset)]);
-        mapLeaf.DefaultCameraAnglesOffsetFromTargetOverride =
-            ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camangle)]);
-        mapLeaf.DefaultCameraLowerBounds =
-            ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camlimitneg)]);
-        mapLeaf.DefaultCameraUpperBounds =
-            ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camlimitpos)]);
-        if (mapControlBaseField[nameof(MapControl.rotatecam)].AsBool)
+        string mapNamedId = ((MainManager.Maps)mapGameId).ToString();
+        MapControlData mapControlData = new()
         {
-            mapLeaf.CameraMoveAroundCircleConfiguration = new()
-            {
-                InitialCircleCenter =
-                    ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.centralpoint)]),
-                CameraFollowsTargetInYAxis = mapControlBaseField[nameof(MapControl.tieYtoplayer)].AsBool,
-                CameraMaxRadiusFromCenterPointAllowed = mapControlBaseField[nameof(MapControl.tetherdistance)].AsFloat
-            };
-        }
+            AreaId = mapControlBaseField[nameof(MapControl.areaid)].AsInt,
+            CamOffset = ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camoffset)]),
+            CamAngle = ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camangle)]),
+            CamLimitNeg = ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camlimitneg)]),
+            CamLimitPos = ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.camlimitpos)]),
+            RotateCam = mapControlBaseField[nameof(MapControl.rotatecam)].AsBool,
+            CentralPoint = ExtractVector3FromAssetValueField(mapControlBaseField[nameof(MapControl.centralpoint)]),
+            TieYToPlayer = mapControlBaseField[nameof(MapControl.tieYtoplayer)].AsBool,
+            TetherDistance = mapControlBaseField[nameof(MapControl.tetherdistance)].AsFloat,
+            FogEnd = mapControlBaseField[nameof(MapControl.fogend)].AsFloat,
+            FogColor = ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.fogcolor)]),
+            ScreenEffect = mapControlBaseField[nameof(MapControl.screeneffect)].AsInt,
+            GlobalLight = ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.globallight)]),
+            WindIntensity = mapControlBaseField[nameof(MapControl.windintensity)].AsFloat,
+            FaderChange = mapControlBaseField[nameof(MapControl.faderchange)].AsBool,
+            SkyColor = ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.skycolor)]),
+            BattleMap = mapControlBaseField[nameof(MapControl.battlemap)].AsInt,
+            BattleLeafType = mapControlBaseField[nameof(MapControl.battleleaftype)].AsInt,
+            ExpMulti = mapControlBaseField[nameof(MapControl.expmulti)].AsFloat,
+            BattleLeafColor = ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.battleleafcolor)]),
+            NoBattleMusic = mapControlBaseField[nameof(MapControl.nobattlemusic)].AsBool,
+            KeepMusic = mapControlBaseField[nameof(MapControl.keepmusic)].AsBool,
+            TieInsideDoorEntities = mapControlBaseField[nameof(MapControl.tieinsidedoorentities)].AsBool,
+            HideInsides = mapControlBaseField[nameof(MapControl.hideinsides)].AsBool,
+            SetInsideCenter = mapControlBaseField[nameof(MapControl.setinsidecenter)].AsBool,
+            FadingSpeed = mapControlBaseField[nameof(MapControl.fadingspeed)].AsFloat,
+            TattleId = mapControlBaseField[nameof(MapControl.tattleid)].AsInt,
+            FollowerYLimit = mapControlBaseField[nameof(MapControl.followerylimit)].AsFloat,
+            YLimit = mapControlBaseField[nameof(MapControl.ylimit)].AsFloat,
+            IceMap = mapControlBaseField[nameof(MapControl.icemap)].AsBool,
+            LimitBehavior = mapControlBaseField[nameof(MapControl.limitbehavior)].AsBool,
+            KeepObjectsActive = mapControlBaseField[nameof(MapControl.keepobjectsactive)].AsBool,
+            ReadDataFromOtherMap = mapControlBaseField[nameof(MapControl.readdatafromothermap)].AsInt,
+            CantCompass = mapControlBaseField[nameof(MapControl.cantcompass)].AsBool
+        };
 
-        mapLeaf.InitialFogEndDistance = mapControlBaseField[nameof(MapControl.fogend)].AsFloat;
-        mapLeaf.InitialFogColor = ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.fogcolor)]);
-        mapLeaf.HasSunRaysTopRightScreenEffect = mapControlBaseField[nameof(MapControl.screeneffect)].AsInt ==
-                                                 (int)MapControl.ScreenEffects.SunRaysTopRight;
-        AssetTypeValueField skyboxMatRef = mapControlBaseField[nameof(MapControl.skyboxmat)];
         if (TryGetBaseFieldFromReference(
-                skyboxMatRef,
+                mapControlBaseField[nameof(MapControl.skyboxmat)],
                 resourcesFileInstance,
                 manager,
                 out AssetTypeValueField? skyboxMaterialBaseField))
         {
-            string skyboxMaterialName = skyboxMaterialBaseField["m_Name"].AsString;
-            mapLeaf.SkyboxMaterial = Resources.Load<Material>($"Materials/Skybox/{skyboxMaterialName}");
+            mapControlData.SkyboxMaterialName = skyboxMaterialBaseField["m_Name"].AsString;
         }
 
-        mapLeaf.InitialAmbientLightColor =
-            ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.globallight)]);
-        mapLeaf.WindIntensity = mapControlBaseField[nameof(MapControl.windintensity)].AsFloat;
-        mapLeaf.ForceAllFadersToFadeInsteadOfCulling = mapControlBaseField[nameof(MapControl.faderchange)].AsBool;
-        mapLeaf.AllFadersFadingTint = ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.skycolor)]);
-
-        mapLeaf.DefaultBattleMap = (MainManager.BattleMaps)mapControlBaseField[nameof(MapControl.battlemap)].AsInt;
-        mapLeaf.BattleTransition =
-            (MapControl.BattleLeafType)mapControlBaseField[nameof(MapControl.battleleaftype)].AsInt;
-        mapLeaf.ExpMultiplier = mapControlBaseField[nameof(MapControl.expmulti)].AsFloat;
-        mapLeaf.DefaultBattleTransitionLeavesColor =
-            ExtractColorFromAssetValueField(mapControlBaseField[nameof(MapControl.battleleafcolor)]);
-        mapLeaf.DisableMusicChangeWhenEnteringBattle = mapControlBaseField[nameof(MapControl.nobattlemusic)].AsBool;
-
-        List<MapMusic> orderedMapMusics = new();
         AssetTypeValueField musicAudioClipsArray = mapControlBaseField[nameof(MapControl.music)][nameof(Array)];
         for (int i = 0; i < musicAudioClipsArray.AsArray.size; i++)
         {
-            AssetTypeValueField audioClipValueField = musicAudioClipsArray[i];
-            if (!TryGetBaseFieldFromReference(
-                    audioClipValueField,
+            mapControlData.MusicNames.Add(
+                TryGetBaseFieldFromReference(
+                    musicAudioClipsArray[i],
                     resourcesFileInstance,
                     manager,
-                    out AssetTypeValueField? audioClipBaseField))
-            {
-                MapMusic silenceMapMusic = mapLeaf.AddMusicToMap(null);
-                orderedMapMusics.Add(silenceMapMusic);
-                continue;
-            }
-
-            string audioClipName = audioClipBaseField["m_Name"].AsString;
-            MusicLeaf musicLeaf = _musicsRegistry.GetByEffectiveId(audioClipName);
-            MapMusic mapMusic = mapLeaf.AddMusicToMap(musicLeaf);
-            orderedMapMusics.Add(mapMusic);
+                    out AssetTypeValueField? audioClipBaseField)
+                    ? audioClipBaseField["m_Name"].AsString
+                    : null);
         }
 
-        if (mapLeaf.MusicsAvailable.Count == 0)
-        {
-            MapMusic silenceMapMusic = mapLeaf.AddMusicToMap(null);
-            orderedMapMusics.Add(silenceMapMusic);
-        }
-
-        mapLeaf.KeepsExistingMusicPlayingOnLoad = mapControlBaseField[nameof(MapControl.keepmusic)].AsBool;
         AssetTypeValueField musicFlagsArray = mapControlBaseField[nameof(MapControl.musicflags)][nameof(Array)];
         foreach (AssetTypeValueField musicFlagValueField in musicFlagsArray)
-        {
-            Vector2Int musicFlagValue = ExtractVector2IntFromAssetValueField(musicFlagValueField);
-            FlagLeaf? flagLeaf = musicFlagValue.x >= 0
-                ? _flagsRegistry.GetByGameId(musicFlagValue.x)
-                : null;
-            MapMusic mapMusic = orderedMapMusics[musicFlagValue.y];
-            mapLeaf.MusicSelectionConditions.Add(
-                new()
-                {
-                    RequiredFlag = flagLeaf is null ? null : new(flagLeaf),
-                    MapMusic = mapMusic
-                });
-        }
+            mapControlData.MusicFlags.Add(ExtractVector2IntFromAssetValueField(musicFlagValueField));
 
         AssetTypeValueField insidesArray = mapControlBaseField[nameof(MapControl.insides)][nameof(Array)];
-        AssetTypeValueField insideTypesArray = mapControlBaseField[nameof(MapControl.insidetypes)][nameof(Array)];
         for (int i = 0; i < insidesArray.AsArray.size; i++)
         {
             AssetTypeValueField insideValueField = insidesArray[i];
@@ -468,7 +481,7 @@ internal sealed class MapsCollector : IBaseGameCollector
                     out AssetTypeValueField? insideGameObjectBaseField))
             {
                 ThrowHelper.ThrowInvalidDataException(
-                    $"Can't find the GameObject of an inside, map: {mapLeaf.NamedId}, index: {i}");
+                    $"Can't find the GameObject of an inside, map: {mapNamedId}, index: {i}");
             }
 
             if (!TryGetBaseFieldFromReference(
@@ -478,62 +491,24 @@ internal sealed class MapsCollector : IBaseGameCollector
                     out AssetTypeValueField? insideTransformBaseField))
             {
                 ThrowHelper.ThrowInvalidDataException(
-                    $"Can't find the Transform of an inside's GameObject, map: {mapLeaf.NamedId}, index: {i}");
+                    $"Can't find the Transform of an inside's GameObject, map: {mapNamedId}, index: {i}");
             }
 
-            string transformPath = GetTransformPathFromRoot(
-                insideTransformBaseField,
-                resourcesFileInstance,
-                manager,
-                new());
-            MapControl.InsideType insideType = i < insideTypesArray.AsArray.size
-                ? (MapControl.InsideType)insideTypesArray[i].AsInt
-                : MapControl.InsideType.Stretch;
-
-            mapLeaf.Insides.Add(
-                new()
-                {
-                    GameObjectPathInPrefab = transformPath,
-                    TransitionWhenEnteringOrExiting = insideType
-                });
+            mapControlData.InsidesTransformPaths.Add(
+                GetTransformPathFromRoot(
+                    insideTransformBaseField,
+                    resourcesFileInstance,
+                    manager,
+                    new()));
         }
 
-        mapLeaf.ForceRestoreCameraWhenExitingAnyInsideTransitionZone =
-            mapControlBaseField[nameof(MapControl.tieinsidedoorentities)].AsBool;
-        mapLeaf.DisablesInsideWhenCurrentInsideIsDifferent = mapControlBaseField[nameof(MapControl.hideinsides)].AsBool;
-        mapLeaf.SetCameraTargetToCurrentInsideWhileInside =
-            mapControlBaseField[nameof(MapControl.setinsidecenter)].AsBool;
-        mapLeaf.FadingSpeedWhenEnteringOrExitingAnInside = mapControlBaseField[nameof(MapControl.fadingspeed)].AsFloat;
-
-        int dialogueGameId = mapControlBaseField[nameof(MapControl.tattleid)].AsInt;
-        DialogueLeaf spyDialogue = dialogueGameId < 0
-            ? _commonDialoguesRegistry.GetByGameId(dialogueGameId)
-            : mapLeaf.DialoguesRegistry.GetByGameId(dialogueGameId);
-        mapLeaf.SpyDialogue = spyDialogue;
+        AssetTypeValueField insideTypesArray = mapControlBaseField[nameof(MapControl.insidetypes)][nameof(Array)];
+        foreach (AssetTypeValueField insideTypeValueField in insideTypesArray)
+            mapControlData.InsideTypes.Add(insideTypeValueField.AsInt);
 
         AssetTypeValueField canFollowIdsArray = mapControlBaseField[nameof(MapControl.canfollowID)][nameof(Array)];
         foreach (AssetTypeValueField followerValueField in canFollowIdsArray)
-        {
-            AnimIdLeaf animIdLeaf = _animIdsRegistry.GetByGameId(followerValueField.AsInt);
-            mapLeaf.FollowerAnimIdsAllowed.Add(animIdLeaf);
-        }
-
-        mapLeaf.MaximumYFollowerDistanceBeforeTeleport = mapControlBaseField[nameof(MapControl.followerylimit)].AsFloat;
-
-        if (_mapGameIdsWithHoleHazards.Contains(mapLeaf.GameId))
-        {
-            mapLeaf.AllEntitiesYPositionLowerBoundLimitBeforeRespawn = -150f;
-        }
-        else
-        {
-            mapLeaf.AllEntitiesYPositionLowerBoundLimitBeforeRespawn =
-                mapControlBaseField[nameof(MapControl.ylimit)].AsFloat;
-        }
-
-        mapLeaf.IsFrozenMap = mapControlBaseField[nameof(MapControl.icemap)].AsBool;
-        mapLeaf.MapEntitiesHaveRestrictedActiveRange = mapControlBaseField[nameof(MapControl.limitbehavior)].AsBool;
-        mapLeaf.MapEntitiesAndEmoticonsAreActiveWhenOutOfRange =
-            mapControlBaseField[nameof(MapControl.keepobjectsactive)].AsBool;
+            mapControlData.CanFollowIds.Add(followerValueField.AsInt);
 
         if (TryGetBaseFieldFromReference(
                 mapControlBaseField[nameof(MapControl.mainmesh)],
@@ -541,39 +516,22 @@ internal sealed class MapsCollector : IBaseGameCollector
                 manager,
                 out AssetTypeValueField? mainMeshBaseField))
         {
-            mapLeaf.MainMapTransformOverridePrefabPath = GetMapMainMeshTransformPathFromRoot(
+            mapControlData.MainMeshTransformPath = GetMapMainMeshTransformPathFromRoot(
                 mainMeshBaseField,
                 resourcesFileInstance,
                 manager,
-                mapLeaf,
+                mapGameId,
+                mapNamedId,
                 new());
         }
 
         AssetTypeValueField discoveryIdsArray = mapControlBaseField[nameof(MapControl.discoveryids)][nameof(Array)];
         foreach (AssetTypeValueField discoveryValueField in discoveryIdsArray)
-        {
-            DiscoveryLeaf discoveryLeaf = _discoveriesRegistry.GetByGameId(discoveryValueField.AsInt);
-            mapLeaf.DetectableDiscoveriesByDetectorMedal.Add(discoveryLeaf);
-        }
-
-        int readFromOtherMapGameId = mapControlBaseField[nameof(MapControl.readdatafromothermap)].AsInt;
-        if (readFromOtherMapGameId > 0)
-            mapLeaf.MapWhoProvidesEntitiesAndDialogues = _mapsRegistry.GetByGameId(readFromOtherMapGameId);
-        mapLeaf.DisallowAntCompassUsage = mapControlBaseField[nameof(MapControl.cantcompass)].AsBool;
+            mapControlData.DiscoveryIds.Add(discoveryValueField.AsInt);
 
         AssetTypeValueField autoEventsArray = mapControlBaseField[nameof(MapControl.autoevent)][nameof(Array)];
         foreach (AssetTypeValueField autoEventValueField in autoEventsArray)
-        {
-            Vector2 autoEvent = ExtractVector2FromAssetValueField(autoEventValueField);
-            FlagLeaf flagLeaf = _flagsRegistry.GetByGameId((int)autoEvent.x);
-            EventLeaf eventLeaf = _eventsRegistry.GetByGameId((int)autoEvent.y);
-            mapLeaf.AutomaticallyTriggeredEventsAfterLoad.Add(
-                new()
-                {
-                    AlreadyTriggeredFlag = flagLeaf,
-                    EventToTriggerWhenFlagIsFalse = eventLeaf
-                });
-        }
+            mapControlData.AutoEvents.Add(ExtractVector2FromAssetValueField(autoEventValueField));
 
         AssetTypeValueField eventPointersArray = mapControlBaseField[nameof(MapControl.eventPointers)][nameof(Array)];
         for (int i = 0; i < eventPointersArray.AsArray.size; i++)
@@ -586,7 +544,7 @@ internal sealed class MapsCollector : IBaseGameCollector
                     out AssetTypeValueField? eventPointerGameObjectBaseField))
             {
                 ThrowHelper.ThrowInvalidDataException(
-                    $"Can't find the GameObject of an event pointer, map: {mapLeaf.NamedId}, index: {i}");
+                    $"Can't find the GameObject of an event pointer, map: {mapNamedId}, index: {i}");
             }
 
             if (!TryGetBaseFieldFromReference(
@@ -596,16 +554,154 @@ internal sealed class MapsCollector : IBaseGameCollector
                     out AssetTypeValueField? eventPointerTransformBaseField))
             {
                 ThrowHelper.ThrowInvalidDataException(
-                    $"Can't find the Transform of an event pointer's GameObject, map: {mapLeaf.NamedId}, index: {i}");
+                    $"Can't find the Transform of an event pointer's GameObject, map: {mapNamedId}, index: {i}");
             }
 
-            string transformPath = GetTransformPathFromRoot(
-                eventPointerTransformBaseField,
-                resourcesFileInstance,
-                manager,
-                new());
-            mapLeaf.EventsGameObjectPrefabPaths.Add(transformPath);
+            mapControlData.EventPointersTransformPaths.Add(
+                GetTransformPathFromRoot(
+                    eventPointerTransformBaseField,
+                    resourcesFileInstance,
+                    manager,
+                    new()));
         }
+
+        return mapControlData;
+    }
+
+    private void FillMapControlDataIntoMapLeaf(MapControlData mapControlData, MapLeaf mapLeaf)
+    {
+        mapLeaf.Area = _areasRegistry.GetByGameId(mapControlData.AreaId);
+
+        mapLeaf.DefaultCameraPositionOffsetFromTargetOverride = mapControlData.CamOffset;
+        mapLeaf.DefaultCameraAnglesOffsetFromTargetOverride = mapControlData.CamAngle;
+        mapLeaf.DefaultCameraLowerBounds = mapControlData.CamLimitNeg;
+        mapLeaf.DefaultCameraUpperBounds = mapControlData.CamLimitPos;
+        if (mapControlData.RotateCam)
+        {
+            mapLeaf.CameraMoveAroundCircleConfiguration = new()
+            {
+                InitialCircleCenter = mapControlData.CentralPoint,
+                CameraFollowsTargetInYAxis = mapControlData.TieYToPlayer,
+                CameraMaxRadiusFromCenterPointAllowed = mapControlData.TetherDistance
+            };
+        }
+
+        mapLeaf.InitialFogEndDistance = mapControlData.FogEnd;
+        mapLeaf.InitialFogColor = mapControlData.FogColor;
+        mapLeaf.HasSunRaysTopRightScreenEffect =
+            mapControlData.ScreenEffect == (int)MapControl.ScreenEffects.SunRaysTopRight;
+        if (mapControlData.SkyboxMaterialName is not null)
+            mapLeaf.SkyboxMaterial = Resources.Load<Material>($"Materials/Skybox/{mapControlData.SkyboxMaterialName}");
+
+        mapLeaf.InitialAmbientLightColor = mapControlData.GlobalLight;
+        mapLeaf.WindIntensity = mapControlData.WindIntensity;
+        mapLeaf.ForceAllFadersToFadeInsteadOfCulling = mapControlData.FaderChange;
+        mapLeaf.AllFadersFadingTint = mapControlData.SkyColor;
+
+        mapLeaf.DefaultBattleMap = (MainManager.BattleMaps)mapControlData.BattleMap;
+        mapLeaf.BattleTransition = (MapControl.BattleLeafType)mapControlData.BattleLeafType;
+        mapLeaf.ExpMultiplier = mapControlData.ExpMulti;
+        mapLeaf.DefaultBattleTransitionLeavesColor = mapControlData.BattleLeafColor;
+        mapLeaf.DisableMusicChangeWhenEnteringBattle = mapControlData.NoBattleMusic;
+
+        List<MapMusic> orderedMapMusics = new();
+        foreach (string? audioClipName in mapControlData.MusicNames)
+        {
+            MusicLeaf? musicLeaf = audioClipName is null ? null : _musicsRegistry.GetByEffectiveId(audioClipName);
+            MapMusic mapMusic = mapLeaf.AddMusicToMap(musicLeaf);
+            orderedMapMusics.Add(mapMusic);
+        }
+
+        if (mapLeaf.MusicsAvailable.Count == 0)
+        {
+            MapMusic silenceMapMusic = mapLeaf.AddMusicToMap(null);
+            orderedMapMusics.Add(silenceMapMusic);
+        }
+
+        mapLeaf.KeepsExistingMusicPlayingOnLoad = mapControlData.KeepMusic;
+        foreach (Vector2Int musicFlagValue in mapControlData.MusicFlags)
+        {
+            FlagLeaf? flagLeaf = musicFlagValue.x >= 0
+                ? _flagsRegistry.GetByGameId(musicFlagValue.x)
+                : null;
+            MapMusic mapMusic = orderedMapMusics[musicFlagValue.y];
+            mapLeaf.MusicSelectionConditions.Add(
+                new()
+                {
+                    RequiredFlag = flagLeaf is null ? null : new(flagLeaf),
+                    MapMusic = mapMusic
+                });
+        }
+
+        for (int i = 0; i < mapControlData.InsidesTransformPaths.Count; i++)
+        {
+            MapControl.InsideType insideType = i < mapControlData.InsideTypes.Count
+                ? (MapControl.InsideType)mapControlData.InsideTypes[i]
+                : MapControl.InsideType.Stretch;
+
+            mapLeaf.Insides.Add(
+                new()
+                {
+                    GameObjectPathInPrefab = mapControlData.InsidesTransformPaths[i],
+                    TransitionWhenEnteringOrExiting = insideType
+                });
+        }
+
+        mapLeaf.ForceRestoreCameraWhenExitingAnyInsideTransitionZone = mapControlData.TieInsideDoorEntities;
+        mapLeaf.DisablesInsideWhenCurrentInsideIsDifferent = mapControlData.HideInsides;
+        mapLeaf.SetCameraTargetToCurrentInsideWhileInside = mapControlData.SetInsideCenter;
+        mapLeaf.FadingSpeedWhenEnteringOrExitingAnInside = mapControlData.FadingSpeed;
+
+        int dialogueGameId = mapControlData.TattleId;
+        DialogueLeaf spyDialogue = dialogueGameId < 0
+            ? _commonDialoguesRegistry.GetByGameId(dialogueGameId)
+            : mapLeaf.DialoguesRegistry.GetByGameId(dialogueGameId);
+        mapLeaf.SpyDialogue = spyDialogue;
+
+        foreach (int followerAnimId in mapControlData.CanFollowIds)
+        {
+            AnimIdLeaf animIdLeaf = _animIdsRegistry.GetByGameId(followerAnimId);
+            mapLeaf.FollowerAnimIdsAllowed.Add(animIdLeaf);
+        }
+
+        mapLeaf.MaximumYFollowerDistanceBeforeTeleport = mapControlData.FollowerYLimit;
+
+        mapLeaf.AllEntitiesYPositionLowerBoundLimitBeforeRespawn =
+            _mapsAssetsData.MapGameIdsWithHoleHazards.Contains(mapLeaf.GameId)
+                ? -150f
+                : mapControlData.YLimit;
+
+        mapLeaf.IsFrozenMap = mapControlData.IceMap;
+        mapLeaf.MapEntitiesHaveRestrictedActiveRange = mapControlData.LimitBehavior;
+        mapLeaf.MapEntitiesAndEmoticonsAreActiveWhenOutOfRange = mapControlData.KeepObjectsActive;
+
+        if (mapControlData.MainMeshTransformPath is not null)
+            mapLeaf.MainMapTransformOverridePrefabPath = mapControlData.MainMeshTransformPath;
+
+        foreach (int discoveryGameId in mapControlData.DiscoveryIds)
+        {
+            DiscoveryLeaf discoveryLeaf = _discoveriesRegistry.GetByGameId(discoveryGameId);
+            mapLeaf.DetectableDiscoveriesByDetectorMedal.Add(discoveryLeaf);
+        }
+
+        int readFromOtherMapGameId = mapControlData.ReadDataFromOtherMap;
+        if (readFromOtherMapGameId > 0)
+            mapLeaf.MapWhoProvidesEntitiesAndDialogues = _mapsRegistry.GetByGameId(readFromOtherMapGameId);
+        mapLeaf.DisallowAntCompassUsage = mapControlData.CantCompass;
+
+        foreach (Vector2 autoEvent in mapControlData.AutoEvents)
+        {
+            FlagLeaf flagLeaf = _flagsRegistry.GetByGameId((int)autoEvent.x);
+            EventLeaf eventLeaf = _eventsRegistry.GetByGameId((int)autoEvent.y);
+            mapLeaf.AutomaticallyTriggeredEventsAfterLoad.Add(
+                new()
+                {
+                    AlreadyTriggeredFlag = flagLeaf,
+                    EventToTriggerWhenFlagIsFalse = eventLeaf
+                });
+        }
+
+        mapLeaf.EventsGameObjectPrefabPaths.AddRange(mapControlData.EventPointersTransformPaths);
     }
 
     private static string GetTransformPathFromRoot(
@@ -648,7 +744,8 @@ internal sealed class MapsCollector : IBaseGameCollector
         AssetTypeValueField transformBaseField,
         AssetsFileInstance resourcesFileInstance,
         AssetsManager manager,
-        MapLeaf mapLeaf,
+        int mapGameId,
+        string mapNamedId,
         Stack<string> pathPartsStack)
     {
         if (!TryGetBaseFieldFromReference(
@@ -661,9 +758,9 @@ internal sealed class MapsCollector : IBaseGameCollector
         }
 
         string name = gameObjectBaseField["m_Name"].AsString;
-        if (name == mapLeaf.NamedId)
+        if (name == mapNamedId)
             return "";
-        if (mapLeaf.GameId != (int)MainManager.Maps.BugariaCommercial)
+        if (mapGameId != (int)MainManager.Maps.BugariaCommercial)
             return $"{name}";
 
         if (TryGetBaseFieldFromReference(
@@ -15,8 +15,7 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class MedalFortuneTellerHintCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _medalFortuneTellerHintsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedMedalFortuneTellerHintsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _medalFortuneTellerHintsLanguageData;
 
     private readonly ILogger<MedalFortuneTellerHintCollector> _logger;
     private readonly IAssemblyCSharpDataCollector _assemblyCSharpDataCollector;
@@ -25,6 +24,7 @@ internal sealed class MedalFortuneTellerHintCollector : IBaseGameCollector
     private readonly ILeavesRegistry<FlagLeaf> _flagsRegistry;
 
     public MedalFortuneTellerHintCollector(
+        IBaseGameResources baseGameResources,
         ILogger<MedalFortuneTellerHintCollector> logger,
         IAssemblyCSharpDataCollector assemblyCSharpDataCollector,
         ILocalizedTextAssetParser<MedalFortuneTellerHintLeaf> localizedTextAssetParser,
@@ -36,9 +36,14 @@ internal sealed class MedalFortuneTellerHintCollector : IBaseGameCollector
         _localizedTextAssetParser = localizedTextAssetParser;
         _medalFortuneTellerHintsRegistry = medalFortuneTellerHintsRegistry;
         _flagsRegistry = flagsRegistry;
+
+        _medalFortuneTellerHintsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedMedalFortuneTellerHintsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
     {
         int[] flags = CollectMedalObtainedFlagGameIds();
 
@@ -48,6 +53,17 @@ internal sealed class MedalFortuneTellerHintCollector : IBaseGameCollector
             MedalFortuneTellerHintLeaf medalFortuneTellerHintLeaf =
                 _medalFortuneTellerHintsRegistry.RegisterExisting(i, i.ToString());
             medalFortuneTellerHintLeaf.MedalObtainedFlag = _flagsRegistry.GetByGameId(flags[i]);
+        }
+
+        RootCollector.LogCollectedAmount(_logger, _medalFortuneTellerHintsRegistry, medalFortuneTellerHintsAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        int medalFortuneTellerHintsAmount = _medalFortuneTellerHintsLanguageData.Values.First().Length;
+        for (int i = 0; i < medalFortuneTellerHintsAmount; i++)
+        {
+            MedalFortuneTellerHintLeaf medalFortuneTellerHintLeaf = _medalFortuneTellerHintsRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _localizedTextAssetParser.FromTextAssetSerializedString(
@@ -57,8 +73,6 @@ internal sealed class MedalFortuneTellerHintCollector : IBaseGameCollector
                     medalFortuneTellerHintLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _medalFortuneTellerHintsRegistry, medalFortuneTellerHintsAmount);
     }
 
     // The flags are hardcoded in an array in event 71 (Fortune Teller event).
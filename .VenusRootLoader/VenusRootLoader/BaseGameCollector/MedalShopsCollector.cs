@@ -33,7 +33,9 @@ internal sealed class MedalShopsCollector : IBaseGameCollector
         _assemblyCSharpDataCollector = assemblyCSharpDataCollector;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         int medalShopsAmount = CollectMedalShopsAmount();
         List<List<Branch<MedalLeaf>>> medalShopsStartingStock = CollectMedalShopsStartingStock(medalShopsAmount);
@@ -50,6 +52,10 @@ internal sealed class MedalShopsCollector : IBaseGameCollector
         RootCollector.LogCollectedAmount(_logger, _medalShopsRegistry, medalShopsAmount);
     }
 
+    public void ParseBaseGameData()
+    {
+    }
+
     private static int CollectMedalShopsAmount()
     {
         int medalShopsAmount = 0;
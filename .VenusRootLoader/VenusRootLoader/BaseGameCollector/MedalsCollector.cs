@@ -20,13 +20,9 @@ internal sealed class MedalsCollector : IBaseGameCollector
     private const string SpritesItemsItems1ResourcesPath =
         $"{ResourcesPaths.RootSpritesPathPrefix}{ResourcesPaths.SpritesItems1Path}";
 
-    private readonly string[] _medalsData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataMedalsPath);
-
-    private readonly string _medalsOrderingData =
-        RootCollector.ReadWholeTextAsset(ResourcesPaths.DataMedalsOrderingPath);
-
-    private readonly Dictionary<int, string[]> _medalsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedMedalPathSuffix);
+    private readonly TextAssetLines _medalsData;
+    private readonly string _medalsOrderingData;
+    private readonly Dictionary<int, TextAssetLines> _medalsLanguageData;
 
     private readonly string[] _badgeNamedIds = Enum.GetNames(typeof(MainManager.BadgeTypes)).ToArray();
 
@@ -38,6 +34,7 @@ internal sealed class MedalsCollector : IBaseGameCollector
     private readonly ILocalizedTextAssetParser<MedalLeaf> _medalLanguageDataSerializer;
 
     public MedalsCollector(
+        IBaseGameResources baseGameResources,
         IOrderedLeavesRegistry<MedalLeaf> orderedRegistry,
         ILeavesRegistry<LanguageLeaf> languageRegistry,
         ILogger<MedalsCollector> logger,
@@ -51,14 +48,28 @@ internal sealed class MedalsCollector : IBaseGameCollector
         _medalOrderingDataSerializer = medalOrderingDataSerializer;
         _medalLanguageDataSerializer = medalLanguageDataSerializer;
         _languageRegistry = languageRegistry;
+
+        _medalsData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataMedalsPath);
+        _medalsOrderingData = baseGameResources.ReadWholeTextAsset(ResourcesPaths.DataMedalsOrderingPath);
+        _medalsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedMedalPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        for (int i = 0; i < _badgeNamedIds.Length; i++)
+            _orderedRegistry.RegisterExistingWithOrdering(i, _badgeNamedIds[i]);
+
+        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, _badgeNamedIds.Length);
+    }
+
+    public void ParseBaseGameData()
     {
         for (int i = 0; i < _badgeNamedIds.Length; i++)
         {
-            string medalNamedId = _badgeNamedIds[i];
-            MedalLeaf medalLeaf = _orderedRegistry.RegisterExistingWithOrdering(i, medalNamedId);
+            MedalLeaf medalLeaf = _orderedRegistry.Registry.GetByGameId(i);
             _medalDataSerializer.FromTextAssetSerializedString(
                 ResourcesPaths.DataMedalsPath,
                 _medalsData[i],
@@ -80,6 +91,5 @@ internal sealed class MedalsCollector : IBaseGameCollector
         }
 
         _medalOrderingDataSerializer.FromTextAssetString(_medalsOrderingData, _orderedRegistry);
-        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, _badgeNamedIds.Length);
     }
 }
\ No newline at end of file
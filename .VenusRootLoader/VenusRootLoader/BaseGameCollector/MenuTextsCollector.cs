@@ -8,14 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class MenuTextsCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _menuTextsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedMenuTextsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _menuTextsLanguageData;
 
     private readonly ILogger<MenuTextsCollector> _logger;
     private readonly ILeavesRegistry<MenuTextLeaf> _menuTextsRegistry;
     private readonly ILocalizedTextAssetParser<MenuTextLeaf> _menuTextLanguageDataSerializer;
 
     public MenuTextsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<MenuTextsCollector> logger,
         ILocalizedTextAssetParser<MenuTextLeaf> menuTextLanguageDataSerializer,
         ILeavesRegistry<MenuTextLeaf> menuTextsRegistry)
@@ -23,14 +23,28 @@ internal sealed class MenuTextsCollector : IBaseGameCollector
         _logger = logger;
         _menuTextLanguageDataSerializer = menuTextLanguageDataSerializer;
         _menuTextsRegistry = menuTextsRegistry;
+
+        _menuTextsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedMenuTextsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        int menuTextsAmount = _menuTextsLanguageData.Values.First().Length;
+        for (int i = 0; i < menuTextsAmount; i++)
+            _menuTextsRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _menuTextsRegistry, menuTextsAmount);
+    }
+
+    public void ParseBaseGameData()
     {
         int menuTextsAmount = _menuTextsLanguageData.Values.First().Length;
         for (int i = 0; i < menuTextsAmount; i++)
         {
-            MenuTextLeaf menuTextLeaf = _menuTextsRegistry.RegisterExisting(i, i.ToString());
+            MenuTextLeaf menuTextLeaf = _menuTextsRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _menuTextLanguageDataSerializer.FromTextAssetSerializedString(
@@ -40,7 +54,5 @@ internal sealed class MenuTextsCollector : IBaseGameCollector
                     menuTextLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _menuTextsRegistry, menuTextsAmount);
     }
 }
\ No newline at end of file
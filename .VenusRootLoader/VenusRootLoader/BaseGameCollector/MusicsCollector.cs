@@ -19,16 +19,9 @@ internal sealed class MusicsCollector : IBaseGameCollector
     private const string AudioMusicResourcesPath =
         $"{ResourcesPaths.RootAudioPathPrefix}{ResourcesPaths.AudioMusicDirectory}";
 
-    private readonly string[] _loopPointsData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataMusicLoopPointsPath);
-
-    private readonly HashSet<string> _musicAudioClipsByName = Resources
-        .LoadAll<AudioClip>(AudioMusicResourcesPath)
-        .Select(a => a.name)
-        .ToHashSet();
-
-    private readonly Dictionary<int, string[]> _musicsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedMusicNamesPathSuffix);
+    private readonly TextAssetLines _loopPointsData;
+    private readonly HashSet<string> _musicAudioClipsByName;
+    private readonly Dictionary<int, TextAssetLines> _musicsLanguageData;
 
     private readonly string[] _musicNamedIds = Enum.GetNames(typeof(MainManager.Musics)).ToArray();
 
@@ -38,6 +31,7 @@ internal sealed class MusicsCollector : IBaseGameCollector
     private readonly ILocalizedTextAssetParser<MusicLeaf> _musicLocalizedTextAssetParser;
 
     public MusicsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<MusicsCollector> logger,
         ILeavesRegistry<MusicLeaf> musicRegistry,
         ITextAssetParser<MusicLeaf> musicTextAssetParser,
@@ -47,9 +41,16 @@ internal sealed class MusicsCollector : IBaseGameCollector
         _musicRegistry = musicRegistry;
         _musicTextAssetParser = musicTextAssetParser;
         _musicLocalizedTextAssetParser = musicLocalizedTextAssetParser;
+
+        _loopPointsData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataMusicLoopPointsPath);
+        _musicAudioClipsByName = baseGameResources.ReadAssetsNames<AudioClip>(AudioMusicResourcesPath).ToHashSet();
+        _musicsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedMusicNamesPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
     {
         // The game contains specific music that technically exists as music, but cannot be purchased from Samira.
         // This is enforced in FixSamira where should any music ends up being unlocked, it will be removed from the list.
@@ -70,18 +71,6 @@ internal sealed class MusicsCollector : IBaseGameCollector
         for (int i = 0; i < _musicNamedIds.Length; i++)
         {
             MusicLeaf musicLeaf = _musicRegistry.RegisterExisting(i, _musicNamedIds[i]);
-            _musicTextAssetParser.FromTextAssetSerializedString(
-                ResourcesPaths.DataMusicLoopPointsPath,
-                _loopPointsData[i],
-                musicLeaf);
-            for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
-            {
-                _musicLocalizedTextAssetParser.FromTextAssetSerializedString(
-                    ResourcesPaths.DataLocalizedMusicNamesPathSuffix,
-                    j,
-                    _musicsLanguageData[j][i],
-                    musicLeaf);
-            }
 
             // Some music have an enum value so they technically exist, but they don't have an actual AudioClip to back them.
             // Those are considered unused and should also be excluded from Samira as the game implicitly does it.
@@ -101,4 +90,24 @@ internal sealed class MusicsCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _musicRegistry, _musicNamedIds.Length);
     }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _musicNamedIds.Length; i++)
+        {
+            MusicLeaf musicLeaf = _musicRegistry.GetByGameId(i);
+            _musicTextAssetParser.FromTextAssetSerializedString(
+                ResourcesPaths.DataMusicLoopPointsPath,
+                _loopPointsData[i],
+                musicLeaf);
+            for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
+            {
+                _musicLocalizedTextAssetParser.FromTextAssetSerializedString(
+                    ResourcesPaths.DataLocalizedMusicNamesPathSuffix,
+                    j,
+                    _musicsLanguageData[j][i],
+                    musicLeaf);
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -32,7 +32,9 @@ internal sealed class PrizeMedalsCollector : IBaseGameCollector
         _assemblyCSharpDataCollector = assemblyCSharpDataCollector;
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
     {
         IMetadataTokenProvider tokenPrizeIds = null!;
         IMetadataTokenProvider tokenPrizeFlags = null!;
@@ -81,4 +83,8 @@ internal sealed class PrizeMedalsCollector : IBaseGameCollector
 
         RootCollector.LogCollectedAmount(_logger, _prizeMedalsRegistry, prizeIds.Length);
     }
+
+    public void ParseBaseGameData()
+    {
+    }
 }
\ No newline at end of file
@@ -15,13 +15,9 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class QuestsCollector : IBaseGameCollector
 {
-    private readonly string[] _boardData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataQuestsPath);
-
-    private readonly string[] _checksData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataQuestsRequirementsPath);
-
-    private readonly Dictionary<int, string[]> _questsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedQuestsPathSuffix);
+    private readonly TextAssetLines _boardData;
+    private readonly TextAssetLines _checksData;
+    private readonly Dictionary<int, TextAssetLines> _questsLanguageData;
 
     private readonly string[] _questNamedIds = Enum.GetNames(typeof(MainManager.BoardQuests)).ToArray();
 
@@ -31,6 +27,7 @@ internal sealed class QuestsCollector : IBaseGameCollector
     private readonly ILocalizedTextAssetParser<QuestLeaf> _questLocalizedTextAssetParser;
 
     public QuestsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<QuestsCollector> logger,
         ILeavesRegistry<QuestLeaf> questsRegistry,
         ITextAssetParser<QuestLeaf> questTextAssetParser,
@@ -40,15 +37,34 @@ internal sealed class QuestsCollector : IBaseGameCollector
         _questsRegistry = questsRegistry;
         _questTextAssetParser = questTextAssetParser;
         _questLocalizedTextAssetParser = questLocalizedTextAssetParser;
+
+        _boardData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataQuestsPath);
+        _checksData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataQuestsRequirementsPath);
+        _questsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedQuestsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+        [typeof(LanguagesCollector), typeof(AreasCollector), typeof(GlobalFlagsCollector)];
+
+    public void RegisterBaseGameData()
     {
         List<int> bountyQuestsGameIds = CollectBountyQuestsGameIds();
 
         for (int i = 0; i < _questNamedIds.Length; i++)
         {
             QuestLeaf questLeaf = _questsRegistry.RegisterExisting(i, _questNamedIds[i]);
+            questLeaf.CanOnlyBeTakenAtUndergroundBar = bountyQuestsGameIds.Contains(i);
+        }
+
+        RootCollector.LogCollectedAmount(_logger, _questsRegistry, _questNamedIds.Length);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _questNamedIds.Length; i++)
+        {
+            QuestLeaf questLeaf = _questsRegistry.GetByGameId(i);
             _questTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataQuestsPath,
                 _boardData[i],
@@ -57,7 +73,6 @@ internal sealed class QuestsCollector : IBaseGameCollector
                 ResourcesPaths.DataQuestsRequirementsPath,
                 _checksData[i],
                 questLeaf);
-            questLeaf.CanOnlyBeTakenAtUndergroundBar = bountyQuestsGameIds.Contains(i);
 
             IHasEnemyPortraitSprite hasEnemyPortraitSprite = questLeaf;
             hasEnemyPortraitSprite.PortraitSprite = new AssetLoaderFromResources<Sprite>(
@@ -73,8 +88,6 @@ internal sealed class QuestsCollector : IBaseGameCollector
                     questLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _questsRegistry, _questNamedIds.Length);
     }
 
     // Bounty quests have their game ids hardcoded in GetQuestsBoards so we need to collect them from that method.
@@ -8,14 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class RankBonusesCollector : IBaseGameCollector
 {
-    private readonly string[] _rankBonusesData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataRankBonusesPath);
+    private readonly TextAssetLines _rankBonusesData;
 
     private readonly ILogger<RankBonusesCollector> _logger;
     private readonly ILeavesRegistry<RankBonusLeaf> _rankBonusesRegistry;
     private readonly ITextAssetParser<RankBonusLeaf> _rankBonusTextAssetParser;
 
     public RankBonusesCollector(
+        IBaseGameResources baseGameResources,
         ILogger<RankBonusesCollector> logger,
         ILeavesRegistry<RankBonusLeaf> rankBonusesRegistry,
         ITextAssetParser<RankBonusLeaf> rankBonusTextAssetParser)
@@ -23,21 +23,30 @@ internal sealed class RankBonusesCollector : IBaseGameCollector
         _logger = logger;
         _rankBonusesRegistry = rankBonusesRegistry;
         _rankBonusTextAssetParser = rankBonusTextAssetParser;
+
+        _rankBonusesData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataRankBonusesPath);
+    }
+
+    public IReadOnlyCollection<Type> ParsingDependencies => [];
+
+    public void RegisterBaseGameData()
+    {
+        for (int i = 0; i < _rankBonusesData.Length; i++)
+            _rankBonusesRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _rankBonusesRegistry, _rankBonusesData.Length);
     }
 
-    public void CollectBaseGameData()
+    public void ParseBaseGameData()
     {
         for (int i = 0; i < _rankBonusesData.Length; i++)
         {
             string rankBonusString = _rankBonusesData[i];
-            RankBonusLeaf rankBonusLeaf =
-                _rankBonusesRegistry.RegisterExisting(i, i.ToString());
+            RankBonusLeaf rankBonusLeaf = _rankBonusesRegistry.GetByGameId(i);
             _rankBonusTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataRankBonusesPath,
                 rankBonusString,
                 rankBonusLeaf);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _rankBonusesRegistry, _rankBonusesData.Length);
     }
 }
\ No newline at end of file
@@ -8,17 +8,15 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class RecipeLibraryEntriesCollector : IBaseGameCollector
 {
-    private readonly string[] _cookOrderData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataRecipesLibraryEntriesResultItemsPath);
-
-    private readonly string[] _cookLibraryData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataRecipesLibraryEntriesInputItemsPath);
+    private readonly TextAssetLines _cookOrderData;
+    private readonly TextAssetLines _cookLibraryData;
 
     private readonly ILogger<RecipeLibraryEntriesCollector> _logger;
     private readonly ILeavesRegistry<RecipeLibraryEntryLeaf> _recipeLibraryEntriesRegistry;
     private readonly ITextAssetParser<RecipeLibraryEntryLeaf> _recipeTextAssetParser;
 
     public RecipeLibraryEntriesCollector(
+        IBaseGameResources baseGameResources,
         ILogger<RecipeLibraryEntriesCollector> logger,
         ILeavesRegistry<RecipeLibraryEntryLeaf> recipeLibraryEntriesRegistry,
         ITextAssetParser<RecipeLibraryEntryLeaf> recipeTextAssetParser)
@@ -26,16 +24,30 @@ internal sealed class RecipeLibraryEntriesCollector : IBaseGameCollector
         _logger = logger;
         _recipeLibraryEntriesRegistry = recipeLibraryEntriesRegistry;
         _recipeTextAssetParser = recipeTextAssetParser;
+
+        _cookOrderData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataRecipesLibraryEntriesResultItemsPath);
+        _cookLibraryData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataRecipesLibraryEntriesInputItemsPath);
     }
 
-    public void CollectBaseGameData()
+    // The entries are matched to their recipe using the recipes' parsed items
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+        [typeof(ItemsCollector), typeof(RecipesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        for (int i = 0; i < _cookOrderData.Length; i++)
+            _recipeLibraryEntriesRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _recipeLibraryEntriesRegistry, _cookOrderData.Length);
+    }
+
+    public void ParseBaseGameData()
     {
         for (int i = 0; i < _cookOrderData.Length; i++)
         {
             string cookLibraryLine = _cookLibraryData[i];
             string cookOrderLine = _cookOrderData[i];
-            RecipeLibraryEntryLeaf recipeLibraryEntryLeaf =
-                _recipeLibraryEntriesRegistry.RegisterExisting(i, i.ToString());
+            RecipeLibraryEntryLeaf recipeLibraryEntryLeaf = _recipeLibraryEntriesRegistry.GetByGameId(i);
             _recipeTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataRecipesLibraryEntriesResultItemsPath,
                 cookOrderLine,
@@ -45,7 +57,5 @@ internal sealed class RecipeLibraryEntriesCollector : IBaseGameCollector
                 cookLibraryLine,
                 recipeLibraryEntryLeaf);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _recipeLibraryEntriesRegistry, _cookOrderData.Length);
     }
 }
\ No newline at end of file
@@ -8,13 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class RecipesCollector : IBaseGameCollector
 {
-    private readonly string[] _recipesData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataRecipesPath);
+    private readonly TextAssetLines _recipesData;
 
     private readonly ILogger<RecipesCollector> _logger;
     private readonly ILeavesRegistry<RecipeLeaf> _recipesRegistry;
     private readonly ITextAssetParser<RecipeLeaf> _recipeTextAssetParser;
 
     public RecipesCollector(
+        IBaseGameResources baseGameResources,
         ILeavesRegistry<RecipeLeaf> recipesRegistry,
         ILogger<RecipesCollector> logger,
         ITextAssetParser<RecipeLeaf> recipeTextAssetParser)
@@ -22,20 +23,30 @@ internal sealed class RecipesCollector : IBaseGameCollector
         _recipesRegistry = recipesRegistry;
         _logger = logger;
         _recipeTextAssetParser = recipeTextAssetParser;
+
+        _recipesData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataRecipesPath);
+    }
+
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(ItemsCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        for (int i = 0; i < _recipesData.Length; i++)
+            _recipesRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _recipesRegistry, _recipesData.Length);
     }
 
-    public void CollectBaseGameData()
+    public void ParseBaseGameData()
     {
         for (int i = 0; i < _recipesData.Length; i++)
         {
             string recipe = _recipesData[i];
-            RecipeLeaf recipeLeaf = _recipesRegistry.RegisterExisting(i, i.ToString());
+            RecipeLeaf recipeLeaf = _recipesRegistry.GetByGameId(i);
             _recipeTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataRecipesPath,
                 recipe,
                 recipeLeaf);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _recipesRegistry, _recipesData.Length);
     }
 }
\ No newline at end of file
@@ -11,11 +11,8 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class RecordsCollector : IBaseGameCollector
 {
-    private readonly string _recordsOrderingData =
-        RootCollector.ReadWholeTextAsset(ResourcesPaths.DataRecordsOrderingPath);
-
-    private readonly Dictionary<int, string[]> _recordsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedRecordsPathSuffix);
+    private readonly string _recordsOrderingData;
+    private readonly Dictionary<int, TextAssetLines> _recordsLanguageData;
 
     private readonly ILogger<RecordsCollector> _logger;
     private readonly IOrderedLeavesRegistry<RecordLeaf> _orderedRegistry;
@@ -23,7 +20,10 @@ internal sealed class RecordsCollector : IBaseGameCollector
     private readonly IOrderingTextAssetParser<RecordLeaf> _recordsOrderingDataSerializer;
     private readonly ILocalizedTextAssetParser<RecordLeaf> _recordsLanguageDataSerializer;
 
+    private int _recordsAmount;
+
     public RecordsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<RecordsCollector> logger,
         IOrderedLeavesRegistry<RecordLeaf> orderedRegistry,
         ILeavesRegistry<LanguageLeaf> languageRegistry,
@@ -35,16 +35,30 @@ internal sealed class RecordsCollector : IBaseGameCollector
         _recordsOrderingDataSerializer = recordsOrderingDataSerializer;
         _recordsLanguageDataSerializer = recordsLanguageDataSerializer;
         _languageRegistry = languageRegistry;
+
+        _recordsOrderingData = baseGameResources.ReadWholeTextAsset(ResourcesPaths.DataRecordsOrderingPath);
+        _recordsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedRecordsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
     {
-        int recordsAmount = _recordsOrderingData
+        _recordsAmount = _recordsOrderingData
             .Split('\n')
             .Length;
-        for (int i = 0; i < recordsAmount; i++)
+        for (int i = 0; i < _recordsAmount; i++)
+            _orderedRegistry.RegisterExistingWithOrdering(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, _recordsAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _recordsAmount; i++)
         {
-            RecordLeaf recordLeaf = _orderedRegistry.RegisterExistingWithOrdering(i, i.ToString());
+            RecordLeaf recordLeaf = _orderedRegistry.Registry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 recordLeaf.LocalizedData[_languageRegistry.GetByGameId(j)] = new();
@@ -64,7 +78,5 @@ internal sealed class RecordsCollector : IBaseGameCollector
                 ResourcesPaths.SpritesItemsEnemyPortraitsResourcesPath,
                 hasEnemyPortraitSprite.EnemyPortraitsSpriteIndex!.Value);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _orderedRegistry.Registry, recordsAmount);
     }
 }
\ No newline at end of file
@@ -1,12 +1,16 @@
+using CommunityToolkit.Diagnostics;
 using Microsoft.Extensions.Logging;
-using UnityEngine;
+using System.Diagnostics;
 using VenusRootLoader.Registry;
-using VenusRootLoader.Utility;
+using VenusRootLoader.Tracing;
 
 namespace VenusRootLoader.BaseGameCollector;
 
 /// <summary>
 /// A service to call all the collector's collection methods. This is meant to be resolved from Entry early on boot.
+/// The leaves are registered on the main thread in the collectors' order before their data gets parsed in parallel on
+/// the thread pool following the collectors' <see cref="IBaseGameCollector.ParsingDependencies"/>. Whatever the
+/// collectors had to read from the game is then saved to the <see cref="IBaseGameResources"/>'s snapshot.
 /// It also contains convenience methods for the collectors to use.
 /// </summary>
 internal sealed class RootCollector
@@ -14,45 +18,115 @@ internal sealed class RootCollector
     internal static readonly string[] LanguageDisplayNames = MainManager.languagenames.ToArray();
 
     private readonly IEnumerable<IBaseGameCollector> _baseGameCollectors;
+    private readonly IBaseGameResources _baseGameResources;
+    private readonly ITracer _tracer;
+    private readonly ILogger<RootCollector> _logger;
 
-    public RootCollector(IEnumerable<IBaseGameCollector> baseGameCollectors) =>
-        _baseGameCollectors = baseGameCollectors;
+    /// <summary>
+    /// How long the parsing of each collector took during the last collection indexed by the collector's type. This
+    /// is the time spent in <see cref="IBaseGameCollector.ParseBaseGameData"/> which excludes the time spent waiting
+    /// for the parsing dependencies.
+    /// </summary>
+    internal IReadOnlyDictionary<Type, TimeSpan> ParseDurations { get; private set; } =
+        new Dictionary<Type, TimeSpan>();
 
-    internal void CollectAndRegisterBaseGameData()
+    public RootCollector(
+        IEnumerable<IBaseGameCollector> baseGameCollectors,
+        IBaseGameResources baseGameResources,
+        ITracer tracer,
+        ILogger<RootCollector> logger)
     {
-        foreach (IBaseGameCollector baseGameCollector in _baseGameCollectors)
-            baseGameCollector.CollectBaseGameData();
+        _baseGameCollectors = baseGameCollectors;
+        _baseGameResources = baseGameResources;
+        _tracer = tracer;
+        _logger = logger;
     }
 
-    internal static string[] ReadTextAssetLines(string resourcesPathSuffix)
+    internal void CollectAndRegisterBaseGameData()
     {
-        return Resources.Load<TextAsset>($"{ResourcesPaths.RootDataPathPrefix}{resourcesPathSuffix}").text
-            .Trim(StringUtils.NewlineSplitDelimiter)
-            .Split(StringUtils.NewlineSplitDelimiter);
-    }
+        IBaseGameCollector[] baseGameCollectors = _baseGameCollectors.ToArray();
+        foreach (IBaseGameCollector baseGameCollector in baseGameCollectors)
+        {
+            using TraceSpan span = _tracer.BeginSpan(
+                $"{baseGameCollector.GetType().Name}.Register",
+                nameof(BaseGameCollector));
+            baseGameCollector.RegisterBaseGameData();
+        }
 
-    internal static string ReadWholeTextAsset(string resourcesPathSuffix)
-    {
-        return Resources
-            .Load<TextAsset>($"{ResourcesPaths.RootDataPathPrefix}{resourcesPathSuffix}").text
-            .Trim('\n');
+        ParseAllBaseGameData(baseGameCollectors);
+
+        // Every collector read the game's data when it got constructed so the snapshot is complete at this point
+        using (_tracer.BeginSpan("BaseGameSnapshot.Save", nameof(BaseGameCollector)))
+            _baseGameResources.SaveSnapshotIfChanged();
     }
 
-    internal static Dictionary<int, string[]> ReadLocalizedTestAssetLines(string resourcesPathSuffix)
+    private void ParseAllBaseGameData(IBaseGameCollector[] baseGameCollectors)
     {
-        Dictionary<int, string[]> localizedLines = new();
-        for (int i = 0; i < LanguageDisplayNames.Length; i++)
+        long[] parseTicks = new long[baseGameCollectors.Length];
+        Dictionary<Type, Task> parseTasks = new();
+        for (int i = 0; i < baseGameCollectors.Length; i++)
+        {
+            IBaseGameCollector baseGameCollector = baseGameCollectors[i];
+            Type collectorType = baseGameCollector.GetType();
+            List<Task> dependenciesTasks = new();
+            foreach (Type dependency in baseGameCollector.ParsingDependencies)
+            {
+                // Requiring the dependencies to come before also means the dependency graph cannot have cycles
+                if (!parseTasks.TryGetValue(dependency, out Task dependencyTask))
+                {
+                    ThrowHelper.ThrowInvalidOperationException(
+                        $"The collector {collectorType.Name} depends on {dependency.Name} which isn't registered " +
+                        $"before it");
+                }
+
+                dependenciesTasks.Add(dependencyTask);
+            }
+
+            int collectorIndex = i;
+            Action parse = () => parseTicks[collectorIndex] = ParseBaseGameData(baseGameCollector);
+            parseTasks[collectorType] = dependenciesTasks.Count == 0
+                ? Task.Run(parse)
+                : Task.WhenAll(dependenciesTasks).ContinueWith(
+                    _ => parse(),
+                    CancellationToken.None,
+                    TaskContinuationOptions.OnlyOnRanToCompletion,
+                    TaskScheduler.Default);
+        }
+
+        try
         {
-            string[] lines = Resources
-                .Load<TextAsset>(
-                    $"{ResourcesPaths.DataSlashDialogues}{i}/{resourcesPathSuffix}")
-                .text
-                .Trim(StringUtils.NewlineSplitDelimiter)
-                .Split(StringUtils.NewlineSplitDelimiter);
-            localizedLines.Add(i, lines);
+            Task.WaitAll(parseTasks.Values.ToArray());
+        }
+        catch (AggregateException e)
+        {
+            // The collectors whose dependencies failed are canceled so only the actual failures are reported
+            throw new AggregateException(
+                "Failed to parse the base game data",
+                e.InnerExceptions.Where(inner => inner is not OperationCanceledException));
         }
 
-        return localizedLines;
+        Dictionary<Type, TimeSpan> parseDurations = new();
+        for (int i = 0; i < baseGameCollectors.Length; i++)
+        {
+            TimeSpan parseDuration = TimeSpan.FromTicks(parseTicks[i]);
+            parseDurations[baseGameCollectors[i].GetType()] = parseDuration;
+            _logger.LogDebug(
+                "Parsed the base game data of {collector} in {duration} ms",
+                baseGameCollectors[i].GetType().Name,
+                parseDuration.TotalMilliseconds);
+        }
+
+        ParseDurations = parseDurations;
+    }
+
+    private long ParseBaseGameData(IBaseGameCollector baseGameCollector)
+    {
+        using TraceSpan span = _tracer.BeginSpan(
+            $"{baseGameCollector.GetType().Name}.Parse",
+            nameof(BaseGameCollector));
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        baseGameCollector.ParseBaseGameData();
+        return stopwatch.Elapsed.Ticks;
     }
 
     internal static void LogCollectedAmount(
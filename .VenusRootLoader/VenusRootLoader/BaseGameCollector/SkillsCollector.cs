@@ -8,10 +8,8 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class SkillsCollector : IBaseGameCollector
 {
-    private readonly string[] _skillsData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataSkillsPath);
-
-    private readonly Dictionary<int, string[]> _skillsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedSkillsPathSuffix);
+    private readonly TextAssetLines _skillsData;
+    private readonly Dictionary<int, TextAssetLines> _skillsLanguageData;
 
     private readonly string[] _skillNamedIds = Enum.GetNames(typeof(MainManager.Skills)).ToArray();
 
@@ -22,6 +20,7 @@ internal sealed class SkillsCollector : IBaseGameCollector
     private readonly ILeavesRegistry<LanguageLeaf> _languageRegistry;
 
     public SkillsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<SkillsCollector> logger,
         ITextAssetParser<SkillLeaf> skillTextAssetParser,
         ILocalizedTextAssetParser<SkillLeaf> skillLocalizedTextAssetParser,
@@ -33,14 +32,29 @@ internal sealed class SkillsCollector : IBaseGameCollector
         _skillLocalizedTextAssetParser = skillLocalizedTextAssetParser;
         _skillsRegistry = skillsRegistry;
         _languageRegistry = languageRegistry;
+
+        _skillsData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataSkillsPath);
+        _skillsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedSkillsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+        [typeof(LanguagesCollector), typeof(ActionCommandHelpTextsCollector)];
+
+    public void RegisterBaseGameData()
     {
         int skillsAmount = _skillNamedIds.Length;
         for (int i = 0; i < skillsAmount; i++)
+            _skillsRegistry.RegisterExisting(i, _skillNamedIds[i]);
+
+        RootCollector.LogCollectedAmount(_logger, _skillsRegistry, skillsAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _skillNamedIds.Length; i++)
         {
-            SkillLeaf skillLeaf = _skillsRegistry.RegisterExisting(i, _skillNamedIds[i]);
+            SkillLeaf skillLeaf = _skillsRegistry.GetByGameId(i);
             _skillTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataSkillsPath,
                 _skillsData[i],
@@ -55,7 +69,5 @@ internal sealed class SkillsCollector : IBaseGameCollector
                     skillLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _skillsRegistry, skillsAmount);
     }
 }
\ No newline at end of file
@@ -8,13 +8,9 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class SpyCardsCollector : IBaseGameCollector
 {
-    private readonly string[] _spyCardsData = RootCollector.ReadTextAssetLines(ResourcesPaths.DataSpyCardsPath);
-
-    private readonly string _spyCardsOrderingData =
-        RootCollector.ReadWholeTextAsset(ResourcesPaths.DataSpyCardsOrderingPath);
-
-    private readonly Dictionary<int, string[]> _spyCardsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedSpyCardsPathSuffix);
+    private readonly TextAssetLines _spyCardsData;
+    private readonly string _spyCardsOrderingData;
+    private readonly Dictionary<int, TextAssetLines> _spyCardsLanguageData;
 
     private readonly ILogger<SpyCardsCollector> _logger;
     private readonly IOrderedLeavesRegistry<SpyCardLeaf> _orderedRegistry;
@@ -24,6 +20,7 @@ internal sealed class SpyCardsCollector : IBaseGameCollector
     private readonly ILocalizedTextAssetParser<SpyCardLeaf> _spyCardLocalizedTextAssetParser;
 
     public SpyCardsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<SpyCardsCollector> logger,
         IOrderedLeavesRegistry<SpyCardLeaf> orderedRegistry,
         ILeavesRegistry<LanguageLeaf> languageRegistry,
@@ -37,14 +34,30 @@ internal sealed class SpyCardsCollector : IBaseGameCollector
         _spyCardTextAssetParser = spyCardTextAssetParser;
         _spyCardLocalizedTextAssetParser = spyCardLocalizedTextAssetParser;
         _languageRegistry = languageRegistry;
+
+        _spyCardsData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataSpyCardsPath);
+        _spyCardsOrderingData = baseGameResources.ReadWholeTextAsset(ResourcesPaths.DataSpyCardsOrderingPath);
+        _spyCardsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedSpyCardsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies =>
+        [typeof(LanguagesCollector), typeof(EnemiesCollector)];
+
+    public void RegisterBaseGameData()
     {
         int spyCardAmount = _spyCardsData.Length;
         for (int i = 0; i < spyCardAmount; i++)
+            _orderedRegistry.RegisterExistingWithOrdering(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _languageRegistry, spyCardAmount);
+    }
+
+    public void ParseBaseGameData()
+    {
+        for (int i = 0; i < _spyCardsData.Length; i++)
         {
-            SpyCardLeaf spyCardLeaf = _orderedRegistry.RegisterExistingWithOrdering(i, i.ToString());
+            SpyCardLeaf spyCardLeaf = _orderedRegistry.Registry.GetByGameId(i);
             _spyCardTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataSpyCardsPath,
                 _spyCardsData[i],
@@ -61,6 +74,5 @@ internal sealed class SpyCardsCollector : IBaseGameCollector
         }
 
         _spyCardOrderingTextAssetParser.FromTextAssetString(_spyCardsOrderingData, _orderedRegistry);
-        RootCollector.LogCollectedAmount(_logger, _languageRegistry, spyCardAmount);
     }
 }
\ No newline at end of file
@@ -8,14 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class SpyCardsTextsCollector : IBaseGameCollector
 {
-    private readonly Dictionary<int, string[]> _spyCardsTextsLanguageData =
-        RootCollector.ReadLocalizedTestAssetLines(ResourcesPaths.DataLocalizedSpyCardsTextsPathSuffix);
+    private readonly Dictionary<int, TextAssetLines> _spyCardsTextsLanguageData;
 
     private readonly ILogger<SpyCardsTextsCollector> _logger;
     private readonly ILeavesRegistry<SpyCardsTextLeaf> _spyCardsTextsRegistry;
     private readonly ILocalizedTextAssetParser<SpyCardsTextLeaf> _spyCardsTextLocalizedTextAssetParser;
 
     public SpyCardsTextsCollector(
+        IBaseGameResources baseGameResources,
         ILogger<SpyCardsTextsCollector> logger,
         ILocalizedTextAssetParser<SpyCardsTextLeaf> spyCardsTextLocalizedTextAssetParser,
         ILeavesRegistry<SpyCardsTextLeaf> spyCardsTextsRegistry)
@@ -23,14 +23,28 @@ internal sealed class SpyCardsTextsCollector : IBaseGameCollector
         _logger = logger;
         _spyCardsTextLocalizedTextAssetParser = spyCardsTextLocalizedTextAssetParser;
         _spyCardsTextsRegistry = spyCardsTextsRegistry;
+
+        _spyCardsTextsLanguageData = baseGameResources.ReadLocalizedTextAssetLines(
+            ResourcesPaths.DataLocalizedSpyCardsTextsPathSuffix);
     }
 
-    public void CollectBaseGameData()
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(LanguagesCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        int spyCardsTextsAmount = _spyCardsTextsLanguageData.Values.First().Length;
+        for (int i = 0; i < spyCardsTextsAmount; i++)
+            _spyCardsTextsRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _spyCardsTextsRegistry, spyCardsTextsAmount);
+    }
+
+    public void ParseBaseGameData()
     {
         int spyCardsTextsAmount = _spyCardsTextsLanguageData.Values.First().Length;
         for (int i = 0; i < spyCardsTextsAmount; i++)
         {
-            SpyCardsTextLeaf spyCardsTextLeaf = _spyCardsTextsRegistry.RegisterExisting(i, i.ToString());
+            SpyCardsTextLeaf spyCardsTextLeaf = _spyCardsTextsRegistry.GetByGameId(i);
             for (int j = 0; j < RootCollector.LanguageDisplayNames.Length; j++)
             {
                 _spyCardsTextLocalizedTextAssetParser.FromTextAssetSerializedString(
@@ -40,7 +54,5 @@ internal sealed class SpyCardsTextsCollector : IBaseGameCollector
                     spyCardsTextLeaf);
             }
         }
-
-        RootCollector.LogCollectedAmount(_logger, _spyCardsTextsRegistry, spyCardsTextsAmount);
     }
 }
\ No newline at end of file
@@ -8,14 +8,14 @@ namespace VenusRootLoader.BaseGameCollector;
 
 internal sealed class TermacadePrizesCollector : IBaseGameCollector
 {
-    private readonly string[] _termacadePrizesData =
-        RootCollector.ReadTextAssetLines(ResourcesPaths.DataTermacadePrizesPath);
+    private readonly TextAssetLines _termacadePrizesData;
 
     private readonly ILogger<TermacadePrizesCollector> _logger;
     private readonly ILeavesRegistry<TermacadePrizeLeaf> _termacadePrizesRegistry;
     private readonly ITextAssetParser<TermacadePrizeLeaf> _termacadePrizesTextAssetParser;
 
     public TermacadePrizesCollector(
+        IBaseGameResources baseGameResources,
         ILeavesRegistry<TermacadePrizeLeaf> termacadePrizesRegistry,
         ILogger<TermacadePrizesCollector> logger,
         ITextAssetParser<TermacadePrizeLeaf> termacadePrizesTextAssetParser)
@@ -23,21 +23,30 @@ internal sealed class TermacadePrizesCollector : IBaseGameCollector
         _termacadePrizesRegistry = termacadePrizesRegistry;
         _logger = logger;
         _termacadePrizesTextAssetParser = termacadePrizesTextAssetParser;
+
+        _termacadePrizesData = baseGameResources.ReadTextAssetLines(ResourcesPaths.DataTermacadePrizesPath);
+    }
+
+    public IReadOnlyCollection<Type> ParsingDependencies => [typeof(GlobalFlagsCollector)];
+
+    public void RegisterBaseGameData()
+    {
+        for (int i = 0; i < _termacadePrizesData.Length; i++)
+            _termacadePrizesRegistry.RegisterExisting(i, i.ToString());
+
+        RootCollector.LogCollectedAmount(_logger, _termacadePrizesRegistry, _termacadePrizesData.Length);
     }
 
-    public void CollectBaseGameData()
+    public void ParseBaseGameData()
     {
         for (int i = 0; i < _termacadePrizesData.Length; i++)
         {
             string termacadePrizeString = _termacadePrizesData[i];
-            TermacadePrizeLeaf termacadePrizeLeaf =
-                _termacadePrizesRegistry.RegisterExisting(i, i.ToString());
+            TermacadePrizeLeaf termacadePrizeLeaf = _termacadePrizesRegistry.GetByGameId(i);
             _termacadePrizesTextAssetParser.FromTextAssetSerializedString(
                 ResourcesPaths.DataTermacadePrizesPath,
                 termacadePrizeString,
                 termacadePrizeLeaf);
         }
-
-        RootCollector.LogCollectedAmount(_logger, _termacadePrizesRegistry, _termacadePrizesData.Length);
     }
 }
\ No newline at end of file
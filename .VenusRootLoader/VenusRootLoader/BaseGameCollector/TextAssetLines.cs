@@ -0,0 +1,61 @@
+using VenusRootLoader.Utility;
+
+namespace VenusRootLoader.BaseGameCollector;
+
+/// <summary>
+/// The lines of a base game TextAsset whose text was read on the main thread. Splitting the text is only done the
+/// first time a line is accessed which allows it to happen in <see cref="IBaseGameCollector.ParseBaseGameData"/> on
+/// the thread pool while <see cref="IBaseGameCollector.RegisterBaseGameData"/> gets the amount of lines from a count
+/// of the line endings without allocating anything.
+/// </summary>
+internal sealed class TextAssetLines
+{
+    private readonly string _text;
+    private readonly bool _trimLineEndings;
+    private string[]? _lines;
+
+    /// <summary>
+    /// The amount of lines which is the same as the amount of elements of <see cref="Lines"/>.
+    /// </summary>
+    internal int Length { get; }
+
+    /// <summary>
+    /// The lines of the text, split on first access.
+    /// </summary>
+    internal string[] Lines =>
+        _lines ??= (_trimLineEndings ? _text.Trim(StringUtils.NewlineSplitDelimiter) : _text)
+            .Split(StringUtils.NewlineSplitDelimiter);
+
+    internal string this[int index] => Lines[index];
+
+    /// <param name="text">The text of the TextAsset.</param>
+    /// <param name="trimLineEndings">Whether the line endings at the start and end of the text are ignored.</param>
+    internal TextAssetLines(string text, bool trimLineEndings)
+    {
+        _text = text;
+        _trimLineEndings = trimLineEndings;
+        Length = CountLines();
+    }
+
+    private int CountLines()
+    {
+        int start = 0;
+        int end = _text.Length;
+        if (_trimLineEndings)
+        {
+            while (start < end && _text[start] == '\n')
+                start++;
+            while (end > start && _text[end - 1] == '\n')
+                end--;
+        }
+
+        int lineEndingsAmount = 0;
+        for (int i = start; i < end; i++)
+        {
+            if (_text[i] == '\n')
+                lineEndingsAmount++;
+        }
+
+        return lineEndingsAmount + 1;
+    }
+}
\ No newline at end of file
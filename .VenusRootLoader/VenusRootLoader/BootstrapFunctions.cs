@@ -1,5 +1,6 @@
 using Microsoft.Extensions.Logging;
 using System.Runtime.InteropServices;
+using VenusRootLoader.Tracing;
 
 namespace VenusRootLoader;
 
@@ -7,5 +8,19 @@ internal sealed class BootstrapFunctions
 {
     [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
     internal delegate void BootstrapLogFn(string message, string category, LogLevel logLevel);
+
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl, CharSet = CharSet.Unicode)]
+    internal delegate void BootstrapTraceFn(
+        TraceEventPhase phase,
+        string name,
+        string category,
+        long allocatedBytes,
+        int gcCount);
+
     internal required BootstrapLogFn BootstrapLog { get; init; }
+
+    /// <summary>
+    /// The function that records trace events on the bootstrap's side. This is null when tracing is disabled.
+    /// </summary>
+    internal BootstrapTraceFn? BootstrapTrace { get; init; }
 }
\ No newline at end of file
@@ -1,4 +1,3 @@
-using AsmResolver.DotNet;
 using VenusRootLoader.Api;
 
 namespace VenusRootLoader.BudLoading;
@@ -19,7 +18,7 @@ internal sealed record BudInfo
     internal required string BudAssemblyPath { get; init; }
 
     /// <summary>
-    /// The type definition of the <see cref="Bud"/>.
+    /// The full name of the type of the <see cref="Bud"/> in its assembly.
     /// </summary>
-    internal required TypeDefinition BudType { get; init; }
+    internal required string BudTypeFullName { get; init; }
 }
\ No newline at end of file
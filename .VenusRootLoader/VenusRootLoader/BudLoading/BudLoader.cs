@@ -2,6 +2,7 @@ using Microsoft.Extensions.Logging;
 using System.IO.Abstractions;
 using System.Reflection;
 using VenusRootLoader.Api;
+using VenusRootLoader.Tracing;
 
 namespace VenusRootLoader.BudLoading;
 
@@ -34,6 +35,7 @@ internal sealed class BudLoader : IBudLoader
     private readonly ILoggerFactory _loggerFactory;
     private readonly IVenusFactory _venusFactory;
     private readonly IBudConfigManager _budConfigManager;
+    private readonly ITracer _tracer;
 
     public BudLoader(
         IBudsDiscoverer budsDiscoverer,
@@ -46,7 +48,8 @@ internal sealed class BudLoader : IBudLoader
         ILogger<BudLoader> logger,
         ILoggerFactory loggerFactory,
         IVenusFactory venusFactory,
-        IBudConfigManager budConfigManager)
+        IBudConfigManager budConfigManager,
+        ITracer tracer)
     {
         _budsDiscoverer = budsDiscoverer;
         _budsValidator = budsValidator;
@@ -59,6 +62,7 @@ internal sealed class BudLoader : IBudLoader
         _loggerFactory = loggerFactory;
         _venusFactory = venusFactory;
         _budConfigManager = budConfigManager;
+        _tracer = tracer;
 
         if (!_fileSystem.Directory.Exists(_budLoaderContext.BudsPath))
             _fileSystem.Directory.CreateDirectory(_budLoaderContext.BudsPath);
@@ -111,7 +115,7 @@ internal sealed class BudLoader : IBudLoader
         try
         {
             Assembly assembly = _assemblyLoader.LoadFromPath(budLoadingInfo.BudAssemblyPath);
-            Type budType = assembly.GetType(budLoadingInfo.BudType.FullName);
+            Type budType = assembly.GetType(budLoadingInfo.BudTypeFullName);
             Bud bud = (Bud)Activator.CreateInstance(budType);
             object? configData = UpdateConfig(bud, budLoadingInfo);
             bud.BudInfo = budLoadingInfo.BudManifest;
@@ -121,7 +125,8 @@ internal sealed class BudLoader : IBudLoader
             bud.ConfigData = configData;
 
             _logger.LogDebug("Loading bud {budId}...", budLoadingInfo.BudManifest.BudId);
-            bud.Main();
+            using (_tracer.BeginSpan(budLoadingInfo.BudManifest.BudId, nameof(Bud)))
+                bud.Main();
             _logger.LogDebug("Loaded bud {budId} successfully", budLoadingInfo.BudManifest.BudId);
         }
         catch (Exception e)
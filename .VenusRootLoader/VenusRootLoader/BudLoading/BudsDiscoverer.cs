@@ -1,6 +1,5 @@
 using AsmResolver.DotNet;
 using Microsoft.Extensions.Logging;
-using System.Diagnostics.CodeAnalysis;
 using System.IO.Abstractions;
 using System.Text.Json;
 using VenusRootLoader.Api;
@@ -23,72 +22,96 @@ internal interface IBudsDiscoverer
 /// <inheritdoc/>
 internal sealed class BudsDiscoverer : IBudsDiscoverer
 {
+    // The outcome of discovering a single bud directory. The errors are logged after all directories were discovered
+    // so they appear in the same order regardless of which thread discovered them.
+    private readonly struct BudDiscoveryResult
+    {
+        internal readonly BudInfo? Bud;
+        internal readonly Exception? ManifestException;
+        internal readonly Exception? AssemblyException;
+        internal readonly string? BudAssemblyPath;
+
+        internal BudDiscoveryResult(
+            BudInfo? bud,
+            Exception? manifestException,
+            Exception? assemblyException,
+            string? budAssemblyPath)
+        {
+            Bud = bud;
+            ManifestException = manifestException;
+            AssemblyException = assemblyException;
+            BudAssemblyPath = budAssemblyPath;
+        }
+    }
+
+    // This is reused for every manifest so System.Text.Json's metadata about BudManifest only gets built once
+    internal static readonly JsonSerializerOptions BudManifestSerializerOptions = new()
+    {
+        Converters =
+        {
+            NuGetVersionJsonConverter.Instance,
+            NuGetVersionRangeJsonConverter.Instance
+        }
+    };
+
     private readonly IFileSystem _fileSystem;
     private readonly ILogger<BudsDiscoverer> _logger;
     private readonly BudLoaderContext _budLoaderContext;
+    private readonly IBudsDiscoveryCache _budsDiscoveryCache;
 
     public BudsDiscoverer(
         IFileSystem fileSystem,
         ILogger<BudsDiscoverer> logger,
-        BudLoaderContext budLoaderContext)
+        BudLoaderContext budLoaderContext,
+        IBudsDiscoveryCache budsDiscoveryCache)
     {
         _fileSystem = fileSystem;
         _logger = logger;
         _budLoaderContext = budLoaderContext;
+        _budsDiscoveryCache = budsDiscoveryCache;
     }
 
     public IList<BudInfo> DiscoverAllBudsFromDisk()
     {
-        List<BudInfo> result = [];
+        // The directories are sorted so the result doesn't depend on the order the file system enumerates them
+        string[] budDirectories = _fileSystem.Directory.EnumerateDirectories(_budLoaderContext.BudsPath)
+            .OrderBy(d => d, StringComparer.Ordinal)
+            .ToArray();
 
-        foreach (string budDirectory in _fileSystem.Directory.EnumerateDirectories(_budLoaderContext.BudsPath))
-        {
-            string manifestPath = _fileSystem.Path.Combine(budDirectory, "manifest.json");
-            if (!_fileSystem.File.Exists(manifestPath))
-                continue;
+        _budsDiscoveryCache.Load();
+        BudDiscoveryResult[] discoveryResults = new BudDiscoveryResult[budDirectories.Length];
+        Parallel.For(0, budDirectories.Length, i => discoveryResults[i] = DiscoverBud(budDirectories[i]));
+        _budsDiscoveryCache.Save();
 
-            try
+        List<BudInfo> result = [];
+        for (int i = 0; i < discoveryResults.Length; i++)
+        {
+            BudDiscoveryResult discoveryResult = discoveryResults[i];
+            if (discoveryResult.Bud is not null)
+            {
+                result.Add(discoveryResult.Bud);
+            }
+            else if (discoveryResult.AssemblyException is not null)
             {
-                string manifestContent = _fileSystem.File.ReadAllText(manifestPath);
-                BudManifest? budManifest = JsonSerializer.Deserialize<BudManifest>(
-                    manifestContent,
-                    new JsonSerializerOptions
-                    {
-                        Converters =
-                        {
-                            NuGetVersionJsonConverter.Instance,
-                            NuGetVersionRangeJsonConverter.Instance
-                        }
-                    });
-                if (budManifest is null)
-                    throw new JsonException("The bud manifest deserialized to null");
-
-                EnsureBudManifestIsValid(budManifest);
-
-                string budAssemblyPath = _fileSystem.Path.Combine(budDirectory, budManifest.AssemblyFile);
-                if (!_fileSystem.File.Exists(budAssemblyPath))
-                    throw new FileNotFoundException("The bud assembly file does not exist", budAssemblyPath);
-
-                if (TryValidateBudAssembly(budAssemblyPath, out TypeDefinition? budType))
-                {
-                    BudInfo newBud = new()
-                    {
-                        BudManifest = budManifest,
-                        BudAssemblyPath = budAssemblyPath,
-                        BudType = budType
-                    };
-                    result.Add(newBud);
-                }
+                _logger.LogError(
+                    discoveryResult.AssemblyException,
+                    "The bud assembly {budAssemblyPath} could not be loaded",
+                    discoveryResult.BudAssemblyPath);
             }
-            catch (Exception e)
+            else if (discoveryResult.ManifestException is not null)
             {
                 _logger.LogError(
-                    e,
+                    discoveryResult.ManifestException,
                     "An exception occurred while reading the bud manifest located at {manifestPath}",
-                    manifestPath);
+                    _fileSystem.Path.Combine(budDirectories[i], "manifest.json"));
             }
         }
 
+        _logger.LogInformation(
+            "Buds discovery cache: {hits} hits, {misses} misses",
+            _budsDiscoveryCache.Hits,
+            _budsDiscoveryCache.Misses);
+
         if (result.Count == 0)
         {
             _logger.LogDebug("Discovered no buds");
@@ -103,6 +126,51 @@ internal sealed class BudsDiscoverer : IBudsDiscoverer
         return result;
     }
 
+    private BudDiscoveryResult DiscoverBud(string budDirectory)
+    {
+        string manifestPath = _fileSystem.Path.Combine(budDirectory, "manifest.json");
+        if (!_fileSystem.File.Exists(manifestPath))
+            return default;
+
+        if (_budsDiscoveryCache.TryGetBud(manifestPath, out BudInfo? cachedBud))
+            return new(cachedBud, null, null, null);
+
+        BudManifest budManifest;
+        string budAssemblyPath;
+        try
+        {
+            string manifestContent = _fileSystem.File.ReadAllText(manifestPath);
+            budManifest = JsonSerializer.Deserialize<BudManifest>(manifestContent, BudManifestSerializerOptions)
+                          ?? throw new JsonException("The bud manifest deserialized to null");
+
+            EnsureBudManifestIsValid(budManifest);
+
+            budAssemblyPath = _fileSystem.Path.Combine(budDirectory, budManifest.AssemblyFile);
+            if (!_fileSystem.File.Exists(budAssemblyPath))
+                throw new FileNotFoundException("The bud assembly file does not exist", budAssemblyPath);
+        }
+        catch (Exception e)
+        {
+            return new(null, e, null, null);
+        }
+
+        try
+        {
+            BudInfo newBud = new()
+            {
+                BudManifest = budManifest,
+                BudAssemblyPath = budAssemblyPath,
+                BudTypeFullName = GetValidatedBudTypeFullName(budAssemblyPath)
+            };
+            _budsDiscoveryCache.AddBud(manifestPath, newBud);
+            return new(newBud, null, null, null);
+        }
+        catch (Exception e)
+        {
+            return new(null, null, e, budAssemblyPath);
+        }
+    }
+
     private static void EnsureBudManifestIsValid(BudManifest budManifest)
     {
         if (string.IsNullOrWhiteSpace(budManifest.AssemblyFile))
@@ -134,38 +202,24 @@ internal sealed class BudsDiscoverer : IBudsDiscoverer
         }
     }
 
-    private bool TryValidateBudAssembly(string budAssemblyPath, [NotNullWhen(true)] out TypeDefinition? budType)
+    private string GetValidatedBudTypeFullName(string budAssemblyPath)
     {
-        budType = null;
-
-        try
+        using Stream assemblyStream = _fileSystem.File.OpenRead(budAssemblyPath);
+        ModuleDefinition moduleDefinition = ModuleDefinition.FromStream(assemblyStream);
+        List<TypeDefinition> iBuds = moduleDefinition.GetAllTypes()
+            .Where(x => !x.IsAbstract
+                        && x.BaseType?.FullName == typeof(Bud).FullName!
+                        && x.GetConstructor() is not null)
+            .ToList();
+
+        return iBuds.Count switch
         {
-            using Stream assemblyStream = _fileSystem.File.OpenRead(budAssemblyPath);
-            ModuleDefinition moduleDefinition = ModuleDefinition.FromStream(assemblyStream);
-            List<TypeDefinition> iBuds = moduleDefinition.GetAllTypes()
-                .Where(x => !x.IsAbstract
-                            && x.BaseType?.FullName == typeof(Bud).FullName!
-                            && x.GetConstructor() is not null)
-                .ToList();
-
-            switch (iBuds.Count)
-            {
-                case <= 0:
-                    throw new Exception(
-                        $"There are no non abstract classes in the assembly that inherits from {nameof(Bud)} with a parameterless constructor");
-                case > 1:
-                    throw new Exception(
-                        $"There are more than 1 non abstract classes in the assembly that inherits from {nameof(Bud)} with a parameterless constructor " +
-                        $"which creates ambiguity. Here are the list of types:\n\n{string.Join("\n", iBuds.Select(x => x.FullName))}");
-                default:
-                    budType = iBuds.Single();
-                    return true;
-            }
-        }
-        catch (Exception e)
-        {
-            _logger.LogError(e, "The bud assembly {budAssemblyPath} could not be loaded", budAssemblyPath);
-            return false;
-        }
+            <= 0 => throw new Exception(
+                $"There are no non abstract classes in the assembly that inherits from {nameof(Bud)} with a parameterless constructor"),
+            > 1 => throw new Exception(
+                $"There are more than 1 non abstract classes in the assembly that inherits from {nameof(Bud)} with a parameterless constructor " +
+                $"which creates ambiguity. Here are the list of types:\n\n{string.Join("\n", iBuds.Select(x => x.FullName))}"),
+            _ => iBuds.Single().FullName
+        };
     }
 }
\ No newline at end of file
@@ -0,0 +1,209 @@
+using Microsoft.Extensions.Logging;
+using System.Collections.Concurrent;
+using System.Diagnostics.CodeAnalysis;
+using System.IO.Abstractions;
+using System.Text.Json;
+using VenusRootLoader.Api;
+
+namespace VenusRootLoader.BudLoading;
+
+/// <summary>
+/// A persistent cache of the buds that the <see cref="IBudsDiscoverer"/> found to be well-formed. Each entry is stamped
+/// with the size and last write time of the bud's manifest and assembly and is only reused if both are unchanged which
+/// allows to skip deserializing the manifest and inspecting the assembly. This is thread safe.
+/// </summary>
+internal interface IBudsDiscoveryCache
+{
+    /// <summary>
+    /// The amount of buds retrieved from the cache since it was loaded.
+    /// </summary>
+    int Hits { get; }
+
+    /// <summary>
+    /// The amount of buds that couldn't be retrieved from the cache since it was loaded.
+    /// </summary>
+    int Misses { get; }
+
+    /// <summary>
+    /// Loads the cache from the disk. Failing to load is not fatal since every bud will simply be a miss.
+    /// </summary>
+    void Load();
+
+    /// <summary>
+    /// Attempts to get the <see cref="BudInfo"/> of the bud whose manifest is at the given path.
+    /// </summary>
+    /// <param name="manifestPath">The full path of the bud's manifest.</param>
+    /// <param name="budInfo">When this method returns, the cached <see cref="BudInfo"/> if it was still valid;
+    /// otherwise, null.</param>
+    /// <returns>True if the bud was in the cache and its files didn't change, false otherwise.</returns>
+    bool TryGetBud(string manifestPath, [NotNullWhen(true)] out BudInfo? budInfo);
+
+    /// <summary>
+    /// Adds a bud found to be well-formed to the cache stamped with the current state of its files.
+    /// </summary>
+    /// <param name="manifestPath">The full path of the bud's manifest.</param>
+    /// <param name="budInfo">The <see cref="BudInfo"/> of the bud.</param>
+    void AddBud(string manifestPath, BudInfo budInfo);
+
+    /// <summary>
+    /// Saves the cache to the disk if it changed since it was loaded. Only the buds that were retrieved or added since
+    /// it was loaded are kept. Failing to save is not fatal since the buds will simply be misses on the next boot.
+    /// </summary>
+    void Save();
+}
+
+/// <inheritdoc/>
+internal sealed class BudsDiscoveryCache : IBudsDiscoveryCache
+{
+    private sealed class CacheData
+    {
+        public required int FormatVersion { get; init; }
+        public required Dictionary<string, CacheEntry> EntriesByManifestPaths { get; init; } = new();
+    }
+
+    private sealed class CacheEntry
+    {
+        public required long ManifestSize { get; init; }
+        public required long ManifestLastWriteTimeUtcTicks { get; init; }
+        public required string AssemblyPath { get; init; }
+        public required long AssemblySize { get; init; }
+        public required long AssemblyLastWriteTimeUtcTicks { get; init; }
+        public required BudManifest BudManifest { get; init; }
+        public required string BudTypeFullName { get; init; }
+    }
+
+    internal const string CacheFileName = "BudsDiscoveryCache.json";
+
+    // This must be incremented whenever the layout of the cache or what makes a bud well-formed changes
+    private const int CacheFormatVersion = 1;
+
+    private readonly string _cachePath;
+    private readonly IFileSystem _fileSystem;
+    private readonly ILogger<BudsDiscoveryCache> _logger;
+
+    private Dictionary<string, CacheEntry> _loadedEntries = new();
+    private readonly ConcurrentDictionary<string, CacheEntry> _currentEntries = new();
+    private int _hits;
+    private int _misses;
+    private bool _hasNewEntries;
+
+    public BudsDiscoveryCache(
+        IFileSystem fileSystem,
+        ILogger<BudsDiscoveryCache> logger,
+        BudLoaderContext budLoaderContext)
+    {
+        _fileSystem = fileSystem;
+        _logger = logger;
+        _cachePath = _fileSystem.Path.Combine(budLoaderContext.LoaderPath, CacheFileName);
+    }
+
+    public int Hits => _hits;
+    public int Misses => _misses;
+
+    public void Load()
+    {
+        _loadedEntries = new();
+        _currentEntries.Clear();
+        _hits = 0;
+        _misses = 0;
+        _hasNewEntries = false;
+
+        if (!_fileSystem.File.Exists(_cachePath))
+            return;
+
+        try
+        {
+            CacheData? cacheData = JsonSerializer.Deserialize<CacheData>(
+                _fileSystem.File.ReadAllText(_cachePath),
+                BudsDiscoverer.BudManifestSerializerOptions);
+            if (cacheData?.FormatVersion != CacheFormatVersion)
+            {
+                _logger.LogInformation("The buds discovery cache is from a different version and will be regenerated");
+                return;
+            }
+
+            _loadedEntries = cacheData.EntriesByManifestPaths;
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(
+                e,
+                "Unable to read the buds discovery cache at {path}, it will be regenerated",
+                _cachePath);
+        }
+    }
+
+    public bool TryGetBud(string manifestPath, [NotNullWhen(true)] out BudInfo? budInfo)
+    {
+        budInfo = null;
+        if (!_loadedEntries.TryGetValue(manifestPath, out CacheEntry? entry) ||
+            !IsFileUnchanged(manifestPath, entry.ManifestSize, entry.ManifestLastWriteTimeUtcTicks) ||
+            !IsFileUnchanged(entry.AssemblyPath, entry.AssemblySize, entry.AssemblyLastWriteTimeUtcTicks))
+        {
+            Interlocked.Increment(ref _misses);
+            return false;
+        }
+
+        _currentEntries[manifestPath] = entry;
+        Interlocked.Increment(ref _hits);
+        budInfo = new()
+        {
+            BudManifest = entry.BudManifest,
+            BudAssemblyPath = entry.AssemblyPath,
+            BudTypeFullName = entry.BudTypeFullName
+        };
+        return true;
+    }
+
+    public void AddBud(string manifestPath, BudInfo budInfo)
+    {
+        IFileInfo manifestFileInfo = _fileSystem.FileInfo.New(manifestPath);
+        IFileInfo assemblyFileInfo = _fileSystem.FileInfo.New(budInfo.BudAssemblyPath);
+        _currentEntries[manifestPath] = new()
+        {
+            ManifestSize = manifestFileInfo.Length,
+            ManifestLastWriteTimeUtcTicks = manifestFileInfo.LastWriteTimeUtc.Ticks,
+            AssemblyPath = budInfo.BudAssemblyPath,
+            AssemblySize = assemblyFileInfo.Length,
+            AssemblyLastWriteTimeUtcTicks = assemblyFileInfo.LastWriteTimeUtc.Ticks,
+            BudManifest = budInfo.BudManifest,
+            BudTypeFullName = budInfo.BudTypeFullName
+        };
+        _hasNewEntries = true;
+    }
+
+    public void Save()
+    {
+        // Buds that were removed or are no longer well-formed don't get retrieved so they are pruned when saving
+        if (!_hasNewEntries && _currentEntries.Count == _loadedEntries.Count)
+            return;
+
+        // We write to a temporary file first so a crash while saving can't leave a truncated cache behind
+        string temporaryCachePath = _cachePath + ".tmp";
+        try
+        {
+            CacheData cacheData = new()
+            {
+                FormatVersion = CacheFormatVersion,
+                EntriesByManifestPaths = new(_currentEntries)
+            };
+            _fileSystem.File.WriteAllText(
+                temporaryCachePath,
+                JsonSerializer.Serialize(cacheData, BudsDiscoverer.BudManifestSerializerOptions));
+
+            if (_fileSystem.File.Exists(_cachePath))
+                _fileSystem.File.Delete(_cachePath);
+            _fileSystem.File.Move(temporaryCachePath, _cachePath);
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(e, "Unable to save the buds discovery cache to {path}", _cachePath);
+        }
+    }
+
+    private bool IsFileUnchanged(string path, long size, long lastWriteTimeUtcTicks)
+    {
+        IFileInfo fileInfo = _fileSystem.FileInfo.New(path);
+        return fileInfo.Exists && fileInfo.Length == size && fileInfo.LastWriteTimeUtc.Ticks == lastWriteTimeUtcTicks;
+    }
+}
\ No newline at end of file
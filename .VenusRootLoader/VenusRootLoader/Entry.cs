@@ -6,8 +6,10 @@ using UnityEngine;
 using VenusRootLoader.BaseGameCollector;
 using VenusRootLoader.Logging;
 using VenusRootLoader.Patching;
+using VenusRootLoader.Tracing;
 
 [assembly: InternalsVisibleTo("VenusRootLoader.Tests")]
+[assembly: InternalsVisibleTo("VenusRootLoader.Benchmarks")]
 [assembly: InternalsVisibleTo("DynamicProxyGenAssembly2")]
 
 namespace VenusRootLoader;
@@ -20,18 +22,26 @@ internal static class Entry
     private static BootstrapFunctions.BootstrapLogFn _bootstrapLog = null!;
     private static string _basePath = null!;
 
-    internal static void Main(nint bootstrapLogFunctionPtr, nint gameExecutionContextPtr, nint basePathPtr)
+    internal static void Main(
+        nint bootstrapLogFunctionPtr,
+        nint bootstrapTraceFunctionPtr,
+        nint gameExecutionContextPtr,
+        nint basePathPtr)
     {
         try
         {
             _bootstrapLog =
                 Marshal.GetDelegateForFunctionPointer<BootstrapFunctions.BootstrapLogFn>(bootstrapLogFunctionPtr);
+            BootstrapFunctions.BootstrapTraceFn? bootstrapTrace = bootstrapTraceFunctionPtr == 0
+                ? null
+                : Marshal.GetDelegateForFunctionPointer<BootstrapFunctions.BootstrapTraceFn>(bootstrapTraceFunctionPtr);
             _gameExecutionContext = Marshal.PtrToStructure<GameExecutionContext>(gameExecutionContextPtr);
             _basePath = Marshal.PtrToStringUni(basePathPtr)!;
             IServiceProvider host = Startup.BuildServiceProvider(
                 _basePath,
                 _gameExecutionContext,
-                new() { BootstrapLog = _bootstrapLog });
+                new() { BootstrapLog = _bootstrapLog, BootstrapTrace = bootstrapTrace });
+            ITracer tracer = host.GetRequiredService<ITracer>();
 
             AppDomainEventsHandler appDomainEventsHandler = host.GetRequiredService<AppDomainEventsHandler>();
             appDomainEventsHandler.InstallHandlers();
@@ -39,11 +49,14 @@ internal static class Entry
             UnityLogger unityLogger = host.GetRequiredService<UnityLogger>();
             unityLogger.InstallManagedUnityLogger();
 
-            RunAllCollectors(host);
-            Resources.UnloadUnusedAssets();
+            using (tracer.BeginSpan("Base game data collection", "Loader"))
+                RunAllCollectors(host);
+            using (tracer.BeginSpan(nameof(Resources.UnloadUnusedAssets), "Loader"))
+                Resources.UnloadUnusedAssets();
 
             RootPatcher patcher = host.GetRequiredService<RootPatcher>();
-            patcher.RunAllTopLevelPatchers();
+            using (tracer.BeginSpan("Top level patching", "Loader"))
+                patcher.RunAllTopLevelPatchers();
         }
         catch (Exception e)
         {
@@ -0,0 +1,60 @@
+using System.Buffers;
+using System.Globalization;
+
+namespace VenusRootLoader.Extensions;
+
+internal static class BufferWriterExtensions
+{
+    // The length of int.MinValue formatted
+    private const int MaxInt32Length = 11;
+
+    extension(IBufferWriter<char> writer)
+    {
+        public IBufferWriter<char> Write(char value)
+        {
+            writer.GetSpan(1)[0] = value;
+            writer.Advance(1);
+            return writer;
+        }
+
+        public IBufferWriter<char> Write(string value)
+        {
+            writer.Write(value.AsSpan());
+            return writer;
+        }
+
+        public IBufferWriter<char> WriteInvariant(bool value) =>
+            writer.Write(value ? bool.TrueString : bool.FalseString);
+
+        public IBufferWriter<char> WriteInvariant(int value)
+        {
+            Span<char> destination = writer.GetSpan(MaxInt32Length);
+            writer.Advance(FormatInt32(value, destination));
+            return writer;
+        }
+
+        public IBufferWriter<char> WriteInvariant(float value) =>
+            writer.Write(value.ToString(CultureInfo.InvariantCulture));
+    }
+
+    // Formats the same way as int.ToString(CultureInfo.InvariantCulture) would
+    private static int FormatInt32(int value, Span<char> destination)
+    {
+        uint magnitude = value < 0 ? (uint)(0 - (long)value) : (uint)value;
+        int digitsCount = 1;
+        for (uint remaining = magnitude / 10; remaining > 0; remaining /= 10)
+            digitsCount++;
+
+        int length = value < 0 ? digitsCount + 1 : digitsCount;
+        if (value < 0)
+            destination[0] = '-';
+
+        for (int i = length - 1; i >= length - digitsCount; i--)
+        {
+            destination[i] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        }
+
+        return length;
+    }
+}
\ No newline at end of file
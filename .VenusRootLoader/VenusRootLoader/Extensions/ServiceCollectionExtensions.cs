@@ -1,6 +1,7 @@
 using Microsoft.Extensions.DependencyInjection;
 using Microsoft.Extensions.Logging;
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.BaseGameCollector;
 using VenusRootLoader.Patching;
 using VenusRootLoader.Patching.Resources.TextAssetPatchers;
 using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers;
@@ -33,6 +34,7 @@ internal static class ServiceCollectionExtensions
                     provider.GetRequiredService<EnumPatcher>(),
                     provider.GetRequiredService<ILoggerFactory>().CreateLogger(
                         IServiceCollection.GenerateRegistryLogCategoryName<TLeaf>())));
+            collection.AddNonGenericLeavesRegistry<TLeaf>();
             return collection;
         }
 
@@ -71,6 +73,7 @@ internal static class ServiceCollectionExtensions
                         .CreateLogger(IServiceCollection.GenerateRegistryLogCategoryName<TLeaf>()),
                     sequenceDirection,
                     firstGameId));
+            collection.AddNonGenericLeavesRegistry<TLeaf>();
             return collection;
         }
 
@@ -99,12 +102,15 @@ internal static class ServiceCollectionExtensions
         /// <param name="textAssetResourcesPath">The resources paths that the patcher and parser can handle.</param>
         /// <param name="leavesSorter">A calback to determine the order of the leaves as they appear in the TextAsset
         /// if they do not follow their <see cref="Leaf.GameId"/> order.</param>
+        /// <param name="otherLeavesVersion">A callback to obtain the combined version of the other <see cref="Leaf"/>
+        /// types the parser reads beyond their game id, if there are any.</param>
         /// <typeparam name="TLeaf">The type of <see cref="Leaf"/> to patch.</typeparam>
         /// <typeparam name="TTextAssetParser">The matching <see cref="ITextAssetParser{T}"/> that can handle the leaves.</typeparam>
         /// <returns>The service collection.</returns>
         internal IServiceCollection AddTextAssetPatcher<TLeaf, TTextAssetParser>(
             string[] textAssetResourcesPath,
-            Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? leavesSorter = null)
+            Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? leavesSorter = null,
+            Func<int>? otherLeavesVersion = null)
             where TLeaf : Leaf
             where TTextAssetParser : class, ITextAssetParser<TLeaf>
         {
@@ -113,9 +119,11 @@ internal static class ServiceCollectionExtensions
                 textAssetResourcesPath,
                 provider.GetRequiredService<ILogger<TextAssetPatcher<TLeaf>>>(),
                 provider.GetRequiredService<ITextAssetDumper>(),
+                provider.GetRequiredService<ITextAssetPatchCache>(),
                 provider.GetRequiredService<ILeavesRegistry<TLeaf>>(),
                 provider.GetRequiredService<ITextAssetParser<TLeaf>>(),
-                leavesSorter));
+                leavesSorter,
+                otherLeavesVersion));
             return collection;
         }
 
@@ -136,6 +144,7 @@ internal static class ServiceCollectionExtensions
                 textAssetResourcesPath,
                 provider.GetRequiredService<ILogger<OrderingTextAssetPatcher<TLeaf>>>(),
                 provider.GetRequiredService<ITextAssetDumper>(),
+                provider.GetRequiredService<ITextAssetPatchCache>(),
                 provider.GetRequiredService<IOrderedLeavesRegistry<TLeaf>>(),
                 provider.GetRequiredService<IOrderingTextAssetParser<TLeaf>>()));
             return collection;
@@ -163,12 +172,63 @@ internal static class ServiceCollectionExtensions
                 textAssetResourcesSubpath,
                 provider.GetRequiredService<ILogger<LocalizedTextAssetPatcher<TLeaf>>>(),
                 provider.GetRequiredService<ITextAssetDumper>(),
+                provider.GetRequiredService<ITextAssetPatchCache>(),
                 provider.GetRequiredService<ILeavesRegistry<TLeaf>>(),
                 provider.GetRequiredService<ILocalizedTextAssetParser<TLeaf>>(),
                 leavesSorter));
             return collection;
         }
 
+        /// <summary>
+        /// Adds every <see cref="IBaseGameCollector"/> in the order they get registered and parsed by the
+        /// <see cref="RootCollector"/>.
+        /// </summary>
+        /// <returns>The service collection.</returns>
+        internal IServiceCollection AddBaseGameCollectors()
+        {
+            collection.AddScoped<IBaseGameCollector, LanguagesCollector>();
+            collection.AddScoped<IBaseGameCollector, EventCollector>();
+            collection.AddScoped<IBaseGameCollector, DialogueBleepCollector>();
+            collection.AddScoped<IBaseGameCollector, AnimIdsCollector>();
+            collection.AddScoped<IBaseGameCollector, ItemsCollector>();
+            collection.AddScoped<IBaseGameCollector, BattleEventDialoguesCollector>();
+            collection.AddScoped<IBaseGameCollector, EnemiesCollector>();
+            collection.AddScoped<IBaseGameCollector, RecipesCollector>();
+            collection.AddScoped<IBaseGameCollector, RecipeLibraryEntriesCollector>();
+            collection.AddScoped<IBaseGameCollector, AreasCollector>();
+            collection.AddScoped<IBaseGameCollector, MedalsCollector>();
+            collection.AddScoped<IBaseGameCollector, GlobalFlagsCollector>();
+            collection.AddScoped<IBaseGameCollector, PrizeMedalsCollector>();
+            collection.AddScoped<IBaseGameCollector, CrystalBerriesCollector>();
+            collection.AddScoped<IBaseGameCollector, CommonDialoguesCollector>();
+            collection.AddScoped<IBaseGameCollector, MedalFortuneTellerHintCollector>();
+            collection.AddScoped<IBaseGameCollector, MenuTextsCollector>();
+            collection.AddScoped<IBaseGameCollector, DiscoveriesCollector>();
+            collection.AddScoped<IBaseGameCollector, RecordsCollector>();
+            collection.AddScoped<IBaseGameCollector, TermacadePrizesCollector>();
+            collection.AddScoped<IBaseGameCollector, MusicsCollector>();
+            collection.AddScoped<IBaseGameCollector, QuestsCollector>();
+            collection.AddScoped<IBaseGameCollector, RankBonusesCollector>();
+            collection.AddScoped<IBaseGameCollector, LoreBooksCollector>();
+            collection.AddScoped<IBaseGameCollector, ActionCommandHelpTextsCollector>();
+            collection.AddScoped<IBaseGameCollector, SkillsCollector>();
+            collection.AddScoped<IBaseGameCollector, FishingTextsCollector>();
+            collection.AddScoped<IBaseGameCollector, SpyCardsTextsCollector>();
+            collection.AddScoped<IBaseGameCollector, SpyCardsCollector>();
+            collection.AddScoped<IBaseGameCollector, MedalShopsCollector>();
+            collection.AddScoped<IBaseGameCollector, CuttableGrassCollector>();
+            collection.AddScoped<IBaseGameCollector, MapsCollector>();
+            collection.AddScoped<RootCollector>();
+            return collection;
+        }
+
+        // This allows services that needs to operate on every registry to get them all regardless of their leaf type
+        private void AddNonGenericLeavesRegistry<TLeaf>()
+            where TLeaf : Leaf
+        {
+            collection.AddSingleton<ILeavesRegistry>(provider => provider.GetRequiredService<ILeavesRegistry<TLeaf>>());
+        }
+
         private static string GenerateRegistryLogCategoryName<TLeaf>() where TLeaf : Leaf =>
             $"{nameof(VenusRootLoader)}.{nameof(Registry)}.{typeof(TLeaf).Name}Registry";
     }
@@ -0,0 +1,71 @@
+using VenusRootLoader.Api.Leaves;
+
+namespace VenusRootLoader.LeavesInternals;
+
+/// <summary>
+/// Tracks the modifications done to the leaves of a type and to the data they own with a version that changes every
+/// time a leaf of that type gets registered or any of their setters or collections gets modified. Services deriving
+/// data from the leaves can compare the versions of the leaf types they read to know if their derived data is still
+/// up to date without requiring anything from the buds.
+/// </summary>
+/// <remarks>
+/// Each leaf type has its own version so modifying a leaf only invalidates the data derived from its type. The type
+/// is the one of its registry, which means every kind of map entity shares the version of <see cref="MapEntityLeaf"/>.
+/// </remarks>
+/// <typeparam name="TLeaf">The type of the leaves whose modifications are tracked.</typeparam>
+internal static class LeafModifications<TLeaf>
+    where TLeaf : Leaf
+{
+    private static int _version;
+
+    /// <summary>
+    /// Signals a modification of the leaves of this type. This is meant to be given to the collections owned by the
+    /// leaves so they can signal their own modifications.
+    /// </summary>
+    internal static readonly Action Notifier = Notify;
+
+    /// <summary>
+    /// The current version of the leaves of this type. Reading it doesn't count as a modification.
+    /// </summary>
+    /// <remarks>
+    /// Modifications of data that couldn't be attributed to a leaf type also change it. Both counters only ever go up
+    /// by one at a time so their sum changes every time one of them does.
+    /// </remarks>
+    internal static int Version => Volatile.Read(ref _version) + LeafModifications.UnattributedVersion;
+
+    /// <summary>
+    /// Signals that a leaf of this type or some of its data was modified which changes the <see cref="Version"/>.
+    /// </summary>
+    internal static void Notify() => Interlocked.Increment(ref _version);
+
+    /// <summary>
+    /// Sets the backing field of a leaf's property and signals the modification.
+    /// </summary>
+    /// <param name="field">The backing field of the property.</param>
+    /// <param name="value">The new value of the property.</param>
+    /// <typeparam name="T">The type of the property.</typeparam>
+    internal static void Set<T>(ref T field, T value)
+    {
+        field = value;
+        Notify();
+    }
+}
+
+/// <summary>
+/// Tracks the modifications of leaf data whose leaf type isn't known such as a collection a bud created itself before
+/// assigning it to a leaf. They change the <see cref="LeafModifications{TLeaf}.Version"/> of every leaf type.
+/// </summary>
+internal static class LeafModifications
+{
+    private static int _unattributedVersion;
+
+    /// <summary>
+    /// The version of the modifications that couldn't be attributed to a leaf type.
+    /// </summary>
+    internal static int UnattributedVersion => Volatile.Read(ref _unattributedVersion);
+
+    /// <summary>
+    /// Signals a modification of leaf data whose leaf type isn't known.
+    /// </summary>
+    internal static void NotifyAll() => Interlocked.Increment(ref _unattributedVersion);
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 using System.Collections;
+using VenusRootLoader.Api;
 
 namespace VenusRootLoader.LeavesInternals;
 
@@ -20,8 +21,8 @@ internal sealed class ListDoubleRefWrapper<TWrapper, TWrapped1, TWrapped2> : ILi
     where TWrapped1 : struct
     where TWrapped2 : struct
 {
-    private readonly List<Ref<TWrapped1>> _wrappedList1;
-    private readonly List<Ref<TWrapped2>> _wrappedList2;
+    private readonly LeafList<Ref<TWrapped1>> _wrappedList1;
+    private readonly LeafList<Ref<TWrapped2>> _wrappedList2;
     private readonly int _startingIndex;
     private readonly Func<TWrapper, Ref<TWrapped1>> _refWrapper1;
     private readonly Func<TWrapper, Ref<TWrapped2>> _refWrapper2;
@@ -36,8 +37,8 @@ internal sealed class ListDoubleRefWrapper<TWrapper, TWrapped1, TWrapped2> : ILi
     /// <param name="refWrapper1">A function that transforms a <typeparamref name="TWrapper"/> into a <see cref="Ref{T}"/> of <typeparamref name="TWrapped1"/>.</param>
     /// <param name="refWrapper2">A function that transforms a <typeparamref name="TWrapper"/> into a <see cref="Ref{T}"/> of <typeparamref name="TWrapped2"/>.</param>
     internal ListDoubleRefWrapper(
-        List<Ref<TWrapped1>> wrappedList1,
-        List<Ref<TWrapped2>> wrappedList2,
+        LeafList<Ref<TWrapped1>> wrappedList1,
+        LeafList<Ref<TWrapped2>> wrappedList2,
         int startingIndex,
         Func<TWrapper, Ref<TWrapped1>> refWrapper1,
         Func<TWrapper, Ref<TWrapped2>> refWrapper2)
@@ -1,4 +1,5 @@
 using System.Collections;
+using VenusRootLoader.Api;
 
 namespace VenusRootLoader.LeavesInternals;
 
@@ -18,7 +19,7 @@ namespace VenusRootLoader.LeavesInternals;
 internal sealed class ListRefWrapper<TWrapper, TWrapped> : IList<TWrapper>
     where TWrapped : struct
 {
-    private readonly List<Ref<TWrapped>> _wrappedList;
+    private readonly LeafList<Ref<TWrapped>> _wrappedList;
     private readonly int _startingIndex;
     private readonly Func<TWrapper, Ref<TWrapped>> _refWrapper;
     private readonly List<TWrapper> _backingList = new();
@@ -30,7 +31,7 @@ internal sealed class ListRefWrapper<TWrapper, TWrapped> : IList<TWrapper>
     /// <param name="startingIndex">The starting index to bind the underlying list's elements.</param>
     /// <param name="refWrapper">A function that transforms a <typeparamref name="TWrapper"/> into a <see cref="Ref{T}"/> of <typeparamref name="TWrapped"/>.</param>
     internal ListRefWrapper(
-        List<Ref<TWrapped>> wrappedList,
+        LeafList<Ref<TWrapped>> wrappedList,
         int startingIndex,
         Func<TWrapper, Ref<TWrapped>> refWrapper)
     {
@@ -1,3 +1,5 @@
+using VenusRootLoader.Api.Leaves;
+
 namespace VenusRootLoader.LeavesInternals;
 
 /// <summary>
@@ -8,9 +10,10 @@ internal sealed class Ref<T>
     where T : struct
 {
     /// <summary>
-    /// The value referred to by this instance.
+    /// The value referred to by this instance. Setting it counts as a modification of the leaf owning it which is
+    /// always a <see cref="MapEntityLeaf"/>.
     /// </summary>
-    internal T Value;
+    internal T Value { get; set => LeafModifications<MapEntityLeaf>.Set(ref field, value); }
 
     /// <summary>
     /// Creates a <see cref="Ref{T}"/> from a value.
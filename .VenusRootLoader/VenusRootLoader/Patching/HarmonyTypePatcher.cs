@@ -1,5 +1,6 @@
 using HarmonyLib;
 using VenusRootLoader.Logging;
+using VenusRootLoader.Tracing;
 
 namespace VenusRootLoader.Patching;
 
@@ -20,12 +21,18 @@ internal interface IHarmonyTypePatcher
 internal sealed class HarmonyTypePatcher : IHarmonyTypePatcher
 {
     private readonly Harmony _harmonyInstance;
+    private readonly ITracer _tracer;
 
-    public HarmonyTypePatcher(HarmonyLogger harmonyLogger)
+    public HarmonyTypePatcher(HarmonyLogger harmonyLogger, ITracer tracer)
     {
+        _tracer = tracer;
         harmonyLogger.InstallHarmonyLogging();
         _harmonyInstance = new Harmony(nameof(VenusRootLoader));
     }
 
-    public void PatchAll(Type type) => _harmonyInstance.PatchAll(type);
+    public void PatchAll(Type type)
+    {
+        using TraceSpan span = _tracer.BeginSpan(type.Name, nameof(Harmony.PatchAll));
+        _harmonyInstance.PatchAll(type);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.Registry;
+
+namespace VenusRootLoader.Patching.Logic;
+
+/// <summary>
+/// A patcher that freezes every registry including the map entities and map dialogues registries of every map. This
+/// must happen right after loading all buds since no leaves can be registered after that point.
+/// </summary>
+internal sealed class RegistriesFreezeTopLevelPatcher : ITopLevelPatcher
+{
+    private readonly IEnumerable<ILeavesRegistry> _registries;
+    private readonly ILeavesRegistry<MapLeaf> _mapsRegistry;
+
+    public RegistriesFreezeTopLevelPatcher(
+        IEnumerable<ILeavesRegistry> registries,
+        ILeavesRegistry<MapLeaf> mapsRegistry)
+    {
+        _registries = registries;
+        _mapsRegistry = mapsRegistry;
+    }
+
+    public void Patch()
+    {
+        foreach (ILeavesRegistry registry in _registries)
+            registry.Freeze();
+
+        foreach (MapLeaf map in _mapsRegistry)
+        {
+            map.EntitiesRegistry.Freeze();
+            map.DialoguesRegistry.Freeze();
+        }
+    }
+}
\ No newline at end of file
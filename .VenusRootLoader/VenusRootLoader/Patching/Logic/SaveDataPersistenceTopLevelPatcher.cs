@@ -5,6 +5,7 @@ using System.Reflection;
 using System.Reflection.Emit;
 using UnityEngine;
 using VenusRootLoader.Persistence;
+using VenusRootLoader.Tracing;
 
 namespace VenusRootLoader.Patching.Logic;
 
@@ -35,16 +36,21 @@ internal sealed class SaveDataPersistenceTopLevelPatcher : ITopLevelPatcher
 
     private static readonly string BaseGameSavesPrefix = IsGogEdition ? "Saves/save" : "save";
 
+    private const string SaveDataTraceCategory = "SaveData";
+
     private readonly IHarmonyTypePatcher _harmonyTypePatcher;
     private readonly ISaveDataPersistence _saveDataPersistence;
+    private readonly ITracer _tracer;
 
     public SaveDataPersistenceTopLevelPatcher(
         IHarmonyTypePatcher harmonyTypePatcher,
-        ISaveDataPersistence saveDataPersistence)
+        ISaveDataPersistence saveDataPersistence,
+        ITracer tracer)
     {
         _instance = this;
         _harmonyTypePatcher = harmonyTypePatcher;
         _saveDataPersistence = saveDataPersistence;
+        _tracer = tracer;
     }
 
     public void Patch() => _harmonyTypePatcher.PatchAll(typeof(SaveDataPersistenceTopLevelPatcher));
@@ -59,11 +65,13 @@ internal sealed class SaveDataPersistenceTopLevelPatcher : ITopLevelPatcher
 
         if (lite)
         {
-            __result = _instance._saveDataPersistence.LoadLiteSaveDataFromSlot(file);
+            using (_instance._tracer.BeginSpan("Load lite save data", SaveDataTraceCategory))
+                __result = _instance._saveDataPersistence.LoadLiteSaveDataFromSlot(file);
             return false;
         }
 
-        __result = _instance._saveDataPersistence.LoadFullSaveDataFromSlot(file);
+        using (_instance._tracer.BeginSpan("Load full save data", SaveDataTraceCategory))
+            __result = _instance._saveDataPersistence.LoadFullSaveDataFromSlot(file);
         // This is necessary for the stats calc and HUD to work properly since the save loading effectively did a ChangeParty
         MainManager.RebuildHUD();
         return false;
@@ -74,6 +82,7 @@ internal sealed class SaveDataPersistenceTopLevelPatcher : ITopLevelPatcher
     // ReSharper disable once InconsistentNaming
     internal static bool WriteSaveData(Vector3? savepos, ref bool __result)
     {
+        using TraceSpan span = _instance._tracer.BeginSpan("Write save data", SaveDataTraceCategory);
         __result = _instance._saveDataPersistence.WriteSaveDataToSaveSlot(MainManager.saveslot, savepos);
         return false;
     }
@@ -1,6 +1,7 @@
 using HarmonyLib;
 using System.Diagnostics.CodeAnalysis;
 using UnityEngine;
+using VenusRootLoader.Tracing;
 using Object = UnityEngine.Object;
 
 namespace VenusRootLoader.Patching.Resources;
@@ -9,6 +10,8 @@ namespace VenusRootLoader.Patching.Resources;
 /// A patcher that processes all <see cref="IResourcesTypePatcher{T}"/> and <see cref="IResourcesArrayTypePatcher{T}"/>.
 /// Notably, it's where <c>Resources.Load</c> and <c>Resources.LoadAll</c> are patched.
 /// The expectation is that each resources type patchers handles patching a specific type of resources.
+/// When tracing is enabled, every patch is recorded in a span named after the resource's path so hitches caused by a
+/// bud's resources can be found.
 /// </summary>
 internal sealed class ResourcesTopLevelPatcher : ITopLevelPatcher
 {
@@ -19,6 +22,7 @@ internal sealed class ResourcesTopLevelPatcher : ITopLevelPatcher
     private readonly IResourcesTypePatcher<Object> _prefabPatcher;
     private readonly IResourcesArrayTypePatcher<Sprite> _spriteArrayPatcher;
     private readonly IResourcesArrayTypePatcher<AudioClip> _audioClipArrayPatcher;
+    private readonly ITracer _tracer;
 
     public ResourcesTopLevelPatcher(
         IHarmonyTypePatcher harmonyTypePatcher,
@@ -26,7 +30,8 @@ internal sealed class ResourcesTopLevelPatcher : ITopLevelPatcher
         IResourcesTypePatcher<AudioClip> audioClipPatcher,
         IResourcesTypePatcher<Object> prefabPatcher,
         IResourcesArrayTypePatcher<Sprite> spriteArrayPatcher,
-        IResourcesArrayTypePatcher<AudioClip> audioClipArrayPatcher)
+        IResourcesArrayTypePatcher<AudioClip> audioClipArrayPatcher,
+        ITracer tracer)
     {
         _instance = this;
         _harmonyTypePatcher = harmonyTypePatcher;
@@ -35,6 +40,7 @@ internal sealed class ResourcesTopLevelPatcher : ITopLevelPatcher
         _prefabPatcher = prefabPatcher;
         _audioClipPatcher = audioClipPatcher;
         _audioClipArrayPatcher = audioClipArrayPatcher;
+        _tracer = tracer;
     }
 
     public void Patch() => _harmonyTypePatcher.PatchAll(typeof(ResourcesTopLevelPatcher));
@@ -43,6 +49,7 @@ internal sealed class ResourcesTopLevelPatcher : ITopLevelPatcher
     [HarmonyPatch(typeof(UnityEngine.Resources), nameof(UnityEngine.Resources.Load), [typeof(string), typeof(Type)])]
     private static void PatchResources(string path, Type systemTypeInstance, ref Object __result)
     {
+        using TraceSpan span = _instance._tracer.BeginSpan(path, nameof(UnityEngine.Resources.Load));
         if (systemTypeInstance == typeof(TextAsset))
             __result = _instance._textAssetPatcher.PatchResource(path, (TextAsset)__result);
         if (systemTypeInstance == typeof(AudioClip))
@@ -56,6 +63,7 @@ internal sealed class ResourcesTopLevelPatcher : ITopLevelPatcher
     [SuppressMessage("ReSharper", "CoVariantArrayConversion")]
     private static void PatchResourcesArray(string path, Type systemTypeInstance, ref Object[] __result)
     {
+        using TraceSpan span = _instance._tracer.BeginSpan(path, nameof(UnityEngine.Resources.LoadAll));
         if (systemTypeInstance == typeof(Sprite))
         {
             __result = _instance._spriteArrayPatcher.PatchResources(path, __result.Cast<Sprite>().ToArray());
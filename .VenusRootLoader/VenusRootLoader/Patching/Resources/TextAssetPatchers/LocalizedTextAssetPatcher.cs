@@ -2,6 +2,7 @@ using Microsoft.Extensions.Logging;
 using System.Text;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers;
 using VenusRootLoader.Registry;
 
@@ -40,6 +41,7 @@ internal sealed class LocalizedTextAssetPatcher<TLeaf> : ILocalizedTextAssetPatc
 {
     private readonly ILogger<LocalizedTextAssetPatcher<TLeaf>> _logger;
     private readonly ITextAssetDumper _textAssetDumper;
+    private readonly ITextAssetPatchCache _textAssetPatchCache;
     private readonly ILeavesRegistry<TLeaf> _registry;
     private readonly ILocalizedTextAssetParser<TLeaf> _parser;
     private readonly Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? _leavesSorter;
@@ -48,6 +50,7 @@ internal sealed class LocalizedTextAssetPatcher<TLeaf> : ILocalizedTextAssetPatc
         string[] subPaths,
         ILogger<LocalizedTextAssetPatcher<TLeaf>> logger,
         ITextAssetDumper textAssetDumper,
+        ITextAssetPatchCache textAssetPatchCache,
         ILeavesRegistry<TLeaf> registry,
         ILocalizedTextAssetParser<TLeaf> parser,
         Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? leavesSorter)
@@ -58,11 +61,37 @@ internal sealed class LocalizedTextAssetPatcher<TLeaf> : ILocalizedTextAssetPatc
         _logger = logger;
         _parser = parser;
         _textAssetDumper = textAssetDumper;
+        _textAssetPatchCache = textAssetPatchCache;
     }
 
     public string[] SubPaths { get; }
 
     public TextAsset PatchLocalisedTextAsset(int languageId, string subpath, TextAsset original)
+    {
+        // The localized data falls back to the first language when it has no data for the requested one
+        int version = LeafModifications<TLeaf>.Version + LeafModifications<LanguageLeaf>.Version;
+        if (_textAssetPatchCache.TryGetPatchedText(subpath, languageId, version, out string? cachedText))
+            return new TextAsset(cachedText);
+
+        // Some game data relies on having a trailing LF for the parsing to work correctly
+        bool appendTrailingLineFeed = original != null && original.text.EndsWith("\n");
+        string text = BuildPatchedText(languageId, subpath, appendTrailingLineFeed);
+        _textAssetPatchCache.SetPatchedText(subpath, languageId, version, text);
+        if (_logger.IsEnabled(LogLevel.Trace))
+            _textAssetDumper.DumpTextAssetContent(subpath, text);
+
+        return new TextAsset(text);
+    }
+
+    /// <summary>
+    /// Builds the patched text of a localized <see cref="TextAsset"/> from every leaf of the registry. This doesn't
+    /// involve any Unity objects so it can be measured outside the game.
+    /// </summary>
+    /// <param name="languageId">The language game id the localized <see cref="TextAsset"/> is associated with.</param>
+    /// <param name="subpath">The resources path excluding the <c>Data/DialoguesX/</c> prefix.</param>
+    /// <param name="appendTrailingLineFeed">Tells if the text should end with a LF like the original one.</param>
+    /// <returns>The patched text.</returns>
+    internal string BuildPatchedText(int languageId, string subpath, bool appendTrailingLineFeed)
     {
         string assetName = subpath[(subpath.LastIndexOf('/') + 1)..];
         IEnumerable<TLeaf> sortedLeaves = _leavesSorter is null
@@ -71,15 +100,9 @@ internal sealed class LocalizedTextAssetPatcher<TLeaf> : ILocalizedTextAssetPatc
         IEnumerable<string> newLines = sortedLeaves
             .Select(customLine => _parser.GetTextAssetSerializedString(assetName, languageId, customLine));
 
-        // Some game data relies on having a trailing LF for the parsing to work correctly
         StringBuilder sb = new(string.Join("\n", newLines));
-        if (original != null && original.text.EndsWith("\n"))
+        if (appendTrailingLineFeed)
             sb.Append('\n');
-
-        string text = sb.ToString();
-        if (_logger.IsEnabled(LogLevel.Trace))
-            _textAssetDumper.DumpTextAssetContent(subpath, text);
-
-        return new TextAsset(text);
+        return sb.ToString();
     }
 }
\ No newline at end of file
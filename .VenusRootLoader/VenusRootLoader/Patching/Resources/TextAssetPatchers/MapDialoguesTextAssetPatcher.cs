@@ -1,6 +1,7 @@
 using Microsoft.Extensions.Logging;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Registry;
 
 namespace VenusRootLoader.Patching.Resources.TextAssetPatchers;
@@ -28,12 +29,14 @@ internal sealed class MapDialoguesTextAssetPatcher : IMapDialoguesTextAssetPatch
 {
     private readonly ILogger<MapDialoguesTextAssetPatcher> _logger;
     private readonly ITextAssetDumper _textAssetDumper;
+    private readonly ITextAssetPatchCache _textAssetPatchCache;
     private readonly ILeavesRegistry<MapLeaf> _mapsRegistry;
     private readonly ILeavesRegistry<LanguageLeaf> _languageRegistry;
 
     public MapDialoguesTextAssetPatcher(
         ILogger<MapDialoguesTextAssetPatcher> logger,
         ITextAssetDumper textAssetDumper,
+        ITextAssetPatchCache textAssetPatchCache,
         ILeavesRegistry<MapLeaf> mapsRegistry,
         ILeavesRegistry<LanguageLeaf> languageRegistry)
     {
@@ -41,6 +44,7 @@ internal sealed class MapDialoguesTextAssetPatcher : IMapDialoguesTextAssetPatch
         _mapsRegistry = mapsRegistry;
         _languageRegistry = languageRegistry;
         _textAssetDumper = textAssetDumper;
+        _textAssetPatchCache = textAssetPatchCache;
     }
 
     public TextAsset PatchMapDialoguesTextAsset(int languageId, string path, TextAsset original)
@@ -53,11 +57,18 @@ internal sealed class MapDialoguesTextAssetPatcher : IMapDialoguesTextAssetPatch
         string mapName = path[mapNameStart..];
 
         MapLeaf leaf = _mapsRegistry.GetByEffectiveId(mapName);
+        int version = LeafModifications<MapLeaf>.Version +
+                      LeafModifications<MapDialogueLeaf>.Version +
+                      LeafModifications<LanguageLeaf>.Version;
+        if (_textAssetPatchCache.TryGetPatchedText(path, languageId, version, out string? cachedText))
+            return new TextAsset(cachedText);
+
         List<string> newLines = leaf.DialoguesRegistry
             .Select(d => d.LocalizedText[_languageRegistry.GetByGameId(languageId)])
             .ToList();
 
         string text = string.Join("\n", newLines);
+        _textAssetPatchCache.SetPatchedText(path, languageId, version, text);
         if (_logger.IsEnabled(LogLevel.Trace))
             _textAssetDumper.DumpTextAssetContent(path, text);
 
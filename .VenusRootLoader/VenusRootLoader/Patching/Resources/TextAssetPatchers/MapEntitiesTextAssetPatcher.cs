@@ -3,6 +3,7 @@ using System.Text;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.Api.Leaves.MapEntities;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers;
 using VenusRootLoader.Registry;
 
@@ -31,18 +32,21 @@ internal sealed class MapEntitiesTextAssetPatcher : IMapEntityTextAssetPatcher
 {
     private readonly ILogger<MapEntitiesTextAssetPatcher> _logger;
     private readonly ITextAssetDumper _textAssetDumper;
+    private readonly ITextAssetPatchCache _textAssetPatchCache;
     private readonly ILeavesRegistry<MapLeaf> _mapsRegistry;
     private readonly IMapEntityTextAssetParser _parser;
 
     public MapEntitiesTextAssetPatcher(
         ILogger<MapEntitiesTextAssetPatcher> logger,
         ITextAssetDumper textAssetDumper,
+        ITextAssetPatchCache textAssetPatchCache,
         ILeavesRegistry<MapLeaf> mapsRegistry,
         IMapEntityTextAssetParser parser)
     {
         _logger = logger;
         _parser = parser;
         _textAssetDumper = textAssetDumper;
+        _textAssetPatchCache = textAssetPatchCache;
         _mapsRegistry = mapsRegistry;
     }
 
@@ -67,17 +71,39 @@ internal sealed class MapEntitiesTextAssetPatcher : IMapEntityTextAssetPatcher
         }
 
         MapLeaf leaf = _mapsRegistry.GetByGameId(mapGameId);
-        IEnumerable<string> newLines = leaf.EntitiesRegistry
-            .Select(mapEntity => _parser.GetTextAssetSerializedString(path, mapEntity));
-
-        StringBuilder sb = new(string.Join("\n", newLines));
-        // The game always expects a trailing LF.
-        sb.Append('\n');
+        int version = LeafModifications<MapLeaf>.Version + LeafModifications<MapEntityLeaf>.Version;
+        if (_textAssetPatchCache.TryGetPatchedText(
+                path,
+                TextAssetPatchCache.NonLocalizedLanguageId,
+                version,
+                out string? cachedText))
+        {
+            return new TextAsset(cachedText);
+        }
 
-        string text = sb.ToString();
+        string text = BuildPatchedText(path, leaf);
+        _textAssetPatchCache.SetPatchedText(path, TextAssetPatchCache.NonLocalizedLanguageId, version, text);
         if (_logger.IsEnabled(LogLevel.Trace))
             _textAssetDumper.DumpTextAssetContent(path, text);
 
         return new TextAsset(text);
     }
+
+    /// <summary>
+    /// Builds the patched text of a map entities <see cref="TextAsset"/> from every entity of a map. This doesn't
+    /// involve any Unity objects so it can be measured outside the game.
+    /// </summary>
+    /// <param name="path">The resources path of the map entities <see cref="TextAsset"/>.</param>
+    /// <param name="map">The map whose entities are serialized.</param>
+    /// <returns>The patched text.</returns>
+    internal string BuildPatchedText(string path, MapLeaf map)
+    {
+        IEnumerable<string> newLines = map.EntitiesRegistry
+            .Select(mapEntity => _parser.GetTextAssetSerializedString(path, mapEntity));
+
+        StringBuilder sb = new(string.Join("\n", newLines));
+        // The game always expects a trailing LF.
+        sb.Append('\n');
+        return sb.ToString();
+    }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@ using Microsoft.Extensions.Logging;
 using System.Text;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers;
 using VenusRootLoader.Registry;
 
@@ -25,12 +26,14 @@ internal sealed class OrderingTextAssetPatcher<TLeaf> : IOrderingTextAssetPatche
     private readonly IOrderedLeavesRegistry<TLeaf> _orderedLeaves;
     private readonly ILogger<OrderingTextAssetPatcher<TLeaf>> _logger;
     private readonly ITextAssetDumper _textAssetDumper;
+    private readonly ITextAssetPatchCache _textAssetPatchCache;
     private readonly IOrderingTextAssetParser<TLeaf> _parser;
 
     public OrderingTextAssetPatcher(
         string subPaths,
         ILogger<OrderingTextAssetPatcher<TLeaf>> logger,
         ITextAssetDumper textAssetDumper,
+        ITextAssetPatchCache textAssetPatchCache,
         IOrderedLeavesRegistry<TLeaf> orderedLeaves,
         IOrderingTextAssetParser<TLeaf> parser)
     {
@@ -38,6 +41,7 @@ internal sealed class OrderingTextAssetPatcher<TLeaf> : IOrderingTextAssetPatche
         _logger = logger;
         _parser = parser;
         _textAssetDumper = textAssetDumper;
+        _textAssetPatchCache = textAssetPatchCache;
         _orderedLeaves = orderedLeaves;
     }
 
@@ -49,12 +53,23 @@ internal sealed class OrderingTextAssetPatcher<TLeaf> : IOrderingTextAssetPatche
         if (!registryHasData)
             return original;
 
+        int version = LeafModifications<TLeaf>.Version;
+        if (_textAssetPatchCache.TryGetPatchedText(
+                path,
+                TextAssetPatchCache.NonLocalizedLanguageId,
+                version,
+                out string? cachedText))
+        {
+            return new TextAsset(cachedText);
+        }
+
         // Some game data relies on having a trailing LF for the parsing to work correctly
         StringBuilder sb = new(_parser.GetTextAssetString(_orderedLeaves));
         if (original != null && original.text.EndsWith("\n"))
             sb.Append('\n');
 
         string text = sb.ToString();
+        _textAssetPatchCache.SetPatchedText(path, TextAssetPatchCache.NonLocalizedLanguageId, version, text);
         if (_logger.IsEnabled(LogLevel.Trace))
             _textAssetDumper.DumpTextAssetContent(path, text);
 
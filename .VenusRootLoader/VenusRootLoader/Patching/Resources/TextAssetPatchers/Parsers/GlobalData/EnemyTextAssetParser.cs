@@ -1,4 +1,5 @@
 using System.Text;
+using VenusRootLoader.Api;
 using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.Extensions;
 using VenusRootLoader.LeavesInternals;
@@ -105,7 +106,7 @@ internal sealed class EnemyTextAssetParser : ITextAssetParser<EnemyLeaf>
         sb.Append(leaf.InternalDeathType);
         sb.Append(',');
 
-        List<Branch<EnemyLeaf>> enemies = leaf.EnemiesWhoTriggerHitActionWhenDamaged;
+        LeafList<Branch<EnemyLeaf>> enemies = leaf.EnemiesWhoTriggerHitActionWhenDamaged;
         if (enemies.Count == 0)
             sb.Append("-1");
         else
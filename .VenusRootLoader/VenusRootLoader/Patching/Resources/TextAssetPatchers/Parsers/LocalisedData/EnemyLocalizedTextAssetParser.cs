@@ -37,7 +37,7 @@ internal sealed class EnemyLocalizedTextAssetParser : ILocalizedTextAssetParser<
         leaf.LocalizedData[_languageRegistry.GetByGameId(languageId)] = new()
         {
             Name = fields[0],
-            PaginatedBiography = fields[1].Split(StringUtils.OpeningBraceSplitDelimiter).ToList(),
+            PaginatedBiography = [.. fields[1].Split(StringUtils.OpeningBraceSplitDelimiter)],
             BeeSpyDialogue = fields[2],
             BeetleSpyDialogue = fields[3],
             MothSpyDialogue = fields[4]
@@ -0,0 +1,113 @@
+using System.Collections.Concurrent;
+using System.Diagnostics.CodeAnalysis;
+using UnityEngine;
+using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
+
+namespace VenusRootLoader.Patching.Resources.TextAssetPatchers;
+
+/// <summary>
+/// A cache of the patched text of <see cref="TextAsset"/> keyed by their resources subpath and language. Each entry
+/// remembers the version it was built from which combines the <see cref="LeafModifications{TLeaf}.Version"/> of every
+/// <see cref="Leaf"/> type the asset is built from so a patcher can reuse it as long as none of these leaves changed
+/// since. This avoids rebuilding the same asset every time the game reloads it.
+/// </summary>
+/// <remarks>The cache can be used from any thread.</remarks>
+internal interface ITextAssetPatchCache
+{
+    /// <summary>
+    /// The number of lookups that returned an up to date cached text.
+    /// </summary>
+    long Hits { get; }
+
+    /// <summary>
+    /// The number of lookups that didn't find an up to date cached text.
+    /// </summary>
+    long Misses { get; }
+
+    /// <summary>
+    /// Obtains the cached patched text of a <see cref="TextAsset"/> if it was built from <paramref name="version"/>.
+    /// </summary>
+    /// <param name="subpath">The resources subpath of the <see cref="TextAsset"/>.</param>
+    /// <param name="languageId">The language game id of the <see cref="TextAsset"/> or
+    /// <see cref="TextAssetPatchCache.NonLocalizedLanguageId"/> if it isn't localized.</param>
+    /// <param name="version">The current version of the data the <see cref="TextAsset"/> is built from.</param>
+    /// <param name="text">When this method returns, the cached text if it is up to date; otherwise, null.</param>
+    /// <returns>True if an up to date cached text was found, false otherwise.</returns>
+    bool TryGetPatchedText(string subpath, int languageId, int version, [NotNullWhen(true)] out string? text);
+
+    /// <summary>
+    /// Caches the patched text of a <see cref="TextAsset"/> which replaces any existing entry for it.
+    /// </summary>
+    /// <param name="subpath">The resources subpath of the <see cref="TextAsset"/>.</param>
+    /// <param name="languageId">The language game id of the <see cref="TextAsset"/> or
+    /// <see cref="TextAssetPatchCache.NonLocalizedLanguageId"/> if it isn't localized.</param>
+    /// <param name="version">The version of the data the <paramref name="text"/> was built from.</param>
+    /// <param name="text">The patched text.</param>
+    void SetPatchedText(string subpath, int languageId, int version, string text);
+}
+
+/// <inheritdoc/>
+internal sealed class TextAssetPatchCache : ITextAssetPatchCache
+{
+    internal const int NonLocalizedLanguageId = -1;
+
+    private readonly struct CacheKey
+    {
+        internal readonly string Subpath;
+        internal readonly int LanguageId;
+
+        internal CacheKey(string subpath, int languageId)
+        {
+            Subpath = subpath;
+            LanguageId = languageId;
+        }
+    }
+
+    private sealed class CacheKeyComparer : IEqualityComparer<CacheKey>
+    {
+        public bool Equals(CacheKey x, CacheKey y) =>
+            x.LanguageId == y.LanguageId && string.Equals(x.Subpath, y.Subpath, StringComparison.OrdinalIgnoreCase);
+
+        public int GetHashCode(CacheKey obj) =>
+            HashCode.Combine(StringComparer.OrdinalIgnoreCase.GetHashCode(obj.Subpath), obj.LanguageId);
+    }
+
+    private readonly struct CacheEntry
+    {
+        internal readonly int Version;
+        internal readonly string Text;
+
+        internal CacheEntry(int version, string text)
+        {
+            Version = version;
+            Text = text;
+        }
+    }
+
+    // Resources paths are case-insensitive in Unity so the cache must be as well
+    private readonly ConcurrentDictionary<CacheKey, CacheEntry> _entries = new(new CacheKeyComparer());
+
+    private long _hits;
+    private long _misses;
+
+    public long Hits => Interlocked.Read(ref _hits);
+    public long Misses => Interlocked.Read(ref _misses);
+
+    public bool TryGetPatchedText(string subpath, int languageId, int version, [NotNullWhen(true)] out string? text)
+    {
+        if (_entries.TryGetValue(new(subpath, languageId), out CacheEntry entry) && entry.Version == version)
+        {
+            Interlocked.Increment(ref _hits);
+            text = entry.Text;
+            return true;
+        }
+
+        Interlocked.Increment(ref _misses);
+        text = null;
+        return false;
+    }
+
+    public void SetPatchedText(string subpath, int languageId, int version, string text) =>
+        _entries[new(subpath, languageId)] = new(version, text);
+}
\ No newline at end of file
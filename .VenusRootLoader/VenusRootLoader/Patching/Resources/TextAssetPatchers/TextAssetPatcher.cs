@@ -2,6 +2,7 @@ using Microsoft.Extensions.Logging;
 using System.Text;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Patching.Resources.TextAssetPatchers.Parsers;
 using VenusRootLoader.Registry;
 
@@ -33,29 +34,39 @@ internal interface ITextAssetPatcher
 /// An <see cref="ITextAssetPatcher"/> whose <see cref="TextAsset"/> represents <see cref="Leaf"/> data.
 /// It relies on a <see cref="ITextAssetParser{T}"/> to do the actual conversion from <see cref="Leaf"/> to string.
 /// </summary>
+/// <remarks>
+/// The patched text is cached until a <typeparamref name="TLeaf"/> gets modified or registered, or until the version
+/// of the other leaf types the parser reads changes.
+/// </remarks>
 /// <typeparam name="TLeaf">The <see cref="Leaf"/> type</typeparam>
 internal sealed class TextAssetPatcher<TLeaf> : ITextAssetPatcher
     where TLeaf : Leaf
 {
     private readonly ILogger<TextAssetPatcher<TLeaf>> _logger;
     private readonly ITextAssetDumper _textAssetDumper;
+    private readonly ITextAssetPatchCache _textAssetPatchCache;
     private readonly ILeavesRegistry<TLeaf> _registry;
     private readonly ITextAssetParser<TLeaf> _parser;
     private readonly Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? _leavesSorter;
+    private readonly Func<int>? _otherLeavesVersion;
 
     public TextAssetPatcher(
         string[] subPaths,
         ILogger<TextAssetPatcher<TLeaf>> logger,
         ITextAssetDumper textAssetDumper,
+        ITextAssetPatchCache textAssetPatchCache,
         ILeavesRegistry<TLeaf> registry,
         ITextAssetParser<TLeaf> parser,
-        Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? leavesSorter)
+        Func<ILeavesRegistry<TLeaf>, IEnumerable<TLeaf>>? leavesSorter,
+        Func<int>? otherLeavesVersion)
     {
         SubPaths = subPaths;
         _leavesSorter = leavesSorter;
+        _otherLeavesVersion = otherLeavesVersion;
         _logger = logger;
         _parser = parser;
         _textAssetDumper = textAssetDumper;
+        _textAssetPatchCache = textAssetPatchCache;
         _registry = registry;
     }
 
@@ -67,21 +78,47 @@ internal sealed class TextAssetPatcher<TLeaf> : ITextAssetPatcher
         if (!registryHasData)
             return original;
 
+        // Some game data relies on having a trailing LF for the parsing to work correctly
+        string text = GetPatchedText(path, () => original != null && original.text.EndsWith("\n"));
+        return new TextAsset(text);
+    }
+
+    /// <summary>
+    /// Obtains the patched text of a <see cref="TextAsset"/> from the cache if none of the leaves it reads were
+    /// modified since it was built or builds it from every leaf of the registry otherwise. This doesn't involve any
+    /// Unity objects so it can be tested outside the game.
+    /// </summary>
+    /// <param name="path">The resources path the game requested to load excluding the <c>Data/</c> prefix.</param>
+    /// <param name="appendTrailingLineFeed">Tells if the text should end with a LF like the original one. It is only
+    /// called when the text needs to be built.</param>
+    /// <returns>The patched text.</returns>
+    internal string GetPatchedText(string path, Func<bool> appendTrailingLineFeed)
+    {
+        int version = LeafModifications<TLeaf>.Version + (_otherLeavesVersion?.Invoke() ?? 0);
+        if (_textAssetPatchCache.TryGetPatchedText(
+                path,
+                TextAssetPatchCache.NonLocalizedLanguageId,
+                version,
+                out string? cachedText))
+        {
+            return cachedText;
+        }
+
         IEnumerable<TLeaf> sortedLeaves = _leavesSorter is null
             ? _registry.OrderBy(l => l.GameId)
             : _leavesSorter(_registry);
         IEnumerable<string> newLines = sortedLeaves
             .Select(customLine => _parser.GetTextAssetSerializedString(path, customLine));
 
-        // Some game data relies on having a trailing LF for the parsing to work correctly
         StringBuilder sb = new(string.Join("\n", newLines));
-        if (original != null && original.text.EndsWith("\n"))
+        if (appendTrailingLineFeed())
             sb.Append('\n');
 
         string text = sb.ToString();
+        _textAssetPatchCache.SetPatchedText(path, TextAssetPatchCache.NonLocalizedLanguageId, version, text);
         if (_logger.IsEnabled(LogLevel.Trace))
             _textAssetDumper.DumpTextAssetContent(path, text);
 
-        return new TextAsset(text);
+        return text;
     }
 }
\ No newline at end of file
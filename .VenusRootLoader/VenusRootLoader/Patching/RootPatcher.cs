@@ -1,3 +1,5 @@
+using VenusRootLoader.Tracing;
+
 namespace VenusRootLoader.Patching;
 
 /// <summary>
@@ -8,17 +10,22 @@ internal sealed class RootPatcher
 {
     private readonly IEnumerable<ITopLevelPatcher> _patchers;
     private readonly IHarmonyTypePatcher _harmonyTypePatcher;
+    private readonly ITracer _tracer;
 
-    public RootPatcher(IEnumerable<ITopLevelPatcher> patchers, IHarmonyTypePatcher harmonyTypePatcher)
+    public RootPatcher(IEnumerable<ITopLevelPatcher> patchers, IHarmonyTypePatcher harmonyTypePatcher, ITracer tracer)
     {
         _patchers = patchers;
         _harmonyTypePatcher = harmonyTypePatcher;
+        _tracer = tracer;
     }
 
     public void RunAllTopLevelPatchers()
     {
         _harmonyTypePatcher.PatchAll(typeof(UnpatchedMethods));
         foreach (ITopLevelPatcher patcher in _patchers)
+        {
+            using TraceSpan span = _tracer.BeginSpan(patcher.GetType().Name, nameof(ITopLevelPatcher));
             patcher.Patch();
+        }
     }
 }
\ No newline at end of file
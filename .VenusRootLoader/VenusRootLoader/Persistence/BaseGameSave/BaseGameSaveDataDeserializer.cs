@@ -1,6 +1,5 @@
 using CommunityToolkit.Diagnostics;
 using Microsoft.Extensions.Logging;
-using System.Globalization;
 using System.Text;
 using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.Extensions;
@@ -12,7 +11,10 @@ namespace VenusRootLoader.Persistence.BaseGameSave;
 
 internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializer
 {
+    private const char LineFeed = '\n';
     private const char Comma = ',';
+    private const char AtSymbol = '@';
+    private const string FlagstringSeparator = "|SPLIT|";
     private const char Dash = '-';
 
     private readonly ILogger<BaseGameSaveDataDeserializer> _logger;
@@ -73,90 +75,87 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
 
     public MainManager.LoadData DeserializeLiteBaseGameSaveData(string saveData)
     {
-        string[] baseGameSaveDataLines = saveData.Split(StringUtils.NewlineSplitDelimiter);
-        if (baseGameSaveDataLines.Length < 3)
+        SpanTokenizer baseGameSaveDataLines = new(saveData.AsSpan(), LineFeed, removeEmptyEntries: false);
+        if (baseGameSaveDataLines.CountRemaining() < 3)
             ThrowHelper.ThrowInvalidDataException("There are less than 3 lines in the base game save data");
 
         MainManager.LoadData loadData = new();
-        LoadHeaderLine(baseGameSaveDataLines[0], ref loadData);
-        LoadGeneralInformationLine(baseGameSaveDataLines[2], ref loadData, null);
+        LoadHeaderLine(baseGameSaveDataLines.ReadNext(), ref loadData);
+        baseGameSaveDataLines.Skip(1);
+        LoadGeneralInformationLine(baseGameSaveDataLines.ReadNext(), ref loadData, null);
 
         return loadData;
     }
 
     public MainManager.LoadData DeserializeFullBaseGameSaveData(string saveData, StagingLoadData stagingLoadData)
     {
-        string[] baseGameSaveDataLines = saveData.Split(StringUtils.NewlineSplitDelimiter);
-        if (baseGameSaveDataLines.Length < 18)
+        SpanTokenizer baseGameSaveDataLines = new(saveData.AsSpan(), LineFeed, removeEmptyEntries: false);
+        if (baseGameSaveDataLines.CountRemaining() < 18)
             ThrowHelper.ThrowInvalidDataException("There are less than 18 lines in the base game save data");
 
         MainManager.LoadData loadData = new();
-        LoadHeaderLine(baseGameSaveDataLines[0], ref loadData);
-        LoadPlayerPartyLine(baseGameSaveDataLines[1], stagingLoadData);
-        LoadGeneralInformationLine(baseGameSaveDataLines[2], ref loadData, stagingLoadData);
-        LoadMedalShopsLine(baseGameSaveDataLines[3], stagingLoadData.AvaliableBadgePool);
-        LoadMedalShopsLine(baseGameSaveDataLines[4], stagingLoadData.BadgeShops);
-        LoadQuestsLine(baseGameSaveDataLines[5], stagingLoadData);
-        LoadItemsLine(baseGameSaveDataLines[6], stagingLoadData);
-        LoadMedalsLine(baseGameSaveDataLines[7], stagingLoadData);
-        LoadSamiraSongsLine(baseGameSaveDataLines[8], stagingLoadData);
-        LoadStatBonusesLine(baseGameSaveDataLines[9], stagingLoadData);
-        LoadLibraryLine(baseGameSaveDataLines[10], stagingLoadData);
-        LoadFlagsLine(baseGameSaveDataLines[11], stagingLoadData);
-        LoadFlagstringsLine(baseGameSaveDataLines[12], stagingLoadData);
-        LoadFlagvarsLine(baseGameSaveDataLines[13], stagingLoadData);
-        LoadRegionalFlagsLine(baseGameSaveDataLines[14], stagingLoadData);
-        LoadCrystalBerriesLine(baseGameSaveDataLines[15], stagingLoadData);
-        LoadFollowersLine(baseGameSaveDataLines[16], stagingLoadData);
-        LoadEnemyEncountersDataLine(baseGameSaveDataLines[17], stagingLoadData);
+        LoadHeaderLine(baseGameSaveDataLines.ReadNext(), ref loadData);
+        LoadPlayerPartyLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadGeneralInformationLine(baseGameSaveDataLines.ReadNext(), ref loadData, stagingLoadData);
+        LoadMedalShopsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData.AvaliableBadgePool);
+        LoadMedalShopsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData.BadgeShops);
+        LoadQuestsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadItemsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadMedalsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadSamiraSongsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadStatBonusesLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadLibraryLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadFlagsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadFlagstringsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadFlagvarsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadRegionalFlagsLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadCrystalBerriesLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadFollowersLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
+        LoadEnemyEncountersDataLine(baseGameSaveDataLines.ReadNext(), stagingLoadData);
 
         return loadData;
     }
 
-    private static void LoadHeaderLine(string headerLine, ref MainManager.LoadData loadData)
+    private static void LoadHeaderLine(ReadOnlySpan<char> headerLine, ref MainManager.LoadData loadData)
     {
-        string[] headerData = headerLine.Split(StringUtils.CommaSplitDelimiter);
-        if (headerData.Length < 10)
+        SpanTokenizer headerData = new(headerLine, Comma, removeEmptyEntries: false);
+        if (headerData.CountRemaining() < 10)
         {
             ThrowHelper.ThrowInvalidDataException(
                 "There are less than 10 fields in the base game save data header line");
         }
 
         loadData.loadpos = new(
-            float.Parse(headerData[0], CultureInfo.InvariantCulture),
-            float.Parse(headerData[1], CultureInfo.InvariantCulture),
-            float.Parse(headerData[2], CultureInfo.InvariantCulture));
+            InvariantSpanParser.ParseSingle(headerData.ReadNext()),
+            InvariantSpanParser.ParseSingle(headerData.ReadNext()),
+            InvariantSpanParser.ParseSingle(headerData.ReadNext()));
 
         loadData.challenges =
         [
-            bool.Parse(headerData[3]),
-            bool.Parse(headerData[4]),
-            bool.Parse(headerData[5]),
-            bool.Parse(headerData[6]),
-            bool.Parse(headerData[7]),
-            bool.Parse(headerData[8]),
+            InvariantSpanParser.ParseBoolean(headerData.ReadNext()),
+            InvariantSpanParser.ParseBoolean(headerData.ReadNext()),
+            InvariantSpanParser.ParseBoolean(headerData.ReadNext()),
+            InvariantSpanParser.ParseBoolean(headerData.ReadNext()),
+            InvariantSpanParser.ParseBoolean(headerData.ReadNext()),
+            InvariantSpanParser.ParseBoolean(headerData.ReadNext()),
         ];
 
-        loadData.filename = headerData[9];
+        loadData.filename = headerData.ReadNext().ToString();
     }
 
-    private void LoadPlayerPartyLine(string playerPartyLine, StagingLoadData stagingLoadData)
+    private void LoadPlayerPartyLine(ReadOnlySpan<char> playerPartyLine, StagingLoadData stagingLoadData)
     {
-        string[] playerPartyData = playerPartyLine.Split(
-            StringUtils.AtSymbolSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        for (int i = 0; i < playerPartyData.Length; i++)
+        SpanTokenizer playerPartyData = new(playerPartyLine, AtSymbol, removeEmptyEntries: true);
+        for (int i = 0; playerPartyData.TryReadNext(out ReadOnlySpan<char> partyMember); i++)
         {
-            string[] partyMemberData = playerPartyData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
-            if (partyMemberData.Length < 8)
+            SpanTokenizer partyMemberData = new(partyMember, Comma, removeEmptyEntries: true);
+            if (partyMemberData.CountRemaining() < 8)
             {
                 ThrowHelper.ThrowInvalidDataException(
                     $"There are less than 8 fields in the base game save data player party line element index {i}");
             }
 
-            string animIdEffectiveId = partyMemberData[0];
+            string animIdEffectiveId = partyMemberData.ReadNext().ToString();
             if (!_animIdsLeafRegistry.TryGetByEffectiveId(animIdEffectiveId, out AnimIdLeaf? animIdLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(animIdEffectiveId);
@@ -173,13 +172,13 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
             {
                 Trueid = animIdLeaf.GameId,
                 Animid = animIdLeaf.GameId,
-                Hp = int.Parse(partyMemberData[1], CultureInfo.InvariantCulture),
-                Maxhp = int.Parse(partyMemberData[2], CultureInfo.InvariantCulture),
-                Basehp = int.Parse(partyMemberData[3], CultureInfo.InvariantCulture),
-                Atk = int.Parse(partyMemberData[4], CultureInfo.InvariantCulture),
-                Baseatk = int.Parse(partyMemberData[5], CultureInfo.InvariantCulture),
-                Def = int.Parse(partyMemberData[6], CultureInfo.InvariantCulture),
-                Basedef = int.Parse(partyMemberData[7], CultureInfo.InvariantCulture),
+                Hp = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
+                Maxhp = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
+                Basehp = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
+                Atk = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
+                Baseatk = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
+                Def = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
+                Basedef = InvariantSpanParser.ParseInt32(partyMemberData.ReadNext()),
             };
             stagingLoadData.PlayerData.Add(memberBattleData);
             stagingLoadData.PartyOrder.Add(memberBattleData.Trueid);
@@ -187,20 +186,28 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
     }
 
     private void LoadGeneralInformationLine(
-        string generalInformationLine,
+        ReadOnlySpan<char> generalInformationLine,
         ref MainManager.LoadData loadData,
         StagingLoadData? stagingLoadData)
     {
-        string[] generalInformationData = generalInformationLine.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        if (generalInformationData.Length < 16)
+        SpanTokenizer generalInformationData = new(generalInformationLine, Comma, removeEmptyEntries: true);
+        if (generalInformationData.CountRemaining() < 16)
         {
             ThrowHelper.ThrowInvalidDataException(
                 "There are less than 16 fields in the base game save data general information line");
         }
 
-        string mapEffectiveId = generalInformationData[6];
+        // The fields aren't in the order they need to be validated and loaded so we keep a tokenizer positioned at
+        // each group of fields: the party stats (1 to 5), the location (6 and 7), the limits (8 to 11) and the
+        // clock and progression (12 to 15)
+        ReadOnlySpan<char> levelField = generalInformationData.ReadNext();
+        SpanTokenizer partyStatsFields = generalInformationData;
+        generalInformationData.Skip(5);
+        string mapEffectiveId = generalInformationData.ReadNext().ToString();
+        string areaEffectiveId = generalInformationData.ReadNext().ToString();
+        SpanTokenizer limitsFields = generalInformationData;
+        generalInformationData.Skip(4);
+
         if (!_mapsLeafRegistry.TryGetByEffectiveId(mapEffectiveId, out MapLeaf? mapLeaf))
         {
             (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(mapEffectiveId);
@@ -209,7 +216,6 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 $"while no such {nameof(MapLeaf)} exists in the registry.");
         }
 
-        string areaEffectiveId = generalInformationData[7];
         if (!_areasLeafRegistry.TryGetByEffectiveId(areaEffectiveId, out AreaLeaf? areaLeaf))
         {
             (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(areaEffectiveId);
@@ -218,45 +224,43 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 $"while no such {nameof(AreaLeaf)} exists in the registry.");
         }
 
-        loadData.level = int.Parse(generalInformationData[0], CultureInfo.InvariantCulture);
+        loadData.level = InvariantSpanParser.ParseInt32(levelField);
         loadData.mapid = mapLeaf.GameId;
         loadData.areaid = areaLeaf.GameId;
-        loadData.timeh = int.Parse(generalInformationData[12], CultureInfo.InvariantCulture);
-        loadData.timem = int.Parse(generalInformationData[13], CultureInfo.InvariantCulture);
-        loadData.times = int.Parse(generalInformationData[14], CultureInfo.InvariantCulture);
-        loadData.progression = int.Parse(generalInformationData[15], CultureInfo.InvariantCulture);
+        loadData.timeh = InvariantSpanParser.ParseInt32(generalInformationData.ReadNext());
+        loadData.timem = InvariantSpanParser.ParseInt32(generalInformationData.ReadNext());
+        loadData.times = InvariantSpanParser.ParseInt32(generalInformationData.ReadNext());
+        loadData.progression = InvariantSpanParser.ParseInt32(generalInformationData.ReadNext());
 
         if (stagingLoadData is null)
             return;
 
         stagingLoadData.PartyLevel = loadData.level;
-        stagingLoadData.PartyExp = int.Parse(generalInformationData[1], CultureInfo.InvariantCulture);
-        stagingLoadData.NeededExp = int.Parse(generalInformationData[2], CultureInfo.InvariantCulture);
-        stagingLoadData.BaseTp = int.Parse(generalInformationData[3], CultureInfo.InvariantCulture);
-        stagingLoadData.Tp = int.Parse(generalInformationData[4], CultureInfo.InvariantCulture);
-        stagingLoadData.Money = int.Parse(generalInformationData[5], CultureInfo.InvariantCulture);
-        stagingLoadData.Bp = int.Parse(generalInformationData[8], CultureInfo.InvariantCulture);
-        stagingLoadData.MaxBp = int.Parse(generalInformationData[9], CultureInfo.InvariantCulture);
-        stagingLoadData.MaxItems = int.Parse(generalInformationData[10], CultureInfo.InvariantCulture);
-        stagingLoadData.MaxStorage = int.Parse(generalInformationData[11], CultureInfo.InvariantCulture);
+        stagingLoadData.PartyExp = InvariantSpanParser.ParseInt32(partyStatsFields.ReadNext());
+        stagingLoadData.NeededExp = InvariantSpanParser.ParseInt32(partyStatsFields.ReadNext());
+        stagingLoadData.BaseTp = InvariantSpanParser.ParseInt32(partyStatsFields.ReadNext());
+        stagingLoadData.Tp = InvariantSpanParser.ParseInt32(partyStatsFields.ReadNext());
+        stagingLoadData.Money = InvariantSpanParser.ParseInt32(partyStatsFields.ReadNext());
+        stagingLoadData.Bp = InvariantSpanParser.ParseInt32(limitsFields.ReadNext());
+        stagingLoadData.MaxBp = InvariantSpanParser.ParseInt32(limitsFields.ReadNext());
+        stagingLoadData.MaxItems = InvariantSpanParser.ParseInt32(limitsFields.ReadNext());
+        stagingLoadData.MaxStorage = InvariantSpanParser.ParseInt32(limitsFields.ReadNext());
         stagingLoadData.ClockHour = loadData.timeh;
         stagingLoadData.ClockMin = loadData.timem;
         stagingLoadData.ClockSec = loadData.times;
         stagingLoadData.AreaId = loadData.areaid;
     }
 
-    private void LoadMedalShopsLine(string medalShopsLine, List<List<int>> stagingMedalShopList)
+    private void LoadMedalShopsLine(ReadOnlySpan<char> medalShopsLine, List<List<int>> stagingMedalShopList)
     {
-        string[] medalShopsData = medalShopsLine.Split(StringUtils.AtSymbolSplitDelimiter);
-        for (int i = 0; i < medalShopsData.Length; i++)
+        SpanTokenizer medalShopsData = new(medalShopsLine, AtSymbol, removeEmptyEntries: false);
+        for (int i = 0; medalShopsData.TryReadNext(out ReadOnlySpan<char> medalShopData); i++)
         {
-            string[] medalEffectiveIds = medalShopsData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
+            SpanTokenizer medalEffectiveIds = new(medalShopData, Comma, removeEmptyEntries: true);
             List<int> medalGameIds = new();
-            for (int j = 0; j < medalEffectiveIds.Length; j++)
+            for (int j = 0; medalEffectiveIds.TryReadNext(out ReadOnlySpan<char> medalEffectiveIdData); j++)
             {
-                string medalEffectiveId = medalEffectiveIds[j];
+                string medalEffectiveId = medalEffectiveIdData.ToString();
                 if (!_medalsLeafRegistry.TryGetByEffectiveId(medalEffectiveId, out MedalLeaf? medalLeaf))
                 {
                     (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(medalEffectiveId);
@@ -277,14 +281,12 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         }
     }
 
-    private void LoadQuestsLine(string questsLine, StagingLoadData stagingLoadData)
+    private void LoadQuestsLine(ReadOnlySpan<char> questsLine, StagingLoadData stagingLoadData)
     {
-        string[] boardQuestData = questsLine.Split(StringUtils.AtSymbolSplitDelimiter);
-        for (int i = 0; i < boardQuestData.Length; i++)
+        SpanTokenizer boardQuestData = new(questsLine, AtSymbol, removeEmptyEntries: false);
+        for (int i = 0; boardQuestData.TryReadNext(out ReadOnlySpan<char> boardData); i++)
         {
-            string[] questEffectiveIds = boardQuestData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
+            SpanTokenizer questEffectiveIds = new(boardData, Comma, removeEmptyEntries: true);
             string boardName = i switch
             {
                 0 => "Open",
@@ -293,9 +295,9 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 _ => ThrowHelper.ThrowArgumentOutOfRangeException<string>(null, $"Unknown board index: {i}")
             };
             List<int> questGameIds = new();
-            for (int j = 0; j < questEffectiveIds.Length; j++)
+            for (int j = 0; questEffectiveIds.TryReadNext(out ReadOnlySpan<char> questEffectiveIdData); j++)
             {
-                string questEffectiveId = questEffectiveIds[j];
+                string questEffectiveId = questEffectiveIdData.ToString();
                 if (!_questsLeafRegistry.TryGetByEffectiveId(questEffectiveId, out QuestLeaf? questLeaf))
                 {
                     (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(questEffectiveId);
@@ -316,14 +318,12 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         }
     }
 
-    private void LoadItemsLine(string itemsLine, StagingLoadData stagingLoadData)
+    private void LoadItemsLine(ReadOnlySpan<char> itemsLine, StagingLoadData stagingLoadData)
     {
-        string[] itemsInventoryData = itemsLine.Split(StringUtils.AtSymbolSplitDelimiter);
-        for (int i = 0; i < itemsInventoryData.Length; i++)
+        SpanTokenizer itemsInventoryData = new(itemsLine, AtSymbol, removeEmptyEntries: false);
+        for (int i = 0; itemsInventoryData.TryReadNext(out ReadOnlySpan<char> inventoryData); i++)
         {
-            string[] itemEffectiveIds = itemsInventoryData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
+            SpanTokenizer itemEffectiveIds = new(inventoryData, Comma, removeEmptyEntries: true);
             string inventoryName = i switch
             {
                 0 => "regular items",
@@ -332,9 +332,9 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 _ => ThrowHelper.ThrowArgumentOutOfRangeException<string>(null, $"Unknown items inventory index: {i}")
             };
             List<int> itemGameIds = new();
-            for (int j = 0; j < itemEffectiveIds.Length; j++)
+            for (int j = 0; itemEffectiveIds.TryReadNext(out ReadOnlySpan<char> itemEffectiveIdData); j++)
             {
-                string itemEffectiveId = itemEffectiveIds[j];
+                string itemEffectiveId = itemEffectiveIdData.ToString();
                 if (!_itemsLeafRegistry.TryGetByEffectiveId(itemEffectiveId, out ItemLeaf? itemLeaf))
                 {
                     (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(itemEffectiveId);
@@ -355,15 +355,13 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         }
     }
 
-    private void LoadMedalsLine(string medalsLine, StagingLoadData stagingLoadData)
+    private void LoadMedalsLine(ReadOnlySpan<char> medalsLine, StagingLoadData stagingLoadData)
     {
-        string[] medalsOnHandData = medalsLine.Split(
-            StringUtils.AtSymbolSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        for (int i = 0; i < medalsOnHandData.Length; i++)
+        SpanTokenizer medalsOnHandData = new(medalsLine, AtSymbol, removeEmptyEntries: true);
+        for (int i = 0; medalsOnHandData.TryReadNext(out ReadOnlySpan<char> medalOnHandData); i++)
         {
-            string[] medalEquipData = medalsOnHandData[i].Split(StringUtils.CommaSplitDelimiter);
-            string medalEffectiveId = medalEquipData[0];
+            SpanTokenizer medalEquipData = new(medalOnHandData, Comma, removeEmptyEntries: false);
+            string medalEffectiveId = medalEquipData.ReadNext().ToString();
             if (!_medalsLeafRegistry.TryGetByEffectiveId(medalEffectiveId, out MedalLeaf? medalLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(medalEffectiveId);
@@ -376,8 +374,9 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 continue;
             }
 
-            string? medalEquipAnimIdEffectiveId = !string.IsNullOrWhiteSpace(medalEquipData[1])
-                ? medalEquipData[1]
+            ReadOnlySpan<char> medalEquipAnimIdData = medalEquipData.ReadNext();
+            string? medalEquipAnimIdEffectiveId = !medalEquipAnimIdData.IsWhiteSpace()
+                ? medalEquipAnimIdData.ToString()
                 : null;
             AnimIdLeaf? animIdLeaf = null;
             if (medalEquipAnimIdEffectiveId is not null &&
@@ -397,17 +396,13 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         }
     }
 
-    private void LoadSamiraSongsLine(string samiraSongsLine, StagingLoadData stagingLoadData)
+    private void LoadSamiraSongsLine(ReadOnlySpan<char> samiraSongsLine, StagingLoadData stagingLoadData)
     {
-        string[] samiraSongsData = samiraSongsLine.Split(
-            StringUtils.AtSymbolSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        for (int i = 0; i < samiraSongsData.Length; i++)
+        SpanTokenizer samiraSongsData = new(samiraSongsLine, AtSymbol, removeEmptyEntries: true);
+        for (int i = 0; samiraSongsData.TryReadNext(out ReadOnlySpan<char> samiraSongLine); i++)
         {
-            string[] samiraSongData = samiraSongsData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
-            string samiraSongEffectiveId = samiraSongData[0];
+            SpanTokenizer samiraSongData = new(samiraSongLine, Comma, removeEmptyEntries: true);
+            string samiraSongEffectiveId = samiraSongData.ReadNext().ToString();
             if (!_musicsLeafRegistry.TryGetByEffectiveId(samiraSongEffectiveId, out MusicLeaf? musicLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(samiraSongEffectiveId);
@@ -420,22 +415,20 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 continue;
             }
 
-            int songBoughtStatus = int.Parse(samiraSongData[1], CultureInfo.InvariantCulture);
+            int songBoughtStatus = InvariantSpanParser.ParseInt32(samiraSongData.ReadNext());
             stagingLoadData.SamiraMusics.Add([musicLeaf.GameId, songBoughtStatus]);
         }
     }
 
-    private void LoadStatBonusesLine(string statBonusesLine, StagingLoadData stagingLoadData)
+    private void LoadStatBonusesLine(ReadOnlySpan<char> statBonusesLine, StagingLoadData stagingLoadData)
     {
-        string[] statBonusesData = statBonusesLine.Split(
-            StringUtils.AtSymbolSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        for (int i = 0; i < statBonusesData.Length; i++)
+        SpanTokenizer statBonusesData = new(statBonusesLine, AtSymbol, removeEmptyEntries: true);
+        for (int i = 0; statBonusesData.TryReadNext(out ReadOnlySpan<char> statBonusLine); i++)
         {
-            string[] statBonusData = statBonusesData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
-            string targetAnimIdEffectiveId = statBonusData[2];
+            SpanTokenizer statBonusData = new(statBonusLine, Comma, removeEmptyEntries: true);
+            ReadOnlySpan<char> bonusTypeData = statBonusData.ReadNext();
+            ReadOnlySpan<char> bonusAmountData = statBonusData.ReadNext();
+            string targetAnimIdEffectiveId = statBonusData.ReadNext().ToString();
             if (!_animIdsLeafRegistry.TryGetByEffectiveId(targetAnimIdEffectiveId, out AnimIdLeaf? animIdLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(targetAnimIdEffectiveId);
@@ -448,22 +441,18 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 continue;
             }
 
-            int bonusType = int.Parse(statBonusData[0], CultureInfo.InvariantCulture);
-            int bonusAmount = int.Parse(statBonusData[1], CultureInfo.InvariantCulture);
+            int bonusType = InvariantSpanParser.ParseInt32(bonusTypeData);
+            int bonusAmount = InvariantSpanParser.ParseInt32(bonusAmountData);
             stagingLoadData.StatBonus.Add([bonusType, bonusAmount, animIdLeaf.GameId]);
         }
     }
 
-    private void LoadLibraryLine(string libraryLine, StagingLoadData stagingLoadData)
+    private void LoadLibraryLine(ReadOnlySpan<char> libraryLine, StagingLoadData stagingLoadData)
     {
-        string[] libraryPagesData = libraryLine.Split(
-            StringUtils.AtSymbolSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        for (int i = 0; i < libraryPagesData.Length; i++)
+        SpanTokenizer libraryPagesData = new(libraryLine, AtSymbol, removeEmptyEntries: true);
+        for (int i = 0; libraryPagesData.TryReadNext(out ReadOnlySpan<char> libraryPageData); i++)
         {
-            string[] libraryFlagsData = libraryPagesData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
+            SpanTokenizer libraryFlagsData = new(libraryPageData, Comma, removeEmptyEntries: true);
             int baseGameAmount = (MainManager.LibraryPages)i switch
             {
                 MainManager.LibraryPages.Discoveries => _discoveriesLeafRegistry.CountBaseGame,
@@ -474,57 +463,53 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
                 _ => ThrowHelper.ThrowArgumentOutOfRangeException<int>(null, $"Unknown library page index: {i}")
             };
             for (int j = 0; j < baseGameAmount; j++)
-                stagingLoadData.LibraryStuff[i].Add(bool.Parse(libraryFlagsData[j]));
+                stagingLoadData.LibraryStuff[i].Add(InvariantSpanParser.ParseBoolean(libraryFlagsData.ReadNext()));
         }
     }
 
-    private void LoadFlagsLine(string flagsLine, StagingLoadData stagingLoadData)
+    private void LoadFlagsLine(ReadOnlySpan<char> flagsLine, StagingLoadData stagingLoadData)
     {
-        string[] flagsData = flagsLine.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer flagsData = new(flagsLine, Comma, removeEmptyEntries: true);
         int baseGameAmount = _flagsLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
-            stagingLoadData.Flags.Add(bool.Parse(flagsData[i]));
+            stagingLoadData.Flags.Add(InvariantSpanParser.ParseBoolean(flagsData.ReadNext()));
     }
 
-    private void LoadFlagstringsLine(string flagstringsLine, StagingLoadData stagingLoadData)
+    private void LoadFlagstringsLine(ReadOnlySpan<char> flagstringsLine, StagingLoadData stagingLoadData)
     {
-        string[] flagstringsData = flagstringsLine.Split(StringUtils.FlagstringSplitDelimiter, StringSplitOptions.None);
+        SpanTokenizer flagstringsData = new(flagstringsLine, FlagstringSeparator, removeEmptyEntries: false);
         int baseGameAmount = _flagstringsLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
+            ReadOnlySpan<char> flagstringData = flagstringsData.ReadNext();
             string flagstring = i switch
             {
-                8 => !string.IsNullOrWhiteSpace(flagstringsData[i])
-                    ? GetChapter4CaptureDataFlagstringValue(flagstringsData[i])
-                    : flagstringsData[i],
-                12 => !string.IsNullOrWhiteSpace(flagstringsData[i])
-                    ? GetSavedSpyCardsDeckFlagstringValue(flagstringsData[i])
-                    : flagstringsData[i],
-                13 => !string.IsNullOrWhiteSpace(flagstringsData[i])
-                    ? GetMysteryMedalsQueueFlagstingValue(flagstringsData[i])
-                    : flagstringsData[i],
-                _ => flagstringsData[i]
+                8 => !flagstringData.IsWhiteSpace()
+                    ? GetChapter4CaptureDataFlagstringValue(flagstringData)
+                    : flagstringData.ToString(),
+                12 => !flagstringData.IsWhiteSpace()
+                    ? GetSavedSpyCardsDeckFlagstringValue(flagstringData)
+                    : flagstringData.ToString(),
+                13 => !flagstringData.IsWhiteSpace()
+                    ? GetMysteryMedalsQueueFlagstingValue(flagstringData)
+                    : flagstringData.ToString(),
+                _ => flagstringData.ToString()
             };
             stagingLoadData.Flagstrings.Add(flagstring);
         }
     }
 
-    private string GetChapter4CaptureDataFlagstringValue(string flagstring)
+    private string GetChapter4CaptureDataFlagstringValue(ReadOnlySpan<char> flagstring)
     {
-        string[] chapter4CaptureData = flagstring.Split(StringUtils.DashSplitDelimiter);
-        string[] regularItemEffectiveIds = chapter4CaptureData[0].Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        string[] keyItemEffectiveIds = chapter4CaptureData[1].Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer chapter4CaptureData = new(flagstring, Dash, removeEmptyEntries: false);
+        SpanTokenizer regularItemEffectiveIds = new(chapter4CaptureData.ReadNext(), Comma, removeEmptyEntries: true);
+        SpanTokenizer keyItemEffectiveIds = new(chapter4CaptureData.ReadNext(), Comma, removeEmptyEntries: true);
+        ReadOnlySpan<char> berryCount = chapter4CaptureData.ReadNext();
 
         StringBuilder sb = new();
-        for (int i = 0; i < regularItemEffectiveIds.Length; i++)
+        for (int i = 0; regularItemEffectiveIds.TryReadNext(out ReadOnlySpan<char> itemEffectiveIdData); i++)
         {
-            string itemEffectiveId = regularItemEffectiveIds[i];
+            string itemEffectiveId = itemEffectiveIdData.ToString();
             if (!_itemsLeafRegistry.TryGetByEffectiveId(itemEffectiveId, out ItemLeaf? itemLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(itemEffectiveId);
@@ -545,9 +530,9 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
 
         sb.Append(Dash);
 
-        for (int i = 0; i < keyItemEffectiveIds.Length; i++)
+        for (int i = 0; keyItemEffectiveIds.TryReadNext(out ReadOnlySpan<char> itemEffectiveIdData); i++)
         {
-            string itemEffectiveId = keyItemEffectiveIds[i];
+            string itemEffectiveId = itemEffectiveIdData.ToString();
             if (!_itemsLeafRegistry.TryGetByEffectiveId(itemEffectiveId, out ItemLeaf? itemLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(itemEffectiveId);
@@ -567,20 +552,18 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         }
 
         sb.Append(Dash);
-        sb.AppendInvariant(chapter4CaptureData[2]);
+        sb.AppendInvariant(berryCount.ToString());
 
         return sb.ToString();
     }
 
-    private string GetSavedSpyCardsDeckFlagstringValue(string flagstring)
+    private string GetSavedSpyCardsDeckFlagstringValue(ReadOnlySpan<char> flagstring)
     {
-        string[] spyCardsEffectiveId = flagstring.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer spyCardsEffectiveId = new(flagstring, Comma, removeEmptyEntries: true);
         StringBuilder sb = new();
-        for (int i = 0; i < spyCardsEffectiveId.Length; i++)
+        for (int i = 0; spyCardsEffectiveId.TryReadNext(out ReadOnlySpan<char> spyCardEffectiveIdData); i++)
         {
-            string spyCardEffectiveId = spyCardsEffectiveId[i];
+            string spyCardEffectiveId = spyCardEffectiveIdData.ToString();
             if (!_spyCardsLeafRegistry.TryGetByEffectiveId(spyCardEffectiveId, out SpyCardLeaf? spyCardLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(spyCardEffectiveId);
@@ -602,15 +585,13 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         return sb.ToString();
     }
 
-    private string GetMysteryMedalsQueueFlagstingValue(string flagstring)
+    private string GetMysteryMedalsQueueFlagstingValue(ReadOnlySpan<char> flagstring)
     {
-        string[] mysteryMedalsQueue = flagstring.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer mysteryMedalsQueue = new(flagstring, Comma, removeEmptyEntries: true);
         StringBuilder sb = new();
-        for (int i = 0; i < mysteryMedalsQueue.Length; i++)
+        for (int i = 0; mysteryMedalsQueue.TryReadNext(out ReadOnlySpan<char> medalEffectiveIdData); i++)
         {
-            string medalEffectiveId = mysteryMedalsQueue[i];
+            string medalEffectiveId = medalEffectiveIdData.ToString();
             if (!_medalsLeafRegistry.TryGetByEffectiveId(medalEffectiveId, out MedalLeaf? medalLeaf))
             {
                 // Intentionally not mentioning the position in case of spoilers
@@ -632,28 +613,29 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         return sb.ToString();
     }
 
-    private void LoadFlagvarsLine(string flagvarsLine, StagingLoadData stagingLoadData)
+    private void LoadFlagvarsLine(ReadOnlySpan<char> flagvarsLine, StagingLoadData stagingLoadData)
     {
-        string[] flagvarsData = flagvarsLine.Split(StringUtils.CommaSplitDelimiter);
+        SpanTokenizer flagvarsData = new(flagvarsLine, Comma, removeEmptyEntries: false);
         int baseGameAmount = _flagvarsLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
             int flagvar = i == 56
-                ? GetChompyItemFlagvarValue(flagvarsData[i])
-                : int.Parse(flagvarsData[i], CultureInfo.InvariantCulture);
+                ? GetChompyItemFlagvarValue(flagvarsData.ReadNext())
+                : InvariantSpanParser.ParseInt32(flagvarsData.ReadNext());
             stagingLoadData.Flagvars.Add(flagvar);
         }
     }
 
-    private int GetChompyItemFlagvarValue(string flagvar)
+    private int GetChompyItemFlagvarValue(ReadOnlySpan<char> flagvarData)
     {
-        if (string.IsNullOrWhiteSpace(flagvar))
+        if (flagvarData.IsWhiteSpace())
             return 0;
 
+        string flagvar = flagvarData.ToString();
         if (_itemsLeafRegistry.TryGetByEffectiveId(flagvar, out ItemLeaf? itemLeaf))
             return itemLeaf.GameId;
 
-        if (int.TryParse(flagvar, NumberStyles.None, CultureInfo.InvariantCulture, out int value))
+        if (InvariantSpanParser.TryParseDigits(flagvarData, out int value))
         {
             _logger.LogWarning(
                 "The flagvar 56 (ItemLeaf equipped on Chompy) has a value of {value} which isn't an ItemLeaf that exists in the registry. " +
@@ -672,34 +654,28 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         return 0;
     }
 
-    private static void LoadRegionalFlagsLine(string regionalFlagsLine, StagingLoadData stagingLoadData)
+    private static void LoadRegionalFlagsLine(ReadOnlySpan<char> regionalFlagsLine, StagingLoadData stagingLoadData)
     {
-        string[] regionalFlagsData = regionalFlagsLine.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer regionalFlagsData = new(regionalFlagsLine, Comma, removeEmptyEntries: true);
         int baseGameAmount = 100;
         for (int i = 0; i < baseGameAmount; i++)
-            stagingLoadData.RegionalFlags.Add(bool.Parse(regionalFlagsData[i]));
+            stagingLoadData.RegionalFlags.Add(InvariantSpanParser.ParseBoolean(regionalFlagsData.ReadNext()));
     }
 
-    private void LoadCrystalBerriesLine(string crystalBerriesLine, StagingLoadData stagingLoadData)
+    private void LoadCrystalBerriesLine(ReadOnlySpan<char> crystalBerriesLine, StagingLoadData stagingLoadData)
     {
-        string[] crystalBerriesData = crystalBerriesLine.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer crystalBerriesData = new(crystalBerriesLine, Comma, removeEmptyEntries: true);
         int baseGameAmount = _crystalBerriesLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
-            stagingLoadData.CrystalBerryFlags.Add(bool.Parse(crystalBerriesData[i]));
+            stagingLoadData.CrystalBerryFlags.Add(InvariantSpanParser.ParseBoolean(crystalBerriesData.ReadNext()));
     }
 
-    private void LoadFollowersLine(string followersLine, StagingLoadData stagingLoadData)
+    private void LoadFollowersLine(ReadOnlySpan<char> followersLine, StagingLoadData stagingLoadData)
     {
-        string[] animIdEffectiveIds = followersLine.Split(
-            StringUtils.CommaSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
-        for (int i = 0; i < animIdEffectiveIds.Length; i++)
+        SpanTokenizer animIdEffectiveIds = new(followersLine, Comma, removeEmptyEntries: true);
+        for (int i = 0; animIdEffectiveIds.TryReadNext(out ReadOnlySpan<char> animIdEffectiveIdData); i++)
         {
-            string animIdEffectiveId = animIdEffectiveIds[i];
+            string animIdEffectiveId = animIdEffectiveIdData.ToString();
             if (!_animIdsLeafRegistry.TryGetByEffectiveId(animIdEffectiveId, out AnimIdLeaf? animIdLeaf))
             {
                 (string CreatorId, string NamedId) idParts = EffectiveLeafId.SplitParts(animIdEffectiveId);
@@ -716,19 +692,17 @@ internal sealed class BaseGameSaveDataDeserializer : IBaseGameSaveDataDeserializ
         }
     }
 
-    private void LoadEnemyEncountersDataLine(string enemyEncountersDataLine, StagingLoadData stagingLoadData)
+    private void LoadEnemyEncountersDataLine(
+        ReadOnlySpan<char> enemyEncountersDataLine,
+        StagingLoadData stagingLoadData)
     {
-        string[] enemyEncountersData = enemyEncountersDataLine.Split(
-            StringUtils.AtSymbolSplitDelimiter,
-            StringSplitOptions.RemoveEmptyEntries);
+        SpanTokenizer enemyEncountersData = new(enemyEncountersDataLine, AtSymbol, removeEmptyEntries: true);
         int baseGameAmount = _enemiesLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
-            string[] enemyEncounterData = enemyEncountersData[i].Split(
-                StringUtils.CommaSplitDelimiter,
-                StringSplitOptions.RemoveEmptyEntries);
-            int amountSeen = int.Parse(enemyEncounterData[0], CultureInfo.InvariantCulture);
-            int amountDefeated = int.Parse(enemyEncounterData[1], CultureInfo.InvariantCulture);
+            SpanTokenizer enemyEncounterData = new(enemyEncountersData.ReadNext(), Comma, removeEmptyEntries: true);
+            int amountSeen = InvariantSpanParser.ParseInt32(enemyEncounterData.ReadNext());
+            int amountDefeated = InvariantSpanParser.ParseInt32(enemyEncounterData.ReadNext());
             stagingLoadData.EnemyEncounter.Add([amountSeen, amountDefeated]);
         }
     }
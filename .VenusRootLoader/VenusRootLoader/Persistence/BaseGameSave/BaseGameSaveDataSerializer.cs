@@ -1,5 +1,5 @@
 using CommunityToolkit.Diagnostics;
-using System.Text;
+using System.Buffers;
 using UnityEngine;
 using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.Extensions;
@@ -16,6 +16,9 @@ internal sealed class BaseGameSaveDataSerializer : IBaseGameSaveDataSerializer
     private const string FlagstringSeparator = "|SPLIT|";
     private const char Dash = '-';
 
+    // The size of a save with a bit of room for buds leaves to avoid growing the buffer in most cases
+    private const int InitialBufferSize = 30_000;
+
     private readonly IGameDataRuntimeState _gameDataRuntimeState;
     private readonly ILeavesRegistry<AnimIdLeaf> _animIdsLeafRegistry;
     private readonly ILeavesRegistry<AreaLeaf> _areasLeafRegistry;
@@ -74,77 +77,80 @@ internal sealed class BaseGameSaveDataSerializer : IBaseGameSaveDataSerializer
 
     public string GetBaseGameSaveDataFromRuntimeState(Vector3? playerPositionToSave)
     {
-        StringBuilder sb = new(30_000);
-
-        AppendHeaderLineStringData(sb, playerPositionToSave);
-        AppendPlayerPartyMemberStatsLineStringData(sb);
-        AppendGeneralInformationLineStringData(sb);
-        AppendMedalShopsLineStringData(sb, _gameDataRuntimeState.AvailableBadgePool);
-        AppendMedalShopsLineStringData(sb, _gameDataRuntimeState.BadgeShops);
-        AppendQuestsLineStringData(sb);
-        AppendItemsLineStringData(sb);
-        AppendMedalsLineStringData(sb);
-        AppendSamiraSongsLineStringData(sb);
-        AppendStatBonusesLineStringData(sb);
-        AppendLibraryLineStringData(sb);
-        AppendFlagsLineStringData(sb);
-        AppendFlagstringsLineStringData(sb);
-        AppendFlagvarsLineStringData(sb);
-        AppendRegionalFlagsLineStringData(sb);
-        AppendCryatalBerriesLineStringData(sb);
-        AppendFollowersLineStringData(sb);
-        AppendEnemyEncountersDataLineStringData(sb);
-
-        return sb.ToString();
+        using PooledCharBufferWriter writer = new(InitialBufferSize);
+        WriteBaseGameSaveDataFromRuntimeState(writer, playerPositionToSave);
+        return writer.ToString();
+    }
+
+    public void WriteBaseGameSaveDataFromRuntimeState(IBufferWriter<char> writer, Vector3? playerPositionToSave)
+    {
+        AppendHeaderLineStringData(writer, playerPositionToSave);
+        AppendPlayerPartyMemberStatsLineStringData(writer);
+        AppendGeneralInformationLineStringData(writer);
+        AppendMedalShopsLineStringData(writer, _gameDataRuntimeState.AvailableBadgePool);
+        AppendMedalShopsLineStringData(writer, _gameDataRuntimeState.BadgeShops);
+        AppendQuestsLineStringData(writer);
+        AppendItemsLineStringData(writer);
+        AppendMedalsLineStringData(writer);
+        AppendSamiraSongsLineStringData(writer);
+        AppendStatBonusesLineStringData(writer);
+        AppendLibraryLineStringData(writer);
+        AppendFlagsLineStringData(writer);
+        AppendFlagstringsLineStringData(writer);
+        AppendFlagvarsLineStringData(writer);
+        AppendRegionalFlagsLineStringData(writer);
+        AppendCryatalBerriesLineStringData(writer);
+        AppendFollowersLineStringData(writer);
+        AppendEnemyEncountersDataLineStringData(writer);
     }
 
-    private void AppendHeaderLineStringData(StringBuilder sb, Vector3? playerPositionToSave)
+    private void AppendHeaderLineStringData(IBufferWriter<char> writer, Vector3? playerPositionToSave)
     {
         Vector3 savePosition = playerPositionToSave ?? _gameDataRuntimeState.PlayerPosition;
 
-        sb.AppendInvariant(savePosition.x).Append(Comma);
-        sb.AppendInvariant(savePosition.y).Append(Comma);
-        sb.AppendInvariant(savePosition.z).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flags[613]).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flags[614]).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flags[615]).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flags[616]).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flags[656]).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flags[681]).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Flagstring[10]);
-
-        sb.Append(LineFeed);
+        writer.WriteInvariant(savePosition.x).Write(Comma);
+        writer.WriteInvariant(savePosition.y).Write(Comma);
+        writer.WriteInvariant(savePosition.z).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Flags[613]).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Flags[614]).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Flags[615]).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Flags[616]).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Flags[656]).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Flags[681]).Write(Comma);
+        writer.Write(_gameDataRuntimeState.Flagstring[10]);
+
+        writer.Write(LineFeed);
     }
 
-    private void AppendPlayerPartyMemberStatsLineStringData(StringBuilder sb)
+    private void AppendPlayerPartyMemberStatsLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.PlayerData.Count; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
             PartyMemberRuntimeState battleData = _gameDataRuntimeState.PlayerData[i];
             string animIdEffectiveId = _animIdsLeafRegistry.GetByGameId(battleData.Trueid).EffectiveId;
 
-            sb.AppendInvariant(animIdEffectiveId).Append(Comma);
-            sb.AppendInvariant(battleData.Hp).Append(Comma);
-            sb.AppendInvariant(battleData.Maxhp).Append(Comma);
-            sb.AppendInvariant(battleData.Basehp).Append(Comma);
-            sb.AppendInvariant(battleData.Atk).Append(Comma);
-            sb.AppendInvariant(battleData.Baseatk).Append(Comma);
-            sb.AppendInvariant(battleData.Def).Append(Comma);
-            sb.AppendInvariant(battleData.Basedef);
+            writer.Write(animIdEffectiveId).Write(Comma);
+            writer.WriteInvariant(battleData.Hp).Write(Comma);
+            writer.WriteInvariant(battleData.Maxhp).Write(Comma);
+            writer.WriteInvariant(battleData.Basehp).Write(Comma);
+            writer.WriteInvariant(battleData.Atk).Write(Comma);
+            writer.WriteInvariant(battleData.Baseatk).Write(Comma);
+            writer.WriteInvariant(battleData.Def).Write(Comma);
+            writer.WriteInvariant(battleData.Basedef);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendGeneralInformationLineStringData(StringBuilder sb)
+    private void AppendGeneralInformationLineStringData(IBufferWriter<char> writer)
     {
         string areaEffectiveId = _areasLeafRegistry.GetByGameId(_gameDataRuntimeState.MapAreaId).EffectiveId;
         string mapEffectiveId = _mapsLeafRegistry.GetByGameId(int.Parse(_gameDataRuntimeState.MapName)).EffectiveId;
-        List<bool> progressIconFlags =
-        [
+        ReadOnlySpan<bool> progressIconFlags = stackalloc bool[]
+        {
             _gameDataRuntimeState.Flags[41],
             _gameDataRuntimeState.Flags[88],
             _gameDataRuntimeState.Flags[299],
@@ -152,147 +158,153 @@ internal sealed class BaseGameSaveDataSerializer : IBaseGameSaveDataSerializer
             _gameDataRuntimeState.Flags[347],
             _gameDataRuntimeState.Flags[346],
             _gameDataRuntimeState.Flags[555]
-        ];
-
-        sb.AppendInvariant(_gameDataRuntimeState.PartyLevel).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.PartyExp).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.NeededExp).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.BaseTp).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Tp).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Money).Append(Comma);
-        sb.AppendInvariant(mapEffectiveId).Append(Comma);
-        sb.AppendInvariant(areaEffectiveId).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.Bp).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.MaxBp).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.MaxItems).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.MaxStorage).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.ClockHour).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.ClockMin).Append(Comma);
-        sb.AppendInvariant(_gameDataRuntimeState.ClockSec).Append(Comma);
-        sb.AppendInvariant(progressIconFlags.Count(flag => flag));
-
-        sb.Append(LineFeed);
+        };
+        int progressIconsCount = 0;
+        foreach (bool progressIconFlag in progressIconFlags)
+        {
+            if (progressIconFlag)
+                progressIconsCount++;
+        }
+
+        writer.WriteInvariant(_gameDataRuntimeState.PartyLevel).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.PartyExp).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.NeededExp).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.BaseTp).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Tp).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Money).Write(Comma);
+        writer.Write(mapEffectiveId).Write(Comma);
+        writer.Write(areaEffectiveId).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.Bp).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.MaxBp).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.MaxItems).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.MaxStorage).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.ClockHour).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.ClockMin).Write(Comma);
+        writer.WriteInvariant(_gameDataRuntimeState.ClockSec).Write(Comma);
+        writer.WriteInvariant(progressIconsCount);
+
+        writer.Write(LineFeed);
     }
 
-    private void AppendMedalShopsLineStringData(StringBuilder sb, List<int>[] shopsData)
+    private void AppendMedalShopsLineStringData(IBufferWriter<char> writer, List<int>[] shopsData)
     {
         List<int> merabShopData = shopsData[0];
         for (int i = 0; i < merabShopData.Count; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
-            sb.AppendInvariant(_medalsLeafRegistry.GetByGameId(merabShopData[i]).EffectiveId);
+                writer.Write(Comma);
+            writer.Write(_medalsLeafRegistry.GetByGameId(merabShopData[i]).EffectiveId);
         }
 
-        sb.Append(AtSymbol);
+        writer.Write(AtSymbol);
 
         List<int> shadesShopData = shopsData[1];
         for (int i = 0; i < shadesShopData.Count; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
-            sb.AppendInvariant(_medalsLeafRegistry.GetByGameId(shadesShopData[i]).EffectiveId);
+                writer.Write(Comma);
+            writer.Write(_medalsLeafRegistry.GetByGameId(shadesShopData[i]).EffectiveId);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendQuestsLineStringData(StringBuilder sb)
+    private void AppendQuestsLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.BoardQuests.Length; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
             for (int j = 0; j < _gameDataRuntimeState.BoardQuests[i].Count; j++)
             {
                 if (j > 0)
-                    sb.Append(Comma);
+                    writer.Write(Comma);
                 int questGameId = _gameDataRuntimeState.BoardQuests[i][j];
-                sb.AppendInvariant(_questsLeafRegistry.GetByGameId(questGameId).EffectiveId);
+                writer.Write(_questsLeafRegistry.GetByGameId(questGameId).EffectiveId);
             }
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendItemsLineStringData(StringBuilder sb)
+    private void AppendItemsLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.Items.Length; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
             for (int j = 0; j < _gameDataRuntimeState.Items[i].Count; j++)
             {
                 if (j > 0)
-                    sb.Append(Comma);
+                    writer.Write(Comma);
                 int itemGameId = _gameDataRuntimeState.Items[i][j];
-                sb.AppendInvariant(_itemsLeafRegistry.GetByGameId(itemGameId).EffectiveId);
+                writer.Write(_itemsLeafRegistry.GetByGameId(itemGameId).EffectiveId);
             }
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendMedalsLineStringData(StringBuilder sb)
+    private void AppendMedalsLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.Badges.Count; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
             int medalGameId = _gameDataRuntimeState.Badges[i][0];
-            sb.AppendInvariant(_medalsLeafRegistry.GetByGameId(medalGameId).EffectiveId);
-            sb.Append(Comma);
+            writer.Write(_medalsLeafRegistry.GetByGameId(medalGameId).EffectiveId);
+            writer.Write(Comma);
             int medalEquipTarget = _gameDataRuntimeState.Badges[i][1];
             if (medalEquipTarget != -2)
-                sb.AppendInvariant(_animIdsLeafRegistry.GetByGameId(medalEquipTarget).EffectiveId);
+                writer.Write(_animIdsLeafRegistry.GetByGameId(medalEquipTarget).EffectiveId);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendSamiraSongsLineStringData(StringBuilder sb)
+    private void AppendSamiraSongsLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.SamiraMusics.Count; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
             int musicGameId = _gameDataRuntimeState.SamiraMusics[i][0];
-            sb.AppendInvariant(_musicsLeafRegistry.GetByGameId(musicGameId).EffectiveId);
-            sb.Append(Comma);
-            sb.AppendInvariant(_gameDataRuntimeState.SamiraMusics[i][1]);
+            writer.Write(_musicsLeafRegistry.GetByGameId(musicGameId).EffectiveId);
+            writer.Write(Comma);
+            writer.WriteInvariant(_gameDataRuntimeState.SamiraMusics[i][1]);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendStatBonusesLineStringData(StringBuilder sb)
+    private void AppendStatBonusesLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.StatBonus.Count; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
-            sb.AppendInvariant(_gameDataRuntimeState.StatBonus[i][0]);
-            sb.Append(Comma);
-            sb.AppendInvariant(_gameDataRuntimeState.StatBonus[i][1]);
-            sb.Append(Comma);
+            writer.WriteInvariant(_gameDataRuntimeState.StatBonus[i][0]);
+            writer.Write(Comma);
+            writer.WriteInvariant(_gameDataRuntimeState.StatBonus[i][1]);
+            writer.Write(Comma);
             int bonusTarget = _gameDataRuntimeState.StatBonus[i][2];
-            sb.AppendInvariant(_animIdsLeafRegistry.GetByGameId(bonusTarget).EffectiveId);
+            writer.Write(_animIdsLeafRegistry.GetByGameId(bonusTarget).EffectiveId);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendLibraryLineStringData(StringBuilder sb)
+    private void AppendLibraryLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.LibraryStuff.GetLength(0); i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
 
             int baseGameLeavesAmount = (MainManager.LibraryPages)i switch
             {
@@ -308,138 +320,128 @@ internal sealed class BaseGameSaveDataSerializer : IBaseGameSaveDataSerializer
             for (int j = 0; j < 256; j++)
             {
                 if (j > 0)
-                    sb.Append(Comma);
+                    writer.Write(Comma);
                 // ReSharper disable once ConvertIfStatementToConditionalTernaryExpression
                 if (j >= baseGameLeavesAmount)
-                    sb.AppendInvariant(false);
+                    writer.WriteInvariant(false);
                 else
-                    sb.AppendInvariant(_gameDataRuntimeState.LibraryStuff[i, j]);
+                    writer.WriteInvariant(_gameDataRuntimeState.LibraryStuff[i, j]);
             }
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendFlagsLineStringData(StringBuilder sb)
+    private void AppendFlagsLineStringData(IBufferWriter<char> writer)
     {
+        bool[] flags = _gameDataRuntimeState.Flags;
         int baseGameAmount = _flagsLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
-            sb.AppendInvariant(_gameDataRuntimeState.Flags[i]);
+                writer.Write(Comma);
+            writer.WriteInvariant(flags[i]);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendFlagstringsLineStringData(StringBuilder sb)
+    private void AppendFlagstringsLineStringData(IBufferWriter<char> writer)
     {
         int baseGameAmount = _flagstringsLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
             if (i > 0)
-                sb.Append(FlagstringSeparator);
+                writer.Write(FlagstringSeparator);
 
-            string value = i switch
+            switch (i)
             {
-                8 => !string.IsNullOrWhiteSpace(_gameDataRuntimeState.Flagstring[i])
-                    ? ConvertChapter4CaptureData(_gameDataRuntimeState.Flagstring[i])
-                    : _gameDataRuntimeState.Flagstring[i],
-                12 => !string.IsNullOrWhiteSpace(_gameDataRuntimeState.Flagstring[i])
-                    ? ConvertSavedSpyCardsDeck(_gameDataRuntimeState.Flagstring[i])
-                    : _gameDataRuntimeState.Flagstring[i],
-                13 => !string.IsNullOrWhiteSpace(_gameDataRuntimeState.Flagstring[i])
-                    ? ConvertMysteryMedalsQueue(_gameDataRuntimeState.Flagstring[i])
-                    : _gameDataRuntimeState.Flagstring[i],
-                _ => _gameDataRuntimeState.Flagstring[i]
-            };
-            sb.AppendInvariant(value);
+                case 8 when !string.IsNullOrWhiteSpace(_gameDataRuntimeState.Flagstring[i]):
+                    WriteChapter4CaptureData(writer, _gameDataRuntimeState.Flagstring[i]);
+                    break;
+                case 12 when !string.IsNullOrWhiteSpace(_gameDataRuntimeState.Flagstring[i]):
+                    WriteSavedSpyCardsDeck(writer, _gameDataRuntimeState.Flagstring[i]);
+                    break;
+                case 13 when !string.IsNullOrWhiteSpace(_gameDataRuntimeState.Flagstring[i]):
+                    WriteMysteryMedalsQueue(writer, _gameDataRuntimeState.Flagstring[i]);
+                    break;
+                default:
+                    writer.Write(_gameDataRuntimeState.Flagstring[i]);
+                    break;
+            }
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private string ConvertMysteryMedalsQueue(string original)
+    private void WriteMysteryMedalsQueue(IBufferWriter<char> writer, string original)
     {
-        StringBuilder sb = new();
-
-        string[] originalGameIds = original.Split(StringUtils.CommaSplitDelimiter);
-        for (int i = 0; i < originalGameIds.Length; i++)
+        SpanTokenizer originalGameIds = new(original.AsSpan(), Comma, removeEmptyEntries: false);
+        for (int i = 0; originalGameIds.TryReadNext(out ReadOnlySpan<char> originalGameId); i++)
         {
             if (i > 0)
-                sb.Append(Comma);
+                writer.Write(Comma);
 
-            int medalGameId = int.Parse(originalGameIds[i]);
+            int medalGameId = InvariantSpanParser.ParseInt32(originalGameId);
             string medalEffectiveId = _medalsLeafRegistry.GetByGameId(medalGameId).EffectiveId;
-            sb.AppendInvariant(medalEffectiveId);
+            writer.Write(medalEffectiveId);
         }
-
-        return sb.ToString();
     }
 
-    private string ConvertSavedSpyCardsDeck(string original)
+    private void WriteSavedSpyCardsDeck(IBufferWriter<char> writer, string original)
     {
-        StringBuilder sb = new();
-
-        string[] originalGameIds = original.Split(StringUtils.CommaSplitDelimiter);
-        for (int i = 0; i < originalGameIds.Length; i++)
+        SpanTokenizer originalGameIds = new(original.AsSpan(), Comma, removeEmptyEntries: false);
+        for (int i = 0; originalGameIds.TryReadNext(out ReadOnlySpan<char> originalGameId); i++)
         {
             if (i > 0)
-                sb.Append(Comma);
+                writer.Write(Comma);
 
-            int spyCardGameId = int.Parse(originalGameIds[i]);
+            int spyCardGameId = InvariantSpanParser.ParseInt32(originalGameId);
             string spyCardEffectiveId = _spyCardsLeafRegistry.GetByGameId(spyCardGameId).EffectiveId;
-            sb.AppendInvariant(spyCardEffectiveId);
+            writer.Write(spyCardEffectiveId);
         }
-
-        return sb.ToString();
     }
 
-    private string ConvertChapter4CaptureData(string original)
+    private void WriteChapter4CaptureData(IBufferWriter<char> writer, string original)
     {
-        StringBuilder sb = new();
+        SpanTokenizer originalParts = new(original.AsSpan(), Dash, removeEmptyEntries: false);
+        SpanTokenizer regularItemGameIds = new(originalParts.ReadNext(), Comma, removeEmptyEntries: false);
+        SpanTokenizer keyItemGameIds = new(originalParts.ReadNext(), Comma, removeEmptyEntries: false);
+        ReadOnlySpan<char> berryCount = originalParts.ReadNext();
 
-        string[] originalParts = original.Split(StringUtils.DashSplitDelimiter);
-        string[] regularItemGameIds = originalParts[0].Split(StringUtils.CommaSplitDelimiter);
-        string[] keyItemGameIds = originalParts[1].Split(StringUtils.CommaSplitDelimiter);
-        string berryCount = originalParts[2];
-
-        for (int i = 0; i < regularItemGameIds.Length; i++)
+        for (int i = 0; regularItemGameIds.TryReadNext(out ReadOnlySpan<char> regularItemGameId); i++)
         {
             if (i > 0)
-                sb.Append(Comma);
+                writer.Write(Comma);
 
-            int itemGameId = int.Parse(regularItemGameIds[i]);
+            int itemGameId = InvariantSpanParser.ParseInt32(regularItemGameId);
             string itemEffectiveId = _itemsLeafRegistry.GetByGameId(itemGameId).EffectiveId;
-            sb.AppendInvariant(itemEffectiveId);
+            writer.Write(itemEffectiveId);
         }
 
-        sb.Append(Dash);
+        writer.Write(Dash);
 
-        for (int i = 0; i < keyItemGameIds.Length; i++)
+        for (int i = 0; keyItemGameIds.TryReadNext(out ReadOnlySpan<char> keyItemGameId); i++)
         {
             if (i > 0)
-                sb.Append(Comma);
+                writer.Write(Comma);
 
-            int itemGameId = int.Parse(keyItemGameIds[i]);
+            int itemGameId = InvariantSpanParser.ParseInt32(keyItemGameId);
             string itemEffectiveId = _itemsLeafRegistry.GetByGameId(itemGameId).EffectiveId;
-            sb.AppendInvariant(itemEffectiveId);
+            writer.Write(itemEffectiveId);
         }
 
-        sb.Append(Dash);
-        sb.AppendInvariant(berryCount);
-
-        return sb.ToString();
+        writer.Write(Dash);
+        writer.Write(berryCount);
     }
 
-    private void AppendFlagvarsLineStringData(StringBuilder sb)
+    private void AppendFlagvarsLineStringData(IBufferWriter<char> writer)
     {
         int baseGameAmount = _flagvarsLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
+                writer.Write(Comma);
 
             if (i == 56)
             {
@@ -448,73 +450,73 @@ internal sealed class BaseGameSaveDataSerializer : IBaseGameSaveDataSerializer
                     continue;
 
                 string itemEffectiveId = _itemsLeafRegistry.GetByGameId(itemGameId).EffectiveId;
-                sb.AppendInvariant(itemEffectiveId);
+                writer.Write(itemEffectiveId);
             }
             else
             {
-                sb.AppendInvariant(_gameDataRuntimeState.Flagvar[i]);
+                writer.WriteInvariant(_gameDataRuntimeState.Flagvar[i]);
             }
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendRegionalFlagsLineStringData(StringBuilder sb)
+    private void AppendRegionalFlagsLineStringData(IBufferWriter<char> writer)
     {
         int baseGameAmount = 100;
         for (int i = 0; i < baseGameAmount; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
-            sb.AppendInvariant(_gameDataRuntimeState.RegionalFlags[i]);
+                writer.Write(Comma);
+            writer.WriteInvariant(_gameDataRuntimeState.RegionalFlags[i]);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendCryatalBerriesLineStringData(StringBuilder sb)
+    private void AppendCryatalBerriesLineStringData(IBufferWriter<char> writer)
     {
         int baseGameAmount = _crystalBerriesLeafRegistry.CountBaseGame;
         for (int i = 0; i < baseGameAmount; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
-            sb.AppendInvariant(_gameDataRuntimeState.CrystalBFlags[i]);
+                writer.Write(Comma);
+            writer.WriteInvariant(_gameDataRuntimeState.CrystalBFlags[i]);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendFollowersLineStringData(StringBuilder sb)
+    private void AppendFollowersLineStringData(IBufferWriter<char> writer)
     {
         for (int i = 0; i < _gameDataRuntimeState.ExtraFollowers.Count; i++)
         {
             if (i > 0)
-                sb.Append(Comma);
+                writer.Write(Comma);
             int followerAnimId = _gameDataRuntimeState.ExtraFollowers[i];
             string animIdEffectiveId = _animIdsLeafRegistry.GetByGameId(followerAnimId).EffectiveId;
-            sb.AppendInvariant(animIdEffectiveId);
+            writer.Write(animIdEffectiveId);
         }
 
-        sb.Append(LineFeed);
+        writer.Write(LineFeed);
     }
 
-    private void AppendEnemyEncountersDataLineStringData(StringBuilder sb)
+    private void AppendEnemyEncountersDataLineStringData(IBufferWriter<char> writer)
     {
         int baseGameAmount = _enemiesLeafRegistry.CountBaseGame;
         for (int i = 0; i < 256; i++)
         {
             if (i > 0)
-                sb.Append(AtSymbol);
+                writer.Write(AtSymbol);
             if (i >= baseGameAmount)
             {
-                sb.Append("0,0");
+                writer.Write("0,0");
                 continue;
             }
 
-            sb.AppendInvariant(_gameDataRuntimeState.EnemyEncounter[i, 0]);
-            sb.Append(Comma);
-            sb.AppendInvariant(_gameDataRuntimeState.EnemyEncounter[i, 1]);
+            writer.WriteInvariant(_gameDataRuntimeState.EnemyEncounter[i, 0]);
+            writer.Write(Comma);
+            writer.WriteInvariant(_gameDataRuntimeState.EnemyEncounter[i, 1]);
         }
     }
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+using System.Buffers;
 using UnityEngine;
 
 namespace VenusRootLoader.Persistence.BaseGameSave;
@@ -5,4 +6,5 @@ namespace VenusRootLoader.Persistence.BaseGameSave;
 internal interface IBaseGameSaveDataSerializer
 {
     string GetBaseGameSaveDataFromRuntimeState(Vector3? playerPositionToSave);
+    void WriteBaseGameSaveDataFromRuntimeState(IBufferWriter<char> writer, Vector3? playerPositionToSave);
 }
\ No newline at end of file
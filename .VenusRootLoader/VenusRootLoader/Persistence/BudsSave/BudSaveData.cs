@@ -12,12 +12,58 @@ internal sealed class BudSaveData
     public required Dictionary<string, string> Flagstrings { get; init; } = new();
     public required Dictionary<string, int> Flagvars { get; init; } = new();
     public required Dictionary<string, bool> CrystalBerries { get; init; } = new();
+
+    /// <summary>
+    /// Tells if this save data would be serialized to the same content as another one. This is much cheaper than
+    /// serializing both so it allows to know if a bud's save data changed since it was last written.
+    /// </summary>
+    /// <param name="other">The save data to compare to.</param>
+    /// <returns>Whether both save data have the same content.</returns>
+    internal bool HasSameContentAs(BudSaveData other)
+    {
+        return HaveSameContent(MedalShops, other.MedalShops, (x, y) => x.HasSameContentAs(y)) &&
+               HaveSameContent(DiscoveryUnlocks, other.DiscoveryUnlocks, (x, y) => x == y) &&
+               HaveSameContent(Enemies, other.Enemies, (x, y) => x.HasSameContentAs(y)) &&
+               HaveSameContent(RecipeLibraryEntryUnlocks, other.RecipeLibraryEntryUnlocks, (x, y) => x == y) &&
+               HaveSameContent(RecordUnlocks, other.RecordUnlocks, (x, y) => x == y) &&
+               HaveSameContent(AreaUnlocks, other.AreaUnlocks, (x, y) => x == y) &&
+               HaveSameContent(Flags, other.Flags, (x, y) => x == y) &&
+               HaveSameContent(Flagstrings, other.Flagstrings, (x, y) => x == y) &&
+               HaveSameContent(Flagvars, other.Flagvars, (x, y) => x == y) &&
+               HaveSameContent(CrystalBerries, other.CrystalBerries, (x, y) => x == y);
+    }
+
+    // The entries are serialized in order so they must also be in the same order to produce the same content
+    private static bool HaveSameContent<T>(
+        Dictionary<string, T> first,
+        Dictionary<string, T> second,
+        Func<T, T, bool> haveSameValue)
+    {
+        if (first.Count != second.Count)
+            return false;
+
+        using Dictionary<string, T>.Enumerator firstEnumerator = first.GetEnumerator();
+        using Dictionary<string, T>.Enumerator secondEnumerator = second.GetEnumerator();
+        while (firstEnumerator.MoveNext() && secondEnumerator.MoveNext())
+        {
+            if (firstEnumerator.Current.Key != secondEnumerator.Current.Key ||
+                !haveSameValue(firstEnumerator.Current.Value, secondEnumerator.Current.Value))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
 }
 
 internal sealed class MedalShopLeafSaveData
 {
     public required List<string> AvailablePool { get; init; } = new();
     public required List<string> ShopStock { get; init; } = new();
+
+    internal bool HasSameContentAs(MedalShopLeafSaveData other) =>
+        AvailablePool.SequenceEqual(other.AvailablePool) && ShopStock.SequenceEqual(other.ShopStock);
 }
 
 internal sealed class EnemySaveData
@@ -25,4 +71,9 @@ internal sealed class EnemySaveData
     public required bool IsBestiaryEntryUnlocked { get; init; }
     public required int AmountSeen { get; init; }
     public required int AmountDefeated { get; init; }
+
+    internal bool HasSameContentAs(EnemySaveData other) =>
+        IsBestiaryEntryUnlocked == other.IsBestiaryEntryUnlocked &&
+        AmountSeen == other.AmountSeen &&
+        AmountDefeated == other.AmountDefeated;
 }
\ No newline at end of file
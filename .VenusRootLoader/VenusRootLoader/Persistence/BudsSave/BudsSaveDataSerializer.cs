@@ -49,9 +49,9 @@ internal sealed class BudsSaveDataSerializer : IBudsSaveDataSerializer
         _crystalBerriesLeafRegistry = crystalBerriesLeafRegistry;
     }
 
-    public Dictionary<string, string> GetBudsSaveDataFromRuntimeState()
+    public Dictionary<string, BudSaveData> GetBudsSaveDataFromRuntimeState()
     {
-        Dictionary<string, string> budsSaveData = new();
+        Dictionary<string, BudSaveData> budsSaveData = new();
 
         Dictionary<string, List<MedalShopLeaf>> medalShopsByCreatorId = GetLeavesByCreatorIds(_medalShopsLeafRegistry);
         Dictionary<string, List<DiscoveryLeaf>>
@@ -95,13 +95,15 @@ internal sealed class BudsSaveDataSerializer : IBudsSaveDataSerializer
                 GetNormalizedLeavesList(budId, flagstringsByCreatorId),
                 GetNormalizedLeavesList(budId, flagvarsByCreatorId),
                 GetNormalizedLeavesList(budId, crystalBerriesByCreatorId));
-            string jsonBudSaveData = JsonSerializer.Serialize(budSaveData, _serializerOptions);
-            budsSaveData.Add(budId, jsonBudSaveData);
+            budsSaveData.Add(budId, budSaveData);
         }
 
         return budsSaveData;
     }
 
+    public string SerializeBudSaveData(BudSaveData budSaveData) =>
+        JsonSerializer.Serialize(budSaveData, _serializerOptions);
+
     private BudSaveData GetBudSaveDataFromRuntimeState(
         List<MedalShopLeaf> medalShopLeaves,
         List<DiscoveryLeaf> discoveryLeaves,
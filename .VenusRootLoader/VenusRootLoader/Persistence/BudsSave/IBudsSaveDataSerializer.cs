@@ -2,5 +2,6 @@ namespace VenusRootLoader.Persistence.BudsSave;
 
 internal interface IBudsSaveDataSerializer
 {
-    Dictionary<string, string> GetBudsSaveDataFromRuntimeState();
+    Dictionary<string, BudSaveData> GetBudsSaveDataFromRuntimeState();
+    string SerializeBudSaveData(BudSaveData budSaveData);
 }
\ No newline at end of file
@@ -0,0 +1,27 @@
+using System.Runtime.InteropServices;
+
+namespace VenusRootLoader.Persistence;
+
+/// <summary>
+/// Creates hard links which isn't supported by <see cref="System.IO.Abstractions.IFileSystem"/>.
+/// </summary>
+internal interface IFileHardLinker
+{
+    /// <summary>
+    /// Tries to create a new path for an existing file without copying its content.
+    /// </summary>
+    /// <param name="linkPath">The new path of the file which must not exist yet.</param>
+    /// <param name="existingFilePath">The path of the existing file.</param>
+    /// <returns>Whether the link was created. It can fail such as when the file system doesn't support hard links.
+    /// </returns>
+    bool TryCreateHardLink(string linkPath, string existingFilePath);
+}
+
+internal sealed class FileHardLinker : IFileHardLinker
+{
+    [DllImport("kernel32.dll", EntryPoint = "CreateHardLinkW", CharSet = CharSet.Unicode, SetLastError = true)]
+    private static extern bool CreateHardLink(string lpFileName, string lpExistingFileName, nint lpSecurityAttributes);
+
+    public bool TryCreateHardLink(string linkPath, string existingFilePath) =>
+        CreateHardLink(linkPath, existingFilePath, nint.Zero);
+}
\ No newline at end of file
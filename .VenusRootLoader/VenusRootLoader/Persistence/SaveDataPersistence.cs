@@ -1,15 +1,20 @@
 using Microsoft.Extensions.Logging;
 using System.IO.Abstractions;
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.Json;
 using UnityEngine;
 using VenusRootLoader.Api;
 using VenusRootLoader.Persistence.BaseGameSave;
 using VenusRootLoader.Persistence.BudsSave;
+using VenusRootLoader.Utility;
 
 namespace VenusRootLoader.Persistence;
 
 internal sealed class SaveDataPersistence : ISaveDataPersistence
 {
     private const string BaseGameDataFileName = "BaseGame.dat";
+    private const string SaveSlotIndexFileName = "SaveIndex.json";
     private readonly BudLoaderContext _budLoaderContext;
     private readonly IGameDataRuntimeState _gameDataRuntimeState;
     private readonly IFileSystem _fileSystem;
@@ -18,6 +23,11 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
     private readonly IBudsSaveDataDeserializer _budsSaveDataDeserializer;
     private readonly IBaseGameSaveDataSerializer _baseGameSaveDataSerializer;
     private readonly IBudsSaveDataSerializer _budsSaveDataSerializer;
+    private readonly IFileHardLinker _fileHardLinker;
+
+    // The buds save data as they were when they were last written to each save slot during this session. A bud whose
+    // save data didn't change since then doesn't need to be serialized again
+    private readonly Dictionary<int, Dictionary<string, BudSaveData>> _lastWrittenBudsSaveDataBySaveSlots = new();
 
     public SaveDataPersistence(
         BudLoaderContext budLoaderContext,
@@ -27,7 +37,8 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
         IBaseGameSaveDataDeserializer baseGameSaveDataDeserializer,
         IBudsSaveDataDeserializer budsSaveDataDeserializer,
         IBaseGameSaveDataSerializer baseGameSaveDataSerializer,
-        IBudsSaveDataSerializer budsSaveDataSerializer)
+        IBudsSaveDataSerializer budsSaveDataSerializer,
+        IFileHardLinker fileHardLinker)
     {
         _budLoaderContext = budLoaderContext;
         _gameDataRuntimeState = gameDataRuntimeState;
@@ -37,6 +48,7 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
         _budsSaveDataSerializer = budsSaveDataSerializer;
         _budsSaveDataDeserializer = budsSaveDataDeserializer;
         _baseGameSaveDataDeserializer = baseGameSaveDataDeserializer;
+        _fileHardLinker = fileHardLinker;
     }
 
     public bool SaveSlotExistsInVenusRootLoader(int saveSlot)
@@ -53,7 +65,10 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
 
         try
         {
-            string baseGameSaveData = _fileSystem.File.ReadAllText(baseGameSaveFilePath);
+            // Saves written before the index existed or without the needed lines still need to read the whole file
+            SaveSlotIndex? saveSlotIndex = ReadSaveSlotIndex(saveSlotDirectory);
+            string baseGameSaveData = saveSlotIndex?.LiteBaseGameSaveData
+                                      ?? _fileSystem.File.ReadAllText(baseGameSaveFilePath);
             return _baseGameSaveDataDeserializer.DeserializeLiteBaseGameSaveData(baseGameSaveData);
         }
         catch (Exception e)
@@ -80,12 +95,20 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
             MainManager.LoadData? loadData =
                 _baseGameSaveDataDeserializer.DeserializeFullBaseGameSaveData(baseGameSaveData, stagingLoadData);
 
-            Dictionary<string, string> budsSaveDataByIds = new();
-            foreach (string budSaveFilePath in _fileSystem.Directory.EnumerateFiles(saveSlotDirectory, "*.json"))
+            string[] budSaveFilesPaths = _fileSystem.Directory.GetFiles(saveSlotDirectory, "*.json")
+                .Where(path => _fileSystem.Path.GetFileName(path) != SaveSlotIndexFileName)
+                .ToArray();
+            string[] budsSaveData = new string[budSaveFilesPaths.Length];
+            Parallel.For(
+                0,
+                budSaveFilesPaths.Length,
+                i => budsSaveData[i] = _fileSystem.File.ReadAllText(budSaveFilesPaths[i]));
+
+            Dictionary<string, string> budsSaveDataByIds = new(budSaveFilesPaths.Length);
+            for (int i = 0; i < budSaveFilesPaths.Length; i++)
             {
-                string budId = _fileSystem.Path.GetFileNameWithoutExtension(budSaveFilePath);
-                string budSaveData = _fileSystem.File.ReadAllText(budSaveFilePath);
-                budsSaveDataByIds.Add(budId, budSaveData);
+                string budId = _fileSystem.Path.GetFileNameWithoutExtension(budSaveFilesPaths[i]);
+                budsSaveDataByIds.Add(budId, budsSaveData[i]);
             }
 
             _budsSaveDataDeserializer.DeserializeBudsSaveData(budsSaveDataByIds, stagingLoadData);
@@ -109,25 +132,72 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
         string temporarySaveSlotDirectory = saveSlotDirectory + "temp";
         string backupSaveSlotDirectory = saveSlotDirectory + "backup";
         string baseGameSaveFilePath = _fileSystem.Path.Combine(temporarySaveSlotDirectory, BaseGameDataFileName);
+        string saveSlotIndexFilePath = _fileSystem.Path.Combine(temporarySaveSlotDirectory, SaveSlotIndexFileName);
+
+        // Whatever happens next, the files of the save slot might no longer be the ones that were last written
+        _lastWrittenBudsSaveDataBySaveSlots.TryGetValue(
+            saveSlot,
+            out Dictionary<string, BudSaveData>? lastWrittenBudsSaveData);
+        _lastWrittenBudsSaveDataBySaveSlots.Remove(saveSlot);
 
         try
         {
             string saveData = _baseGameSaveDataSerializer.GetBaseGameSaveDataFromRuntimeState(playerPositionToSave);
-            Dictionary<string, string> budsSaveData = _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState();
+            Dictionary<string, BudSaveData> budsSaveData = _budsSaveDataSerializer.GetBudsSaveDataFromRuntimeState();
+
+            SaveSlotIndex? previousSaveSlotIndex = ReadSaveSlotIndex(saveSlotDirectory);
+            SaveSlotIndex saveSlotIndex = new()
+            {
+                FormatVersion = SaveSlotIndex.CurrentFormatVersion,
+                LiteBaseGameSaveData = GetLiteBaseGameSaveData(saveData),
+                BudsSaveFiles = new(budsSaveData.Count)
+            };
 
             if (_fileSystem.Directory.Exists(temporarySaveSlotDirectory))
                 _fileSystem.Directory.Delete(temporarySaveSlotDirectory);
             _fileSystem.Directory.CreateDirectory(temporarySaveSlotDirectory);
 
             _fileSystem.File.WriteAllText(baseGameSaveFilePath, saveData);
-            foreach (KeyValuePair<string, string> budSaveData in budsSaveData)
+            foreach (KeyValuePair<string, BudSaveData> budSaveData in budsSaveData)
             {
-                string budSaveDataFilePath = _fileSystem.Path.Combine(
-                    temporarySaveSlotDirectory,
-                    $"{budSaveData.Key}.json");
-                _fileSystem.File.WriteAllText(budSaveDataFilePath, budSaveData.Value);
+                string budSaveFileName = $"{budSaveData.Key}.json";
+                string existingBudSaveFilePath = _fileSystem.Path.Combine(saveSlotDirectory, budSaveFileName);
+                string budSaveDataFilePath = _fileSystem.Path.Combine(temporarySaveSlotDirectory, budSaveFileName);
+
+                // The existing file is only trusted if it still is the one the previous index described
+                SaveSlotIndex.BudSaveFileInfo? previousBudSaveFileInfo = null;
+                bool isExistingBudSaveFileTrusted =
+                    previousSaveSlotIndex is not null &&
+                    previousSaveSlotIndex.BudsSaveFiles.TryGetValue(budSaveFileName, out previousBudSaveFileInfo) &&
+                    IsBudSaveFileUnchangedOnDisk(existingBudSaveFilePath, previousBudSaveFileInfo);
+
+                // A bud whose save data didn't change since this session last wrote it doesn't need to be serialized
+                // and hashed to know its existing file can be kept
+                if (isExistingBudSaveFileTrusted &&
+                    lastWrittenBudsSaveData is not null &&
+                    lastWrittenBudsSaveData.TryGetValue(budSaveData.Key, out BudSaveData lastWrittenBudSaveData) &&
+                    budSaveData.Value.HasSameContentAs(lastWrittenBudSaveData))
+                {
+                    saveSlotIndex.BudsSaveFiles[budSaveFileName] =
+                        KeepExistingBudSaveFile(existingBudSaveFilePath, budSaveDataFilePath, previousBudSaveFileInfo!);
+                    continue;
+                }
+
+                string serializedBudSaveData = _budsSaveDataSerializer.SerializeBudSaveData(budSaveData.Value);
+                string budSaveDataHash = ComputeSaveDataHash(serializedBudSaveData);
+                if (isExistingBudSaveFileTrusted && previousBudSaveFileInfo!.Hash == budSaveDataHash)
+                {
+                    saveSlotIndex.BudsSaveFiles[budSaveFileName] =
+                        KeepExistingBudSaveFile(existingBudSaveFilePath, budSaveDataFilePath, previousBudSaveFileInfo);
+                    continue;
+                }
+
+                _fileSystem.File.WriteAllText(budSaveDataFilePath, serializedBudSaveData);
+                saveSlotIndex.BudsSaveFiles[budSaveFileName] = GetBudSaveFileInfo(budSaveDataFilePath, budSaveDataHash);
             }
 
+            _fileSystem.File.WriteAllText(saveSlotIndexFilePath, JsonSerializer.Serialize(saveSlotIndex));
+
             if (_fileSystem.Directory.Exists(saveSlotDirectory))
             {
                 if (_fileSystem.Directory.Exists(backupSaveSlotDirectory))
@@ -137,6 +207,7 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
             }
 
             _fileSystem.Directory.Move(temporarySaveSlotDirectory, saveSlotDirectory);
+            _lastWrittenBudsSaveDataBySaveSlots[saveSlot] = budsSaveData;
             return true;
         }
         catch (Exception e)
@@ -151,6 +222,8 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
 
     public bool CopySaveSlot(int sourceSaveSlot, int destinationSaveSlot)
     {
+        _lastWrittenBudsSaveDataBySaveSlots.Remove(destinationSaveSlot);
+
         string sourceSaveSlotDirectory = _fileSystem.Path.Combine(
             _budLoaderContext.SaveDataPath,
             sourceSaveSlot.ToString());
@@ -217,6 +290,7 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
     public bool DeleteSaveSlot(int saveSlot)
     {
         string saveSlotDirectory = _fileSystem.Path.Combine(_budLoaderContext.SaveDataPath, saveSlot.ToString());
+        _lastWrittenBudsSaveDataBySaveSlots.Remove(saveSlot);
 
         try
         {
@@ -229,4 +303,80 @@ internal sealed class SaveDataPersistence : ISaveDataPersistence
             return false;
         }
     }
+
+    private SaveSlotIndex? ReadSaveSlotIndex(string saveSlotDirectory)
+    {
+        string saveSlotIndexFilePath = _fileSystem.Path.Combine(saveSlotDirectory, SaveSlotIndexFileName);
+        if (!_fileSystem.File.Exists(saveSlotIndexFilePath))
+            return null;
+
+        try
+        {
+            SaveSlotIndex? saveSlotIndex =
+                JsonSerializer.Deserialize<SaveSlotIndex>(_fileSystem.File.ReadAllText(saveSlotIndexFilePath));
+            return saveSlotIndex?.FormatVersion == SaveSlotIndex.CurrentFormatVersion ? saveSlotIndex : null;
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(
+                e,
+                "Unable to read the save slot index at {path}, the full save data will be used instead",
+                saveSlotIndexFilePath);
+            return null;
+        }
+    }
+
+    private bool IsBudSaveFileUnchangedOnDisk(string budSaveFilePath, SaveSlotIndex.BudSaveFileInfo budSaveFileInfo)
+    {
+        IFileInfo fileInfo = _fileSystem.FileInfo.New(budSaveFilePath);
+        return fileInfo.Exists &&
+               fileInfo.Length == budSaveFileInfo.Length &&
+               fileInfo.LastWriteTimeUtc.Ticks == budSaveFileInfo.LastWriteTimeUtcTicks;
+    }
+
+    // The existing file also stays in the backup so it is linked instead of moved. Files of a save slot are never
+    // written to once the slot is complete so both paths can safely share the same content
+    private SaveSlotIndex.BudSaveFileInfo KeepExistingBudSaveFile(
+        string existingBudSaveFilePath,
+        string budSaveDataFilePath,
+        SaveSlotIndex.BudSaveFileInfo previousBudSaveFileInfo)
+    {
+        if (_fileHardLinker.TryCreateHardLink(budSaveDataFilePath, existingBudSaveFilePath))
+            return previousBudSaveFileInfo;
+
+        // The file system doesn't support hard links
+        _fileSystem.File.Copy(existingBudSaveFilePath, budSaveDataFilePath);
+        return GetBudSaveFileInfo(budSaveDataFilePath, previousBudSaveFileInfo.Hash);
+    }
+
+    private SaveSlotIndex.BudSaveFileInfo GetBudSaveFileInfo(string budSaveFilePath, string hash)
+    {
+        IFileInfo budSaveFileInfo = _fileSystem.FileInfo.New(budSaveFilePath);
+        return new()
+        {
+            Hash = hash,
+            Length = budSaveFileInfo.Length,
+            LastWriteTimeUtcTicks = budSaveFileInfo.LastWriteTimeUtc.Ticks
+        };
+    }
+
+    // Only the header and general information lines are read by a lite deserialization, the line in between is skipped
+    private static string? GetLiteBaseGameSaveData(string baseGameSaveData)
+    {
+        SpanTokenizer baseGameSaveDataLines = new(baseGameSaveData.AsSpan(), '\n', removeEmptyEntries: false);
+        if (!baseGameSaveDataLines.TryReadNext(out ReadOnlySpan<char> headerLine) ||
+            !baseGameSaveDataLines.TryReadNext(out _) ||
+            !baseGameSaveDataLines.TryReadNext(out ReadOnlySpan<char> generalInformationLine))
+        {
+            return null;
+        }
+
+        return $"{headerLine.ToString()}\n\n{generalInformationLine.ToString()}";
+    }
+
+    private static string ComputeSaveDataHash(string saveData)
+    {
+        using SHA256 sha256 = SHA256.Create();
+        return Convert.ToBase64String(sha256.ComputeHash(Encoding.UTF8.GetBytes(saveData)));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+namespace VenusRootLoader.Persistence;
+
+/// <summary>
+/// A small file written alongside a save slot's data. It holds the base game save data's lines needed for a lite load
+/// so the file select menu doesn't need to read the whole base game save and information about the buds save files
+/// which allows to keep the ones whose content didn't change instead of writing them again.
+/// </summary>
+internal sealed class SaveSlotIndex
+{
+    /// <summary>
+    /// Information about a bud save file as it was when the save slot was written.
+    /// </summary>
+    internal sealed class BudSaveFileInfo
+    {
+        /// <summary>
+        /// The base64 SHA256 hash of the content of the file.
+        /// </summary>
+        public required string Hash { get; init; }
+
+        /// <summary>
+        /// The size of the file in bytes.
+        /// </summary>
+        public required long Length { get; init; }
+
+        /// <summary>
+        /// The UTC ticks of the last time the file was written to.
+        /// </summary>
+        public required long LastWriteTimeUtcTicks { get; init; }
+    }
+
+    // This must be incremented whenever the meaning of any of the fields changes
+    internal const int CurrentFormatVersion = 2;
+
+    public required int FormatVersion { get; init; }
+
+    /// <summary>
+    /// The header and general information lines of the base game save data with an empty line in between so it can
+    /// be given as is to a lite deserialization. This is null if the base game save data didn't have these lines.
+    /// </summary>
+    public required string? LiteBaseGameSaveData { get; init; }
+
+    /// <summary>
+    /// The information about each bud save file by their file names.
+    /// </summary>
+    public required Dictionary<string, BudSaveFileInfo> BudsSaveFiles { get; init; } = new();
+}
\ No newline at end of file
@@ -1,8 +1,8 @@
 using CommunityToolkit.Diagnostics;
 using Microsoft.Extensions.Logging;
 using System.Collections;
+using System.Collections.ObjectModel;
 using System.Diagnostics.CodeAnalysis;
-using System.Reflection;
 using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.LeavesInternals;
 
@@ -12,23 +12,37 @@ namespace VenusRootLoader.Registry;
 internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
     where TLeaf : Leaf
 {
+    // A frozen registry only uses the dense array for game ids from 0 to its length if there's at most this many
+    // unused slots per leaf, the other game ids (such as negative ones) are looked up from the sparse dictionary
+    private const int MaxDenseSlotsPerLeaf = 4;
+
     private readonly ILogger _logger;
 
-    protected BaseRegistry(ILogger logger) => _logger = logger;
+    private Dictionary<int, TLeaf> _leavesByGameIds = new();
+    private Dictionary<string, TLeaf> _leavesByEffectiveIds = new();
 
-    private IDictionary<int, TLeaf> LeavesByGameIds { get; } = new Dictionary<int, TLeaf>();
+    private TLeaf?[] _frozenDenseLeavesByGameIds = [];
+    private TLeaf[] _frozenLeavesInRegistrationOrder = [];
+    private ReadOnlyCollection<TLeaf>? _frozenAllLeaves;
 
-    private IDictionary<string, TLeaf> LeavesByEffectiveIds { get; } = new Dictionary<string, TLeaf>();
+    protected BaseRegistry(ILogger logger) => _logger = logger;
 
     public string RegistryName => typeof(TLeaf).Name;
 
-    public int Count => LeavesByEffectiveIds.Count;
+    public int Count => _leavesByEffectiveIds.Count;
 
     public int CountBaseGame { get; private set; }
 
+    public bool IsFrozen { get; private set; }
+
     protected abstract int CreateNewGameId(string effectiveId);
 
-    public IEnumerator<TLeaf> GetEnumerator() => LeavesByGameIds.Values.GetEnumerator();
+    public IEnumerator<TLeaf> GetEnumerator()
+    {
+        return IsFrozen
+            ? ((IEnumerable<TLeaf>)_frozenLeavesInRegistrationOrder).GetEnumerator()
+            : _leavesByGameIds.Values.GetEnumerator();
+    }
 
     IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
 
@@ -36,20 +50,22 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
 
     public TSubLeaf RegisterNew<TSubLeaf>(string creatorId, string namedId) where TSubLeaf : TLeaf
     {
+        EnsureNotFrozen();
         EffectiveLeafId.EnsureIdPartIsValid(creatorId, nameof(Leaf.CreatorId));
         EffectiveLeafId.EnsureIdPartIsValid(namedId, nameof(Leaf.NamedId));
 
         string effectiveId = EffectiveLeafId.CreateFromParts(creatorId, namedId);
-        if (LeavesByEffectiveIds.ContainsKey(effectiveId))
+        if (_leavesByEffectiveIds.ContainsKey(effectiveId))
         {
             ThrowHelper.ThrowArgumentException(
                 $"The creator {creatorId} already created a leaf named {namedId} in the {RegistryName} registry");
         }
 
         int gameId = CreateNewGameId(effectiveId);
-        TSubLeaf leaf = CreateLeafInstance<TSubLeaf>(gameId, creatorId, namedId);
-        LeavesByEffectiveIds[effectiveId] = leaf;
-        LeavesByGameIds[gameId] = leaf;
+        TSubLeaf leaf = LeafFactory<TSubLeaf>.Create(gameId, creatorId, namedId);
+        _leavesByEffectiveIds[effectiveId] = leaf;
+        _leavesByGameIds[gameId] = leaf;
+        LeafModifications<TLeaf>.Notify();
         LogRegisterContent(leaf);
         return leaf;
     }
@@ -60,33 +76,16 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
     public virtual TSubLeaf RegisterExisting<TSubLeaf>(int gameId, string namedId)
         where TSubLeaf : TLeaf
     {
-        TSubLeaf leaf = CreateLeafInstance<TSubLeaf>(gameId, Constants.BaseGameCreatorId, namedId);
-        LeavesByEffectiveIds[namedId] = leaf;
-        LeavesByGameIds[gameId] = leaf;
+        EnsureNotFrozen();
+        TSubLeaf leaf = LeafFactory<TSubLeaf>.Create(gameId, Constants.BaseGameCreatorId, namedId);
+        _leavesByEffectiveIds[namedId] = leaf;
+        _leavesByGameIds[gameId] = leaf;
+        LeafModifications<TLeaf>.Notify();
         LogRegisterContent(leaf);
         CountBaseGame++;
         return leaf;
     }
 
-    private static TSubLeaf CreateLeafInstance<TSubLeaf>(int gameId, string creatorId, string namedId)
-        where TSubLeaf : TLeaf
-    {
-        // We have to use the Activator here because it's not possible to use a generics constraint that does what we want.
-        // The closest is new(), but this requires the constructor to be public which we don't want on any leaves since
-        // the registry should be the only one allowed to create new leaves from buds
-        return (TSubLeaf)Activator.CreateInstance(
-            typeof(TSubLeaf),
-            BindingFlags.CreateInstance | BindingFlags.Instance | BindingFlags.NonPublic,
-            null,
-            [
-                gameId,
-                creatorId,
-                namedId
-            ],
-            null,
-            null);
-    }
-
     public TLeaf Get(string creatorId, string namedId)
     {
         string effectiveId = EffectiveLeafId.CreateFromParts(creatorId, namedId);
@@ -96,7 +95,7 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
     public bool TryGet(string creatorId, string namedId, [NotNullWhen(true)] out TLeaf? leaf)
     {
         string effectiveId = EffectiveLeafId.CreateFromParts(creatorId, namedId);
-        if (!LeavesByEffectiveIds.TryGetValue(effectiveId, out TLeaf value))
+        if (!_leavesByEffectiveIds.TryGetValue(effectiveId, out TLeaf value))
         {
             leaf = null;
             return false;
@@ -108,7 +107,7 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
 
     public TLeaf GetByEffectiveId(string effectiveId)
     {
-        if (!LeavesByEffectiveIds.TryGetValue(effectiveId, out TLeaf leaf))
+        if (!_leavesByEffectiveIds.TryGetValue(effectiveId, out TLeaf leaf))
         {
             (string CreatorId, string NamedId) parts = EffectiveLeafId.SplitParts(effectiveId);
             return ThrowHelper.ThrowArgumentException<TLeaf>(
@@ -121,7 +120,7 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
 
     public bool TryGetByEffectiveId(string effectiveId, [NotNullWhen(true)] out TLeaf? leaf)
     {
-        if (!LeavesByEffectiveIds.TryGetValue(effectiveId, out TLeaf value))
+        if (!_leavesByEffectiveIds.TryGetValue(effectiveId, out TLeaf value))
         {
             leaf = null;
             return false;
@@ -133,7 +132,14 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
 
     public TLeaf GetByGameId(int gameId)
     {
-        if (!LeavesByGameIds.TryGetValue(gameId, out TLeaf leaf))
+        if ((uint)gameId < (uint)_frozenDenseLeavesByGameIds.Length)
+        {
+            TLeaf? denseLeaf = _frozenDenseLeavesByGameIds[gameId];
+            if (denseLeaf is not null)
+                return denseLeaf;
+        }
+
+        if (!_leavesByGameIds.TryGetValue(gameId, out TLeaf leaf))
         {
             return ThrowHelper.ThrowArgumentException<TLeaf>(
                 nameof(gameId),
@@ -143,7 +149,63 @@ internal abstract class BaseRegistry<TLeaf> : ILeavesRegistry<TLeaf>
         return leaf;
     }
 
-    public IReadOnlyCollection<TLeaf> GetAll() => LeavesByEffectiveIds.Values.ToList().AsReadOnly();
+    public IReadOnlyCollection<TLeaf> GetAll() =>
+        _frozenAllLeaves ?? _leavesByEffectiveIds.Values.ToList().AsReadOnly();
+
+    public void Freeze()
+    {
+        if (IsFrozen)
+            return;
+
+        _frozenLeavesInRegistrationOrder = _leavesByGameIds.Values.ToArray();
+        _frozenAllLeaves = _leavesByEffectiveIds.Values.ToList().AsReadOnly();
+        _leavesByEffectiveIds = new(_leavesByEffectiveIds, StringComparer.Ordinal);
+
+        int maxGameId = -1;
+        int nonNegativeGameIdsCount = 0;
+        foreach (int gameId in _leavesByGameIds.Keys)
+        {
+            if (gameId < 0)
+                continue;
+
+            nonNegativeGameIdsCount++;
+            maxGameId = Math.Max(maxGameId, gameId);
+        }
+
+        // Game ids are mostly contiguous from 0 so the dense array is used unless they are too sparse to be worth it
+        Dictionary<int, TLeaf> sparseLeavesByGameIds = new();
+        if (maxGameId >= 0 && maxGameId < (long)nonNegativeGameIdsCount * MaxDenseSlotsPerLeaf)
+        {
+            _frozenDenseLeavesByGameIds = new TLeaf?[maxGameId + 1];
+            foreach (KeyValuePair<int, TLeaf> leafByGameId in _leavesByGameIds)
+            {
+                if (leafByGameId.Key >= 0)
+                    _frozenDenseLeavesByGameIds[leafByGameId.Key] = leafByGameId.Value;
+                else
+                    sparseLeavesByGameIds.Add(leafByGameId.Key, leafByGameId.Value);
+            }
+        }
+        else
+        {
+            sparseLeavesByGameIds = new(_leavesByGameIds);
+        }
+
+        _leavesByGameIds = sparseLeavesByGameIds;
+        IsFrozen = true;
+        _logger.LogTrace(
+            "Froze the registry with {DenseSlotsCount} dense game id slots and {SparseCount} sparse game ids",
+            _frozenDenseLeavesByGameIds.Length,
+            _leavesByGameIds.Count);
+    }
+
+    private void EnsureNotFrozen()
+    {
+        if (IsFrozen)
+        {
+            ThrowHelper.ThrowInvalidOperationException(
+                $"The {RegistryName} registry is frozen, no leaves can be registered to it after the buds were loaded");
+        }
+    }
 
     private void LogRegisterContent(TLeaf leaf)
     {
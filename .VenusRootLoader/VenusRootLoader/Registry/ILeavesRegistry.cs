@@ -19,6 +19,19 @@ internal interface ILeavesRegistry
     /// <summary>Gets the number of leaves from the base game contained in the registry.</summary>
     /// <returns>The number of leaves from the base game contained in the registry.</returns>
     int CountBaseGame { get; }
+
+    /// <summary>
+    /// Tells if the registry was frozen by <see cref="Freeze"/> which means no leaves can be registered to it anymore.
+    /// </summary>
+    bool IsFrozen { get; }
+
+    /// <summary>
+    /// Freezes the registry once all leaves were registered to it which happens after loading all buds. A frozen
+    /// registry looks up leaves from a contiguous array indexed by their game id and no longer copies its leaves when
+    /// getting all of them. Registering a leaf to a frozen registry throws an <see cref="InvalidOperationException"/>,
+    /// but its leaves can still be modified. Freezing an already frozen registry does nothing.
+    /// </summary>
+    void Freeze();
 }
 
 /// <summary>
@@ -39,6 +52,7 @@ internal interface ILeavesRegistry<TLeaf> : ILeavesRegistry, IEnumerable<TLeaf>
     /// <param name="creatorId">The creator id that identifies who authored the leaf.</param>
     /// <param name="namedId">The named id of the new leaf for buds to identify it.</param>
     /// <returns>The newly registered leaf.</returns>
+    /// <exception cref="InvalidOperationException">Thrown if the registry is frozen.</exception>
     TLeaf RegisterNew(string creatorId, string namedId);
 
     /// <summary>
@@ -48,6 +62,7 @@ internal interface ILeavesRegistry<TLeaf> : ILeavesRegistry, IEnumerable<TLeaf>
     /// <param name="namedId">The named id of the new leaf for buds to identify it.</param>
     /// <typeparam name="TSubLeaf">The leaf subtype</typeparam>
     /// <returns>The newly registered leaf.</returns>
+    /// <exception cref="InvalidOperationException">Thrown if the registry is frozen.</exception>
     TSubLeaf RegisterNew<TSubLeaf>(string creatorId, string namedId) where TSubLeaf : TLeaf;
 
     /// <summary>
@@ -56,6 +71,7 @@ internal interface ILeavesRegistry<TLeaf> : ILeavesRegistry, IEnumerable<TLeaf>
     /// <param name="gameId">The game id of the new leaf for the game to identify it.</param>
     /// <param name="namedId">The named id of the new leaf for buds to identify it.</param>
     /// <returns>The newly registered leaf.</returns>
+    /// <exception cref="InvalidOperationException">Thrown if the registry is frozen.</exception>
     TLeaf RegisterExisting(int gameId, string namedId);
 
     /// <summary>
@@ -65,6 +81,7 @@ internal interface ILeavesRegistry<TLeaf> : ILeavesRegistry, IEnumerable<TLeaf>
     /// <param name="namedId">The named id of the new leaf for buds to identify it.</param>
     /// <typeparam name="TSubLeaf">The leaf subtype</typeparam>
     /// <returns>The newly registered leaf.</returns>
+    /// <exception cref="InvalidOperationException">Thrown if the registry is frozen.</exception>
     TSubLeaf RegisterExisting<TSubLeaf>(int gameId, string namedId) where TSubLeaf : TLeaf;
 
     /// <summary>
@@ -112,7 +129,8 @@ internal interface ILeavesRegistry<TLeaf> : ILeavesRegistry, IEnumerable<TLeaf>
     TLeaf GetByGameId(int gameId);
 
     /// <summary>
-    /// Obtains a read only copy of a collection containing all the leaves in the registry.
+    /// Obtains a read only copy of a collection containing all the leaves in the registry. Once the registry is frozen,
+    /// the same collection is returned every time.
     /// </summary>
     /// <returns>A collection containing all the leaves of the registry.</returns>
     IReadOnlyCollection<TLeaf> GetAll();
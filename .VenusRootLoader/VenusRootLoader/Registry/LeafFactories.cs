@@ -0,0 +1,61 @@
+using System.Reflection;
+using VenusRootLoader.Api.Leaves;
+
+namespace VenusRootLoader.Registry;
+
+/// <summary>
+/// Holds the delegates that creates each <see cref="Leaf"/> type by calling their internal constructor directly. They
+/// are emitted by the VenusLeafRegistryApiSourceGenerator for every concrete leaf type of the loader so registering a
+/// leaf doesn't need to go through reflection.
+/// </summary>
+internal static partial class LeafFactories
+{
+    private static readonly Dictionary<Type, Delegate> FactoriesByLeafTypes = CreateFactoriesByLeafTypes();
+
+    private static Dictionary<Type, Delegate> CreateFactoriesByLeafTypes()
+    {
+        Dictionary<Type, Delegate> factoriesByLeafTypes = new();
+        AddGeneratedFactories(factoriesByLeafTypes);
+        return factoriesByLeafTypes;
+    }
+
+    static partial void AddGeneratedFactories(Dictionary<Type, Delegate> factoriesByLeafTypes);
+
+    /// <summary>
+    /// Gets the delegate that creates a leaf of type <typeparamref name="TLeaf"/>. Leaf types without a generated
+    /// delegate fall back to a delegate that uses reflection.
+    /// </summary>
+    /// <typeparam name="TLeaf">The type of leaf to create.</typeparam>
+    /// <returns>A delegate that creates the leaf from its game id, creator id and named id.</returns>
+    internal static Func<int, string, string, TLeaf> GetFactory<TLeaf>()
+        where TLeaf : Leaf
+    {
+        if (FactoriesByLeafTypes.TryGetValue(typeof(TLeaf), out Delegate factory))
+            return (Func<int, string, string, TLeaf>)factory;
+
+        // We have to use the Activator here because it's not possible to use a generics constraint that does what we
+        // want. The closest is new(), but this requires the constructor to be public which we don't want on any leaves
+        // since the registry should be the only one allowed to create new leaves from buds
+        return (gameId, creatorId, namedId) => (TLeaf)Activator.CreateInstance(
+            typeof(TLeaf),
+            BindingFlags.CreateInstance | BindingFlags.Instance | BindingFlags.NonPublic,
+            null,
+            [
+                gameId,
+                creatorId,
+                namedId
+            ],
+            null,
+            null);
+    }
+}
+
+/// <summary>
+/// Caches the delegate from <see cref="LeafFactories"/> that creates a leaf of type <typeparamref name="TLeaf"/>.
+/// </summary>
+/// <typeparam name="TLeaf">The type of leaf to create.</typeparam>
+internal static class LeafFactory<TLeaf>
+    where TLeaf : Leaf
+{
+    internal static readonly Func<int, string, string, TLeaf> Create = LeafFactories.GetFactory<TLeaf>();
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 using VenusRootLoader.Api.Leaves;
+using VenusRootLoader.LeavesInternals;
 
 namespace VenusRootLoader.Registry;
 
@@ -62,6 +63,7 @@ internal sealed class OrderedLeavesRegistry<TLeaf> : IOrderedLeavesRegistry<TLea
         BaseGameIdsToOrderingIndex.Clear();
         for (int i = 0; i < orderedGameIds.Length; i++)
             BaseGameIdsToOrderingIndex.Add(orderedGameIds[i], i);
+        LeafModifications<TLeaf>.Notify();
     }
 
     public IReadOnlyCollection<TLeaf> GetOrderedLeaves()
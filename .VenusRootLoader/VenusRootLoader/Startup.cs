@@ -8,6 +8,7 @@ using VenusRootLoader.Api.Leaves;
 using VenusRootLoader.BaseGameCollector;
 using VenusRootLoader.BudLoading;
 using VenusRootLoader.Extensions;
+using VenusRootLoader.LeavesInternals;
 using VenusRootLoader.Logging;
 using VenusRootLoader.Patching;
 using VenusRootLoader.Patching.Logic;
@@ -28,7 +29,9 @@ using VenusRootLoader.Persistence;
 using VenusRootLoader.Persistence.BaseGameSave;
 using VenusRootLoader.Persistence.BudsSave;
 using VenusRootLoader.Registry;
+using VenusRootLoader.Tracing;
 using VenusRootLoader.Unity;
+using VenusRootLoader.Unity.CustomAudioClip;
 using VenusRootLoader.Utility;
 using Object = UnityEngine.Object;
 
@@ -50,6 +53,7 @@ internal static class Startup
 
         services.AddSingleton(gameExecutionContext);
         services.AddSingleton(bootstrapFunctions);
+        services.AddSingleton<ITracer, Tracer>();
         services.AddSingleton(
             new BudLoaderContext
             {
@@ -135,6 +139,7 @@ internal static class Startup
             new([ResourcesPaths.AudioMusicDirectory], provider.GetRequiredService<ILeavesRegistry<MusicLeaf>>()));
 
         services.AddSingleton<ITextAssetDumper, TextAssetDumper>();
+        services.AddSingleton<ITextAssetPatchCache, TextAssetPatchCache>();
 
         services.AddTextAssetPatcher<AnimIdLeaf, AnimIdTextAssetParser>([ResourcesPaths.DataAnimIdsPath]);
 
@@ -181,11 +186,13 @@ internal static class Startup
             [ResourcesPaths.DataTermacadePrizesPath]);
 
         services.AddTextAssetPatcher<RecipeLeaf, RecipeTextAssetParser>([ResourcesPaths.DataRecipesPath]);
+        // The library entries are serialized from the items of their recipe
         services.AddTextAssetPatcher<RecipeLibraryEntryLeaf, RecipeLibraryEntryTextAssetParser>(
-        [
-            ResourcesPaths.DataRecipesLibraryEntriesResultItemsPath,
-            ResourcesPaths.DataRecipesLibraryEntriesInputItemsPath
-        ]);
+            [
+                ResourcesPaths.DataRecipesLibraryEntriesResultItemsPath,
+                ResourcesPaths.DataRecipesLibraryEntriesInputItemsPath
+            ],
+            otherLeavesVersion: () => LeafModifications<RecipeLeaf>.Version);
 
         services.AddLocalizedTextAssetPatcher<AreaLeaf, AreaLocalizedTextAssetParser>(
         [
@@ -240,51 +247,28 @@ internal static class Startup
         services.AddSingleton<IResourcesArrayTypePatcher<Sprite>, RootSpritesArrayPatcher>();
         services.AddSingleton<IResourcesArrayTypePatcher<AudioClip>, RootAudioClipsArrayPatcher>();
 
+        services.AddScoped<IBaseGameSnapshotCache, BaseGameSnapshotCache>();
+        services.AddScoped<IBaseGameResources, BaseGameResources>();
         services.AddScoped<IAssemblyCSharpDataCollector, AssemblyCSharpDataCollector>();
-        services.AddScoped<IBaseGameCollector, LanguagesCollector>();
-        services.AddScoped<IBaseGameCollector, EventCollector>();
-        services.AddScoped<IBaseGameCollector, DialogueBleepCollector>();
-        services.AddScoped<IBaseGameCollector, AnimIdsCollector>();
-        services.AddScoped<IBaseGameCollector, ItemsCollector>();
-        services.AddScoped<IBaseGameCollector, BattleEventDialoguesCollector>();
-        services.AddScoped<IBaseGameCollector, EnemiesCollector>();
-        services.AddScoped<IBaseGameCollector, RecipesCollector>();
-        services.AddScoped<IBaseGameCollector, RecipeLibraryEntriesCollector>();
-        services.AddScoped<IBaseGameCollector, AreasCollector>();
-        services.AddScoped<IBaseGameCollector, MedalsCollector>();
-        services.AddScoped<IBaseGameCollector, GlobalFlagsCollector>();
-        services.AddScoped<IBaseGameCollector, PrizeMedalsCollector>();
-        services.AddScoped<IBaseGameCollector, CrystalBerriesCollector>();
-        services.AddScoped<IBaseGameCollector, CommonDialoguesCollector>();
-        services.AddScoped<IBaseGameCollector, MedalFortuneTellerHintCollector>();
-        services.AddScoped<IBaseGameCollector, MenuTextsCollector>();
-        services.AddScoped<IBaseGameCollector, DiscoveriesCollector>();
-        services.AddScoped<IBaseGameCollector, RecordsCollector>();
-        services.AddScoped<IBaseGameCollector, TermacadePrizesCollector>();
-        services.AddScoped<IBaseGameCollector, MusicsCollector>();
-        services.AddScoped<IBaseGameCollector, QuestsCollector>();
-        services.AddScoped<IBaseGameCollector, RankBonusesCollector>();
-        services.AddScoped<IBaseGameCollector, LoreBooksCollector>();
-        services.AddScoped<IBaseGameCollector, ActionCommandHelpTextsCollector>();
-        services.AddScoped<IBaseGameCollector, SkillsCollector>();
-        services.AddScoped<IBaseGameCollector, FishingTextsCollector>();
-        services.AddScoped<IBaseGameCollector, SpyCardsTextsCollector>();
-        services.AddScoped<IBaseGameCollector, SpyCardsCollector>();
-        services.AddScoped<IBaseGameCollector, MedalShopsCollector>();
-        services.AddScoped<IBaseGameCollector, CuttableGrassCollector>();
-        services.AddScoped<IBaseGameCollector, MapsCollector>();
-        services.AddScoped<RootCollector>();
+        services.AddBaseGameCollectors();
 
         services.AddSingleton<IGameDataRuntimeState, GameDataRuntimeState>();
         services.AddSingleton<IBaseGameSaveDataSerializer, BaseGameSaveDataSerializer>();
         services.AddSingleton<IBaseGameSaveDataDeserializer, BaseGameSaveDataDeserializer>();
         services.AddSingleton<IBudsSaveDataSerializer, BudsSaveDataSerializer>();
         services.AddSingleton<IBudsSaveDataDeserializer, BudsSaveDataDeserializer>();
+        services.AddSingleton<IFileHardLinker, FileHardLinker>();
         services.AddSingleton<ISaveDataPersistence, SaveDataPersistence>();
 
         services.AddSingleton<IGlobalMonoBehaviourExecution, GlobalMonoBehaviourExecution>();
+        services.AddSingleton<IDecodedAudioCache, DecodedAudioCache>();
+        services.AddSingleton<AudioDecodingWorkerPool>(provider =>
+            new(
+                provider.GetRequiredService<ILogger<AudioDecodingWorkerPool>>(),
+                AudioDecodingWorkerPool.DefaultWorkersAmount));
         services.AddSingleton<IBudConfigManager, BudConfigManager>();
         services.AddSingleton<IVenusFactory, VenusFactory>();
+        services.AddSingleton<IBudsDiscoveryCache, BudsDiscoveryCache>();
         services.AddSingleton<IBudsDiscoverer, BudsDiscoverer>();
         services.AddSingleton<IBudsValidator, BudsValidator>();
         services.AddSingleton<IBudsDependencySorter, BudsDependencySorter>();
@@ -320,12 +304,17 @@ internal static class Startup
         services.AddSingleton<ITopLevelPatcher, MapEntitiesArraysLengthZeroTopLevelPatcher>();
 
         services.AddSingleton<ITopLevelPatcher, BudLoaderTopLevelPatcher>();
+        services.AddSingleton<ITopLevelPatcher, RegistriesFreezeTopLevelPatcher>();
 
         services.AddSingleton<ITopLevelPatcher, LoreBooksAmountTopLevelPatcher>();
         services.AddSingleton<RootPatcher>();
 
         ServiceProvider serviceProvider = services.BuildServiceProvider();
         RegistryResolver.Init(serviceProvider);
+        CustomAudioClipProvider.Init(
+            serviceProvider.GetRequiredService<IDecodedAudioCache>(),
+            serviceProvider.GetRequiredService<AudioDecodingWorkerPool>(),
+            serviceProvider.GetRequiredService<ILogger<StreamedNAudio>>());
 
         return serviceProvider;
     }
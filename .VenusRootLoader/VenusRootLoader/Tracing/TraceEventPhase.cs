@@ -0,0 +1,10 @@
+namespace VenusRootLoader.Tracing;
+
+/// <summary>
+/// The kind of a trace event. This is copied from the bootstrap and the values must match.
+/// </summary>
+internal enum TraceEventPhase
+{
+    Begin = 0,
+    End = 1
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+namespace VenusRootLoader.Tracing;
+
+/// <summary>
+/// A span of time recorded by the bootstrap that ends when disposed. The end event carries how much the managed heap
+/// grew and the amount of garbage collections that happened during the span. A default instance does nothing which is
+/// what is returned when tracing is disabled.
+/// </summary>
+internal readonly struct TraceSpan : IDisposable
+{
+    private readonly BootstrapFunctions.BootstrapTraceFn? _bootstrapTrace;
+    private readonly string _name;
+    private readonly string _category;
+    private readonly long _totalMemoryAtBegin;
+    private readonly int _gcCountAtBegin;
+
+    internal TraceSpan(BootstrapFunctions.BootstrapTraceFn bootstrapTrace, string name, string category)
+    {
+        _bootstrapTrace = bootstrapTrace;
+        _name = name;
+        _category = category;
+        _totalMemoryAtBegin = GC.GetTotalMemory(false);
+        _gcCountAtBegin = GC.CollectionCount(0);
+        bootstrapTrace(TraceEventPhase.Begin, name, category, 0, 0);
+    }
+
+    public void Dispose()
+    {
+        // Mono doesn't offer a count of the bytes allocated per thread so the growth of the whole heap is the closest
+        // approximation. It can be negative if a collection happened during the span which the GC count tells
+        _bootstrapTrace?.Invoke(
+            TraceEventPhase.End,
+            _name,
+            _category,
+            GC.GetTotalMemory(false) - _totalMemoryAtBegin,
+            GC.CollectionCount(0) - _gcCountAtBegin);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+namespace VenusRootLoader.Tracing;
+
+/// <summary>
+/// A service that records spans to the bootstrap's trace which is written in the Chrome trace event format. This allows
+/// to see how long each phase of the boot takes as well as some operations done in game.
+/// </summary>
+internal interface ITracer
+{
+    /// <summary>
+    /// Tells if tracing is enabled. When it isn't, spans do nothing.
+    /// </summary>
+    bool IsEnabled { get; }
+
+    /// <summary>
+    /// Records the beginning of a span on the current thread.
+    /// </summary>
+    /// <param name="name">The name of the span.</param>
+    /// <param name="category">The category of the span which allows to filter them in a trace viewer.</param>
+    /// <returns>The span which records its end when disposed.</returns>
+    TraceSpan BeginSpan(string name, string category);
+}
+
+/// <inheritdoc/>
+internal sealed class Tracer : ITracer
+{
+    private readonly BootstrapFunctions.BootstrapTraceFn? _bootstrapTrace;
+
+    public Tracer(BootstrapFunctions bootstrapFunctions) => _bootstrapTrace = bootstrapFunctions.BootstrapTrace;
+
+    public bool IsEnabled => _bootstrapTrace is not null;
+
+    public TraceSpan BeginSpan(string name, string category) =>
+        _bootstrapTrace is null ? default : new TraceSpan(_bootstrapTrace, name, category);
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+using UnityEngine;
+using VenusRootLoader.Api.Unity;
+using VenusRootLoader.Unity.CustomAudioClip;
+
+namespace VenusRootLoader.Unity.AssetLoading;
+
+internal sealed class AudioClipLoaderFromDecodedAudio : IAssetLoader<AudioClip>
+{
+    private readonly string _filePath;
+    private readonly DecodedAudio _decodedAudio;
+
+    internal AudioClipLoaderFromDecodedAudio(string filePath, DecodedAudio decodedAudio)
+    {
+        _filePath = filePath;
+        _decodedAudio = decodedAudio;
+    }
+
+    public AudioClip LoadAsset() => NAudioAudioClipLoader.CreateFromDecodedAudio(_filePath, _decodedAudio);
+}
\ No newline at end of file
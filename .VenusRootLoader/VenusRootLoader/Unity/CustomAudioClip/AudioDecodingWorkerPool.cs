@@ -0,0 +1,112 @@
+using Microsoft.Extensions.Logging;
+using System.Collections.Concurrent;
+
+namespace VenusRootLoader.Unity.CustomAudioClip;
+
+/// <summary>
+/// A small pool of dedicated background threads that decodes audio ahead of where streamed clips are being played.
+/// Decoding is kept off Unity's audio thread and off the shared thread pool so a slow decode can't cause an audible
+/// dropout or be delayed by unrelated work.
+/// </summary>
+internal sealed class AudioDecodingWorkerPool : IDisposable
+{
+    private static readonly TimeSpan WorkersJoinTimeout = TimeSpan.FromSeconds(1);
+
+    private readonly ILogger<AudioDecodingWorkerPool> _logger;
+    private readonly ConcurrentQueue<Action> _workItems = new();
+    private readonly SemaphoreSlim _workItemsAvailable = new(0);
+    private readonly CancellationTokenSource _disposalCancellationTokenSource = new();
+    private readonly List<Thread> _workers = [];
+
+    /// <summary>
+    /// The amount of workers used by the pool of the loader which is half the processors with at least 1 and at most 4.
+    /// </summary>
+    internal static int DefaultWorkersAmount => Math.Max(1, Math.Min(Environment.ProcessorCount / 2, 4));
+
+    /// <summary>
+    /// Creates a pool and starts its workers.
+    /// </summary>
+    /// <param name="logger">The logger used to report the exceptions thrown by the scheduled work.</param>
+    /// <param name="workersAmount">The amount of threads that runs the scheduled work. If this is 0, the scheduled
+    /// work will never run which is only useful for testing.</param>
+    internal AudioDecodingWorkerPool(ILogger<AudioDecodingWorkerPool> logger, int workersAmount)
+    {
+        _logger = logger;
+        for (int i = 0; i < workersAmount; i++)
+        {
+            Thread worker = new(RunWorker)
+            {
+                Name = $"{nameof(VenusRootLoader)} audio decoder {i}",
+                IsBackground = true,
+                Priority = ThreadPriority.AboveNormal
+            };
+            _workers.Add(worker);
+            worker.Start();
+        }
+    }
+
+    /// <summary>
+    /// Schedules work to be done by the next available worker. Exceptions thrown by the work are logged and otherwise
+    /// ignored so it must handle its own failures. Work scheduled after the pool is disposed never runs.
+    /// </summary>
+    /// <param name="workItem">The work to do.</param>
+    internal void Schedule(Action workItem)
+    {
+        if (_disposalCancellationTokenSource.IsCancellationRequested)
+            return;
+
+        _workItems.Enqueue(workItem);
+        _workItemsAvailable.Release();
+    }
+
+    /// <summary>
+    /// Stops the workers once they are done with the work they are currently doing. The work that is still scheduled
+    /// is dropped.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_disposalCancellationTokenSource.IsCancellationRequested)
+            return;
+
+        _disposalCancellationTokenSource.Cancel();
+
+        // The workers are background threads so one stuck in a long decode won't keep the process alive
+        bool haveAllWorkersStopped = true;
+        foreach (Thread worker in _workers)
+            haveAllWorkersStopped &= worker.Join(WorkersJoinTimeout);
+
+        // A worker still running could still use the token. The semaphore isn't disposed since it holds no wait handle
+        // and a clip being read while the pool is disposed could still release it
+        if (haveAllWorkersStopped)
+            _disposalCancellationTokenSource.Dispose();
+    }
+
+    private void RunWorker()
+    {
+        CancellationToken cancellationToken = _disposalCancellationTokenSource.Token;
+        while (true)
+        {
+            try
+            {
+                _workItemsAvailable.Wait(cancellationToken);
+            }
+            catch (OperationCanceledException)
+            {
+                return;
+            }
+
+            if (!_workItems.TryDequeue(out Action? workItem))
+                continue;
+
+            try
+            {
+                workItem();
+            }
+            catch (Exception e)
+            {
+                // A failing work item must never take down a worker since every streamed clip relies on them
+                _logger.LogError(e, "An audio decoding work item failed");
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 using CommunityToolkit.Diagnostics;
+using Microsoft.Extensions.Logging;
 using System.Diagnostics.CodeAnalysis;
 using UnityEngine;
+using VenusRootLoader.Api.Unity;
+using VenusRootLoader.Unity.AssetLoading;
 
 namespace VenusRootLoader.Unity.CustomAudioClip;
 
@@ -15,6 +18,20 @@ namespace VenusRootLoader.Unity.CustomAudioClip;
 [SuppressMessage("System.IO.Abstractions", "IO0006:Replace Path class with IFileSystem.Path for improved testability")]
 internal static class CustomAudioClipProvider
 {
+    private static IDecodedAudioCache? _decodedAudioCache;
+    private static AudioDecodingWorkerPool? _audioDecodingWorkerPool;
+    private static ILogger<StreamedNAudio>? _streamedNAudioLogger;
+
+    internal static void Init(
+        IDecodedAudioCache decodedAudioCache,
+        AudioDecodingWorkerPool audioDecodingWorkerPool,
+        ILogger<StreamedNAudio> streamedNAudioLogger)
+    {
+        _decodedAudioCache = decodedAudioCache;
+        _audioDecodingWorkerPool = audioDecodingWorkerPool;
+        _streamedNAudioLogger = streamedNAudioLogger;
+    }
+
     /// <summary>
     /// Obtains an <see cref="AudioClip"/> from an external audio file.
     /// </summary>
@@ -39,7 +56,12 @@ internal static class CustomAudioClipProvider
         {
             case AudioFileFormat.Mp3:
             case AudioFileFormat.Flac:
-                return NAudioAudioClipLoader.LoadFromFile(filePath, audioFileFormat, isStreamed);
+                return NAudioAudioClipLoader.LoadFromFile(
+                    filePath,
+                    audioFileFormat,
+                    isStreamed,
+                    _audioDecodingWorkerPool!,
+                    _streamedNAudioLogger!);
             case AudioFileFormat.Wav:
             case AudioFileFormat.Ogg:
             case AudioFileFormat.Aiff:
@@ -56,6 +78,47 @@ internal static class CustomAudioClipProvider
         }
     }
 
+    /// <summary>
+    /// Fully decodes an external audio file in the background and obtains an <see cref="IAssetLoader{TObject}"/> that
+    /// creates an <see cref="AudioClip"/> from the decoded samples without further decoding. The loader must still be
+    /// used from the main thread.
+    /// </summary>
+    /// <param name="filePath">The full path of the audio file.</param>
+    /// <param name="audioFileFormat">The format to use for loading the audio file.</param>
+    /// <param name="useDecodedAudioCache">Tells if the decoded samples should be retrieved from or saved to the
+    /// decoded audio cache on disk so the file doesn't need to be decoded again on the next boot.</param>
+    /// <returns>A task that completes with the asset loader once the file is decoded.</returns>
+    /// <remarks>Only the formats decoded by NAudio (<see cref="AudioFileFormat.Mp3"/> and
+    /// <see cref="AudioFileFormat.Flac"/>) are decoded in the background. The other formats are decoded by Unity which
+    /// can only happen on the main thread so the task completes immediately and the file is decoded when the asset is
+    /// loaded.</remarks>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown if <paramref name="audioFileFormat"/> is
+    /// <see cref="AudioFileFormat.AutoDetect"/> and the file format couldn't be determined from the
+    /// <paramref name="filePath"/>'s extension.</exception>
+    internal static Task<IAssetLoader<AudioClip>> GetAudioClipLoaderFromFileAsync(
+        string filePath,
+        AudioFileFormat audioFileFormat,
+        bool useDecodedAudioCache)
+    {
+        if (!File.Exists(filePath))
+            throw new FileNotFoundException(filePath);
+
+        if (audioFileFormat == AudioFileFormat.AutoDetect)
+            audioFileFormat = DetermineFormatFromFileExtension(filePath);
+
+        if (audioFileFormat is not (AudioFileFormat.Mp3 or AudioFileFormat.Flac))
+        {
+            return Task.FromResult<IAssetLoader<AudioClip>>(
+                new AudioClipLoaderFromFile(filePath, false, audioFileFormat));
+        }
+
+        // This doesn't use the AudioDecodingWorkerPool since a long decode there would delay the streamed clips
+        IDecodedAudioCache? decodedAudioCache = useDecodedAudioCache ? _decodedAudioCache : null;
+        return Task.Run<IAssetLoader<AudioClip>>(() => new AudioClipLoaderFromDecodedAudio(
+            filePath,
+            NAudioDecoder.DecodeFile(filePath, audioFileFormat, decodedAudioCache)));
+    }
+
     private static AudioFileFormat DetermineFormatFromFileExtension(string filePath) =>
         Path.GetExtension(filePath).ToLowerInvariant() switch
         {
@@ -0,0 +1,21 @@
+namespace VenusRootLoader.Unity.CustomAudioClip;
+
+/// <summary>
+/// The fully decoded samples of an audio file.
+/// </summary>
+internal sealed class DecodedAudio
+{
+    /// <summary>
+    /// The interleaved samples of every channel.
+    /// </summary>
+    internal required float[] Samples { get; init; }
+
+    internal required int Channels { get; init; }
+
+    internal required int SampleRate { get; init; }
+
+    /// <summary>
+    /// The amount of samples per channel.
+    /// </summary>
+    internal int SampleFrames => Samples.Length / Channels;
+}
\ No newline at end of file
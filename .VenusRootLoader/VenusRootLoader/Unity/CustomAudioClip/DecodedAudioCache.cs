@@ -0,0 +1,184 @@
+using Microsoft.Extensions.Logging;
+using System.Diagnostics.CodeAnalysis;
+using System.IO.Abstractions;
+using System.Security.Cryptography;
+using VenusRootLoader.Api;
+
+namespace VenusRootLoader.Unity.CustomAudioClip;
+
+/// <summary>
+/// A persistent cache of the samples of decoded audio files so large files only need to be decoded the first time
+/// they are loaded. Each entry is identified by the hash of the content of the audio file it was decoded from which
+/// means a file that changes gets a new entry. This is thread safe.
+/// </summary>
+internal interface IDecodedAudioCache
+{
+    /// <summary>
+    /// Computes the hash that identifies the content of an audio file in the cache.
+    /// </summary>
+    /// <param name="audioFilePath">The full path of the audio file.</param>
+    /// <returns>The hash of the file's content.</returns>
+    string ComputeFileHash(string audioFilePath);
+
+    /// <summary>
+    /// Attempts to load the decoded samples of an audio file from the cache.
+    /// </summary>
+    /// <param name="fileHash">The hash of the audio file from <see cref="ComputeFileHash"/>.</param>
+    /// <param name="decodedAudio">When this method returns, the decoded samples if they were in the cache;
+    /// otherwise, null.</param>
+    /// <returns>True if the decoded samples were in the cache and could be read, false otherwise.</returns>
+    bool TryLoad(string fileHash, [NotNullWhen(true)] out DecodedAudio? decodedAudio);
+
+    /// <summary>
+    /// Saves the decoded samples of an audio file to the cache. Failing to save is not fatal since the file will
+    /// simply be decoded again the next time it's loaded.
+    /// </summary>
+    /// <param name="fileHash">The hash of the audio file from <see cref="ComputeFileHash"/>.</param>
+    /// <param name="decodedAudio">The decoded samples.</param>
+    void Save(string fileHash, DecodedAudio decodedAudio);
+}
+
+/// <inheritdoc/>
+internal sealed class DecodedAudioCache : IDecodedAudioCache
+{
+    internal const string CacheDirectoryName = "DecodedAudioCache";
+
+    // This must be incremented whenever the layout of the cache files or how the samples are decoded changes
+    private const int CacheFormatVersion = 1;
+
+    private const int HeaderSize = sizeof(int) * 4;
+    private const int CopyBufferSize = 1 << 16;
+
+    private readonly string _cacheDirectoryPath;
+    private readonly IFileSystem _fileSystem;
+    private readonly ILogger<DecodedAudioCache> _logger;
+
+    public DecodedAudioCache(
+        IFileSystem fileSystem,
+        ILogger<DecodedAudioCache> logger,
+        BudLoaderContext budLoaderContext)
+    {
+        _fileSystem = fileSystem;
+        _logger = logger;
+        _cacheDirectoryPath = _fileSystem.Path.Combine(budLoaderContext.LoaderPath, CacheDirectoryName);
+    }
+
+    public string ComputeFileHash(string audioFilePath)
+    {
+        using SHA256 sha256 = SHA256.Create();
+        using Stream fileStream = _fileSystem.File.OpenRead(audioFilePath);
+        byte[] hash = sha256.ComputeHash(fileStream);
+        return BitConverter.ToString(hash).Replace("-", "");
+    }
+
+    public bool TryLoad(string fileHash, [NotNullWhen(true)] out DecodedAudio? decodedAudio)
+    {
+        decodedAudio = null;
+        string cacheFilePath = GetCacheFilePath(fileHash);
+        if (!_fileSystem.File.Exists(cacheFilePath))
+            return false;
+
+        try
+        {
+            using Stream stream = _fileSystem.File.OpenRead(cacheFilePath);
+            using BinaryReader reader = new(stream);
+            int formatVersion = reader.ReadInt32();
+            int channels = reader.ReadInt32();
+            int sampleRate = reader.ReadInt32();
+            int samplesCount = reader.ReadInt32();
+            if (formatVersion != CacheFormatVersion || channels <= 0 || samplesCount < 0 ||
+                stream.Length != HeaderSize + (long)samplesCount * sizeof(float))
+            {
+                _logger.LogInformation(
+                    "The decoded audio cache file {path} is invalid and will be regenerated",
+                    cacheFilePath);
+                return false;
+            }
+
+            float[] samples = new float[samplesCount];
+            byte[] copyBuffer = new byte[CopyBufferSize];
+            int bytesCount = samplesCount * sizeof(float);
+            int totalBytesRead = 0;
+            while (totalBytesRead < bytesCount)
+            {
+                int bytesRead = stream.Read(copyBuffer, 0, Math.Min(copyBuffer.Length, bytesCount - totalBytesRead));
+                if (bytesRead == 0)
+                    throw new EndOfStreamException();
+
+                Buffer.BlockCopy(copyBuffer, 0, samples, totalBytesRead, bytesRead);
+                totalBytesRead += bytesRead;
+            }
+
+            decodedAudio = new()
+            {
+                Samples = samples,
+                Channels = channels,
+                SampleRate = sampleRate
+            };
+            return true;
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(
+                e,
+                "Unable to read the decoded audio cache file {path}, it will be regenerated",
+                cacheFilePath);
+            return false;
+        }
+    }
+
+    public void Save(string fileHash, DecodedAudio decodedAudio)
+    {
+        string cacheFilePath = GetCacheFilePath(fileHash);
+
+        // We write to a temporary file first so a crash while saving can't leave a truncated file behind. The name is
+        // unique since the same file could be decoded by more than one thread at the same time
+        string temporaryCacheFilePath = $"{cacheFilePath}.{Guid.NewGuid():N}.tmp";
+        try
+        {
+            _fileSystem.Directory.CreateDirectory(_cacheDirectoryPath);
+            using (Stream stream = _fileSystem.File.Create(temporaryCacheFilePath))
+            using (BinaryWriter writer = new(stream))
+            {
+                writer.Write(CacheFormatVersion);
+                writer.Write(decodedAudio.Channels);
+                writer.Write(decodedAudio.SampleRate);
+                writer.Write(decodedAudio.Samples.Length);
+
+                byte[] copyBuffer = new byte[CopyBufferSize];
+                int bytesCount = decodedAudio.Samples.Length * sizeof(float);
+                for (int offset = 0; offset < bytesCount; offset += copyBuffer.Length)
+                {
+                    int bytesToCopy = Math.Min(copyBuffer.Length, bytesCount - offset);
+                    Buffer.BlockCopy(decodedAudio.Samples, offset, copyBuffer, 0, bytesToCopy);
+                    writer.Write(copyBuffer, 0, bytesToCopy);
+                }
+            }
+
+            if (_fileSystem.File.Exists(cacheFilePath))
+                _fileSystem.File.Delete(cacheFilePath);
+            _fileSystem.File.Move(temporaryCacheFilePath, cacheFilePath);
+        }
+        catch (Exception e)
+        {
+            _logger.LogWarning(e, "Unable to save the decoded audio cache file {path}", cacheFilePath);
+            DeleteTemporaryCacheFile(temporaryCacheFilePath);
+        }
+    }
+
+    private void DeleteTemporaryCacheFile(string temporaryCacheFilePath)
+    {
+        try
+        {
+            if (_fileSystem.File.Exists(temporaryCacheFilePath))
+                _fileSystem.File.Delete(temporaryCacheFilePath);
+        }
+        catch (Exception)
+        {
+            // The file being left behind only wastes disk space
+        }
+    }
+
+    private string GetCacheFilePath(string fileHash) =>
+        _fileSystem.Path.Combine(_cacheDirectoryPath, $"{fileHash}.pcm");
+}
\ No newline at end of file
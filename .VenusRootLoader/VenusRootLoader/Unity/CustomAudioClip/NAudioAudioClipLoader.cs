@@ -1,5 +1,4 @@
-using CommunityToolkit.Diagnostics;
-using NAudio.Flac;
+using Microsoft.Extensions.Logging;
 using NAudio.Wave;
 using System.Diagnostics.CodeAnalysis;
 using UnityEngine;
@@ -9,63 +8,49 @@ namespace VenusRootLoader.Unity.CustomAudioClip;
 [SuppressMessage("System.IO.Abstractions", "IO0006:Replace Path class with IFileSystem.Path for improved testability")]
 internal static class NAudioAudioClipLoader
 {
-    internal static AudioClip LoadFromFile(string filePath, AudioFileFormat format, bool isStreamed)
+    internal static AudioClip LoadFromFile(
+        string filePath,
+        AudioFileFormat format,
+        bool isStreamed,
+        AudioDecodingWorkerPool workerPool,
+        ILogger<StreamedNAudio> streamedNAudioLogger)
     {
-        WaveStream waveStream = GetWaveStreamFromFile(filePath, format);
+        if (!isStreamed)
+            return CreateFromDecodedAudio(filePath, NAudioDecoder.DecodeFile(filePath, format, null));
+
+        WaveStream waveStream = NAudioDecoder.OpenWaveStream(filePath, format);
         ISampleProvider sampleProvider = waveStream.ToSampleProvider();
         int sampleFrames = (int)(waveStream.Length / waveStream.BlockAlign);
 
-        if (isStreamed)
-        {
-            StreamedNAudio streamedNAudio = new(sampleProvider, waveStream);
-            return AudioClip.Create(
-                Path.GetFileNameWithoutExtension(filePath),
-                sampleFrames,
-                sampleProvider.WaveFormat.Channels,
-                sampleProvider.WaveFormat.SampleRate,
-                true,
-                streamedNAudio.OnRead,
-                streamedNAudio.OnSeek);
-        }
-
-        int lengthSamples = sampleFrames * waveStream.WaveFormat.Channels;
-        float[] samples = ReadAllSamplesFromSampleProvider(sampleProvider, lengthSamples);
-
-        AudioClip clip = AudioClip.Create(
+        // The buffer is filled before the clip is created so the first read from the audio thread doesn't play silence
+        StreamedNAudio streamedNAudio = new(streamedNAudioLogger, sampleProvider, waveStream, workerPool);
+        streamedNAudio.DecodeAhead();
+        return AudioClip.Create(
             Path.GetFileNameWithoutExtension(filePath),
             sampleFrames,
             sampleProvider.WaveFormat.Channels,
             sampleProvider.WaveFormat.SampleRate,
-            false);
-        clip.SetData(samples, 0);
-        return clip;
-    }
-
-    private static float[] ReadAllSamplesFromSampleProvider(ISampleProvider sampleProvider, int lengthSamples)
-    {
-        float[] samples = new float[lengthSamples];
-        int offset = 0;
-        int totalRead = 0;
-        int read = 0;
-        while (totalRead <= lengthSamples)
-        {
-            read += sampleProvider.Read(samples, offset, lengthSamples);
-            offset += read;
-            totalRead += read;
-        }
-
-        return samples;
+            true,
+            streamedNAudio.OnRead,
+            streamedNAudio.OnSeek);
     }
 
-    private static WaveStream GetWaveStreamFromFile(string filePath, AudioFileFormat audioFileFormat)
+    /// <summary>
+    /// Creates a non streamed <see cref="AudioClip"/> from samples that were already decoded. This must be called from
+    /// the main thread.
+    /// </summary>
+    /// <param name="filePath">The full path of the audio file the samples were decoded from.</param>
+    /// <param name="decodedAudio">The decoded samples.</param>
+    /// <returns>The newly created <see cref="AudioClip"/>.</returns>
+    internal static AudioClip CreateFromDecodedAudio(string filePath, DecodedAudio decodedAudio)
     {
-        return audioFileFormat switch
-        {
-            AudioFileFormat.Mp3 => new Mp3FileReaderBase(filePath, f => new AcmMp3FrameDecompressor(f)),
-            AudioFileFormat.Flac => new FlacReader(filePath),
-            _ => ThrowHelper.ThrowArgumentOutOfRangeException<WaveStream>(
-                nameof(audioFileFormat),
-                $"Invalid or unsupported audio file format by NAudio: {audioFileFormat}")
-        };
+        AudioClip clip = AudioClip.Create(
+            Path.GetFileNameWithoutExtension(filePath),
+            decodedAudio.SampleFrames,
+            decodedAudio.Channels,
+            decodedAudio.SampleRate,
+            false);
+        clip.SetData(decodedAudio.Samples, 0);
+        return clip;
     }
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+using CommunityToolkit.Diagnostics;
+using NAudio.Flac;
+using NAudio.Wave;
+
+namespace VenusRootLoader.Unity.CustomAudioClip;
+
+/// <summary>
+/// Decodes audio files using NAudio. This doesn't depend on Unity so it can be used from any thread.
+/// </summary>
+internal static class NAudioDecoder
+{
+    private const int DecodeChunkLength = 1 << 16;
+
+    // The largest float array allowed by the runtime without gcAllowVeryLargeObjects
+    private const int MaxSamples = 0x7FFFFFC7 / sizeof(float);
+
+    /// <summary>
+    /// Opens an audio file as a <see cref="WaveStream"/>.
+    /// </summary>
+    /// <param name="filePath">The full path of the audio file.</param>
+    /// <param name="audioFileFormat">The format of the audio file.</param>
+    /// <returns>The opened <see cref="WaveStream"/>.</returns>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown if NAudio can't decode the
+    /// <paramref name="audioFileFormat"/>.</exception>
+    internal static WaveStream OpenWaveStream(string filePath, AudioFileFormat audioFileFormat)
+    {
+        return audioFileFormat switch
+        {
+            AudioFileFormat.Mp3 => new Mp3FileReaderBase(filePath, f => new AcmMp3FrameDecompressor(f)),
+            AudioFileFormat.Flac => new FlacReader(filePath),
+            AudioFileFormat.Wav => new WaveFileReader(filePath),
+            _ => ThrowHelper.ThrowArgumentOutOfRangeException<WaveStream>(
+                nameof(audioFileFormat),
+                $"Invalid or unsupported audio file format by NAudio: {audioFileFormat}")
+        };
+    }
+
+    /// <summary>
+    /// Decodes every sample from the current position of a <see cref="WaveStream"/> to its end.
+    /// </summary>
+    /// <param name="waveStream">The stream to decode.</param>
+    /// <returns>The decoded samples.</returns>
+    internal static DecodedAudio DecodeAllSamples(WaveStream waveStream)
+    {
+        ISampleProvider sampleProvider = waveStream.ToSampleProvider();
+        int channels = sampleProvider.WaveFormat.Channels;
+
+        // The length of compressed streams is only an estimate so the samples buffer grows if it turns out too short
+        long estimatedSamples = (waveStream.Length - waveStream.Position) / waveStream.BlockAlign * channels;
+        float[] samples = new float[Math.Min(estimatedSamples, MaxSamples - MaxSamples % channels)];
+        float[] overflowChunk = new float[channels * 1024];
+        int totalRead = 0;
+        while (true)
+        {
+            int countToRead = Math.Min(samples.Length - totalRead, DecodeChunkLength);
+            countToRead -= countToRead % channels;
+            if (countToRead == 0)
+            {
+                // The buffer is only grown once it's known there are more samples
+                int overflowRead = sampleProvider.Read(overflowChunk, 0, overflowChunk.Length);
+                if (overflowRead == 0)
+                    break;
+
+                Array.Resize(ref samples, (int)Math.Min(Math.Max((long)samples.Length * 2, 1024), MaxSamples));
+                if (samples.Length - totalRead < overflowRead)
+                    ThrowHelper.ThrowInvalidDataException("The audio stream has too many samples to be decoded fully");
+
+                Array.Copy(overflowChunk, 0, samples, totalRead, overflowRead);
+                totalRead += overflowRead;
+                continue;
+            }
+
+            int read = sampleProvider.Read(samples, totalRead, countToRead);
+            if (read == 0)
+                break;
+
+            totalRead += read;
+        }
+
+        if (totalRead != samples.Length)
+            Array.Resize(ref samples, totalRead - totalRead % channels);
+
+        return new()
+        {
+            Samples = samples,
+            Channels = channels,
+            SampleRate = sampleProvider.WaveFormat.SampleRate
+        };
+    }
+
+    /// <summary>
+    /// Decodes every sample of an audio file using a cache of the decoded samples if one is given.
+    /// </summary>
+    /// <param name="filePath">The full path of the audio file.</param>
+    /// <param name="audioFileFormat">The format of the audio file.</param>
+    /// <param name="decodedAudioCache">The cache to retrieve the samples from or to add them to after decoding.
+    /// If this is null, the file is always decoded.</param>
+    /// <returns>The decoded samples.</returns>
+    internal static DecodedAudio DecodeFile(
+        string filePath,
+        AudioFileFormat audioFileFormat,
+        IDecodedAudioCache? decodedAudioCache)
+    {
+        string? fileHash = decodedAudioCache?.ComputeFileHash(filePath);
+        if (fileHash is not null && decodedAudioCache!.TryLoad(fileHash, out DecodedAudio? cachedDecodedAudio))
+            return cachedDecodedAudio;
+
+        DecodedAudio decodedAudio;
+        using (WaveStream waveStream = OpenWaveStream(filePath, audioFileFormat))
+            decodedAudio = DecodeAllSamples(waveStream);
+
+        if (fileHash is not null)
+            decodedAudioCache!.Save(fileHash, decodedAudio);
+        return decodedAudio;
+    }
+}
\ No newline at end of file
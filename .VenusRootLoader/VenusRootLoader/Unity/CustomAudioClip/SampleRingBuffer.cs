@@ -0,0 +1,96 @@
+using CommunityToolkit.Diagnostics;
+
+namespace VenusRootLoader.Unity.CustomAudioClip;
+
+/// <summary>
+/// A fixed size ring buffer of audio samples that is lock free as long as there's only a single thread writing to it
+/// and a single thread reading from it at the same time.
+/// </summary>
+internal sealed class SampleRingBuffer
+{
+    private readonly float[] _buffer;
+    private readonly int _mask;
+
+    // These only ever increase and are allowed to overflow: the difference between them is always the amount of
+    // buffered samples since the capacity is much lower than the range of an int
+    private int _readPosition;
+    private int _writePosition;
+
+    /// <summary>
+    /// Creates a ring buffer.
+    /// </summary>
+    /// <param name="capacity">The maximum amount of samples the buffer can hold. It must be a power of 2.</param>
+    internal SampleRingBuffer(int capacity)
+    {
+        if (capacity <= 0 || capacity > 1 << 30 || (capacity & (capacity - 1)) != 0)
+            ThrowHelper.ThrowArgumentOutOfRangeException(nameof(capacity), "The capacity must be a power of 2");
+
+        _buffer = new float[capacity];
+        _mask = capacity - 1;
+    }
+
+    internal int Capacity => _buffer.Length;
+
+    /// <summary>
+    /// The amount of samples that can be read. This may be outdated by the time it's used if the producer is active.
+    /// </summary>
+    internal int Count => Volatile.Read(ref _writePosition) - Volatile.Read(ref _readPosition);
+
+    /// <summary>
+    /// The amount of samples that can be written. This may be outdated by the time it's used if the consumer is
+    /// active.
+    /// </summary>
+    internal int FreeCount => Capacity - Count;
+
+    /// <summary>
+    /// Writes as many samples as possible to the buffer. This must only be called from the producer's side.
+    /// </summary>
+    /// <param name="samples">The samples to write.</param>
+    /// <returns>The amount of samples written which is lower than the amount given if the buffer became full.</returns>
+    internal int Write(ReadOnlySpan<float> samples)
+    {
+        int writePosition = _writePosition;
+        int freeCount = Capacity - (writePosition - Volatile.Read(ref _readPosition));
+        int countToWrite = Math.Min(samples.Length, freeCount);
+
+        int index = writePosition & _mask;
+        int countBeforeWrapping = Math.Min(countToWrite, Capacity - index);
+        samples[..countBeforeWrapping].CopyTo(_buffer.AsSpan(index));
+        samples.Slice(countBeforeWrapping, countToWrite - countBeforeWrapping).CopyTo(_buffer);
+
+        // The samples must be fully written before the consumer can see them
+        Volatile.Write(ref _writePosition, writePosition + countToWrite);
+        return countToWrite;
+    }
+
+    /// <summary>
+    /// Reads as many samples as possible from the buffer. This must only be called from the consumer's side.
+    /// </summary>
+    /// <param name="destination">The span to copy the samples into.</param>
+    /// <returns>The amount of samples read which is lower than the length of <paramref name="destination"/> if the
+    /// buffer became empty.</returns>
+    internal int Read(Span<float> destination)
+    {
+        int readPosition = _readPosition;
+        int count = Volatile.Read(ref _writePosition) - readPosition;
+        int countToRead = Math.Min(destination.Length, count);
+
+        int index = readPosition & _mask;
+        int countBeforeWrapping = Math.Min(countToRead, Capacity - index);
+        _buffer.AsSpan(index, countBeforeWrapping).CopyTo(destination);
+        _buffer.AsSpan(0, countToRead - countBeforeWrapping).CopyTo(destination[countBeforeWrapping..]);
+
+        // The samples must be fully copied before the producer can overwrite them
+        Volatile.Write(ref _readPosition, readPosition + countToRead);
+        return countToRead;
+    }
+
+    /// <summary>
+    /// Discards every buffered samples. This must only be called when the other side isn't using the buffer.
+    /// </summary>
+    internal void Clear()
+    {
+        Volatile.Write(ref _readPosition, 0);
+        Volatile.Write(ref _writePosition, 0);
+    }
+}
\ No newline at end of file
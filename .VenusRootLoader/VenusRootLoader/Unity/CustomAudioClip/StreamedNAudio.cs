@@ -1,18 +1,137 @@
+using Microsoft.Extensions.Logging;
 using NAudio.Wave;
 
 namespace VenusRootLoader.Unity.CustomAudioClip;
 
+/// <summary>
+/// Streams the samples of a <see cref="WaveStream"/> to a streamed <see cref="UnityEngine.AudioClip"/>. The decoding is
+/// done ahead of time by an <see cref="AudioDecodingWorkerPool"/> into a <see cref="SampleRingBuffer"/> so the
+/// callbacks Unity calls from its audio thread only copy samples. Unity never calls <see cref="OnRead"/> and
+/// <see cref="OnSeek"/> at the same time.
+/// </summary>
 internal sealed class StreamedNAudio
 {
+    // This is about 1.4 seconds of stereo audio at 48 kHz
+    internal const int DefaultBufferCapacity = 1 << 17;
+
+    private const int DecodeChunkLength = 4096;
+
+    private readonly ILogger<StreamedNAudio> _logger;
     private readonly ISampleProvider _sampleProvider;
     private readonly WaveStream _waveStream;
+    private readonly AudioDecodingWorkerPool _workerPool;
+    private readonly SampleRingBuffer _ringBuffer;
+    private readonly float[] _decodeChunk;
+    private readonly Action _decodeAheadAction;
+
+    private int _isDecodeAheadScheduled;
+    private int _requestedSeekFramePosition;
+    private int _requestedSeekGeneration;
+    private int _appliedSeekGeneration;
+
+    // This is only accessed by the decoding side
+    private bool _isEndOfStream;
 
-    internal StreamedNAudio(ISampleProvider sampleProvider, WaveStream waveStream)
+    internal StreamedNAudio(
+        ILogger<StreamedNAudio> logger,
+        ISampleProvider sampleProvider,
+        WaveStream waveStream,
+        AudioDecodingWorkerPool workerPool,
+        int bufferCapacity = DefaultBufferCapacity)
     {
+        _logger = logger;
         _sampleProvider = sampleProvider;
         _waveStream = waveStream;
+        _workerPool = workerPool;
+        _ringBuffer = new(bufferCapacity);
+        _decodeChunk = new float[Math.Min(DecodeChunkLength, bufferCapacity)];
+        _decodeAheadAction = DecodeAhead;
+    }
+
+    /// <summary>
+    /// The amount of decoded samples waiting to be read.
+    /// </summary>
+    internal int BufferedSamplesCount => _ringBuffer.Count;
+
+    internal void OnRead(float[] data)
+    {
+        // Until the decoding side applies the latest seek, the buffer contains samples from before it which must be
+        // skipped so silence is played instead
+        int read = 0;
+        if (Volatile.Read(ref _appliedSeekGeneration) == _requestedSeekGeneration)
+            read = _ringBuffer.Read(data);
+
+        if (read < data.Length)
+            Array.Clear(data, read, data.Length - read);
+
+        ScheduleDecodeAhead();
+    }
+
+    internal void OnSeek(int position)
+    {
+        Volatile.Write(ref _requestedSeekFramePosition, position);
+        Interlocked.Increment(ref _requestedSeekGeneration);
+        ScheduleDecodeAhead();
     }
 
-    internal void OnRead(float[] data) => _sampleProvider.Read(data, 0, data.Length);
-    internal void OnSeek(int position) => _waveStream.Position = position;
+    /// <summary>
+    /// Decodes samples until the buffer is full or the end of the stream is reached while applying any pending seek.
+    /// This is normally ran by the <see cref="AudioDecodingWorkerPool"/>, but it can be called directly to fill the
+    /// buffer before the stream starts to be read as long as it isn't scheduled at the same time.
+    /// </summary>
+    internal void DecodeAhead()
+    {
+        try
+        {
+            DecodeUntilBufferIsFull();
+        }
+        catch (Exception e)
+        {
+            // A stream that failed to decode is treated as ended so it plays silence instead of retrying forever
+            _logger.LogError(e, "Decoding a streamed audio clip failed, the rest of the clip will be silent");
+            _isEndOfStream = true;
+        }
+
+        Volatile.Write(ref _isDecodeAheadScheduled, 0);
+
+        // A read or a seek could have happened after the last check, but before the flag was cleared
+        bool hasPendingSeek = Volatile.Read(ref _requestedSeekGeneration) != _appliedSeekGeneration;
+        if (hasPendingSeek || (!_isEndOfStream && _ringBuffer.FreeCount >= _decodeChunk.Length))
+            ScheduleDecodeAhead();
+    }
+
+    private void DecodeUntilBufferIsFull()
+    {
+        while (true)
+        {
+            int requestedSeekGeneration = Volatile.Read(ref _requestedSeekGeneration);
+            if (requestedSeekGeneration != _appliedSeekGeneration)
+            {
+                // The reading side doesn't touch the buffer while a seek is pending so it's safe to clear it here
+                _waveStream.Position = (long)Volatile.Read(ref _requestedSeekFramePosition) * _waveStream.BlockAlign;
+                _ringBuffer.Clear();
+                _isEndOfStream = false;
+                Volatile.Write(ref _appliedSeekGeneration, requestedSeekGeneration);
+            }
+
+            int freeCount = _ringBuffer.FreeCount;
+            if (_isEndOfStream || freeCount == 0)
+                return;
+
+            int read = _sampleProvider.Read(_decodeChunk, 0, Math.Min(freeCount, _decodeChunk.Length));
+            if (read == 0)
+            {
+                _isEndOfStream = true;
+                return;
+            }
+
+            _ringBuffer.Write(_decodeChunk.AsSpan(0, read));
+        }
+    }
+
+    private void ScheduleDecodeAhead()
+    {
+        if (Interlocked.CompareExchange(ref _isDecodeAheadScheduled, 1, 0) == 0)
+            _workerPool.Schedule(_decodeAheadAction);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+using CommunityToolkit.Diagnostics;
+using System.Globalization;
+
+namespace VenusRootLoader.Utility;
+
+/// <summary>
+/// Parses primitive values out of spans with the same rules as their culture invariant string parsing counterparts.
+/// The framework doesn't offer span overloads of these methods on the runtime the game uses, so this avoids
+/// allocating a string for every value parsed.
+/// </summary>
+internal static class InvariantSpanParser
+{
+    // The whitespaces allowed by NumberStyles.AllowLeadingWhite and NumberStyles.AllowTrailingWhite
+    private const string NumberWhitespaces = "\t\n\v\f\r ";
+
+    /// <summary>
+    /// Parses an integer like <see cref="int.Parse(string, IFormatProvider)"/> with
+    /// <see cref="CultureInfo.InvariantCulture"/>
+    /// </summary>
+    /// <param name="value">The value to parse</param>
+    /// <returns>The parsed integer</returns>
+    /// <exception cref="FormatException">Thrown if the value isn't an integer</exception>
+    /// <exception cref="OverflowException">Thrown if the value doesn't fit in an integer</exception>
+    internal static int ParseInt32(ReadOnlySpan<char> value)
+    {
+        ReadOnlySpan<char> trimmedValue = value.Trim(NumberWhitespaces.AsSpan());
+        bool isNegative = false;
+        if (!trimmedValue.IsEmpty && (trimmedValue[0] == '-' || trimmedValue[0] == '+'))
+        {
+            isNegative = trimmedValue[0] == '-';
+            trimmedValue = trimmedValue.Slice(1);
+        }
+
+        if (trimmedValue.IsEmpty)
+            ThrowHelper.ThrowFormatException("The input string was not in a correct format.");
+
+        ulong maxMagnitude = isNegative ? (ulong)int.MaxValue + 1 : int.MaxValue;
+        ulong magnitude = 0;
+        foreach (char c in trimmedValue)
+        {
+            uint digit = (uint)(c - '0');
+            if (digit > 9)
+                ThrowHelper.ThrowFormatException("The input string was not in a correct format.");
+
+            magnitude = magnitude * 10 + digit;
+            if (magnitude > maxMagnitude)
+                ThrowHelper.ThrowOverflowException("Value was either too large or too small for an Int32.");
+        }
+
+        return isNegative ? (int)(0 - (long)magnitude) : (int)magnitude;
+    }
+
+    /// <summary>
+    /// Tries to parse an integer like <see cref="int.TryParse(string, NumberStyles, IFormatProvider, out int)"/> with
+    /// <see cref="NumberStyles.None"/> and <see cref="CultureInfo.InvariantCulture"/> which only allows digits
+    /// </summary>
+    /// <param name="value">The value to parse</param>
+    /// <param name="result">The parsed integer if it succeeded or 0 otherwise</param>
+    /// <returns>Whether the value was successfully parsed</returns>
+    internal static bool TryParseDigits(ReadOnlySpan<char> value, out int result)
+    {
+        result = 0;
+        if (value.IsEmpty)
+            return false;
+
+        ulong magnitude = 0;
+        foreach (char c in value)
+        {
+            uint digit = (uint)(c - '0');
+            if (digit > 9)
+                return false;
+
+            magnitude = magnitude * 10 + digit;
+            if (magnitude > int.MaxValue)
+                return false;
+        }
+
+        result = (int)magnitude;
+        return true;
+    }
+
+    /// <summary>
+    /// Parses a boolean like <see cref="bool.Parse(string)"/>
+    /// </summary>
+    /// <param name="value">The value to parse</param>
+    /// <returns>The parsed boolean</returns>
+    /// <exception cref="FormatException">Thrown if the value isn't a boolean</exception>
+    internal static bool ParseBoolean(ReadOnlySpan<char> value)
+    {
+        ReadOnlySpan<char> trimmedValue = value.Trim().TrimEnd('\0');
+        if (trimmedValue.Equals(bool.TrueString.AsSpan(), StringComparison.OrdinalIgnoreCase))
+            return true;
+        if (trimmedValue.Equals(bool.FalseString.AsSpan(), StringComparison.OrdinalIgnoreCase))
+            return false;
+
+        return ThrowHelper.ThrowFormatException<bool>("String was not recognized as a valid Boolean.");
+    }
+
+    /// <summary>
+    /// Parses a float like <see cref="float.Parse(string, IFormatProvider)"/> with
+    /// <see cref="CultureInfo.InvariantCulture"/>. Unlike the other methods, this allocates a string since implementing
+    /// floating point parsing isn't worth it for the few floats being parsed
+    /// </summary>
+    /// <param name="value">The value to parse</param>
+    /// <returns>The parsed float</returns>
+    internal static float ParseSingle(ReadOnlySpan<char> value) =>
+        float.Parse(value.ToString(), CultureInfo.InvariantCulture);
+}
\ No newline at end of file
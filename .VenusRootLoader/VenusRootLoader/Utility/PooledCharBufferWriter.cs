@@ -0,0 +1,76 @@
+using CommunityToolkit.Diagnostics;
+using System.Buffers;
+
+namespace VenusRootLoader.Utility;
+
+/// <summary>
+/// An <see cref="IBufferWriter{T}"/> of chars whose buffer is rented from <see cref="ArrayPool{T}.Shared"/> and grows
+/// by renting a bigger one. Once disposed, the buffer is returned to the pool so it must not be used afterward.
+/// </summary>
+internal sealed class PooledCharBufferWriter : IBufferWriter<char>, IDisposable
+{
+    private char[] _buffer;
+    private int _writtenCount;
+
+    internal PooledCharBufferWriter(int initialCapacity)
+    {
+        _buffer = ArrayPool<char>.Shared.Rent(initialCapacity);
+    }
+
+    internal int WrittenCount => _writtenCount;
+
+    internal ReadOnlySpan<char> WrittenSpan => _buffer.AsSpan(0, _writtenCount);
+
+    public void Advance(int count)
+    {
+        if (count < 0 || _writtenCount + count > _buffer.Length)
+            ThrowHelper.ThrowArgumentOutOfRangeException(nameof(count));
+
+        _writtenCount += count;
+    }
+
+    public Memory<char> GetMemory(int sizeHint = 0)
+    {
+        EnsureCapacity(sizeHint);
+        return _buffer.AsMemory(_writtenCount);
+    }
+
+    public Span<char> GetSpan(int sizeHint = 0)
+    {
+        EnsureCapacity(sizeHint);
+        return _buffer.AsSpan(_writtenCount);
+    }
+
+    /// <summary>
+    /// Discards everything written so far while keeping the buffer for the next writes
+    /// </summary>
+    internal void Clear() => _writtenCount = 0;
+
+    public override string ToString() => new(_buffer, 0, _writtenCount);
+
+    public void Dispose()
+    {
+        char[] buffer = _buffer;
+        if (buffer.Length == 0)
+            return;
+
+        _buffer = [];
+        _writtenCount = 0;
+        ArrayPool<char>.Shared.Return(buffer);
+    }
+
+    private void EnsureCapacity(int sizeHint)
+    {
+        if (sizeHint < 1)
+            sizeHint = 1;
+
+        if (_buffer.Length - _writtenCount >= sizeHint)
+            return;
+
+        char[] newBuffer = ArrayPool<char>.Shared.Rent(Math.Max(_buffer.Length * 2, _writtenCount + sizeHint));
+        _buffer.AsSpan(0, _writtenCount).CopyTo(newBuffer);
+        if (_buffer.Length > 0)
+            ArrayPool<char>.Shared.Return(_buffer);
+        _buffer = newBuffer;
+    }
+}
\ No newline at end of file
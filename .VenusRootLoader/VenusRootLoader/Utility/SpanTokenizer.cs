@@ -0,0 +1,103 @@
+using CommunityToolkit.Diagnostics;
+
+namespace VenusRootLoader.Utility;
+
+/// <summary>
+/// Enumerates the tokens of a span delimited by a separator the same way
+/// <see cref="string.Split(string[], StringSplitOptions)"/> would, but without allocating an array or any of the
+/// tokens. This is meant to replace splits on hot paths where the tokens are immediately parsed or looked up.
+/// </summary>
+internal ref struct SpanTokenizer
+{
+    private readonly ReadOnlySpan<char> _separator;
+    private readonly char _separatorChar;
+    private readonly bool _removeEmptyEntries;
+    private ReadOnlySpan<char> _remaining;
+    private bool _isFinished;
+
+    internal SpanTokenizer(ReadOnlySpan<char> source, char separator, bool removeEmptyEntries)
+    {
+        _remaining = source;
+        _separator = default;
+        _separatorChar = separator;
+        _removeEmptyEntries = removeEmptyEntries;
+        _isFinished = false;
+    }
+
+    internal SpanTokenizer(ReadOnlySpan<char> source, string separator, bool removeEmptyEntries)
+    {
+        _remaining = source;
+        _separator = separator.AsSpan();
+        _separatorChar = default;
+        _removeEmptyEntries = removeEmptyEntries;
+        _isFinished = false;
+    }
+
+    internal bool TryReadNext(out ReadOnlySpan<char> token)
+    {
+        while (!_isFinished)
+        {
+            int separatorIndex = _separator.IsEmpty
+                ? _remaining.IndexOf(_separatorChar)
+                : _remaining.IndexOf(_separator);
+            int separatorLength = _separator.IsEmpty ? 1 : _separator.Length;
+            if (separatorIndex < 0)
+            {
+                token = _remaining;
+                _remaining = default;
+                _isFinished = true;
+            }
+            else
+            {
+                token = _remaining.Slice(0, separatorIndex);
+                _remaining = _remaining.Slice(separatorIndex + separatorLength);
+            }
+
+            if (!_removeEmptyEntries || !token.IsEmpty)
+                return true;
+        }
+
+        token = default;
+        return false;
+    }
+
+    /// <summary>
+    /// Reads the next token
+    /// </summary>
+    /// <returns>The next token</returns>
+    /// <exception cref="InvalidDataException">Thrown if there are no more tokens</exception>
+    internal ReadOnlySpan<char> ReadNext()
+    {
+        if (!TryReadNext(out ReadOnlySpan<char> token))
+            ThrowHelper.ThrowInvalidDataException("There are less tokens than expected in the data");
+
+        return token;
+    }
+
+    /// <summary>
+    /// Skips the given amount of tokens
+    /// </summary>
+    /// <param name="count">The amount of tokens to skip</param>
+    /// <exception cref="InvalidDataException">
+    /// Thrown if there are less tokens remaining than the amount to skip
+    /// </exception>
+    internal void Skip(int count)
+    {
+        for (int i = 0; i < count; i++)
+            ReadNext();
+    }
+
+    /// <summary>
+    /// Counts the tokens remaining without consuming them
+    /// </summary>
+    /// <returns>The amount of tokens remaining</returns>
+    internal readonly int CountRemaining()
+    {
+        SpanTokenizer tokenizer = this;
+        int count = 0;
+        while (tokenizer.TryReadNext(out _))
+            count++;
+
+        return count;
+    }
+}
\ No newline at end of file